@@ -8,7 +8,9 @@
 //------------------------------------------------------------------------------
 
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
+using UnityEngine.Experimental.Rendering;
 using UnityEngine.Rendering;
 
 namespace UnityEngine.Rendering.Universal
@@ -39,7 +41,8 @@ namespace UnityEngine.Rendering.Universal
         NVSDK_NGX_Result_FAIL_UnableToWriteToAppDataPath = unchecked((int)0xBAD0000F),
         NVSDK_NGX_Result_FAIL_UnsupportedParameter = unchecked((int)0xBAD00010),
         NVSDK_NGX_Result_FAIL_Denied = unchecked((int)0xBAD00011),
-        NVSDK_NGX_Result_FAIL_NotImplemented = unchecked((int)0xBAD00012)
+        NVSDK_NGX_Result_FAIL_NotImplemented = unchecked((int)0xBAD00012),
+        DLSS_Result_FAIL_NotReady = unchecked((int)0xBAD0FF01)     // Plugin: DLSS_InitAsync is still running
     }
 
     /// <summary>
@@ -63,6 +66,38 @@ namespace UnityEngine.Rendering.Universal
         NVSDK_NGX_LOGGING_LEVEL_VERBOSE = 2
     }
 
+    /// <summary>
+    /// Native init state matching DLSSInitState.
+    /// </summary>
+    public enum DLSSInitState : int
+    {
+        NotInitialized = 0,
+        Initializing = 1,
+        Ready = 2,
+        Failed = 3
+    }
+
+    /// <summary>
+    /// Graphics API the native plugin drives NGX through, matching DLSSGraphicsApi.
+    /// </summary>
+    public enum DLSSGraphicsApi : int
+    {
+        None = 0,       // No device yet, or Unity's API is not supported
+        D3D12 = 1,
+        Vulkan = 2,
+        D3D11 = 3
+    }
+
+    /// <summary>
+    /// Evaluate health of a feature handle, matching DLSSFeatureHealthState.
+    /// </summary>
+    public enum DLSSFeatureHealthState : int
+    {
+        Healthy = 0,    // Evaluates run normally
+        Bypassed = 1,   // Tripped after repeated failures: evaluates skip NGX
+        Probing = 2     // The next evaluate retries NGX
+    }
+
     /// <summary>
     /// NGX Feature types.
     /// </summary>
@@ -143,8 +178,17 @@ namespace UnityEngine.Rendering.Universal
         private const int EVENT_ID_CREATE_FEATURE = 0;
         private const int EVENT_ID_EVALUATE_FEATURE = 1;
         private const int EVENT_ID_DESTROY_FEATURE = 2;
+        private const int EVENT_ID_END_FRAME = 3;
+        private const int EVENT_ID_EVALUATE_FEATURE_JITTERED = 4;
+        private const int EVENT_ID_EVALUATE_FEATURE_BOUND = 5;
 
         // Ring buffer size
+        // Default calibration candidates: SR presets J-M, RR presets D-E, every quality mode
+        public const uint DLSS_CALIBRATION_SR_PRESETS_DEFAULT = (1u << 10) | (1u << 11) | (1u << 12) | (1u << 13);
+        public const uint DLSS_CALIBRATION_RR_PRESETS_DEFAULT = (1u << 4) | (1u << 5);
+        public const uint DLSS_CALIBRATION_QUALITIES_DEFAULT = (1u << 6) - 1;
+        public const int DLSS_MAX_CALIBRATION_FRAMES = 256;
+
         private const int ALLOCATOR_SIZE = 2 * 1024 * 1024; // 2MB
 
         #endregion
@@ -262,18 +306,349 @@ namespace UnityEngine.Rendering.Universal
             public IntPtr parameters;
         }
 
+        [StructLayout(LayoutKind.Sequential)]
+        private struct DLSSEvaluateJitteredParams
+        {
+            public int handle;
+            public IntPtr parameters;
+            public ulong jitterFrameIndex;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct DLSSEvaluateBoundParams
+        {
+            public int handle;
+            public int bindingSet;
+            public IntPtr parameters;
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct DLSSBindingDesc
+        {
+            [MarshalAs(UnmanagedType.LPStr)]
+            public string name;
+            public int textureId;
+            public uint width;
+            public uint height;
+            public uint channels;
+            public uint flags;
+        }
+
+        private const uint DLSS_BINDING_RANDOM_WRITE = 1 << 0;
+        private const uint DLSS_BINDING_DEPTH_FORMAT = 1 << 1;
+
         [StructLayout(LayoutKind.Sequential)]
         private struct DLSSDestroyFeatureParams
         {
             public int handle;
         }
 
+        [StructLayout(LayoutKind.Sequential)]
+        private struct DLSSEndFrameParams
+        {
+            public ulong ringBufferBytesUsed;
+        }
+
+        /// <summary>
+        /// Aggregated failure count for one (handle, NGX result) pair.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSErrorCounter
+        {
+            public int handle;
+            public NVSDK_NGX_Result result;
+            public ulong count;
+            public ulong reportedCount;
+        }
+
+        /// <summary>
+        /// Instrumented native entry points (matches DLSSTelemetryPoint).
+        /// </summary>
+        public enum DLSSTelemetryPoint
+        {
+            Init = 0,
+            Shutdown,
+            AllocateParameters,
+            GetCapabilityParameters,
+            DestroyParameters,
+            Parameter_SetULL,
+            Parameter_SetF,
+            Parameter_SetD,
+            Parameter_SetUI,
+            Parameter_SetI,
+            Parameter_SetD3d12Resource,
+            Parameter_SetVoidPointer,
+            Parameter_GetULL,
+            Parameter_GetF,
+            Parameter_GetD,
+            Parameter_GetUI,
+            Parameter_GetI,
+            Parameter_GetD3d12Resource,
+            Parameter_GetVoidPointer,
+            AllocateFeatureHandle,
+            FreeFeatureHandle,
+            GetErrorCounters,
+            GetGpuTimings,
+            DumpFlightRecorder,
+            CopyFlightRecorder,
+            RenderCreateFeature,
+            RenderEvaluateFeature,
+            RenderDestroyFeature,
+            RenderEndFrame,
+            Parameter_SetTexture,
+            Parameter_SetTextureId,
+            RegisterTexture,
+            CreateBindingSet,
+            UpdateBindingSet,
+            BeginTrace,
+            EndTrace,
+            BeginCapture,
+            EndCapture,
+            DrsConfigure,
+            DrsUpdate,
+            SetOptimalSettingsResolutions,
+            GetOptimalSettingsTable,
+            LookupOptimalSettings,
+            QueryCapabilities,
+            InitAsync,
+            GetInitState,
+            GetJitterOffset,
+            GetJitterSequence,
+            RunCalibration,
+            GetCalibrationTable,
+            SetCircuitBreakerSettings,
+            GetFeatureHealth,
+            ResetFeatureHealth,
+            UnregisterTexture,
+            DestroyBindingSet
+        }
+
+        /// <summary>
+        /// CPU latency distribution of one native entry point.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSLatencyStats
+        {
+            public DLSSTelemetryPoint point;
+            public int reserved;
+            public ulong count;
+            public float meanUs;
+            public float p50Us;
+            public float p90Us;
+            public float p99Us;
+            public float p999Us;
+            public float maxUs;
+        }
+
+        /// <summary>
+        /// Rolling GPU time of EvaluateFeature for one feature handle.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSGpuTiming
+        {
+            public int handle;
+            public NVSDK_NGX_Feature feature;
+            public uint sampleCount;
+            public float minMs;
+            public float avgMs;
+            public float p95Ms;
+            public float maxMs;
+        }
+
+        /// <summary>
+        /// Dynamic resolution controller settings. Zero selects the default for every field except targetFrameMs.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSDrsSettings
+        {
+            public float targetFrameMs;
+            public float kp;
+            public float ki;
+            public float maxStep;
+            public float deadband;
+            public int latencyFrames;
+        }
+
+        /// <summary>
+        /// Render size chosen by the dynamic resolution controller for the next frame.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSDrsResult
+        {
+            public uint renderWidth;
+            public uint renderHeight;
+            public float scale;
+            public float dlssMs;
+            public float errorMs;
+        }
+
+        /// <summary>
+        /// NGX capability report of one feature.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSFeatureCapability
+        {
+            public int available;
+            public int needsUpdatedDriver;
+            public uint minDriverVersionMajor;
+            public uint minDriverVersionMinor;
+            public NVSDK_NGX_Result featureInitResult;
+        }
+
+        /// <summary>
+        /// Capability snapshot taken by the native plugin at init.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSCapabilityInfo
+        {
+            public NVSDK_NGX_Result initResult;
+            public NVSDK_NGX_Result capabilityResult;
+            public ulong ngxVramBytes;
+            public ulong ngxVramPeakBytes;
+            public DLSSFeatureCapability superResolution;
+            public DLSSFeatureCapability rayReconstruction;
+            public DLSSFeatureCapability frameGeneration;
+            public int reserved;
+        }
+
+        /// <summary>
+        /// Output resolution covered by the optimal settings table.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSResolution
+        {
+            public uint width;
+            public uint height;
+        }
+
+        /// <summary>
+        /// Precomputed DLSS-SR optimal settings for one output resolution and quality mode.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSOptimalSettings
+        {
+            public uint outputWidth;
+            public uint outputHeight;
+            public NVSDK_NGX_PerfQuality_Value perfQuality;
+            public NVSDK_NGX_Result result;
+            public uint renderWidth;
+            public uint renderHeight;
+            public uint minRenderWidth;
+            public uint minRenderHeight;
+            public uint maxRenderWidth;
+            public uint maxRenderHeight;
+            public float sharpness;
+        }
+
+        /// <summary>
+        /// Sub-pixel jitter of one frame, in render pixels within [-0.5, 0.5).
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSJitterOffset
+        {
+            public float x;
+            public float y;
+        }
+
+        /// <summary>
+        /// The feature a binding set is validated against: the values it was created with.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSBindingSetInfo
+        {
+            public NVSDK_NGX_Feature feature;
+            public NVSDK_NGX_DLSS_Feature_Flags createFlags;
+            public uint renderWidth;
+            public uint renderHeight;
+            public uint outputWidth;
+            public uint outputHeight;
+        }
+
+        /// <summary>
+        /// Candidates and sample counts for RunCalibration. Mask bit n selects render preset n
+        /// (srPresetMask / rrPresetMask) or NVSDK_NGX_PerfQuality_Value n (perfQualityMask).
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSCalibrationParams
+        {
+            public uint outputWidth;
+            public uint outputHeight;
+            public uint srPresetMask;
+            public uint rrPresetMask;
+            public uint perfQualityMask;
+            public NVSDK_NGX_DLSS_Feature_Flags featureFlags;
+            public uint warmupFrames;
+            public uint frameCount;
+        }
+
+        /// <summary>
+        /// Measured GPU cost of one (feature, preset, quality) candidate at one output size.
+        /// The timings are zero when result is not a success.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSCalibrationResult
+        {
+            public uint outputWidth;
+            public uint outputHeight;
+            public NVSDK_NGX_Feature feature;
+            public uint preset;
+            public NVSDK_NGX_PerfQuality_Value perfQuality;
+            public NVSDK_NGX_Result result;
+            public uint renderWidth;
+            public uint renderHeight;
+            public uint sampleCount;
+            public float minMs;
+            public float medianMs;
+            public float avgMs;
+            public float p95Ms;
+            public float maxMs;
+        }
+
+        /// <summary>
+        /// Circuit breaker settings. Zero selects the default for every field.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSCircuitBreakerSettings
+        {
+            public uint failureThreshold;   // Consecutive failed evaluates that trip a feature (default 3)
+            public uint initialBackoff;     // Evaluates bypassed before the first retry (default 8)
+            public uint maxBackoff;         // Cap of the doubling back-off (default 512)
+        }
+
+        /// <summary>
+        /// Circuit breaker state of one feature handle since its creation.
+        /// </summary>
+        [StructLayout(LayoutKind.Sequential)]
+        public struct DLSSFeatureHealth
+        {
+            public DLSSFeatureHealthState state;
+            public NVSDK_NGX_Result lastResult;
+            public uint consecutiveFailures;
+            public uint trips;
+            public uint backoff;
+            public uint evaluatesUntilRetry;
+            public ulong bypassedEvaluates;
+            public ulong fallbackCopies;
+        }
+
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
         private static extern int DLSS_Init_with_ProjectID_D3D12(ref DLSSInitParams initParams);
 
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_InitAsync(ref DLSSInitParams initParams);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern DLSSInitState DLSS_GetInitState(out int outResult);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern DLSSGraphicsApi DLSS_GetGraphicsApi();
+
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
         private static extern int DLSS_Shutdown_D3D12();
 
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_QueryCapabilities(out DLSSCapabilityInfo outInfo);
+
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
         private static extern int DLSS_AllocateParameters_D3D12(out IntPtr ppOutParameters);
 
@@ -292,6 +667,73 @@ namespace UnityEngine.Rendering.Universal
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
         private static extern IntPtr DLSS_UnityRenderEventFunc();
 
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetErrorCounters([Out] DLSSErrorCounter[] outCounters, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetGpuTimings([Out] DLSSGpuTiming[] outTimings, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_DrsConfigure(int handle, ref DLSSDrsSettings settings);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_DrsUpdate(int handle, float frameMs, out DLSSDrsResult outResult);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_SetOptimalSettingsResolutions([In] DLSSResolution[] resolutions, int count);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetOptimalSettingsTable([Out] DLSSOptimalSettings[] outSettings, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_LookupOptimalSettings(uint outputWidth, uint outputHeight, int perfQuality,
+            out DLSSOptimalSettings outSettings);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetJitterOffset(uint renderWidth, uint renderHeight, uint outputWidth,
+            uint outputHeight, ulong frameIndex, out DLSSJitterOffset outOffset);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetJitterSequence(uint renderWidth, uint renderHeight, uint outputWidth,
+            uint outputHeight, [Out] DLSSJitterOffset[] outOffsets, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_RunCalibration(ref DLSSCalibrationParams calibrationParams,
+            [Out] DLSSCalibrationResult[] outResults, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetCalibrationTable([Out] DLSSCalibrationResult[] outResults, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_SetCircuitBreakerSettings(ref DLSSCircuitBreakerSettings settings);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetFeatureHealth(int handle, out DLSSFeatureHealth outHealth);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_ResetFeatureHealth(int handle);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_GetTelemetry([Out] DLSSLatencyStats[] outStats, int maxCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern void DLSS_ResetTelemetry();
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
+        private static extern int DLSS_BeginTrace(string path);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_EndTrace();
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
+        private static extern int DLSS_BeginCapture(string path);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_EndCapture();
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
+        private static extern int DLSS_DumpFlightRecorder(string path);
+
         // Parameter setters
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
         private static extern void DLSS_Parameter_SetULL(IntPtr pParameters, string paramName, ulong value);
@@ -314,6 +756,31 @@ namespace UnityEngine.Rendering.Universal
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
         private static extern void DLSS_Parameter_SetVoidPointer(IntPtr pParameters, string paramName, IntPtr value);
 
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
+        private static extern void DLSS_Parameter_SetTexture(IntPtr pParameters, string paramName, IntPtr nativeTexture);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
+        private static extern void DLSS_Parameter_SetTextureId(IntPtr pParameters, string paramName, int textureId);
+
+        // Texture registry
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_RegisterTexture(int textureId, IntPtr nativeTexture);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_UnregisterTexture(int textureId);
+
+        // Binding sets
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_CreateBindingSet(ref DLSSBindingSetInfo info,
+            [In] DLSSBindingDesc[] bindings, int bindingCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_UpdateBindingSet(int bindingSet, ref DLSSBindingSetInfo info,
+            [In] DLSSBindingDesc[] bindings, int bindingCount);
+
+        [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION)]
+        private static extern int DLSS_DestroyBindingSet(int bindingSet);
+
         // Parameter getters
         [DllImport(DLL_NAME, CallingConvention = CALLING_CONVENTION, CharSet = CharSet.Ansi)]
         private static extern int DLSS_Parameter_GetULL(IntPtr pParameters, string paramName, out ulong pValue);
@@ -338,9 +805,22 @@ namespace UnityEngine.Rendering.Universal
         #region Instance Fields
 
         private bool m_Initialized = false;
+        private bool m_InitPending = false;
         private bool m_SRSupported = false;
         private bool m_RRSupported = false;
         private RingBufferAllocator m_Allocator;
+        private long m_AllocatorBytesAtFrameStart;
+        private int m_HelperFrame = -1;         // Time.frameCount of the last frame a helper issued DLSS work in
+        private bool m_FrameEnded = true;       // EndFrame issued since the helpers' last DLSS work
+
+        // Size and format each registered texture had when registered, by instance ID
+        private struct RegisteredTexture
+        {
+            public int width;
+            public int height;
+            public GraphicsFormat format;
+        }
+        private readonly Dictionary<int, RegisteredTexture> m_RegisteredTextures = new Dictionary<int, RegisteredTexture>();
 
         #endregion
 
@@ -377,6 +857,11 @@ namespace UnityEngine.Rendering.Universal
         /// </summary>
         public bool IsInitialized => m_Initialized;
 
+        /// <summary>
+        /// True between InitAsync and the PollInit call that sees the native init finish.
+        /// </summary>
+        public bool IsInitPending => m_InitPending;
+
         /// <summary>
         /// Check if DLSS-SR (Super Resolution) is supported.
         /// </summary>
@@ -394,65 +879,21 @@ namespace UnityEngine.Rendering.Universal
         public void Init()
         {
 #if DLSS_PLUGIN_INTEGRATE
-            Debug.Log("[DLSSExtension] Initializing DLSS...");
-            Debug.Log($"[DLSSExtension] Graphics Device: {SystemInfo.graphicsDeviceName}");
-            Debug.Log($"[DLSSExtension] Graphics Vendor: {SystemInfo.graphicsDeviceVendor}");
-
-            // Check if NVIDIA GPU
-            if (!SystemInfo.graphicsDeviceVendor.ToLowerInvariant().Contains("nvidia"))
-            {
-                Debug.Log("[DLSSExtension] Non-NVIDIA GPU detected. DLSS is not available.");
-                m_Initialized = false;
-                return;
-            }
-
-            // Check if D3D12
-            if (SystemInfo.graphicsDeviceType != GraphicsDeviceType.Direct3D12)
+            // The native init rejects a second init until Shutdown
+            if (m_Initialized || m_InitPending || !CanInit())
             {
-                Debug.LogWarning("[DLSSExtension] DLSS requires Direct3D12. Current API: " + SystemInfo.graphicsDeviceType);
-                m_Initialized = false;
                 return;
             }
 
             try
             {
                 // Initialize DLSS native SDK
-                var initParams = new DLSSInitParams
-                {
-                    projectId = "",
-                    engineType = NVSDK_NGX_EngineType.NVSDK_NGX_ENGINE_TYPE_UNITY,
-                    engineVersion = Application.version,
-                    applicationDataPath = "",
-                    loggingLevel = NVSDK_NGX_Logging_Level.NVSDK_NGX_LOGGING_LEVEL_VERBOSE
-                };
-
-                var result = (NVSDK_NGX_Result)DLSS_Init_with_ProjectID_D3D12(ref initParams);
-                m_Initialized = NVSDK_NGX_SUCCEED(result);
-
-                if (!m_Initialized)
-                {
-                    Debug.LogWarning($"[DLSSExtension] DLSS initialization failed: {result}");
-                    return;
-                }
-
-                // Query capabilities
-                QueryFeatureAvailability();
-
-                // Initialize ring buffer allocator
-                m_Allocator = new RingBufferAllocator(ALLOCATOR_SIZE);
-
-                Debug.Log($"[DLSSExtension] DLSS-SR Available: {m_SRSupported}");
-                Debug.Log($"[DLSSExtension] DLSS-RR Available: {m_RRSupported}");
-                Debug.Log("[DLSSExtension] DLSS initialized successfully!");
-
-                // Cache instance
-                s_Instance = this;
+                var initParams = CreateInitParams();
+                CompleteInit((NVSDK_NGX_Result)DLSS_Init_with_ProjectID_D3D12(ref initParams));
             }
             catch (DllNotFoundException e)
             {
-                Debug.LogWarning($"[DLSSExtension] DLSS DLL not found: {e.Message}");
-                Debug.LogWarning("[DLSSExtension] Make sure UnityDLSS.dll and nvngx_*.dll are in Assets/Plugins/x86_64/");
-                m_Initialized = false;
+                OnDllNotFound(e);
             }
             catch (Exception e)
             {
@@ -464,26 +905,91 @@ namespace UnityEngine.Rendering.Universal
 #endif
         }
 
-        public bool Support()
+        /// <summary>
+        /// Start native initialization on a worker thread instead of blocking like Init.
+        /// Call PollInit (e.g. once per frame) until it returns true or IsInitPending is false;
+        /// QueryCapabilities and TryGetOptimalSettings already answer from the capability cache meanwhile.
+        /// </summary>
+        public bool InitAsync()
         {
 #if DLSS_PLUGIN_INTEGRATE
-            // Consider DLSS supported if either SR or RR is available
-            return m_Initialized && (m_SRSupported || m_RRSupported);
+            if (m_Initialized || m_InitPending || !CanInit())
+            {
+                return m_InitPending;
+            }
+
+            try
+            {
+                var initParams = CreateInitParams();
+                var result = (NVSDK_NGX_Result)DLSS_InitAsync(ref initParams);
+                m_InitPending = NVSDK_NGX_SUCCEED(result);
+                if (!m_InitPending)
+                {
+                    Debug.LogWarning($"[DLSSExtension] DLSS async initialization could not start: {result}");
+                }
+            }
+            catch (DllNotFoundException e)
+            {
+                OnDllNotFound(e);
+            }
+            return m_InitPending;
 #else
             return false;
 #endif
         }
 
-        public bool ShutDown()
+        /// <summary>
+        /// Finish an InitAsync once the native worker is done. Cheap; returns IsInitialized.
+        /// </summary>
+        public bool PollInit()
         {
 #if DLSS_PLUGIN_INTEGRATE
-            if (m_Initialized)
+            if (m_InitPending)
             {
-                m_Allocator?.Dispose();
-                m_Allocator = null;
-
-                DLSS_Shutdown_D3D12();
-
+                var state = DLSS_GetInitState(out int result);
+                if (state != DLSSInitState.Initializing)
+                {
+                    m_InitPending = false;
+                    CompleteInit((NVSDK_NGX_Result)result);
+                }
+            }
+#endif
+            return m_Initialized;
+        }
+
+        /// <summary>
+        /// Graphics API the native plugin uses; None until Unity's device exists or if it is unsupported.
+        /// </summary>
+        public DLSSGraphicsApi GetGraphicsApi()
+        {
+#if DLSS_PLUGIN_INTEGRATE
+            return DLSS_GetGraphicsApi();
+#else
+            return DLSSGraphicsApi.None;
+#endif
+        }
+
+        public bool Support()
+        {
+#if DLSS_PLUGIN_INTEGRATE
+            // Consider DLSS supported if either SR or RR is available
+            return m_Initialized && (m_SRSupported || m_RRSupported);
+#else
+            return false;
+#endif
+        }
+
+        public bool ShutDown()
+        {
+#if DLSS_PLUGIN_INTEGRATE
+            if (m_Initialized || m_InitPending)
+            {
+                m_InitPending = false;
+                m_Allocator?.Dispose();
+                m_Allocator = null;
+
+                DLSS_Shutdown_D3D12();
+
                 m_Initialized = false;
                 m_SRSupported = false;
                 m_RRSupported = false;
@@ -591,6 +1097,65 @@ namespace UnityEngine.Rendering.Universal
             cmd.IssuePluginEventAndData(DLSS_UnityRenderEventFunc(), EVENT_ID_EVALUATE_FEATURE, ptr);
         }
 
+        /// <summary>
+        /// Evaluate a DLSS feature with the plugin's Halton jitter for the given frame index.
+        /// The plugin writes Jitter.Offset.X/Y itself; use GetJitterOffset with the same
+        /// frame index for the projection matrix.
+        /// </summary>
+        public void EvaluateFeatureJittered(CommandBuffer cmd, int handle, IntPtr parameters, ulong jitterFrameIndex)
+        {
+            if (!m_Initialized)
+            {
+                Debug.LogError("[DLSSExtension] Cannot evaluate feature: not initialized");
+                return;
+            }
+
+            var evalParams = new DLSSEvaluateJitteredParams
+            {
+                handle = handle,
+                parameters = parameters,
+                jitterFrameIndex = jitterFrameIndex
+            };
+
+            IntPtr ptr = m_Allocator.Allocate(evalParams);
+            if (ptr == IntPtr.Zero)
+            {
+                Debug.LogError("[DLSSExtension] Failed to allocate space in ring buffer for EvaluateFeatureJittered");
+                return;
+            }
+
+            cmd.IssuePluginEventAndData(DLSS_UnityRenderEventFunc(), EVENT_ID_EVALUATE_FEATURE_JITTERED, ptr);
+        }
+
+        /// <summary>
+        /// Evaluate a DLSS feature with the resources of a binding set (CreateBindingSet).
+        /// Set the per-frame parameters (jitter, matrices, reset, ...) on the parameter block as usual.
+        /// </summary>
+        public void EvaluateFeatureBound(CommandBuffer cmd, int handle, int bindingSet, IntPtr parameters)
+        {
+            if (!m_Initialized)
+            {
+                Debug.LogError("[DLSSExtension] Cannot evaluate feature: not initialized");
+                return;
+            }
+
+            var evalParams = new DLSSEvaluateBoundParams
+            {
+                handle = handle,
+                bindingSet = bindingSet,
+                parameters = parameters
+            };
+
+            IntPtr ptr = m_Allocator.Allocate(evalParams);
+            if (ptr == IntPtr.Zero)
+            {
+                Debug.LogError("[DLSSExtension] Failed to allocate space in ring buffer for EvaluateFeatureBound");
+                return;
+            }
+
+            cmd.IssuePluginEventAndData(DLSS_UnityRenderEventFunc(), EVENT_ID_EVALUATE_FEATURE_BOUND, ptr);
+        }
+
         /// <summary>
         /// Destroy a DLSS feature via command buffer.
         /// </summary>
@@ -647,6 +1212,328 @@ namespace UnityEngine.Rendering.Universal
             return result;
         }
 
+        /// <summary>
+        /// Mark the end of a frame on the render thread. Call once per frame after all DLSS work.
+        /// Also flushes the native Unity Profiler counters (DLSS Live Features, Evaluates, ...).
+        /// </summary>
+        public void EndFrame(CommandBuffer cmd)
+        {
+            if (!m_Initialized)
+                return;
+
+            long totalBytes = m_Allocator.TotalBytesAllocated;
+            var endFrameParams = new DLSSEndFrameParams
+            {
+                ringBufferBytesUsed = (ulong)(totalBytes - m_AllocatorBytesAtFrameStart)
+            };
+            m_AllocatorBytesAtFrameStart = totalBytes;
+
+            IntPtr ptr = m_Allocator.Allocate(endFrameParams);
+            cmd.IssuePluginEventAndData(DLSS_UnityRenderEventFunc(), EVENT_ID_END_FRAME, ptr);
+            m_FrameEnded = true;
+        }
+
+        /// <summary>
+        /// Called by DLSSSuperResolution and DLSSRayReconstruction before their DLSS work.
+        /// On the first call of a frame, issues EndFrame for the previous frame unless the
+        /// application already did, so the helpers work without an explicit EndFrame.
+        /// </summary>
+        internal void OnHelperFrameWork(CommandBuffer cmd)
+        {
+            int frame = Time.frameCount;
+            if (frame == m_HelperFrame)
+                return;
+
+            // Closing the previous frame here, before this frame's first evaluate, keeps every
+            // camera's work in the frame it was rendered in
+            if (!m_FrameEnded)
+                EndFrame(cmd);
+            m_HelperFrame = frame;
+            m_FrameEnded = false;
+        }
+
+        /// <summary>
+        /// Write the native flight recorder (recent plugin events) to a file for post-mortem analysis.
+        /// </summary>
+        /// <returns>Number of records written, or -1 on failure</returns>
+        public int DumpFlightRecorder(string path)
+            => DLSS_DumpFlightRecorder(path);
+
+        /// <summary>
+        /// Get deduplicated NGX failure counters aggregated per (handle, result) pair.
+        /// </summary>
+        public DLSSErrorCounter[] GetErrorCounters()
+        {
+            int count = DLSS_GetErrorCounters(null, 0);
+            var counters = new DLSSErrorCounter[count];
+            if (count > 0)
+            {
+                DLSS_GetErrorCounters(counters, counters.Length);
+            }
+            return counters;
+        }
+
+        /// <summary>
+        /// Get rolling GPU timings (min/avg/p95/max) of EvaluateFeature per feature handle.
+        /// </summary>
+        public DLSSGpuTiming[] GetGpuTimings()
+        {
+            int count = DLSS_GetGpuTimings(null, 0);
+            var timings = new DLSSGpuTiming[count];
+            if (count > 0)
+            {
+                int written = DLSS_GetGpuTimings(timings, timings.Length);
+                if (written < count)
+                {
+                    Array.Resize(ref timings, written);
+                }
+            }
+            return timings;
+        }
+
+        /// <summary>
+        /// Set the dynamic resolution target and gains for a feature handle.
+        /// Call after issuing the create event; settings are dropped when the feature is destroyed.
+        /// </summary>
+        public bool DrsConfigure(int handle, DLSSDrsSettings settings)
+        {
+            return DLSS_DrsConfigure(handle, ref settings) == 0;
+        }
+
+        /// <summary>
+        /// Feed the measured GPU frame time (e.g. FrameTimingManager gpuFrameTime) and get the
+        /// render size for the next frame, to pass as the DLSS subrect dimensions.
+        /// </summary>
+        public bool DrsUpdate(int handle, float gpuFrameMs, out DLSSDrsResult result)
+        {
+            return DLSS_DrsUpdate(handle, gpuFrameMs, out result) == 0;
+        }
+
+        /// <summary>
+        /// Get the capability snapshot taken at init (SR/RR/FG availability, driver requirements,
+        /// NGX VRAM usage). Copies a cached struct, so it is cheap enough to poll from a settings menu.
+        /// </summary>
+        public bool QueryCapabilities(out DLSSCapabilityInfo info)
+        {
+            return DLSS_QueryCapabilities(out info) == 0;
+        }
+
+        /// <summary>
+        /// Set the output resolutions the native optimal settings table covers (null restores the defaults).
+        /// Applies immediately when DLSS is initialized, otherwise at the next init.
+        /// </summary>
+        public bool SetOptimalSettingsResolutions(DLSSResolution[] resolutions)
+        {
+            return DLSS_SetOptimalSettingsResolutions(resolutions, resolutions?.Length ?? 0) == 0;
+        }
+
+        /// <summary>
+        /// Get the optimal settings of every table resolution and quality mode, e.g. for a settings UI preview.
+        /// </summary>
+        public DLSSOptimalSettings[] GetOptimalSettingsTable()
+        {
+            int count = DLSS_GetOptimalSettingsTable(null, 0);
+            var rows = new DLSSOptimalSettings[count];
+            if (count > 0)
+            {
+                int written = DLSS_GetOptimalSettingsTable(rows, rows.Length);
+                if (written < count)
+                {
+                    Array.Resize(ref rows, written);
+                }
+            }
+            return rows;
+        }
+
+        /// <summary>
+        /// Look up the render size of a quality mode from the table computed at init, without NGX calls.
+        /// Returns false if the output resolution is not in the table or the mode is unsupported;
+        /// fall back to the NGX optimal settings query in that case.
+        /// </summary>
+        public bool TryGetOptimalSettings(uint outputWidth, uint outputHeight, NVSDK_NGX_PerfQuality_Value quality,
+            out DLSSOptimalSettings settings)
+        {
+            return DLSS_LookupOptimalSettings(outputWidth, outputHeight, (int)quality, out settings) == 0;
+        }
+
+        /// <summary>
+        /// Get the Halton(2,3) jitter of a frame for a render/output size pair. The sequence has
+        /// 8 x (output area / render area) phases and matches what EvaluateFeatureJittered applies.
+        /// </summary>
+        public bool GetJitterOffset(uint renderWidth, uint renderHeight, uint outputWidth, uint outputHeight,
+            ulong frameIndex, out DLSSJitterOffset offset)
+        {
+            return DLSS_GetJitterOffset(renderWidth, renderHeight, outputWidth, outputHeight, frameIndex, out offset) == 0;
+        }
+
+        /// <summary>
+        /// Get the whole jitter sequence of a render/output size pair, one entry per phase.
+        /// </summary>
+        public DLSSJitterOffset[] GetJitterSequence(uint renderWidth, uint renderHeight, uint outputWidth, uint outputHeight)
+        {
+            int count = DLSS_GetJitterSequence(renderWidth, renderHeight, outputWidth, outputHeight, null, 0);
+            var offsets = new DLSSJitterOffset[Math.Max(count, 0)];
+            if (count > 0)
+            {
+                DLSS_GetJitterSequence(renderWidth, renderHeight, outputWidth, outputHeight, offsets, offsets.Length);
+            }
+            return offsets;
+        }
+
+        /// <summary>
+        /// Measure the GPU cost of every requested preset and quality combination at one output size,
+        /// on synthetic inputs and a private queue. Blocks for the whole run (a few seconds with the
+        /// defaults), so call it from a loading screen or first-launch setup while no DLSS feature is
+        /// being evaluated. Results are persisted and come back through GetCalibrationTable on later launches.
+        /// </summary>
+        /// <returns>This run's candidates, cheapest first and failed ones last; null if the run could not start</returns>
+        public DLSSCalibrationResult[] RunCalibration(uint outputWidth, uint outputHeight,
+            uint srPresetMask = DLSS_CALIBRATION_SR_PRESETS_DEFAULT,
+            uint rrPresetMask = DLSS_CALIBRATION_RR_PRESETS_DEFAULT,
+            uint perfQualityMask = DLSS_CALIBRATION_QUALITIES_DEFAULT,
+            NVSDK_NGX_DLSS_Feature_Flags featureFlags = NVSDK_NGX_DLSS_Feature_Flags.IsHDR | NVSDK_NGX_DLSS_Feature_Flags.MVLowRes,
+            uint warmupFrames = 4, uint frameCount = 32)
+        {
+            var calibrationParams = new DLSSCalibrationParams
+            {
+                outputWidth = outputWidth,
+                outputHeight = outputHeight,
+                srPresetMask = srPresetMask,
+                rrPresetMask = rrPresetMask,
+                perfQualityMask = perfQualityMask,
+                featureFlags = featureFlags,
+                warmupFrames = warmupFrames,
+                frameCount = frameCount
+            };
+
+            // Every candidate fits: 32 presets x 6 modes per feature
+            var results = new DLSSCalibrationResult[2 * 32 * 6];
+            int count = DLSS_RunCalibration(ref calibrationParams, results, results.Length);
+            if (count < 0)
+            {
+                Debug.LogError($"[DLSSExtension] Calibration failed: {(NVSDK_NGX_Result)count}");
+                return null;
+            }
+
+            Array.Resize(ref results, Math.Min(count, results.Length));
+            return results;
+        }
+
+        /// <summary>
+        /// Get every calibration result measured on this machine, grouped by output size and ranked
+        /// cheapest first within each size. Empty until a calibration ran on this adapter and driver.
+        /// </summary>
+        public DLSSCalibrationResult[] GetCalibrationTable()
+        {
+            int count = DLSS_GetCalibrationTable(null, 0);
+            var rows = new DLSSCalibrationResult[count];
+            if (count > 0)
+            {
+                int written = DLSS_GetCalibrationTable(rows, rows.Length);
+                if (written < count)
+                {
+                    Array.Resize(ref rows, written);
+                }
+            }
+            return rows;
+        }
+
+        /// <summary>
+        /// Pick the cheapest calibrated preset of a feature and quality mode at an output size whose
+        /// median cost fits a GPU budget. Returns false if nothing was measured for it or nothing fits;
+        /// keep the default preset in that case.
+        /// </summary>
+        public bool TryPickCalibratedPreset(NVSDK_NGX_Feature feature, uint outputWidth, uint outputHeight,
+            NVSDK_NGX_PerfQuality_Value quality, float budgetMs, out DLSSCalibrationResult result)
+        {
+            // Rows are ranked within an output size, so the first match is the cheapest
+            foreach (var row in GetCalibrationTable())
+            {
+                if (row.feature == feature && row.outputWidth == outputWidth && row.outputHeight == outputHeight &&
+                    row.perfQuality == quality && row.sampleCount > 0 && row.medianMs <= budgetMs)
+                {
+                    result = row;
+                    return true;
+                }
+            }
+
+            result = default;
+            return false;
+        }
+
+        /// <summary>
+        /// Set how many consecutive failed evaluates trip a feature and how long it stays bypassed.
+        /// Applies to every feature handle.
+        /// </summary>
+        public void SetCircuitBreakerSettings(DLSSCircuitBreakerSettings settings)
+        {
+            DLSS_SetCircuitBreakerSettings(ref settings);
+        }
+
+        /// <summary>
+        /// Get the circuit breaker state of a feature handle. While it is not Healthy, evaluate
+        /// events skip NGX and the output only holds a copy of color at native resolution, so
+        /// the pipeline should switch to TAA until the handle reports Healthy again.
+        /// Returns false if the feature has not been created.
+        /// </summary>
+        public bool GetFeatureHealth(int handle, out DLSSFeatureHealth health)
+        {
+            return DLSS_GetFeatureHealth(handle, out health) == 0;
+        }
+
+        /// <summary>
+        /// Let the next evaluate of a tripped handle go to NGX again, e.g. after fixing its inputs.
+        /// </summary>
+        public bool ResetFeatureHealth(int handle)
+        {
+            return DLSS_ResetFeatureHealth(handle) == 0;
+        }
+
+        /// <summary>
+        /// Get CPU latency statistics (mean/p50/p90/p99/p99.9/max) of every instrumented native entry point,
+        /// indexed by DLSSTelemetryPoint.
+        /// </summary>
+        public DLSSLatencyStats[] GetTelemetry()
+        {
+            var stats = new DLSSLatencyStats[DLSS_GetTelemetry(null, 0)];
+            DLSS_GetTelemetry(stats, stats.Length);
+            return stats;
+        }
+
+        /// <summary>
+        /// Clear the native latency histograms.
+        /// </summary>
+        public void ResetTelemetry()
+            => DLSS_ResetTelemetry();
+
+        /// <summary>
+        /// Start recording a Chrome Trace Event JSON file of the native plugin timeline.
+        /// Open the result in chrome://tracing or ui.perfetto.dev.
+        /// </summary>
+        public bool BeginTrace(string path)
+            => DLSS_BeginTrace(path) == 0;
+
+        /// <summary>
+        /// Stop the running trace.
+        /// </summary>
+        /// <returns>Number of events written, or -1 if no trace was running</returns>
+        public int EndTrace()
+            => DLSS_EndTrace();
+
+        /// <summary>
+        /// Start recording render events and parameter writes to a binary capture file.
+        /// Replay it offline with the dlss_replay tool.
+        /// </summary>
+        public bool BeginCapture(string path)
+            => DLSS_BeginCapture(path) == 0;
+
+        /// <summary>
+        /// Stop the running capture.
+        /// </summary>
+        /// <returns>Number of records written, or -1 if no capture was running</returns>
+        public int EndCapture()
+            => DLSS_EndCapture();
+
         #region Parameter Setters
 
         public void SetParameterUI(IntPtr pParams, string name, uint value)
@@ -661,12 +1548,39 @@ namespace UnityEngine.Rendering.Universal
         public void SetParameterD3d12Resource(IntPtr pParams, string name, IntPtr resource)
             => DLSS_Parameter_SetD3d12Resource(pParams, name, resource);
 
+        /// <summary>
+        /// Bind a texture as a resource parameter on any supported graphics API.
+        /// Textures registered with RegisterRenderTexture are bound by instance ID and
+        /// resolved natively; others go through GetNativeTexturePtr on every call.
+        /// </summary>
         public void SetParameterRenderTexture(IntPtr pParams, string name, RenderTexture texture)
         {
+            if (texture != null && m_RegisteredTextures.Count > 0)
+            {
+                int id = texture.GetInstanceID();
+                if (m_RegisteredTextures.TryGetValue(id, out RegisteredTexture registered))
+                {
+                    // A resize or format change means Unity recreated the native texture
+                    if (registered.width != texture.width || registered.height != texture.height ||
+                        registered.format != texture.graphicsFormat)
+                    {
+                        RegisterRenderTexture(texture);
+                    }
+                    DLSS_Parameter_SetTextureId(pParams, name, id);
+                    return;
+                }
+            }
             IntPtr ptr = texture != null ? texture.GetNativeTexturePtr() : IntPtr.Zero;
-            DLSS_Parameter_SetD3d12Resource(pParams, name, ptr);
+            DLSS_Parameter_SetTexture(pParams, name, ptr);
         }
 
+        /// <summary>
+        /// Bind a resource parameter to a texture registered under textureId (0 unbinds).
+        /// The native texture is looked up on the render thread.
+        /// </summary>
+        public void SetParameterTextureId(IntPtr pParams, string name, int textureId)
+            => DLSS_Parameter_SetTextureId(pParams, name, textureId);
+
         public void SetParameterVoidPointer(IntPtr pParams, string name, IntPtr value)
             => DLSS_Parameter_SetVoidPointer(pParams, name, value);
 
@@ -695,6 +1609,108 @@ namespace UnityEngine.Rendering.Universal
 
         #endregion
 
+        #region Texture Registry
+
+        /// <summary>
+        /// Register a RenderTexture's native texture under its instance ID, creating the
+        /// texture if needed, so SetParameterRenderTexture no longer calls GetNativeTexturePtr
+        /// for it. Call again after Release()/Create(); resizes are picked up automatically.
+        /// </summary>
+        /// <returns>The instance ID, or 0 on failure</returns>
+        public int RegisterRenderTexture(RenderTexture texture)
+        {
+            if (texture == null || (!texture.IsCreated() && !texture.Create()))
+                return 0;
+
+            int id = texture.GetInstanceID();
+            if (DLSS_RegisterTexture(id, texture.GetNativeTexturePtr()) != 0)
+                return 0;
+
+            m_RegisteredTextures[id] = new RegisteredTexture
+            {
+                width = texture.width,
+                height = texture.height,
+                format = texture.graphicsFormat
+            };
+            return id;
+        }
+
+        /// <summary>
+        /// Forget a registered RenderTexture; call before destroying it.
+        /// </summary>
+        public void UnregisterRenderTexture(RenderTexture texture)
+        {
+            if (texture == null)
+                return;
+
+            int id = texture.GetInstanceID();
+            if (m_RegisteredTextures.Remove(id))
+                DLSS_UnregisterTexture(id);
+        }
+
+        #endregion
+
+        #region Binding Sets
+
+        /// <summary>
+        /// Store the resource parameters of a view for EvaluateFeatureBound. Every texture is
+        /// registered (RegisterRenderTexture) and the set is validated against info once; the
+        /// plugin logs the binding that failed. Update the set when a texture is recreated.
+        /// </summary>
+        /// <param name="names">Resource parameters, e.g. NVSDK_NGX_Parameter_Color</param>
+        /// <param name="textures">Texture of each name</param>
+        /// <returns>Binding set id, or -1 on failure</returns>
+        public int CreateBindingSet(DLSSBindingSetInfo info, string[] names, RenderTexture[] textures)
+        {
+            DLSSBindingDesc[] bindings = BuildBindings(names, textures);
+            return bindings != null ? DLSS_CreateBindingSet(ref info, bindings, bindings.Length) : -1;
+        }
+
+        /// <summary>
+        /// Replace the bindings of a set, e.g. after a resize. The set is unchanged on failure.
+        /// </summary>
+        /// <returns>True on success</returns>
+        public bool UpdateBindingSet(int bindingSet, DLSSBindingSetInfo info, string[] names, RenderTexture[] textures)
+        {
+            DLSSBindingDesc[] bindings = BuildBindings(names, textures);
+            return bindings != null && DLSS_UpdateBindingSet(bindingSet, ref info, bindings, bindings.Length) == 0;
+        }
+
+        public bool DestroyBindingSet(int bindingSet)
+            => DLSS_DestroyBindingSet(bindingSet) == 0;
+
+        private DLSSBindingDesc[] BuildBindings(string[] names, RenderTexture[] textures)
+        {
+            if (names == null || textures == null || names.Length != textures.Length)
+            {
+                Debug.LogError("[DLSSExtension] Binding set needs one texture per name");
+                return null;
+            }
+
+            var bindings = new DLSSBindingDesc[names.Length];
+            for (int i = 0; i < names.Length; i++)
+            {
+                RenderTexture texture = textures[i];
+                bindings[i].name = names[i];
+                if (texture == null)
+                    continue;
+
+                // Depth-only render textures have no colour format
+                GraphicsFormat format = texture.graphicsFormat;
+                bool depth = format == GraphicsFormat.None || GraphicsFormatUtility.IsDepthFormat(format);
+
+                bindings[i].textureId = RegisterRenderTexture(texture);
+                bindings[i].width = (uint)texture.width;
+                bindings[i].height = (uint)texture.height;
+                bindings[i].channels = depth ? 1 : GraphicsFormatUtility.GetComponentCount(format);
+                bindings[i].flags = (texture.enableRandomWrite ? DLSS_BINDING_RANDOM_WRITE : 0) |
+                    (depth ? DLSS_BINDING_DEPTH_FORMAT : 0);
+            }
+            return bindings;
+        }
+
+        #endregion
+
         #region Parameter Getters
 
         public NVSDK_NGX_Result GetParameterUI(IntPtr pParams, string name, out uint value)
@@ -710,23 +1726,90 @@ namespace UnityEngine.Rendering.Universal
 
         #region Internal Helpers
 
-        private void QueryFeatureAvailability()
+#if DLSS_PLUGIN_INTEGRATE
+        private bool CanInit()
         {
-            if (NVSDK_NGX_SUCCEED((NVSDK_NGX_Result)DLSS_GetCapabilityParameters_D3D12(out IntPtr capParams)))
+            Debug.Log("[DLSSExtension] Initializing DLSS...");
+            Debug.Log($"[DLSSExtension] Graphics Device: {SystemInfo.graphicsDeviceName}");
+            Debug.Log($"[DLSSExtension] Graphics Vendor: {SystemInfo.graphicsDeviceVendor}");
+
+#if !DLSS_NULL_BACKEND
+            // Check if NVIDIA GPU
+            if (!SystemInfo.graphicsDeviceVendor.ToLowerInvariant().Contains("nvidia"))
             {
-                // Query SuperSampling availability
-                if (NVSDK_NGX_SUCCEED((NVSDK_NGX_Result)DLSS_Parameter_GetI(capParams, NVSDK_NGX_Parameter_SuperSampling_Available, out int ssAvailable)))
-                {
-                    m_SRSupported = ssAvailable != 0;
-                }
+                Debug.Log("[DLSSExtension] Non-NVIDIA GPU detected. DLSS is not available.");
+                m_Initialized = false;
+                return false;
+            }
 
-                // Query RayReconstruction availability
-                if (NVSDK_NGX_SUCCEED((NVSDK_NGX_Result)DLSS_Parameter_GetI(capParams, NVSDK_NGX_Parameter_SuperSamplingDenoising_Available, out int rrAvailable)))
-                {
-                    m_RRSupported = rrAvailable != 0;
-                }
+            // Check for a graphics API the native plugin has a backend for
+            if (SystemInfo.graphicsDeviceType != GraphicsDeviceType.Direct3D12 &&
+                SystemInfo.graphicsDeviceType != GraphicsDeviceType.Vulkan &&
+                SystemInfo.graphicsDeviceType != GraphicsDeviceType.Direct3D11)
+            {
+                Debug.LogWarning("[DLSSExtension] DLSS requires Direct3D12, Vulkan or Direct3D11. Current API: " + SystemInfo.graphicsDeviceType);
+                m_Initialized = false;
+                return false;
+            }
+#else
+            // Plugin built with DLSS_BACKEND=null: runs on any device (including -nographics) without a GPU
+            Debug.Log("[DLSSExtension] Using the null NGX backend");
+#endif
+            return true;
+        }
+
+        private static DLSSInitParams CreateInitParams()
+        {
+            return new DLSSInitParams
+            {
+                projectId = "",
+                engineType = NVSDK_NGX_EngineType.NVSDK_NGX_ENGINE_TYPE_UNITY,
+                engineVersion = Application.version,
+                applicationDataPath = Application.persistentDataPath,
+                loggingLevel = NVSDK_NGX_Logging_Level.NVSDK_NGX_LOGGING_LEVEL_VERBOSE
+            };
+        }
 
-                DLSS_DestroyParameters_D3D12(capParams);
+        // Shared by Init and PollInit once the native init result is known
+        private void CompleteInit(NVSDK_NGX_Result result)
+        {
+            m_Initialized = NVSDK_NGX_SUCCEED(result);
+
+            if (!m_Initialized)
+            {
+                Debug.LogWarning($"[DLSSExtension] DLSS initialization failed: {result}");
+                return;
+            }
+
+            // Query capabilities
+            QueryFeatureAvailability();
+
+            // Initialize ring buffer allocator
+            m_Allocator = new RingBufferAllocator(ALLOCATOR_SIZE);
+
+            Debug.Log($"[DLSSExtension] DLSS-SR Available: {m_SRSupported}");
+            Debug.Log($"[DLSSExtension] DLSS-RR Available: {m_RRSupported}");
+            Debug.Log("[DLSSExtension] DLSS initialized successfully!");
+
+            // Cache instance
+            s_Instance = this;
+        }
+
+        private void OnDllNotFound(DllNotFoundException e)
+        {
+            Debug.LogWarning($"[DLSSExtension] DLSS DLL not found: {e.Message}");
+            Debug.LogWarning("[DLSSExtension] Make sure UnityDLSS.dll and nvngx_*.dll are in Assets/Plugins/x86_64/");
+            m_Initialized = false;
+        }
+#endif
+
+        private void QueryFeatureAvailability()
+        {
+            // Snapshot taken by the plugin at init: no capability parameter block or string lookups
+            if (DLSS_QueryCapabilities(out DLSSCapabilityInfo info) == 0)
+            {
+                m_SRSupported = info.superResolution.available != 0;
+                m_RRSupported = info.rayReconstruction.available != 0;
             }
         }
 
@@ -753,6 +1836,9 @@ namespace UnityEngine.Rendering.Universal
                     case NVSDK_NGX_Result.NVSDK_NGX_Result_FAIL_OutOfGPUMemory:
                         message += " - Out of GPU memory";
                         break;
+                    case NVSDK_NGX_Result.DLSS_Result_FAIL_NotReady:
+                        message += " - Async initialization still running";
+                        break;
                 }
 
                 Debug.LogError(message);
@@ -258,6 +258,7 @@ namespace UnityEngine.Rendering.Universal
                 reset, frameTimeDeltaMs);
 
             // Execute
+            Extension.OnHelperFrameWork(cmd);
             Extension.EvaluateFeature(cmd, m_dlssHandle, m_dlssParameters);
             return true;
         }
@@ -170,6 +170,7 @@ namespace UnityEngine.Rendering.Universal
                 reset, preExposure, exposureTexture, biasColorMask);
 
             // Execute
+            Extension.OnHelperFrameWork(cmd);
             Extension.EvaluateFeature(cmd, m_dlssHandle, m_dlssParameters);
             return true;
         }
@@ -21,6 +21,7 @@ namespace UnityEngine.Rendering.Universal
         private readonly byte[] _buffer;
         private readonly int _capacity;
         private int _writePosition;
+        private long _totalBytesAllocated;
         private readonly GCHandle _gcHandle;
         private readonly IntPtr _bufferPtr;
         private bool _disposed = false;
@@ -92,6 +93,7 @@ namespace UnityEngine.Rendering.Universal
 
             // Update write position
             _writePosition = allocatedOffset + dataLength;
+            _totalBytesAllocated += dataLength;
 
             return destPtr;
         }
@@ -144,6 +146,7 @@ namespace UnityEngine.Rendering.Universal
             }
 
             _writePosition = allocatedOffset + totalSize;
+            _totalBytesAllocated += totalSize;
 
             return (IntPtr)(_bufferPtr.ToInt64() + allocatedOffset);
         }
@@ -158,6 +161,12 @@ namespace UnityEngine.Rendering.Universal
         /// </summary>
         public int Capacity => _capacity;
 
+        /// <summary>
+        /// Gets the total number of bytes handed out since creation (never reset).
+        /// Sample it once per frame to get per-frame usage.
+        /// </summary>
+        public long TotalBytesAllocated => _totalBytesAllocated;
+
         /// <summary>
         /// Resets the write position to the beginning of the buffer.
         /// Call this at the start of each frame to reuse the buffer.
@@ -0,0 +1,42 @@
+//------------------------------------------------------------------------------
+// DLSSBackend.h - Compile-time selection of the NGX implementation
+//------------------------------------------------------------------------------
+// Plugin sources include this instead of the D3D11 / D3D12 / Vulkan / NGX SDK headers.
+// With DLSS_BACKEND_NULL=1 the plugin is built against NullNGX.h, an
+// in-process stand-in that needs neither a GPU nor the NGX SDK (Linux builds,
+// CI and the offline tools), and IUnityGraphicsVulkan.h against NullVulkan.h.
+// CMake sets it from the DLSS_BACKEND option. Otherwise the real SDK headers
+// are used; the Vulkan functions are loaded at runtime, so CMake also defines
+// VK_NO_PROTOTYPES and the Vulkan loader is not linked. Without the Vulkan SDK
+// CMake sets DLSS_VULKAN_BACKEND=0 and leaves the Vulkan backend out; Unity's
+// Vulkan renderer then gets no graphics backend.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#ifndef DLSS_BACKEND_NULL
+    #define DLSS_BACKEND_NULL 0
+#endif
+
+#ifndef DLSS_VULKAN_BACKEND
+    #define DLSS_VULKAN_BACKEND 1
+#endif
+
+#if DLSS_BACKEND_NULL
+    #include "NullNGX.h"
+    #define UNITY_VULKAN_HEADER "NullVulkan.h"
+#else
+    #include <d3d11.h>
+    #include <d3d12.h>
+    #include <dxgi1_4.h>
+    #if DLSS_VULKAN_BACKEND
+        #include <vulkan/vulkan.h>
+    #endif
+    #include <nvsdk_ngx.h>
+    #include <nvsdk_ngx_defs.h>
+    #include <nvsdk_ngx_defs_dlssd.h>
+    #include <nvsdk_ngx_params.h>
+    #if DLSS_VULKAN_BACKEND
+        #include <nvsdk_ngx_vk.h>
+    #endif
+#endif
@@ -0,0 +1,193 @@
+//------------------------------------------------------------------------------
+// DLSSBindingSet.cpp - Validation of persistent resource binding sets
+//------------------------------------------------------------------------------
+
+#include "DLSSBindingSet.h"
+
+#include <cstring>
+#include <sstream>
+
+#include "DLSSBackend.h"
+
+namespace dlss
+{
+
+namespace
+{
+
+enum class Extent
+{
+    Render,
+    Output,
+    MotionVectors,      // Render size with MVLowRes, else output size
+};
+
+enum RuleFlags : unsigned int
+{
+    kRequiredSR = 1 << 0,
+    kRequiredRR = 1 << 1,
+    kWritable = 1 << 2,
+    kSingleChannelOrDepth = 1 << 3,
+};
+
+struct ResourceRule
+{
+    const char* name;
+    Extent extent;
+    unsigned int minChannels;
+    unsigned int flags;
+};
+
+const ResourceRule kRules[] = {
+    { "Color", Extent::Render, 3, kRequiredSR | kRequiredRR },
+    { "Output", Extent::Output, 3, kRequiredSR | kRequiredRR | kWritable },
+    { "Depth", Extent::Render, 1, kRequiredSR | kRequiredRR | kSingleChannelOrDepth },
+    { "MotionVectors", Extent::MotionVectors, 2, kRequiredSR | kRequiredRR },
+    { "DiffuseAlbedo", Extent::Render, 3, kRequiredRR },
+    { "SpecularAlbedo", Extent::Render, 3, kRequiredRR },
+    { "Normals", Extent::Render, 3, kRequiredRR },
+    { "Roughness", Extent::Render, 1, 0 },
+    { "Emissive", Extent::Render, 3, 0 },
+    { "DiffuseRayDirection", Extent::Render, 3, 0 },
+    { "DiffuseHitDistance", Extent::Render, 1, 0 },
+    { "SpecularRayDirection", Extent::Render, 3, 0 },
+    { "SpecularHitDistance", Extent::Render, 1, 0 },
+    { "DiffuseRayDirectionHitDistance", Extent::Render, 4, 0 },
+    { "SpecularRayDirectionHitDistance", Extent::Render, 4, 0 },
+};
+
+const ResourceRule* FindRule(const char* name)
+{
+    for (const ResourceRule& rule : kRules)
+    {
+        if (std::strcmp(rule.name, name) == 0)
+        {
+            return &rule;
+        }
+    }
+    return nullptr;
+}
+
+bool CheckBinding(const DLSSBindingSetInfo& info, const DLSSBindingDesc& desc, const ResourceRule& rule,
+    std::ostringstream& error)
+{
+    const bool lowResMotion = (info.createFlags & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes) != 0;
+    const bool renderExtent = rule.extent == Extent::Render || (rule.extent == Extent::MotionVectors && lowResMotion);
+    const unsigned int minWidth = renderExtent ? info.renderWidth : info.outputWidth;
+    const unsigned int minHeight = renderExtent ? info.renderHeight : info.outputHeight;
+    if (desc.width < minWidth || desc.height < minHeight)
+    {
+        error << desc.name << " is " << desc.width << "x" << desc.height << ", smaller than the "
+              << (renderExtent ? "render" : "output") << " size " << minWidth << "x" << minHeight;
+        return false;
+    }
+
+    if ((rule.flags & kWritable) && !(desc.flags & DLSS_Binding_RandomWrite))
+    {
+        error << desc.name << " needs random write access (RenderTexture.enableRandomWrite)";
+        return false;
+    }
+
+    // Channel counts of depth formats say nothing about how NGX samples them
+    if (desc.channels == 0 || (desc.flags & DLSS_Binding_DepthFormat))
+    {
+        return true;
+    }
+    if ((rule.flags & kSingleChannelOrDepth) && desc.channels != 1)
+    {
+        error << desc.name << " needs a single-channel or depth format, has " << desc.channels << " channels";
+        return false;
+    }
+    if (desc.channels < rule.minChannels)
+    {
+        error << desc.name << " needs " << rule.minChannels << " channels, has " << desc.channels;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+bool ValidateBindingSet(const DLSSBindingSetInfo& info, const DLSSBindingDesc* bindings, int bindingCount,
+    std::string& outError)
+{
+    std::ostringstream error;
+    unsigned int requiredFlag = 0;
+    switch (info.feature)
+    {
+        case DLSS_NGX_Feature_SuperSampling: requiredFlag = kRequiredSR; break;
+        case DLSS_NGX_Feature_RayReconstruction: requiredFlag = kRequiredRR; break;
+        default:
+            error << "unsupported feature " << static_cast<int>(info.feature);
+            outError = error.str();
+            return false;
+    }
+    if (info.renderWidth == 0 || info.renderHeight == 0 ||
+        info.renderWidth > info.outputWidth || info.renderHeight > info.outputHeight)
+    {
+        error << "render size " << info.renderWidth << "x" << info.renderHeight << " does not fit the output size "
+              << info.outputWidth << "x" << info.outputHeight;
+        outError = error.str();
+        return false;
+    }
+    if (!bindings || bindingCount <= 0 || bindingCount > kMaxBindingSetBindings)
+    {
+        error << "needs 1 to " << kMaxBindingSetBindings << " bindings, got " << bindingCount;
+        outError = error.str();
+        return false;
+    }
+
+    for (int i = 0; i < bindingCount; ++i)
+    {
+        const DLSSBindingDesc& desc = bindings[i];
+        if (!desc.name || !desc.name[0])
+        {
+            error << "binding " << i << " has no name";
+            outError = error.str();
+            return false;
+        }
+        if (desc.textureId == 0)
+        {
+            error << desc.name << " has no texture";
+            outError = error.str();
+            return false;
+        }
+        for (int j = 0; j < i; ++j)
+        {
+            if (std::strcmp(bindings[j].name, desc.name) == 0)
+            {
+                error << desc.name << " is bound twice";
+                outError = error.str();
+                return false;
+            }
+        }
+        const ResourceRule* rule = FindRule(desc.name);
+        if (rule && !CheckBinding(info, desc, *rule, error))
+        {
+            outError = error.str();
+            return false;
+        }
+    }
+
+    for (const ResourceRule& rule : kRules)
+    {
+        if (!(rule.flags & requiredFlag))
+        {
+            continue;
+        }
+        bool found = false;
+        for (int i = 0; i < bindingCount && !found; ++i)
+        {
+            found = std::strcmp(bindings[i].name, rule.name) == 0;
+        }
+        if (!found)
+        {
+            error << "missing " << rule.name;
+            outError = error.str();
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,29 @@
+//------------------------------------------------------------------------------
+// DLSSBindingSet.h - Validation of persistent resource binding sets
+//------------------------------------------------------------------------------
+// A binding set (DLSS_CreateBindingSet) lists the resource parameters of one
+// view as registered texture IDs. It is checked here once, when created or
+// updated, against the feature it will be evaluated with, so a bound evaluate
+// only has to apply it (TextureRegistry::ApplySet). The checks use the size,
+// channel count and flags C# reports for each texture; resources NGX does not
+// name in its requirements (e.g. ExposureTexture) are passed through unchecked.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// Bindings per set; RR uses about 15.
+constexpr int kMaxBindingSetBindings = 32;
+
+/// Check a binding set against the feature it is evaluated with.
+/// @return false with outError naming the offending binding.
+bool ValidateBindingSet(const DLSSBindingSetInfo& info, const DLSSBindingDesc* bindings, int bindingCount,
+    std::string& outError);
+
+} // namespace dlss
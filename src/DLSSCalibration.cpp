@@ -0,0 +1,234 @@
+//------------------------------------------------------------------------------
+// DLSSCalibration.cpp - Measured cost of DLSS presets on this machine
+//------------------------------------------------------------------------------
+
+#include "DLSSCalibration.h"
+#include "DLSSTiming.h"
+
+#include <algorithm>
+#include <fstream>
+#include <system_error>
+
+namespace dlss
+{
+
+// Far above any real table; guards the allocation against a corrupt row count
+static constexpr uint32_t kMaxCalibrationFileRows = 65536;
+
+//------------------------------------------------------------------------------
+// CPU backend
+//------------------------------------------------------------------------------
+
+class CpuCalibrationBackend : public CalibrationBackend
+{
+public:
+    explicit CpuCalibrationBackend(uint32_t queryCount)
+        : m_ticks(queryCount)
+    {
+    }
+
+    uint64_t GetTimestampFrequency() const override
+    {
+        return 1000000000ull;
+    }
+
+    void* GetTexture(CalibrationTexture) const override
+    {
+        return nullptr;
+    }
+
+    bool BeginCommands(void** outCommandList) override
+    {
+        *outCommandList = nullptr;
+        return true;
+    }
+
+    void WriteTimestamp(void*, uint32_t queryIndex) override
+    {
+        if (queryIndex < m_ticks.size())
+        {
+            m_ticks[queryIndex] = MonotonicNs();
+        }
+    }
+
+    bool SubmitAndWait(void*, uint32_t queryCount, uint64_t* outTicks) override
+    {
+        if (queryCount > m_ticks.size())
+        {
+            return false;
+        }
+        std::copy_n(m_ticks.begin(), queryCount, outTicks);
+        return true;
+    }
+
+private:
+    std::vector<uint64_t> m_ticks;
+};
+
+std::unique_ptr<CalibrationBackend> CreateCpuCalibrationBackend(uint32_t queryCount)
+{
+    return std::make_unique<CpuCalibrationBackend>(queryCount);
+}
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+
+void SetCalibrationStats(std::vector<float> samplesMs, DLSSCalibrationResult* outResult)
+{
+    outResult->sampleCount = static_cast<unsigned int>(samplesMs.size());
+    if (samplesMs.empty())
+    {
+        return;
+    }
+
+    std::sort(samplesMs.begin(), samplesMs.end());
+
+    double sum = 0.0;
+    for (float sample : samplesMs)
+    {
+        sum += sample;
+    }
+
+    const size_t count = samplesMs.size();
+    const size_t p95Index = (count * 95 + 99) / 100 - 1;
+    outResult->minMs = samplesMs.front();
+    outResult->maxMs = samplesMs.back();
+    outResult->medianMs = count % 2 ? samplesMs[count / 2] : 0.5f * (samplesMs[count / 2 - 1] + samplesMs[count / 2]);
+    outResult->avgMs = static_cast<float>(sum / static_cast<double>(count));
+    outResult->p95Ms = samplesMs[p95Index];
+}
+
+void RankCalibrationResults(std::vector<DLSSCalibrationResult>* results)
+{
+    // Stable, so failures keep their candidate order
+    std::stable_sort(results->begin(), results->end(),
+        [](const DLSSCalibrationResult& a, const DLSSCalibrationResult& b)
+        {
+            const bool measuredA = a.sampleCount > 0;
+            const bool measuredB = b.sampleCount > 0;
+            if (measuredA != measuredB)
+            {
+                return measuredA;
+            }
+            return measuredA && a.medianMs < b.medianMs;
+        });
+}
+
+//------------------------------------------------------------------------------
+// Result table
+//------------------------------------------------------------------------------
+
+CalibrationTable& CalibrationTable::Instance()
+{
+    static CalibrationTable instance;
+    return instance;
+}
+
+void CalibrationTable::Store(unsigned int outputWidth, unsigned int outputHeight,
+    const std::vector<DLSSCalibrationResult>& results)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::erase_if(m_results, [&](const DLSSCalibrationResult& result)
+    {
+        return result.outputWidth == outputWidth && result.outputHeight == outputHeight;
+    });
+    m_results.insert(m_results.end(), results.begin(), results.end());
+}
+
+void CalibrationTable::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results.clear();
+}
+
+int CalibrationTable::Snapshot(DLSSCalibrationResult* outResults, int maxCount) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const int count = static_cast<int>(m_results.size());
+    if (outResults && maxCount > 0)
+    {
+        std::copy_n(m_results.begin(), std::min(count, maxCount), outResults);
+    }
+    return count;
+}
+
+bool CalibrationTable::Load(const std::filesystem::path& path, const CapabilityCacheKey& key)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    CalibrationFileHeader header = {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != kCalibrationFileMagic ||
+        header.version != kCalibrationFileVersion ||
+        header.headerSize != sizeof(CalibrationFileHeader) ||
+        header.resultSize != sizeof(DLSSCalibrationResult) ||
+        header.rowCount > kMaxCalibrationFileRows ||
+        !(header.key == key))
+    {
+        return false;
+    }
+
+    std::vector<DLSSCalibrationResult> results(header.rowCount);
+    if (!file.read(reinterpret_cast<char*>(results.data()), results.size() * sizeof(DLSSCalibrationResult)) ||
+        Fnv1a(results.data(), results.size() * sizeof(DLSSCalibrationResult)) != header.checksum)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_results = std::move(results);
+    return true;
+}
+
+bool CalibrationTable::Save(const std::filesystem::path& path, const CapabilityCacheKey& key) const
+{
+    std::vector<DLSSCalibrationResult> results;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        results = m_results;
+    }
+
+    CalibrationFileHeader header = {};
+    header.magic = kCalibrationFileMagic;
+    header.version = kCalibrationFileVersion;
+    header.headerSize = static_cast<uint16_t>(sizeof(CalibrationFileHeader));
+    header.key = key;
+    header.resultSize = static_cast<uint32_t>(sizeof(DLSSCalibrationResult));
+    header.rowCount = static_cast<uint32_t>(results.size());
+    header.checksum = Fnv1a(results.data(), results.size() * sizeof(DLSSCalibrationResult));
+
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(results.data()), results.size() * sizeof(DLSSCalibrationResult));
+        if (!file.flush())
+        {
+            file.close();
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// DLSSCalibration.h - Measured cost of DLSS presets on this machine
+//------------------------------------------------------------------------------
+// DLSS_RunCalibration creates every requested (feature, render preset, quality)
+// candidate at one output size, evaluates it on synthetic inputs on a private
+// command queue and times each evaluate with GPU timestamps. The NGX side of a
+// run lives in DLSSPluginLite.cpp; this header holds what has no NGX
+// dependency: the queue/timestamp/texture backend, the statistics, and the
+// ranked result table with its on-disk copy.
+//
+// The table file sits next to the capability cache and uses the same key
+// (adapter LUID, driver and snippet versions), so a driver or DLSS update
+// discards measurements that no longer apply.
+// Internal use only - exposed to C# through DLSS_RunCalibration and
+// DLSS_GetCalibrationTable.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "DLSSCapabilityCache.h"
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// Synthetic inputs of a calibration run, all at the output size.
+enum class CalibrationTexture : uint32_t
+{
+    Color,
+    Output,
+    Depth,
+    MotionVectors,
+    DiffuseAlbedo,      // RR guide buffers, only created when RR is calibrated
+    SpecularAlbedo,
+    Normals,
+    Roughness,
+    Count
+};
+
+/// Graphics-API side of a calibration run.
+class CalibrationBackend
+{
+public:
+    virtual ~CalibrationBackend() = default;
+
+    /// Timestamp tick rate in Hz.
+    virtual uint64_t GetTimestampFrequency() const = 0;
+
+    /// Resource to bind for a synthetic input (an ID3D12Resource* on D3D12).
+    /// Null for RR guides when RR is not calibrated, and on backends without a GPU.
+    virtual void* GetTexture(CalibrationTexture texture) const = 0;
+
+    /// Reset the command list for a new candidate.
+    /// @return false if the command list cannot be opened.
+    virtual bool BeginCommands(void** outCommandList) = 0;
+
+    /// Record a timestamp into queryIndex.
+    virtual void WriteTimestamp(void* commandList, uint32_t queryIndex) = 0;
+
+    /// Resolve queryCount timestamps, execute the command list, wait for the GPU and read them back.
+    virtual bool SubmitAndWait(void* commandList, uint32_t queryCount, uint64_t* outTicks) = 0;
+};
+
+/// Backend that reads the CPU clock instead of GPU timestamps and binds no textures.
+/// Used with the null NGX backend, where evaluates do no GPU work.
+std::unique_ptr<CalibrationBackend> CreateCpuCalibrationBackend(uint32_t queryCount);
+
+/// Fill the timing fields of a result from per-evaluate samples in milliseconds.
+void SetCalibrationStats(std::vector<float> samplesMs, DLSSCalibrationResult* outResult);
+
+/// Order a run's results: successful candidates by median cost, then failures.
+void RankCalibrationResults(std::vector<DLSSCalibrationResult>* results);
+
+constexpr uint32_t kCalibrationFileMagic = 0x42434C44; // 'DLCB'
+constexpr uint16_t kCalibrationFileVersion = 1;
+constexpr const char* kCalibrationFileName = "dlss_calibration.bin";
+
+/// Written once at the start of the file, followed by rowCount DLSSCalibrationResult entries.
+struct CalibrationFileHeader
+{
+    uint32_t magic;                     // kCalibrationFileMagic
+    uint16_t version;                   // kCalibrationFileVersion
+    uint16_t headerSize;                // sizeof(CalibrationFileHeader)
+    CapabilityCacheKey key;
+    uint32_t resultSize;                // sizeof(DLSSCalibrationResult)
+    uint32_t rowCount;
+    uint32_t checksum;                  // FNV-1a of the rows
+    uint32_t reserved;
+};
+static_assert(sizeof(CalibrationFileHeader) == 56, "CalibrationFileHeader must stay 56 bytes");
+
+class CalibrationTable
+{
+public:
+    static CalibrationTable& Instance();
+
+    // Non-copyable
+    CalibrationTable(const CalibrationTable&) = delete;
+    CalibrationTable& operator=(const CalibrationTable&) = delete;
+
+    /// Replace the results of one output size with a ranked run.
+    void Store(unsigned int outputWidth, unsigned int outputHeight, const std::vector<DLSSCalibrationResult>& results);
+
+    /// Drop all results (called on shutdown; the file is kept).
+    void Clear();
+
+    /// Copy results into a caller-provided array.
+    /// @return Total number of results (may exceed maxCount).
+    int Snapshot(DLSSCalibrationResult* outResults, int maxCount) const;
+
+    /// Replace the table with a file's contents.
+    /// @return false if the file is missing, corrupt, of another format version or for another key.
+    bool Load(const std::filesystem::path& path, const CapabilityCacheKey& key);
+
+    /// Write the table through a temporary file, so readers never see a partial one.
+    bool Save(const std::filesystem::path& path, const CapabilityCacheKey& key) const;
+
+private:
+    CalibrationTable() = default;
+
+    std::vector<DLSSCalibrationResult> m_results;   // Grouped by output size, ranked within a size
+    mutable std::mutex m_mutex;
+};
+
+} // namespace dlss
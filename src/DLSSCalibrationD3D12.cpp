@@ -0,0 +1,233 @@
+//------------------------------------------------------------------------------
+// DLSSCalibrationD3D12.cpp - D3D12 queue, synthetic inputs and timestamps for calibration
+//------------------------------------------------------------------------------
+
+#include <windows.h>
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstring>
+
+#include "DLSSCalibrationD3D12.h"
+
+using Microsoft::WRL::ComPtr;
+
+namespace dlss
+{
+
+struct CalibrationTextureDesc
+{
+    DXGI_FORMAT format;
+    D3D12_RESOURCE_STATES state;        // State NGX expects the resource in
+    bool rayReconstructionOnly;
+};
+
+// Indexed by CalibrationTexture. Committed resources are zero-filled, which is
+// as good as real content for timing: DLSS cost does not depend on the pixels.
+static const CalibrationTextureDesc kTextureDescs[] = {
+    {DXGI_FORMAT_R16G16B16A16_FLOAT, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, false},  // Color
+    {DXGI_FORMAT_R16G16B16A16_FLOAT, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, false},           // Output
+    {DXGI_FORMAT_R32_FLOAT, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, false},           // Depth
+    {DXGI_FORMAT_R16G16_FLOAT, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, false},        // MotionVectors
+    {DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, true},       // DiffuseAlbedo
+    {DXGI_FORMAT_R8G8B8A8_UNORM, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, true},       // SpecularAlbedo
+    {DXGI_FORMAT_R16G16B16A16_FLOAT, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, true},   // Normals
+    {DXGI_FORMAT_R8_UNORM, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, true},             // Roughness
+};
+static_assert(sizeof(kTextureDescs) / sizeof(kTextureDescs[0]) == static_cast<size_t>(CalibrationTexture::Count),
+    "kTextureDescs must cover every CalibrationTexture");
+
+class D3D12CalibrationBackend : public CalibrationBackend
+{
+public:
+    ~D3D12CalibrationBackend() override
+    {
+        if (m_fenceEvent)
+        {
+            CloseHandle(m_fenceEvent);
+        }
+    }
+
+    bool Create(ID3D12Device* device, unsigned int width, unsigned int height, bool rayReconstruction,
+        uint32_t queryCount)
+    {
+        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        if (FAILED(device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&m_queue))) ||
+            FAILED(m_queue->GetTimestampFrequency(&m_frequency)) || m_frequency == 0 ||
+            FAILED(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&m_allocator))) ||
+            FAILED(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, m_allocator.Get(), nullptr,
+                IID_PPV_ARGS(&m_commandList))) ||
+            FAILED(m_commandList->Close()) ||
+            FAILED(device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&m_fence))))
+        {
+            return false;
+        }
+
+        m_fenceEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!m_fenceEvent)
+        {
+            return false;
+        }
+
+        D3D12_QUERY_HEAP_DESC heapDesc = {};
+        heapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+        heapDesc.Count = queryCount;
+        if (FAILED(device->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(&m_queryHeap))))
+        {
+            return false;
+        }
+
+        D3D12_HEAP_PROPERTIES readbackProps = {};
+        readbackProps.Type = D3D12_HEAP_TYPE_READBACK;
+
+        D3D12_RESOURCE_DESC bufferDesc = {};
+        bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        bufferDesc.Width = static_cast<UINT64>(queryCount) * sizeof(uint64_t);
+        bufferDesc.Height = 1;
+        bufferDesc.DepthOrArraySize = 1;
+        bufferDesc.MipLevels = 1;
+        bufferDesc.SampleDesc.Count = 1;
+        bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+        if (FAILED(device->CreateCommittedResource(&readbackProps, D3D12_HEAP_FLAG_NONE, &bufferDesc,
+                D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&m_readback))))
+        {
+            return false;
+        }
+
+        D3D12_HEAP_PROPERTIES defaultProps = {};
+        defaultProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+        for (size_t i = 0; i < static_cast<size_t>(CalibrationTexture::Count); ++i)
+        {
+            const CalibrationTextureDesc& desc = kTextureDescs[i];
+            if (desc.rayReconstructionOnly && !rayReconstruction)
+            {
+                continue;
+            }
+
+            D3D12_RESOURCE_DESC textureDesc = {};
+            textureDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+            textureDesc.Width = width;
+            textureDesc.Height = height;
+            textureDesc.DepthOrArraySize = 1;
+            textureDesc.MipLevels = 1;
+            textureDesc.Format = desc.format;
+            textureDesc.SampleDesc.Count = 1;
+            textureDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+            textureDesc.Flags = desc.state == D3D12_RESOURCE_STATE_UNORDERED_ACCESS ?
+                D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS : D3D12_RESOURCE_FLAG_NONE;
+            if (FAILED(device->CreateCommittedResource(&defaultProps, D3D12_HEAP_FLAG_NONE, &textureDesc,
+                    desc.state, nullptr, IID_PPV_ARGS(&m_textures[i]))))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint64_t GetTimestampFrequency() const override
+    {
+        return m_frequency;
+    }
+
+    void* GetTexture(CalibrationTexture texture) const override
+    {
+        return m_textures[static_cast<size_t>(texture)].Get();
+    }
+
+    bool BeginCommands(void** outCommandList) override
+    {
+        *outCommandList = nullptr;
+        if (FAILED(m_allocator->Reset()) || FAILED(m_commandList->Reset(m_allocator.Get(), nullptr)))
+        {
+            return false;
+        }
+        *outCommandList = m_commandList.Get();
+        return true;
+    }
+
+    void WriteTimestamp(void* commandList, uint32_t queryIndex) override
+    {
+        static_cast<ID3D12GraphicsCommandList*>(commandList)->EndQuery(
+            m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, queryIndex);
+    }
+
+    bool SubmitAndWait(void* commandList, uint32_t queryCount, uint64_t* outTicks) override
+    {
+        ID3D12GraphicsCommandList* list = static_cast<ID3D12GraphicsCommandList*>(commandList);
+        if (queryCount > 0)
+        {
+            list->ResolveQueryData(m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, 0, queryCount, m_readback.Get(), 0);
+        }
+        if (FAILED(list->Close()))
+        {
+            return false;
+        }
+
+        ID3D12CommandList* lists[] = {list};
+        m_queue->ExecuteCommandLists(1, lists);
+
+        // A removed device completes every fence, so this cannot hang on a lost GPU
+        const UINT64 fenceValue = ++m_fenceValue;
+        if (FAILED(m_queue->Signal(m_fence.Get(), fenceValue)))
+        {
+            return false;
+        }
+        if (m_fence->GetCompletedValue() < fenceValue)
+        {
+            if (FAILED(m_fence->SetEventOnCompletion(fenceValue, m_fenceEvent)))
+            {
+                return false;
+            }
+            WaitForSingleObject(m_fenceEvent, INFINITE);
+        }
+
+        if (queryCount == 0)
+        {
+            return true;
+        }
+
+        D3D12_RANGE readRange = {};
+        readRange.End = static_cast<SIZE_T>(queryCount) * sizeof(uint64_t);
+
+        void* mapped = nullptr;
+        if (FAILED(m_readback->Map(0, &readRange, &mapped)))
+        {
+            return false;
+        }
+        std::memcpy(outTicks, mapped, readRange.End);
+
+        D3D12_RANGE writeRange = {};
+        m_readback->Unmap(0, &writeRange);
+        return true;
+    }
+
+private:
+    ComPtr<ID3D12CommandQueue> m_queue;
+    ComPtr<ID3D12CommandAllocator> m_allocator;
+    ComPtr<ID3D12GraphicsCommandList> m_commandList;
+    ComPtr<ID3D12Fence> m_fence;
+    HANDLE m_fenceEvent = nullptr;
+    UINT64 m_fenceValue = 0;
+    UINT64 m_frequency = 0;
+    ComPtr<ID3D12QueryHeap> m_queryHeap;
+    ComPtr<ID3D12Resource> m_readback;
+    ComPtr<ID3D12Resource> m_textures[static_cast<size_t>(CalibrationTexture::Count)];
+};
+
+std::unique_ptr<CalibrationBackend> CreateD3D12CalibrationBackend(ID3D12Device* device,
+    unsigned int width, unsigned int height, bool rayReconstruction, uint32_t queryCount)
+{
+    if (!device || width == 0 || height == 0 || queryCount == 0)
+    {
+        return nullptr;
+    }
+
+    auto backend = std::make_unique<D3D12CalibrationBackend>();
+    if (!backend->Create(device, width, height, rayReconstruction, queryCount))
+    {
+        return nullptr;
+    }
+    return backend;
+}
+
+} // namespace dlss
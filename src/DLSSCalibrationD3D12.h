@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// DLSSCalibrationD3D12.h - D3D12 queue, synthetic inputs and timestamps for calibration
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "DLSSCalibration.h"
+
+struct ID3D12Device;
+
+namespace dlss
+{
+
+/// Create a direct queue with its own command list, fence, timestamp heap and
+/// zero-filled synthetic inputs at the output size (RR guide buffers only if
+/// rayReconstruction is set). Everything is released with the backend.
+/// @return Backend, or nullptr if any object cannot be created.
+std::unique_ptr<CalibrationBackend> CreateD3D12CalibrationBackend(ID3D12Device* device,
+    unsigned int width, unsigned int height, bool rayReconstruction, uint32_t queryCount);
+
+} // namespace dlss
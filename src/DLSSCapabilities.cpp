@@ -0,0 +1,50 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilities.cpp - Cached NGX capability snapshot
+//------------------------------------------------------------------------------
+
+#include "DLSSCapabilities.h"
+
+#include <algorithm>
+
+namespace dlss
+{
+
+Capabilities& Capabilities::Instance()
+{
+    static Capabilities instance;
+    return instance;
+}
+
+void Capabilities::Store(const DLSSCapabilityInfo& info)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const unsigned long long vramBytes = m_info.ngxVramBytes;
+    const unsigned long long vramPeakBytes = m_info.ngxVramPeakBytes;
+    m_info = info;
+    m_info.ngxVramBytes = vramBytes;
+    m_info.ngxVramPeakBytes = vramPeakBytes;
+    m_valid = true;
+}
+
+void Capabilities::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_info = {};
+    m_valid = false;
+}
+
+void Capabilities::UpdateVram(uint64_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_info.ngxVramBytes = bytes;
+    m_info.ngxVramPeakBytes = std::max<unsigned long long>(m_info.ngxVramPeakBytes, bytes);
+}
+
+bool Capabilities::Snapshot(DLSSCapabilityInfo* outInfo) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    *outInfo = m_valid ? m_info : DLSSCapabilityInfo{};
+    return m_valid;
+}
+
+} // namespace dlss
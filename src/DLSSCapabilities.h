@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilities.h - Cached NGX capability snapshot
+//------------------------------------------------------------------------------
+// The plugin reads the NGX capability parameter block once at init (or loads
+// it from the capability cache) and stores the result here, and
+// DLSS_QueryCapabilities copies the struct without touching NGX. The NGX VRAM
+// figures are the only live fields: the render thread refreshes them from the
+// stats parameter block at each EndFrame.
+// Internal use only - exposed to C# through DLSS_QueryCapabilities.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+class Capabilities
+{
+public:
+    static Capabilities& Instance();
+
+    // Non-copyable
+    Capabilities(const Capabilities&) = delete;
+    Capabilities& operator=(const Capabilities&) = delete;
+
+    /// Replace the snapshot (at init, or when the capability cache is revalidated).
+    /// The VRAM fields of info are ignored; the live values are kept until Reset.
+    void Store(const DLSSCapabilityInfo& info);
+
+    /// Drop the snapshot (called on shutdown).
+    void Reset();
+
+    /// Record the current NGX VRAM usage.
+    void UpdateVram(uint64_t bytes);
+
+    /// @return false (and a zeroed outInfo) if no snapshot has been stored since the last reset.
+    bool Snapshot(DLSSCapabilityInfo* outInfo) const;
+
+private:
+    Capabilities() = default;
+
+    DLSSCapabilityInfo m_info = {};
+    bool m_valid = false;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace dlss
@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilityCache.cpp - On-disk cache of capability and optimal-settings results
+//------------------------------------------------------------------------------
+
+#include "DLSSCapabilityCache.h"
+
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace dlss
+{
+
+uint32_t Fnv1a(const void* data, size_t size, uint32_t hash)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+template <typename T>
+static uint32_t Fnv1a(const std::vector<T>& values, uint32_t hash)
+{
+    return Fnv1a(values.data(), values.size() * sizeof(T), hash);
+}
+
+static DLSSCapabilityInfo WithoutVram(DLSSCapabilityInfo info)
+{
+    info.ngxVramBytes = 0;
+    info.ngxVramPeakBytes = 0;
+    return info;
+}
+
+static uint32_t Checksum(const DLSSCapabilityInfo& info, const std::vector<DLSSResolution>& resolutions,
+    const std::vector<DLSSOptimalSettings>& rows)
+{
+    uint32_t hash = Fnv1a(&info, sizeof(info));
+    hash = Fnv1a(resolutions, hash);
+    return Fnv1a(rows, hash);
+}
+
+template <typename T>
+static bool SameValues(const std::vector<T>& a, const std::vector<T>& b)
+{
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+bool LoadCapabilityCache(const std::filesystem::path& path, const CapabilityCacheKey& key,
+    const std::vector<DLSSResolution>& resolutions, CapabilityCacheData* outData)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    CapabilityCacheHeader header = {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        header.magic != kCapabilityCacheMagic ||
+        header.version != kCapabilityCacheVersion ||
+        header.headerSize != sizeof(CapabilityCacheHeader) ||
+        header.capabilityInfoSize != sizeof(DLSSCapabilityInfo) ||
+        header.optimalSettingsSize != sizeof(DLSSOptimalSettings) ||
+        !(header.key == key) ||
+        header.resolutionCount != resolutions.size() ||
+        header.rowCount != resolutions.size() * DLSS_PERF_QUALITY_COUNT)
+    {
+        return false;
+    }
+
+    CapabilityCacheData data;
+    data.resolutions.resize(header.resolutionCount);
+    data.optimalSettings.resize(header.rowCount);
+    if (!file.read(reinterpret_cast<char*>(&data.capabilities), sizeof(data.capabilities)) ||
+        !file.read(reinterpret_cast<char*>(data.resolutions.data()), data.resolutions.size() * sizeof(DLSSResolution)) ||
+        !file.read(reinterpret_cast<char*>(data.optimalSettings.data()), data.optimalSettings.size() * sizeof(DLSSOptimalSettings)))
+    {
+        return false;
+    }
+
+    if (Checksum(data.capabilities, data.resolutions, data.optimalSettings) != header.checksum ||
+        !SameValues(data.resolutions, resolutions))
+    {
+        return false;
+    }
+
+    *outData = std::move(data);
+    return true;
+}
+
+bool SaveCapabilityCache(const std::filesystem::path& path, const CapabilityCacheKey& key,
+    const CapabilityCacheData& data)
+{
+    const DLSSCapabilityInfo capabilities = WithoutVram(data.capabilities);
+
+    CapabilityCacheHeader header = {};
+    header.magic = kCapabilityCacheMagic;
+    header.version = kCapabilityCacheVersion;
+    header.headerSize = static_cast<uint16_t>(sizeof(CapabilityCacheHeader));
+    header.key = key;
+    header.capabilityInfoSize = static_cast<uint32_t>(sizeof(DLSSCapabilityInfo));
+    header.optimalSettingsSize = static_cast<uint32_t>(sizeof(DLSSOptimalSettings));
+    header.resolutionCount = static_cast<uint32_t>(data.resolutions.size());
+    header.rowCount = static_cast<uint32_t>(data.optimalSettings.size());
+    header.checksum = Checksum(capabilities, data.resolutions, data.optimalSettings);
+
+    std::filesystem::path tempPath = path;
+    tempPath += ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            return false;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&capabilities), sizeof(capabilities));
+        file.write(reinterpret_cast<const char*>(data.resolutions.data()), data.resolutions.size() * sizeof(DLSSResolution));
+        file.write(reinterpret_cast<const char*>(data.optimalSettings.data()), data.optimalSettings.size() * sizeof(DLSSOptimalSettings));
+        if (!file.flush())
+        {
+            file.close();
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
+
+bool IsSameCapabilityData(const CapabilityCacheData& a, const CapabilityCacheData& b)
+{
+    const DLSSCapabilityInfo infoA = WithoutVram(a.capabilities);
+    const DLSSCapabilityInfo infoB = WithoutVram(b.capabilities);
+    return std::memcmp(&infoA, &infoB, sizeof(DLSSCapabilityInfo)) == 0 &&
+        SameValues(a.resolutions, b.resolutions) &&
+        SameValues(a.optimalSettings, b.optimalSettings);
+}
+
+} // namespace dlss
@@ -0,0 +1,83 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilityCache.h - On-disk cache of capability and optimal-settings results
+//------------------------------------------------------------------------------
+// The capability snapshot and the optimal settings table only change with the
+// GPU, the driver or the DLSS snippets, so DLSS_Init_with_ProjectID_D3D12
+// stores them in applicationDataPath and serves the next launch from the file.
+// A background thread then recomputes both from NGX and rewrites the file if
+// anything changed. The file is keyed by adapter LUID, user-mode driver
+// version and the SR/RR snippet file versions; a key, format or resolution
+// list mismatch, or a failed checksum, is treated as a miss.
+//
+// This header has no platform dependencies; DLSSCapabilityCacheD3D12.cpp
+// builds the key on Windows.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// Identifies the adapter, driver and snippets a cache file was computed for.
+struct CapabilityCacheKey
+{
+    uint64_t adapterLuid = 0;           // (HighPart << 32) | LowPart
+    uint64_t driverVersion = 0;         // User-mode driver version
+    uint64_t srSnippetVersion = 0;      // File version of nvngx_dlss.dll
+    uint64_t rrSnippetVersion = 0;      // File version of nvngx_dlssd.dll
+
+    bool operator==(const CapabilityCacheKey&) const = default;
+};
+
+/// Written once at the start of the file, followed by the DLSSCapabilityInfo,
+/// resolutionCount DLSSResolution entries and rowCount DLSSOptimalSettings entries.
+struct CapabilityCacheHeader
+{
+    uint32_t magic;                     // kCapabilityCacheMagic
+    uint16_t version;                   // kCapabilityCacheVersion
+    uint16_t headerSize;                // sizeof(CapabilityCacheHeader)
+    CapabilityCacheKey key;
+    uint32_t capabilityInfoSize;        // sizeof(DLSSCapabilityInfo)
+    uint32_t optimalSettingsSize;       // sizeof(DLSSOptimalSettings)
+    uint32_t resolutionCount;
+    uint32_t rowCount;
+    uint32_t checksum;                  // FNV-1a of everything after the header
+    uint32_t reserved;
+};
+static_assert(sizeof(CapabilityCacheHeader) == 64, "CapabilityCacheHeader must stay 64 bytes");
+
+constexpr uint32_t kCapabilityCacheMagic = 0x43434C44; // 'DLCC'
+constexpr uint16_t kCapabilityCacheVersion = 1;
+constexpr const char* kCapabilityCacheFileName = "dlss_capabilities.bin";
+
+struct CapabilityCacheData
+{
+    DLSSCapabilityInfo capabilities = {};
+    std::vector<DLSSResolution> resolutions;
+    std::vector<DLSSOptimalSettings> optimalSettings;
+};
+
+/// FNV-1a over a byte range; the checksum of the cache and calibration files.
+uint32_t Fnv1a(const void* data, size_t size, uint32_t hash = 2166136261u);
+
+/// Read a cache file.
+/// @return false if the file is missing, corrupt, of another format version or
+///         computed for another key or resolution list.
+bool LoadCapabilityCache(const std::filesystem::path& path, const CapabilityCacheKey& key,
+    const std::vector<DLSSResolution>& resolutions, CapabilityCacheData* outData);
+
+/// Write a cache file through a temporary file, so readers never see a partial one.
+/// VRAM fields of the capability snapshot are not stored.
+bool SaveCapabilityCache(const std::filesystem::path& path, const CapabilityCacheKey& key,
+    const CapabilityCacheData& data);
+
+/// True if both hold the same capabilities and optimal settings (VRAM fields ignored).
+bool IsSameCapabilityData(const CapabilityCacheData& a, const CapabilityCacheData& b);
+
+} // namespace dlss
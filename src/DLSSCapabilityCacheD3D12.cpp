@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilityCacheD3D12.cpp - Capability cache key for a D3D12 or D3D11 device
+//------------------------------------------------------------------------------
+
+#include <windows.h>
+#include <d3d11.h>
+#include <d3d12.h>
+#include <dxgi1_4.h>
+#include <wrl/client.h>
+#include <vector>
+
+#include "DLSSCapabilityCacheD3D12.h"
+
+using Microsoft::WRL::ComPtr;
+
+namespace dlss
+{
+
+static uint64_t GetFileVersion(const std::filesystem::path& path)
+{
+    DWORD ignored = 0;
+    const DWORD size = GetFileVersionInfoSizeW(path.c_str(), &ignored);
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    std::vector<uint8_t> data(size);
+    VS_FIXEDFILEINFO* info = nullptr;
+    UINT infoSize = 0;
+    if (!GetFileVersionInfoW(path.c_str(), 0, size, data.data()) ||
+        !VerQueryValueW(data.data(), L"\\", reinterpret_cast<void**>(&info), &infoSize) || !info)
+    {
+        return 0;
+    }
+    return (static_cast<uint64_t>(info->dwFileVersionMS) << 32) | info->dwFileVersionLS;
+}
+
+// Directory of UnityDLSS.dll, where the build copies the snippets
+static std::filesystem::path GetPluginDirectory()
+{
+    HMODULE module = nullptr;
+    if (!GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+            reinterpret_cast<LPCWSTR>(&GetPluginDirectory), &module))
+    {
+        return {};
+    }
+
+    wchar_t path[MAX_PATH] = {};
+    const DWORD length = GetModuleFileNameW(module, path, MAX_PATH);
+    if (length == 0 || length == MAX_PATH)
+    {
+        return {};
+    }
+    return std::filesystem::path(path).parent_path();
+}
+
+static CapabilityCacheKey MakeAdapterCapabilityCacheKey(const LUID& luid)
+{
+    CapabilityCacheKey key;
+    key.adapterLuid = (static_cast<uint64_t>(static_cast<uint32_t>(luid.HighPart)) << 32) | luid.LowPart;
+
+    ComPtr<IDXGIFactory4> factory;
+    ComPtr<IDXGIAdapter1> adapter;
+    LARGE_INTEGER driverVersion = {};
+    if (SUCCEEDED(CreateDXGIFactory1(IID_PPV_ARGS(&factory))) &&
+        SUCCEEDED(factory->EnumAdapterByLuid(luid, IID_PPV_ARGS(&adapter))) &&
+        SUCCEEDED(adapter->CheckInterfaceSupport(__uuidof(IDXGIDevice), &driverVersion)))
+    {
+        key.driverVersion = static_cast<uint64_t>(driverVersion.QuadPart);
+    }
+
+    const std::filesystem::path pluginDirectory = GetPluginDirectory();
+    if (!pluginDirectory.empty())
+    {
+        key.srSnippetVersion = GetFileVersion(pluginDirectory / L"nvngx_dlss.dll");
+        key.rrSnippetVersion = GetFileVersion(pluginDirectory / L"nvngx_dlssd.dll");
+    }
+    return key;
+}
+
+CapabilityCacheKey MakeD3D12CapabilityCacheKey(ID3D12Device* device)
+{
+    if (!device)
+    {
+        return {};
+    }
+    return MakeAdapterCapabilityCacheKey(device->GetAdapterLuid());
+}
+
+CapabilityCacheKey MakeD3D11CapabilityCacheKey(ID3D11Device* device)
+{
+    ComPtr<IDXGIDevice> dxgiDevice;
+    ComPtr<IDXGIAdapter> adapter;
+    DXGI_ADAPTER_DESC desc = {};
+    if (!device || FAILED(device->QueryInterface(IID_PPV_ARGS(&dxgiDevice))) ||
+        FAILED(dxgiDevice->GetAdapter(&adapter)) || FAILED(adapter->GetDesc(&desc)))
+    {
+        return {};
+    }
+    return MakeAdapterCapabilityCacheKey(desc.AdapterLuid);
+}
+
+} // namespace dlss
@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// DLSSCapabilityCacheD3D12.h - Capability cache key for a D3D12 or D3D11 device
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "DLSSCapabilityCache.h"
+
+struct ID3D11Device;
+struct ID3D12Device;
+
+namespace dlss
+{
+
+/// Build the cache key from the device's adapter LUID, the adapter's user-mode
+/// driver version and the file versions of the DLSS snippets next to the plugin.
+/// Fields that cannot be read are left at zero.
+CapabilityCacheKey MakeD3D12CapabilityCacheKey(ID3D12Device* device);
+
+/// Same key for a D3D11 device, whose adapter is found through IDXGIDevice.
+CapabilityCacheKey MakeD3D11CapabilityCacheKey(ID3D11Device* device);
+
+} // namespace dlss
@@ -0,0 +1,312 @@
+//------------------------------------------------------------------------------
+// DLSSCapture.cpp - Binary capture of parameter and render-event streams
+//------------------------------------------------------------------------------
+
+#include "DLSSCapture.h"
+#include "DLSSBindingSet.h"
+#include "DLSSPluginLite.h"
+#include "DLSSTiming.h"
+
+#include <cstring>
+
+namespace dlss
+{
+
+std::atomic<bool> Capture::s_active{false};
+
+Capture& Capture::Instance()
+{
+    static Capture instance;
+    return instance;
+}
+
+Capture::~Capture()
+{
+    End();
+}
+
+bool Capture::Begin(const char* path)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_file || !path)
+    {
+        return false;
+    }
+
+    m_file = std::fopen(path, "wb");
+    if (!m_file)
+    {
+        return false;
+    }
+
+    CaptureFileHeader header = {};
+    header.magic = kCaptureMagic;
+    header.version = kCaptureVersion;
+    header.recordHeaderSize = static_cast<uint16_t>(sizeof(CaptureRecordHeader));
+    header.startFrame = CurrentFrameIndex();
+    header.ticksPerSecond = TimestampTicksPerSecond();
+    header.startTimestamp = ReadTimestamp();
+
+    m_buffer.clear();
+    m_buffer.reserve(kFlushThreshold * 2);
+    m_buffer.insert(m_buffer.end(), reinterpret_cast<const uint8_t*>(&header),
+        reinterpret_cast<const uint8_t*>(&header) + sizeof(header));
+    m_names.clear();
+    m_recordCount = 0;
+
+    s_active.store(true, std::memory_order_release);
+    return true;
+}
+
+int Capture::End()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return -1;
+    }
+
+    s_active.store(false, std::memory_order_release);
+    Flush();
+    std::fclose(m_file);
+    m_file = nullptr;
+    m_names.clear();
+
+    return static_cast<int>(m_recordCount);
+}
+
+void Capture::Flush()
+{
+    if (!m_buffer.empty())
+    {
+        std::fwrite(m_buffer.data(), 1, m_buffer.size(), m_file);
+        m_buffer.clear();
+    }
+}
+
+void Capture::Append(CaptureRecordType type, const void* payload, size_t size)
+{
+    CaptureRecordHeader header = {};
+    header.timestamp = ReadTimestamp();
+    header.frameIndex = CurrentFrameIndex();
+    header.type = static_cast<uint8_t>(type);
+    header.size = static_cast<uint16_t>(size);
+
+    const uint8_t* headerBytes = reinterpret_cast<const uint8_t*>(&header);
+    const uint8_t* payloadBytes = static_cast<const uint8_t*>(payload);
+    m_buffer.insert(m_buffer.end(), headerBytes, headerBytes + sizeof(header));
+    m_buffer.insert(m_buffer.end(), payloadBytes, payloadBytes + size);
+    m_recordCount++;
+
+    if (m_buffer.size() >= kFlushThreshold)
+    {
+        Flush();
+    }
+}
+
+uint16_t Capture::InternName(const char* name)
+{
+    auto it = m_names.find(name);
+    if (it != m_names.end())
+    {
+        return it->second;
+    }
+
+    const size_t length = std::strlen(name);
+    if (m_names.size() >= kCaptureInvalidNameId || length > 0xFFFF - sizeof(CaptureName))
+    {
+        return kCaptureInvalidNameId;
+    }
+
+    CaptureName entry = {};
+    entry.id = static_cast<uint16_t>(m_names.size());
+    entry.length = static_cast<uint16_t>(length);
+
+    // Once per distinct name, so the temporary allocation does not matter
+    std::vector<uint8_t> payload(sizeof(entry) + length);
+    std::memcpy(payload.data(), &entry, sizeof(entry));
+    std::memcpy(payload.data() + sizeof(entry), name, length);
+    Append(CaptureRecordType::Name, payload.data(), payload.size());
+
+    m_names.emplace(name, entry.id);
+    return entry.id;
+}
+
+void Capture::RecordResult(CaptureRecordType type, int32_t result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureResult payload = {};
+    payload.result = result;
+    Append(type, &payload, sizeof(payload));
+}
+
+void Capture::RecordParameters(CaptureRecordType type, const void* parameters, int32_t result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureParameters payload = {};
+    payload.parameters = reinterpret_cast<uint64_t>(parameters);
+    payload.result = result;
+    Append(type, &payload, sizeof(payload));
+}
+
+void Capture::RecordParameterSet(const void* parameters, const char* name, CaptureValueType valueType, uint64_t value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureParameterSet payload = {};
+    payload.parameters = reinterpret_cast<uint64_t>(parameters);
+    payload.value = value;
+    payload.nameId = name ? InternName(name) : kCaptureInvalidNameId;
+    payload.valueType = static_cast<uint8_t>(valueType);
+    Append(CaptureRecordType::ParameterSet, &payload, sizeof(payload));
+}
+
+void Capture::RecordFeatureHandle(CaptureRecordType type, int32_t handle, int32_t result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureFeatureHandle payload = {};
+    payload.handle = handle;
+    payload.result = result;
+    Append(type, &payload, sizeof(payload));
+}
+
+void Capture::RecordTexture(CaptureRecordType type, int32_t textureId, const void* nativeTexture, int32_t result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureTexture payload = {};
+    payload.nativeTexture = reinterpret_cast<uint64_t>(nativeTexture);
+    payload.textureId = textureId;
+    payload.result = result;
+    Append(type, &payload, sizeof(payload));
+}
+
+void Capture::RecordBindingSet(CaptureRecordType type, int32_t bindingSet, const DLSSBindingSetInfo* info,
+    const DLSSBindingDesc* bindings, int bindingCount, int32_t result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+
+    CaptureBindingSet header = {};
+    header.bindingSet = bindingSet;
+    header.result = result;
+    if (info)
+    {
+        header.feature = static_cast<int32_t>(info->feature);
+        header.createFlags = info->createFlags;
+        header.renderWidth = info->renderWidth;
+        header.renderHeight = info->renderHeight;
+        header.outputWidth = info->outputWidth;
+        header.outputHeight = info->outputHeight;
+    }
+    if (bindings && bindingCount > 0 && bindingCount <= kMaxBindingSetBindings)
+    {
+        header.bindingCount = static_cast<uint32_t>(bindingCount);
+    }
+
+    // Name records go out before the set that refers to them
+    CaptureBinding entries[kMaxBindingSetBindings] = {};
+    for (uint32_t i = 0; i < header.bindingCount; ++i)
+    {
+        entries[i].textureId = bindings[i].textureId;
+        entries[i].width = bindings[i].width;
+        entries[i].height = bindings[i].height;
+        entries[i].nameId = bindings[i].name ? InternName(bindings[i].name) : kCaptureInvalidNameId;
+        entries[i].channels = static_cast<uint8_t>(bindings[i].channels);
+        entries[i].flags = static_cast<uint8_t>(bindings[i].flags);
+    }
+
+    uint8_t payload[sizeof(CaptureBindingSet) + sizeof(entries)];
+    std::memcpy(payload, &header, sizeof(header));
+    std::memcpy(payload + sizeof(header), entries, header.bindingCount * sizeof(CaptureBinding));
+    Append(type, payload, sizeof(header) + header.bindingCount * sizeof(CaptureBinding));
+}
+
+void Capture::RecordRenderEvent(int eventId, const void* data)
+{
+    CaptureRenderEvent payload = {};
+    payload.eventId = eventId;
+    payload.handle = DLSS_INVALID_FEATURE_HANDLE;
+    payload.hasData = data ? 1 : 0;
+
+    if (data)
+    {
+        switch (eventId)
+        {
+        case DLSS_Event_CreateFeature:
+        {
+            const DLSSCreateFeatureParams* params = static_cast<const DLSSCreateFeatureParams*>(data);
+            payload.handle = params->handle;
+            payload.feature = static_cast<int32_t>(params->feature);
+            payload.parameters = reinterpret_cast<uint64_t>(params->parameters);
+            break;
+        }
+        case DLSS_Event_EvaluateFeature:
+        {
+            const DLSSEvaluateFeatureParams* params = static_cast<const DLSSEvaluateFeatureParams*>(data);
+            payload.handle = params->handle;
+            payload.parameters = reinterpret_cast<uint64_t>(params->parameters);
+            break;
+        }
+        case DLSS_Event_EvaluateFeatureJittered:
+        {
+            const DLSSEvaluateJitteredParams* params = static_cast<const DLSSEvaluateJitteredParams*>(data);
+            payload.handle = params->handle;
+            payload.parameters = reinterpret_cast<uint64_t>(params->parameters);
+            payload.ringBufferBytesUsed = params->jitterFrameIndex;
+            break;
+        }
+        case DLSS_Event_EvaluateFeatureBound:
+        {
+            const DLSSEvaluateBoundParams* params = static_cast<const DLSSEvaluateBoundParams*>(data);
+            payload.handle = params->handle;
+            payload.feature = params->bindingSet;
+            payload.parameters = reinterpret_cast<uint64_t>(params->parameters);
+            break;
+        }
+        case DLSS_Event_DestroyFeature:
+            payload.handle = static_cast<const DLSSDestroyFeatureParams*>(data)->handle;
+            break;
+        case DLSS_Event_EndFrame:
+            payload.ringBufferBytesUsed = static_cast<const DLSSEndFrameParams*>(data)->ringBufferBytesUsed;
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_file)
+    {
+        return;
+    }
+    Append(CaptureRecordType::RenderEvent, &payload, sizeof(payload));
+}
+
+} // namespace dlss
@@ -0,0 +1,265 @@
+//------------------------------------------------------------------------------
+// DLSSCapture.h - Binary capture of parameter and render-event streams
+//------------------------------------------------------------------------------
+// Between DLSS_BeginCapture and DLSS_EndCapture every render event reaching
+// OnDLSSRenderEvent, every DLSS_Parameter_Set* call and the parameter-block /
+// feature-handle lifetime calls around them are appended to a compact binary
+// file, each stamped with a timestamp and the plugin frame index. Parameter
+// names are interned on first use. DLSS_Event_EndFrame records mark frame
+// boundaries.
+//
+// The capture is replayed offline by tools/dlss_replay.cpp against the null
+// NGX backend. Pointers (parameter blocks, resources) are stored as opaque
+// 64-bit identities; the replayer maps them to its own allocations.
+//
+// This header has no platform dependencies so that the replay tool can share
+// the record layout.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct DLSSBindingDesc;
+struct DLSSBindingSetInfo;
+
+namespace dlss
+{
+
+/// Record types stored in CaptureRecordHeader::type.
+/// Values are part of the file format - append only.
+enum class CaptureRecordType : uint8_t
+{
+    None = 0,
+    Name = 1,                       // CaptureName followed by the name bytes
+    Init = 2,                       // CaptureResult
+    Shutdown = 3,                   // CaptureResult
+    AllocateParameters = 4,         // CaptureParameters
+    GetCapabilityParameters = 5,    // CaptureParameters
+    DestroyParameters = 6,          // CaptureParameters
+    ParameterSet = 7,               // CaptureParameterSet
+    AllocateFeatureHandle = 8,      // CaptureFeatureHandle
+    FreeFeatureHandle = 9,          // CaptureFeatureHandle
+    RenderEvent = 10,               // CaptureRenderEvent
+    RegisterTexture = 11,           // CaptureTexture
+    UnregisterTexture = 12,         // CaptureTexture
+    CreateBindingSet = 13,          // CaptureBindingSet followed by bindingCount CaptureBinding
+    UpdateBindingSet = 14,          // CaptureBindingSet followed by bindingCount CaptureBinding
+    DestroyBindingSet = 15,         // CaptureFeatureHandle (handle = binding set)
+
+    Count
+};
+
+/// Which DLSS_Parameter_Set* overload a CaptureParameterSet record came from.
+enum class CaptureValueType : uint8_t
+{
+    ULL = 0,
+    F = 1,
+    D = 2,
+    UI = 3,
+    I = 4,
+    D3d12Resource = 5,
+    VoidPointer = 6,
+    Texture = 7,            // Native texture pointer (DLSS_Parameter_SetTexture)
+    TextureId = 8,          // Registered texture id (DLSS_Parameter_SetTextureId)
+
+    Count
+};
+
+/// Human-readable name of a capture record type.
+inline const char* GetCaptureRecordName(uint8_t type)
+{
+    switch (static_cast<CaptureRecordType>(type))
+    {
+        case CaptureRecordType::Name: return "Name";
+        case CaptureRecordType::Init: return "Init";
+        case CaptureRecordType::Shutdown: return "Shutdown";
+        case CaptureRecordType::AllocateParameters: return "AllocateParameters";
+        case CaptureRecordType::GetCapabilityParameters: return "GetCapabilityParameters";
+        case CaptureRecordType::DestroyParameters: return "DestroyParameters";
+        case CaptureRecordType::ParameterSet: return "ParameterSet";
+        case CaptureRecordType::AllocateFeatureHandle: return "AllocateFeatureHandle";
+        case CaptureRecordType::FreeFeatureHandle: return "FreeFeatureHandle";
+        case CaptureRecordType::RenderEvent: return "RenderEvent";
+        case CaptureRecordType::RegisterTexture: return "RegisterTexture";
+        case CaptureRecordType::UnregisterTexture: return "UnregisterTexture";
+        case CaptureRecordType::CreateBindingSet: return "CreateBindingSet";
+        case CaptureRecordType::UpdateBindingSet: return "UpdateBindingSet";
+        case CaptureRecordType::DestroyBindingSet: return "DestroyBindingSet";
+        default: return "Unknown";
+    }
+}
+
+/// Written once at the start of the file.
+struct CaptureFileHeader
+{
+    uint32_t magic;             // kCaptureMagic
+    uint16_t version;           // kCaptureVersion
+    uint16_t recordHeaderSize;  // sizeof(CaptureRecordHeader)
+    uint32_t startFrame;        // Plugin frame index when the capture began
+    uint32_t reserved;
+    uint64_t startTimestamp;    // ReadTimestamp() ticks when the capture began
+    double ticksPerSecond;      // Timestamp tick rate
+};
+static_assert(sizeof(CaptureFileHeader) == 32, "CaptureFileHeader must stay 32 bytes");
+
+/// Precedes every record payload (16 bytes).
+struct CaptureRecordHeader
+{
+    uint64_t timestamp;         // ReadTimestamp() ticks
+    uint32_t frameIndex;        // Plugin frame index
+    uint8_t type;               // CaptureRecordType
+    uint8_t reserved;
+    uint16_t size;              // Payload bytes following this header
+};
+static_assert(sizeof(CaptureRecordHeader) == 16, "CaptureRecordHeader must stay 16 bytes");
+
+struct CaptureName
+{
+    uint16_t id;
+    uint16_t length;            // Name bytes that follow, no terminator
+};
+
+struct CaptureResult
+{
+    int32_t result;             // NGX result
+    int32_t reserved;
+};
+
+struct CaptureParameters
+{
+    uint64_t parameters;        // NVSDK_NGX_Parameter* identity
+    int32_t result;             // NGX result
+    int32_t reserved;
+};
+
+struct CaptureParameterSet
+{
+    uint64_t parameters;        // NVSDK_NGX_Parameter* identity
+    uint64_t value;             // Value bits (pointers as identities)
+    uint16_t nameId;            // Id from a preceding Name record
+    uint8_t valueType;          // CaptureValueType
+    uint8_t reserved[5];
+};
+static_assert(sizeof(CaptureParameterSet) == 24, "CaptureParameterSet must stay 24 bytes");
+
+struct CaptureFeatureHandle
+{
+    int32_t handle;             // Handle (binding set ID for DestroyBindingSet) returned / passed in
+    int32_t result;             // Handle or 0 / -1, as returned by the export
+};
+
+struct CaptureRenderEvent
+{
+    int32_t eventId;            // DLSSRenderEventId
+    int32_t handle;             // Create/Evaluate/Destroy
+    int32_t feature;            // Create; EvaluateFeatureBound: binding set
+    uint32_t hasData;           // Non-zero if the event carried a payload
+    uint64_t parameters;        // Create/Evaluate: NVSDK_NGX_Parameter* identity
+    uint64_t ringBufferBytesUsed; // EndFrame; EvaluateFeatureJittered: jitter frame index
+};
+static_assert(sizeof(CaptureRenderEvent) == 32, "CaptureRenderEvent must stay 32 bytes");
+
+struct CaptureTexture
+{
+    uint64_t nativeTexture;     // RegisterTexture: native texture identity
+    int32_t textureId;          // Unity instance id
+    int32_t result;             // 0 / -1, as returned by the export
+};
+static_assert(sizeof(CaptureTexture) == 16, "CaptureTexture must stay 16 bytes");
+
+struct CaptureBindingSet
+{
+    int32_t bindingSet;         // Create: id returned; Update: id passed in
+    int32_t result;             // As returned by the export
+    int32_t feature;            // DLSSBindingSetInfo
+    int32_t createFlags;
+    uint32_t renderWidth;
+    uint32_t renderHeight;
+    uint32_t outputWidth;
+    uint32_t outputHeight;
+    uint32_t bindingCount;      // CaptureBinding entries that follow
+    uint32_t reserved;
+};
+static_assert(sizeof(CaptureBindingSet) == 40, "CaptureBindingSet must stay 40 bytes");
+
+struct CaptureBinding
+{
+    int32_t textureId;
+    uint32_t width;
+    uint32_t height;
+    uint16_t nameId;            // Id from a preceding Name record
+    uint8_t channels;
+    uint8_t flags;              // DLSSBindingFlags
+};
+static_assert(sizeof(CaptureBinding) == 16, "CaptureBinding must stay 16 bytes");
+
+constexpr uint32_t kCaptureMagic = 0x50434C44; // 'DLCP'
+constexpr uint16_t kCaptureVersion = 1;
+constexpr uint16_t kCaptureInvalidNameId = 0xFFFF;
+
+class Capture
+{
+public:
+    static Capture& Instance();
+
+    ~Capture();
+
+    // Non-copyable
+    Capture(const Capture&) = delete;
+    Capture& operator=(const Capture&) = delete;
+
+    /// Buffered bytes that trigger a write to disk.
+    static constexpr size_t kFlushThreshold = 64 * 1024;
+
+    /// Cheap check used at instrumentation sites.
+    static bool IsActive()
+    {
+        return s_active.load(std::memory_order_relaxed);
+    }
+
+    /// Open the output file and start recording.
+    /// @return false if a capture is already running or the file cannot be created.
+    bool Begin(const char* path);
+
+    /// Flush and close the file.
+    /// @return Number of records written, or -1 if no capture was running.
+    int End();
+
+    void RecordResult(CaptureRecordType type, int32_t result);
+    void RecordParameters(CaptureRecordType type, const void* parameters, int32_t result);
+    void RecordParameterSet(const void* parameters, const char* name, CaptureValueType valueType, uint64_t value);
+    void RecordFeatureHandle(CaptureRecordType type, int32_t handle, int32_t result);
+    void RecordTexture(CaptureRecordType type, int32_t textureId, const void* nativeTexture, int32_t result);
+
+    /// Bindings are recorded only for counts the export accepts (1 to kMaxBindingSetBindings).
+    void RecordBindingSet(CaptureRecordType type, int32_t bindingSet, const DLSSBindingSetInfo* info,
+        const DLSSBindingDesc* bindings, int bindingCount, int32_t result);
+
+    /// Decode the render event payload (DLSSCreateFeatureParams etc.) into a record.
+    void RecordRenderEvent(int eventId, const void* data);
+
+private:
+    Capture() = default;
+
+    // Callers hold m_mutex
+    void Append(CaptureRecordType type, const void* payload, size_t size);
+    uint16_t InternName(const char* name);
+    void Flush();
+
+    static std::atomic<bool> s_active;
+
+    std::mutex m_mutex;
+    FILE* m_file = nullptr;
+    std::vector<uint8_t> m_buffer;
+    std::unordered_map<std::string, uint16_t> m_names;
+    uint64_t m_recordCount = 0;
+};
+
+} // namespace dlss
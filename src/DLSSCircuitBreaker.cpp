@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// DLSSCircuitBreaker.cpp - Per-feature evaluate circuit breaker
+//------------------------------------------------------------------------------
+
+#include "DLSSCircuitBreaker.h"
+
+#include <algorithm>
+
+namespace dlss
+{
+
+//------------------------------------------------------------------------------
+// CircuitBreaker
+//------------------------------------------------------------------------------
+
+void CircuitBreaker::SetSettings(const DLSSCircuitBreakerSettings& settings)
+{
+    m_settings.failureThreshold = settings.failureThreshold ? settings.failureThreshold : kDefaultFailureThreshold;
+    m_settings.initialBackoff = settings.initialBackoff ? settings.initialBackoff : kDefaultInitialBackoff;
+    m_settings.maxBackoff = std::max(settings.maxBackoff ? settings.maxBackoff : kDefaultMaxBackoff,
+        m_settings.initialBackoff);
+}
+
+EvaluateDecision CircuitBreaker::Begin()
+{
+    switch (m_health.state)
+    {
+    case DLSS_FeatureHealth_Bypassed:
+        m_health.bypassedEvaluates++;
+        if (m_health.evaluatesUntilRetry > 0)
+        {
+            m_health.evaluatesUntilRetry--;
+        }
+        if (m_health.evaluatesUntilRetry == 0)
+        {
+            m_health.state = DLSS_FeatureHealth_Probing;
+        }
+        return EvaluateDecision::Bypass;
+
+    case DLSS_FeatureHealth_Probing:
+        return EvaluateDecision::Probe;
+
+    default:
+        return EvaluateDecision::Evaluate;
+    }
+}
+
+BreakerTransition CircuitBreaker::End(int result, bool succeeded)
+{
+    m_health.lastResult = result;
+    if (succeeded)
+    {
+        m_health.consecutiveFailures = 0;
+        if (m_health.state == DLSS_FeatureHealth_Healthy)
+        {
+            return BreakerTransition::None;
+        }
+        Close();
+        return BreakerTransition::Recovered;
+    }
+
+    m_health.consecutiveFailures++;
+    if (m_health.state == DLSS_FeatureHealth_Probing)
+    {
+        Open(std::min(m_health.backoff * 2, m_settings.maxBackoff));
+        return BreakerTransition::Reopened;
+    }
+    if (m_health.state == DLSS_FeatureHealth_Healthy && m_health.consecutiveFailures >= m_settings.failureThreshold)
+    {
+        m_health.trips++;
+        Open(m_settings.initialBackoff);
+        return BreakerTransition::Tripped;
+    }
+    return BreakerTransition::None;
+}
+
+void CircuitBreaker::Close()
+{
+    m_health.state = DLSS_FeatureHealth_Healthy;
+    m_health.consecutiveFailures = 0;
+    m_health.backoff = 0;
+    m_health.evaluatesUntilRetry = 0;
+}
+
+void CircuitBreaker::Open(unsigned int backoff)
+{
+    m_health.state = DLSS_FeatureHealth_Bypassed;
+    m_health.backoff = std::max(backoff, 1u);
+    m_health.evaluatesUntilRetry = m_health.backoff;
+}
+
+//------------------------------------------------------------------------------
+// FeatureHealth
+//------------------------------------------------------------------------------
+
+FeatureHealth& FeatureHealth::Instance()
+{
+    static FeatureHealth instance;
+    return instance;
+}
+
+void FeatureHealth::AddFeature(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CircuitBreaker& breaker = m_breakers[handle];
+    breaker = CircuitBreaker();
+    breaker.SetSettings(m_settings);
+}
+
+void FeatureHealth::RemoveFeature(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_breakers.erase(handle);
+}
+
+void FeatureHealth::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_breakers.clear();
+}
+
+void FeatureHealth::Configure(const DLSSCircuitBreakerSettings& settings)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_settings = settings;
+    for (auto& pair : m_breakers)
+    {
+        pair.second.SetSettings(settings);
+    }
+}
+
+EvaluateDecision FeatureHealth::BeginEvaluate(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_breakers.find(handle);
+    return it != m_breakers.end() ? it->second.Begin() : EvaluateDecision::Evaluate;
+}
+
+BreakerTransition FeatureHealth::EndEvaluate(int handle, int result, bool succeeded)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_breakers.find(handle);
+    return it != m_breakers.end() ? it->second.End(result, succeeded) : BreakerTransition::None;
+}
+
+void FeatureHealth::RecordFallbackCopy(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_breakers.find(handle);
+    if (it != m_breakers.end())
+    {
+        it->second.RecordFallbackCopy();
+    }
+}
+
+bool FeatureHealth::Get(int handle, DLSSFeatureHealth* outHealth)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_breakers.find(handle);
+    if (it == m_breakers.end())
+    {
+        return false;
+    }
+    *outHealth = it->second.GetHealth();
+    return true;
+}
+
+bool FeatureHealth::Reset(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_breakers.find(handle);
+    if (it == m_breakers.end())
+    {
+        return false;
+    }
+    it->second.Close();
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+// DLSSCircuitBreaker.h - Per-feature evaluate circuit breaker
+//------------------------------------------------------------------------------
+// A feature whose evaluates keep failing (lost inputs, a bad parameter block,
+// a driver problem) would otherwise pay NGX validation and error logging on
+// every frame for as long as C# keeps issuing evaluate events. After
+// failureThreshold consecutive failures the handle's breaker opens: evaluate
+// events skip NGX and run a cheap fallback instead. After a back-off counted
+// in evaluate events, one evaluate probes NGX again; a success closes the
+// breaker, a failure reopens it with twice the back-off (up to maxBackoff).
+//
+// CircuitBreaker is the state machine alone, with no plugin state.
+// FeatureHealth keeps one breaker per feature handle: the render thread drives
+// it from the evaluate events, C# reads it through DLSS_GetFeatureHealth.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// What the render thread does with an evaluate event.
+enum class EvaluateDecision
+{
+    Evaluate,       // Breaker closed
+    Probe,          // Breaker half-open: evaluate once to test recovery
+    Bypass          // Breaker open: skip NGX and run the fallback
+};
+
+/// State change caused by an evaluate result, for logging.
+enum class BreakerTransition
+{
+    None,
+    Tripped,        // Closed -> open
+    Reopened,       // Failed probe, back-off doubled
+    Recovered       // Successful probe, closed again
+};
+
+class CircuitBreaker
+{
+public:
+    static constexpr unsigned int kDefaultFailureThreshold = 3;
+    static constexpr unsigned int kDefaultInitialBackoff = 8;
+    static constexpr unsigned int kDefaultMaxBackoff = 512;
+
+    /// Apply settings; zero fields select the defaults. Keeps the current state.
+    void SetSettings(const DLSSCircuitBreakerSettings& settings);
+
+    /// Decide an evaluate event. Counts bypassed events and moves to probing once the back-off has elapsed.
+    EvaluateDecision Begin();
+
+    /// Record the NGX result of an evaluate that Begin let through.
+    BreakerTransition End(int result, bool succeeded);
+
+    /// Count a bypassed event whose fallback wrote the output.
+    void RecordFallbackCopy() { m_health.fallbackCopies++; }
+
+    /// Close the breaker, keeping the trip and bypass counts.
+    void Close();
+
+    const DLSSFeatureHealth& GetHealth() const { return m_health; }
+
+private:
+    void Open(unsigned int backoff);
+
+    DLSSCircuitBreakerSettings m_settings = {kDefaultFailureThreshold, kDefaultInitialBackoff, kDefaultMaxBackoff};
+    DLSSFeatureHealth m_health = {};
+};
+
+class FeatureHealth
+{
+public:
+    static FeatureHealth& Instance();
+
+    FeatureHealth() = default;
+
+    // Non-copyable
+    FeatureHealth(const FeatureHealth&) = delete;
+    FeatureHealth& operator=(const FeatureHealth&) = delete;
+
+    /// Start a closed breaker for a created feature, replacing any previous one of the handle.
+    void AddFeature(int handle);
+
+    void RemoveFeature(int handle);
+
+    /// Drop every breaker. Settings are kept.
+    void Clear();
+
+    /// Apply settings to every current and future breaker.
+    void Configure(const DLSSCircuitBreakerSettings& settings);
+
+    /// Decide an evaluate event of a handle. Handles without a breaker always evaluate.
+    EvaluateDecision BeginEvaluate(int handle);
+
+    BreakerTransition EndEvaluate(int handle, int result, bool succeeded);
+
+    void RecordFallbackCopy(int handle);
+
+    /// @return false if the handle has no breaker.
+    bool Get(int handle, DLSSFeatureHealth* outHealth);
+
+    /// @return false if the handle has no breaker.
+    bool Reset(int handle);
+
+private:
+    std::unordered_map<int, CircuitBreaker> m_breakers;
+    DLSSCircuitBreakerSettings m_settings = {};
+    std::mutex m_mutex;
+};
+
+} // namespace dlss
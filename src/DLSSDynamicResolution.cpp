@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+// DLSSDynamicResolution.cpp - Closed-loop dynamic resolution controller
+//------------------------------------------------------------------------------
+
+#include "DLSSDynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dlss
+{
+
+// Frame time never treated as below this fraction of the total, so a DLSS
+// timing larger than the frame (stale sample, async compute) cannot flip the sign.
+static constexpr float kMinScalableFraction = 0.1f;
+
+// A new snapped size is only taken once the continuous size is this many
+// steps away from the current one, so the output does not dither.
+static constexpr float kSnapHysteresis = 0.75f;
+
+//------------------------------------------------------------------------------
+// DrsController
+//------------------------------------------------------------------------------
+
+bool DrsController::SetRange(const DrsRange& range)
+{
+    if (range.maxWidth == 0 || range.maxHeight == 0)
+    {
+        return false;
+    }
+
+    m_range = range;
+    m_range.minWidth = std::clamp(range.minWidth, 1u, range.maxWidth);
+    m_range.minHeight = std::clamp(range.minHeight, 1u, range.maxHeight);
+
+    const float minScale = std::max(
+        static_cast<float>(m_range.minWidth) / static_cast<float>(m_range.maxWidth),
+        static_cast<float>(m_range.minHeight) / static_cast<float>(m_range.maxHeight));
+    m_minLogScale = std::log(minScale);
+
+    m_logScale = 0.0f;
+    m_integral = 0.0f;
+    m_width = Snap(1.0f, m_range.maxWidth, m_range.minWidth, 0);
+    m_height = Snap(1.0f, m_range.maxHeight, m_range.minHeight, 0);
+    for (int i = 0; i <= kMaxLatencyFrames; ++i)
+    {
+        PushAppliedSize();
+    }
+    return true;
+}
+
+void DrsController::SetSettings(const DLSSDrsSettings& settings)
+{
+    m_settings = settings;
+    m_settings.kp = settings.kp > 0.0f ? settings.kp : kDefaultKp;
+    m_settings.ki = settings.ki > 0.0f ? settings.ki : kDefaultKi;
+    m_settings.maxStep = settings.maxStep > 0.0f ? settings.maxStep : kDefaultMaxStep;
+    m_settings.deadband = settings.deadband > 0.0f ? settings.deadband : kDefaultDeadband;
+    m_settings.latencyFrames = settings.latencyFrames > 0 ? std::min(settings.latencyFrames, kMaxLatencyFrames) : kDefaultLatencyFrames;
+
+    // Bumpless: continue from the current scale with the new gains
+    m_integral = m_logScale;
+}
+
+void DrsController::Update(float frameMs, float dlssMs, DLSSDrsResult* outResult)
+{
+    const float targetMs = m_settings.targetFrameMs;
+    float error = 0.0f;
+
+    if (frameMs > 0.0f && targetMs > 0.0f)
+    {
+        // Only the part of the frame that scales with render resolution is controlled;
+        // with cost proportional to pixel count, half the log ratio is the per-axis correction.
+        const float fixedMs = std::max(dlssMs, 0.0f);
+        float scalableMs = std::max(frameMs - fixedMs, frameMs * kMinScalableFraction);
+
+        // The measured frame was rendered latencyFrames requests ago; predict its cost at the latest size
+        scalableMs *= std::exp(2.0f * (GetAppliedLogScale(0) - GetAppliedLogScale(m_settings.latencyFrames)));
+        const float scalableTargetMs = std::max(targetMs - fixedMs, targetMs * kMinScalableFraction);
+        error = 0.5f * std::log(scalableTargetMs / scalableMs);
+        if (std::fabs(error) < m_settings.deadband)
+        {
+            error = 0.0f;
+        }
+
+        float command = m_integral + m_settings.ki * error + m_settings.kp * error;
+        command = std::clamp(command, m_logScale - m_settings.maxStep, m_logScale + m_settings.maxStep);
+        command = std::clamp(command, m_minLogScale, 0.0f);
+
+        // Tracking anti-windup: the integrator follows the applied command, so time spent
+        // against the slew limit or the range does not have to be unwound later.
+        m_integral = command - m_settings.kp * error;
+        m_logScale = command;
+
+        const float scale = std::exp(m_logScale);
+        m_width = Snap(scale, m_range.maxWidth, m_range.minWidth, m_width);
+        m_height = Snap(scale, m_range.maxHeight, m_range.minHeight, m_height);
+        PushAppliedSize();
+    }
+
+    if (outResult)
+    {
+        outResult->renderWidth = m_width;
+        outResult->renderHeight = m_height;
+        outResult->scale = std::exp(m_logScale);
+        outResult->dlssMs = dlssMs;
+        outResult->errorMs = frameMs - targetMs;
+    }
+}
+
+void DrsController::PushAppliedSize()
+{
+    // GPU cost follows the snapped pixel count, not the continuous scale
+    const float area = (static_cast<float>(m_width) / static_cast<float>(m_range.maxWidth)) *
+        (static_cast<float>(m_height) / static_cast<float>(m_range.maxHeight));
+    m_applied[m_appliedNext] = 0.5f * std::log(area);
+    m_appliedNext = (m_appliedNext + 1) % (kMaxLatencyFrames + 1);
+}
+
+float DrsController::GetAppliedLogScale(int age) const
+{
+    const int count = kMaxLatencyFrames + 1;
+    return m_applied[(m_appliedNext - 1 - age + 2 * count) % count];
+}
+
+unsigned int DrsController::Snap(float scale, unsigned int maxSize, unsigned int minSize, unsigned int current) const
+{
+    // Snapped bounds stay inside [minSize, maxSize]; a range narrower than one step uses maxSize
+    const unsigned int lo = (minSize + kSnapPixels - 1) / kSnapPixels * kSnapPixels;
+    const unsigned int hi = maxSize / kSnapPixels * kSnapPixels;
+    if (lo > hi || hi == 0)
+    {
+        return maxSize;
+    }
+
+    const float size = scale * static_cast<float>(maxSize);
+    if (current >= lo && current <= hi &&
+        std::fabs(size - static_cast<float>(current)) < kSnapHysteresis * static_cast<float>(kSnapPixels))
+    {
+        return current;
+    }
+
+    const unsigned int snapped = static_cast<unsigned int>(std::lround(size / kSnapPixels)) * kSnapPixels;
+    return std::clamp(snapped, lo, hi);
+}
+
+//------------------------------------------------------------------------------
+// DynamicResolution
+//------------------------------------------------------------------------------
+
+DynamicResolution& DynamicResolution::Instance()
+{
+    static DynamicResolution instance;
+    return instance;
+}
+
+void DynamicResolution::AddFeature(int handle, const DrsRange& range)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    DrsController& controller = m_controllers[handle];
+    controller.SetRange(range);
+    controller.SetSettings(controller.GetSettings());
+}
+
+void DynamicResolution::RemoveFeature(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_controllers.erase(handle);
+}
+
+void DynamicResolution::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_controllers.clear();
+}
+
+void DynamicResolution::Configure(int handle, const DLSSDrsSettings& settings)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_controllers[handle].SetSettings(settings);
+}
+
+bool DynamicResolution::Update(int handle, float frameMs, float dlssMs, DLSSDrsResult* outResult)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_controllers.find(handle);
+    if (it == m_controllers.end() || !it->second.IsReady())
+    {
+        return false;
+    }
+
+    it->second.Update(frameMs, dlssMs, outResult);
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// DLSSDynamicResolution.h - Closed-loop dynamic resolution controller
+//------------------------------------------------------------------------------
+// Picks the next frame's render size from the measured GPU frame time. The
+// controller works on the per-axis render scale in log space, where GPU cost
+// is roughly proportional to pixel count: the DLSS evaluate itself runs at
+// output resolution, so its measured time is subtracted from both the frame
+// time and the target before the error is formed. Frame times arrive a few
+// frames late, so each measurement is first rescaled from the size it was
+// rendered at to the size most recently requested (a Smith predictor over the
+// controller's own output history). A PI term with tracking
+// anti-windup drives the error to zero, a slew limit bounds the per-frame
+// change, and the result is snapped to 8-pixel steps (with hysteresis so the
+// size does not toggle between neighbouring steps) inside the feature's
+// dynamic min/max render range.
+//
+// DrsController is pure math with no plugin state, so it can be driven by
+// synthetic load traces (see tools/dlss_drs_sim.cpp). DynamicResolution
+// keeps one controller per feature handle for DLSS_DrsUpdate.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// Render size range of a feature, in pixels.
+struct DrsRange
+{
+    unsigned int minWidth = 0;
+    unsigned int minHeight = 0;
+    unsigned int maxWidth = 0;
+    unsigned int maxHeight = 0;
+};
+
+class DrsController
+{
+public:
+    static constexpr float kDefaultKp = 0.1f;
+    static constexpr float kDefaultKi = 0.4f;
+    static constexpr float kDefaultMaxStep = 0.08f;
+    static constexpr float kDefaultDeadband = 0.01f;
+    static constexpr int kDefaultLatencyFrames = 2;
+    static constexpr int kMaxLatencyFrames = 8;
+
+    /// Render sizes are multiples of this many pixels.
+    static constexpr unsigned int kSnapPixels = 8;
+
+    /// Set the render range and restart at the largest size. Returns false for an empty range.
+    bool SetRange(const DrsRange& range);
+
+    /// Apply settings; zero fields select the defaults. Keeps the current render size.
+    void SetSettings(const DLSSDrsSettings& settings);
+
+    /// True once both a range and a positive target frame time are set.
+    bool IsReady() const { return m_range.maxWidth > 0 && m_settings.targetFrameMs > 0.0f; }
+
+    /// Feed one measured frame and compute the next render size.
+    /// @param frameMs Measured GPU frame time.
+    /// @param dlssMs Measured GPU time of the DLSS evaluate in that frame (0 if unknown).
+    void Update(float frameMs, float dlssMs, DLSSDrsResult* outResult);
+
+    const DrsRange& GetRange() const { return m_range; }
+    const DLSSDrsSettings& GetSettings() const { return m_settings; }
+
+private:
+    unsigned int Snap(float scale, unsigned int maxSize, unsigned int minSize, unsigned int current) const;
+    void PushAppliedSize();
+
+    /// Log per-axis scale of the size requested `age` updates ago (0 = latest).
+    float GetAppliedLogScale(int age) const;
+
+    DrsRange m_range;
+    DLSSDrsSettings m_settings = {};
+    float m_minLogScale = 0.0f;     // log of the smallest allowed per-axis scale (<= 0)
+    float m_logScale = 0.0f;        // log of the current per-axis scale relative to the max size
+    float m_integral = 0.0f;
+    unsigned int m_width = 0;
+    unsigned int m_height = 0;
+    float m_applied[kMaxLatencyFrames + 1] = {};    // Ring of requested sizes as log per-axis scale
+    int m_appliedNext = 0;
+};
+
+class DynamicResolution
+{
+public:
+    static DynamicResolution& Instance();
+
+    DynamicResolution() = default;
+
+    // Non-copyable
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    /// Register a created feature's render range. Settings configured before creation are kept.
+    void AddFeature(int handle, const DrsRange& range);
+
+    /// Drop a handle's controller and settings.
+    void RemoveFeature(int handle);
+
+    /// Drop every controller.
+    void Clear();
+
+    void Configure(int handle, const DLSSDrsSettings& settings);
+
+    /// @return false if the handle has no feature range or no target frame time yet.
+    bool Update(int handle, float frameMs, float dlssMs, DLSSDrsResult* outResult);
+
+private:
+    std::unordered_map<int, DrsController> m_controllers;
+    std::mutex m_mutex;
+};
+
+} // namespace dlss
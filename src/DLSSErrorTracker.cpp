@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// DLSSErrorTracker.cpp - Per-handle NGX error deduplication
+//------------------------------------------------------------------------------
+
+#include "DLSSErrorTracker.h"
+#include "DLSSTiming.h"
+
+namespace dlss
+{
+
+ErrorTracker& ErrorTracker::Instance()
+{
+    static ErrorTracker instance;
+    return instance;
+}
+
+bool ErrorTracker::Record(int handle, int result, uint64_t* outSuppressed)
+{
+    const uint64_t now = MonotonicNs();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries[MakeKey(handle, result)];
+    entry.count++;
+
+    // First occurrence is always reported, later ones at most once per interval
+    if (entry.reported != 0 && now - entry.lastReportNs < kReportIntervalNs)
+    {
+        entry.suppressedSinceReport++;
+        return false;
+    }
+
+    if (outSuppressed)
+    {
+        *outSuppressed = entry.suppressedSinceReport;
+    }
+    entry.reported++;
+    entry.suppressedSinceReport = 0;
+    entry.lastReportNs = now;
+    return true;
+}
+
+int ErrorTracker::Snapshot(DLSSErrorCounter* outCounters, int maxCount) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int written = 0;
+    for (const auto& pair : m_entries)
+    {
+        if (!outCounters || written >= maxCount)
+        {
+            break;
+        }
+
+        DLSSErrorCounter& counter = outCounters[written++];
+        counter.handle = static_cast<int>(static_cast<uint32_t>(pair.first >> 32));
+        counter.result = static_cast<int>(static_cast<uint32_t>(pair.first));
+        counter.count = pair.second.count;
+        counter.reportedCount = pair.second.reported;
+    }
+
+    return static_cast<int>(m_entries.size());
+}
+
+void ErrorTracker::RemoveHandle(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (static_cast<uint32_t>(it->first >> 32) == static_cast<uint32_t>(handle))
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void ErrorTracker::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+} // namespace dlss
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// DLSSErrorTracker.h - Per-handle NGX error deduplication
+//------------------------------------------------------------------------------
+// Aggregates failures by (feature handle, NGX result) so that an error that
+// repeats every frame is written to the Unity log once in full and then at
+// most once per report interval with a repeat count.
+// Internal use only - exposed to C# through DLSS_GetErrorCounters.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+class ErrorTracker
+{
+public:
+    static ErrorTracker& Instance();
+
+    // Non-copyable
+    ErrorTracker(const ErrorTracker&) = delete;
+    ErrorTracker& operator=(const ErrorTracker&) = delete;
+
+    /// Minimum time between two log lines for the same (handle, result) pair.
+    static constexpr uint64_t kReportIntervalNs = 1000000000ull;
+
+    /// Record one failure.
+    /// @param outSuppressed Receives the number of occurrences that were not
+    ///                      logged since the previous report of this pair.
+    /// @return true if the caller should write this occurrence to the log.
+    bool Record(int handle, int result, uint64_t* outSuppressed);
+
+    /// Copy aggregates into a caller-provided array.
+    /// @return Total number of tracked pairs (may exceed maxCount).
+    int Snapshot(DLSSErrorCounter* outCounters, int maxCount) const;
+
+    /// Drop the aggregates of one handle (called when the handle is freed, as
+    /// handle values are reused).
+    void RemoveHandle(int handle);
+
+    /// Drop all aggregates (called when NGX is initialized or shut down).
+    void Reset();
+
+private:
+    ErrorTracker() = default;
+
+    struct Entry
+    {
+        uint64_t count = 0;
+        uint64_t reported = 0;
+        uint64_t suppressedSinceReport = 0;
+        uint64_t lastReportNs = 0;
+    };
+
+    static uint64_t MakeKey(int handle, int result)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(handle)) << 32) |
+               static_cast<uint32_t>(result);
+    }
+
+    std::unordered_map<uint64_t, Entry> m_entries;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace dlss
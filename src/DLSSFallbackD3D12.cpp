@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+// DLSSFallbackD3D12.cpp - Output fallback for bypassed evaluates
+//------------------------------------------------------------------------------
+
+#include <d3d12.h>
+
+#include "DLSSFallbackD3D12.h"
+
+namespace dlss
+{
+
+static D3D12_RESOURCE_BARRIER MakeTransition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before,
+    D3D12_RESOURCE_STATES after)
+{
+    D3D12_RESOURCE_BARRIER barrier = {};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+    barrier.Transition.pResource = resource;
+    barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+    barrier.Transition.StateBefore = before;
+    barrier.Transition.StateAfter = after;
+    return barrier;
+}
+
+bool RecordFallbackCopy(ID3D12GraphicsCommandList* commandList, ID3D12Resource* color, ID3D12Resource* output,
+    unsigned int renderWidth, unsigned int renderHeight)
+{
+    if (!commandList || !color || !output)
+    {
+        return false;
+    }
+
+    const D3D12_RESOURCE_DESC colorDesc = color->GetDesc();
+    const D3D12_RESOURCE_DESC outputDesc = output->GetDesc();
+    const UINT64 width = renderWidth ? renderWidth : colorDesc.Width;
+    const UINT height = renderHeight ? renderHeight : colorDesc.Height;
+
+    // A copy cannot scale, so only the native-resolution case (DLAA, or a render subrect
+    // grown to the output size) gets a picture; upscales keep the previous output
+    if (colorDesc.Format != outputDesc.Format || colorDesc.SampleDesc.Count != 1 ||
+        width != outputDesc.Width || height != outputDesc.Height ||
+        width > colorDesc.Width || height > colorDesc.Height)
+    {
+        return false;
+    }
+
+    const D3D12_RESOURCE_STATES colorState = D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
+    const D3D12_RESOURCE_STATES outputState = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+
+    D3D12_RESOURCE_BARRIER barriers[2] = {
+        MakeTransition(color, colorState, D3D12_RESOURCE_STATE_COPY_SOURCE),
+        MakeTransition(output, outputState, D3D12_RESOURCE_STATE_COPY_DEST),
+    };
+    commandList->ResourceBarrier(2, barriers);
+
+    D3D12_TEXTURE_COPY_LOCATION source = {};
+    source.pResource = color;
+    source.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    source.SubresourceIndex = 0;
+
+    D3D12_TEXTURE_COPY_LOCATION destination = {};
+    destination.pResource = output;
+    destination.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    destination.SubresourceIndex = 0;
+
+    D3D12_BOX box = {};
+    box.right = static_cast<UINT>(width);
+    box.bottom = height;
+    box.back = 1;
+    commandList->CopyTextureRegion(&destination, 0, 0, 0, &source, &box);
+
+    barriers[0] = MakeTransition(color, D3D12_RESOURCE_STATE_COPY_SOURCE, colorState);
+    barriers[1] = MakeTransition(output, D3D12_RESOURCE_STATE_COPY_DEST, outputState);
+    commandList->ResourceBarrier(2, barriers);
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// DLSSFallbackD3D12.h - Output fallback for bypassed evaluates
+//------------------------------------------------------------------------------
+
+#pragma once
+
+struct ID3D12GraphicsCommandList;
+struct ID3D12Resource;
+
+namespace dlss
+{
+
+/// Copy the render region of color into output when they have the same size and format,
+/// as a stand-in for an evaluate the circuit breaker bypassed. Both resources are expected
+/// in the states NGX requires for an evaluate (color readable by non-pixel shaders, output
+/// in UNORDERED_ACCESS) and are returned to them.
+/// @param renderWidth Width of the color region to copy (0 = whole color texture).
+/// @param renderHeight Height of the color region to copy (0 = whole color texture).
+/// @return false if nothing was recorded (missing resources, different sizes or formats).
+bool RecordFallbackCopy(ID3D12GraphicsCommandList* commandList, ID3D12Resource* color, ID3D12Resource* output,
+    unsigned int renderWidth, unsigned int renderHeight);
+
+} // namespace dlss
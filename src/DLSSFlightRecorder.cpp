@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+// DLSSFlightRecorder.cpp - Memory-resident binary event ring
+//------------------------------------------------------------------------------
+
+#include "DLSSFlightRecorder.h"
+#include "DLSSTiming.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace dlss
+{
+
+static_assert((FlightRecorder::kCapacity & (FlightRecorder::kCapacity - 1)) == 0,
+    "Flight recorder capacity must be a power of two");
+
+FlightRecorder& FlightRecorder::Instance()
+{
+    static FlightRecorder instance;
+    return instance;
+}
+
+FlightRecorder::FlightRecorder()
+{
+    // Pin the calibration epoch as early as possible
+    GetTimestampEpoch();
+}
+
+uint16_t FlightRecorder::GetThreadTag()
+{
+    static std::atomic<uint16_t> s_nextTag{1};
+    thread_local uint16_t t_tag = s_nextTag.fetch_add(1, std::memory_order_relaxed);
+    return t_tag;
+}
+
+void FlightRecorder::Record(FlightEvent eventId, int32_t handle, int32_t result, uint64_t arg)
+{
+    const uint64_t index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+    FlightRecord& record = m_records[index & (kCapacity - 1)];
+    record.timestamp = ReadTimestamp();
+    record.frameIndex = CurrentFrameIndex();
+    record.eventId = static_cast<uint16_t>(eventId);
+    record.threadTag = GetThreadTag();
+    record.handle = handle;
+    record.result = result;
+    record.arg = arg;
+}
+
+size_t FlightRecorder::GetDumpSize() const
+{
+    const uint64_t total = m_writeIndex.load(std::memory_order_acquire);
+    const uint64_t count = total < kCapacity ? total : kCapacity;
+    return sizeof(FlightRecorderDumpHeader) + static_cast<size_t>(count) * sizeof(FlightRecord);
+}
+
+size_t FlightRecorder::Dump(void* buffer, size_t bufferSize) const
+{
+    // Snapshot the write index once; records written concurrently may be torn,
+    // which is acceptable for post-mortem diagnostics.
+    const uint64_t total = m_writeIndex.load(std::memory_order_acquire);
+    const uint32_t count = static_cast<uint32_t>(total < kCapacity ? total : kCapacity);
+    const size_t size = sizeof(FlightRecorderDumpHeader) + static_cast<size_t>(count) * sizeof(FlightRecord);
+
+    if (!buffer || bufferSize < size)
+    {
+        return 0;
+    }
+
+    FlightRecorderDumpHeader header = {};
+    header.magic = kFlightRecorderMagic;
+    header.version = kFlightRecorderVersion;
+    header.recordSize = static_cast<uint16_t>(sizeof(FlightRecord));
+    header.recordCount = count;
+    header.totalRecorded = total;
+    header.ticksPerSecond = TimestampTicksPerSecond();
+
+    uint8_t* out = static_cast<uint8_t*>(buffer);
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    // Oldest record first
+    const uint64_t first = total - count;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        std::memcpy(out, &m_records[(first + i) & (kCapacity - 1)], sizeof(FlightRecord));
+        out += sizeof(FlightRecord);
+    }
+
+    return size;
+}
+
+int FlightRecorder::DumpToFile(const char* path) const
+{
+    if (!path)
+    {
+        return -1;
+    }
+
+    std::vector<uint8_t> buffer(sizeof(FlightRecorderDumpHeader) + kCapacity * sizeof(FlightRecord));
+    const size_t size = Dump(buffer.data(), buffer.size());
+    if (size == 0)
+    {
+        return -1;
+    }
+
+    FILE* file = std::fopen(path, "wb");
+    if (!file)
+    {
+        return -1;
+    }
+
+    const size_t written = std::fwrite(buffer.data(), 1, size, file);
+    std::fclose(file);
+    if (written != size)
+    {
+        return -1;
+    }
+
+    const FlightRecorderDumpHeader* header = reinterpret_cast<const FlightRecorderDumpHeader*>(buffer.data());
+    return static_cast<int>(header->recordCount);
+}
+
+} // namespace dlss
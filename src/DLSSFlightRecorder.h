@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+// DLSSFlightRecorder.h - Memory-resident binary event ring
+//------------------------------------------------------------------------------
+// Every export and render event path appends a fixed 32-byte record to a
+// lock-free ring, except the dump and copy exports, which read the ring. The
+// ring is cheap enough to keep enabled in production and can be dumped after
+// a failure (e.g. device removed) for post-mortem analysis.
+//
+// This header has no platform dependencies so that the decoder tool
+// (tools/dlss_flight_decode.cpp) can share the record layout.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace dlss
+{
+
+/// Event identifiers stored in FlightRecord::eventId.
+/// Values are part of the dump format - append only.
+enum class FlightEvent : uint16_t
+{
+    None = 0,
+
+    // Exports (main thread)
+    Init = 1,                       // result = NGX result, arg = DLSSInitState when rejected
+    Shutdown = 2,                   // result = NGX result
+    AllocateParameters = 3,         // result = NGX result, arg = NVSDK_NGX_Parameter*
+    GetCapabilityParameters = 4,    // result = NGX result, arg = NVSDK_NGX_Parameter*
+    DestroyParameters = 5,          // result = NGX result, arg = NVSDK_NGX_Parameter*
+    ParameterSetULL = 6,            // result = low 32 bits of value, arg = NVSDK_NGX_Parameter*
+    ParameterSetF = 7,
+    ParameterSetD = 8,
+    ParameterSetUI = 9,
+    ParameterSetI = 10,
+    ParameterSetD3d12Resource = 11,
+    ParameterSetVoidPointer = 12,
+    ParameterGetULL = 13,           // result = NGX result, arg = NVSDK_NGX_Parameter*
+    ParameterGetF = 14,
+    ParameterGetD = 15,
+    ParameterGetUI = 16,
+    ParameterGetI = 17,
+    ParameterGetD3d12Resource = 18,
+    ParameterGetVoidPointer = 19,
+    AllocateFeatureHandle = 20,     // handle = allocated handle
+    FreeFeatureHandle = 21,         // handle, result = 0 or -1
+    GetErrorCounters = 22,          // result = number of tracked pairs
+    ParameterSetTexture = 23,       // arg = NVSDK_NGX_Parameter*
+    ParameterSetTextureId = 24,     // result = texture id, arg = NVSDK_NGX_Parameter*
+    RegisterTexture = 25,           // result = texture id, arg = native texture
+    UnregisterTexture = 26,         // result = texture id, arg = 1 if it was registered
+    CreateBindingSet = 27,          // result = binding set or -1, arg = binding count
+    UpdateBindingSet = 28,          // result = 0 or -1, arg = binding set
+    DestroyBindingSet = 29,         // result = 0 or -1, arg = binding set
+
+    // Render thread
+    RenderEventRejected = 32,       // result = NGX result, arg = render event id
+    CreateFeature = 33,             // handle, result = NGX result, arg = NVSDK_NGX_Feature
+    EvaluateFeature = 34,           // handle, result = NGX result
+    DestroyFeature = 35,            // handle, result = NGX result
+    EndFrame = 36,                  // frame index of the frame that ended
+    UnknownRenderEvent = 37,        // arg = render event id
+    EvaluateBypassed = 38,          // handle, result = 1 if color was copied into output
+    BreakerOpened = 39,             // handle, result = NGX result of the failed evaluate, arg = back-off in evaluates
+    BreakerClosed = 40,             // handle, result = NGX result, arg = evaluates bypassed since creation
+    TextureUnresolved = 41,         // result = texture id bound but not registered, arg = NVSDK_NGX_Parameter*
+
+    // Exports (main thread), continued
+    BeginTrace = 42,                // result = 0 or -1
+    EndTrace = 43,                  // result = trace events written or -1
+    BeginCapture = 44,              // result = 0 or -1
+    EndCapture = 45,                // result = capture records written or -1
+    DrsConfigure = 46,              // handle, result = 0 or -1
+    DrsUpdate = 47,                 // handle, result = 0 or -1, arg = render width << 32 | render height
+    SetOptimalSettingsResolutions = 48,// result = 0, -1 or DLSS_RESULT_FAIL_NOT_READY, arg = resolution count
+    GetOptimalSettingsTable = 49,   // result = table rows
+    LookupOptimalSettings = 50,     // result = 0 or -1, arg = output width << 32 | output height
+    QueryCapabilities = 51,         // result = 0 or -1
+    InitAsync = 52,                 // result = NGX result (Success once the worker started)
+    GetInitState = 53,              // result = DLSSInitState, arg = init result as uint32
+    GetJitterOffset = 54,           // result = 0 or -1, arg = frame index
+    GetJitterSequence = 55,         // result = phase count (0 if no table)
+    RunCalibration = 56,            // result = candidate count or NGX failure, arg = output width << 32 | output height
+    GetCalibrationTable = 57,       // result = table rows
+    SetCircuitBreakerSettings = 58, // arg = failure threshold (0 = defaults)
+    GetFeatureHealth = 59,          // arg = DLSSFeatureHealthState
+    ResetFeatureHealth = 60,
+    GetGraphicsApi = 61,            // result = DLSSGraphicsApi
+    UnityRenderEventFunc = 62,
+    GetGpuTimings = 63,             // result = tracked handles
+    GetTelemetry = 64,              // result = telemetry points
+    ResetTelemetry = 65,
+
+    Count
+};
+
+/// Human-readable name of a flight event id.
+inline const char* GetFlightEventName(uint16_t eventId)
+{
+    switch (static_cast<FlightEvent>(eventId))
+    {
+        case FlightEvent::Init: return "Init";
+        case FlightEvent::Shutdown: return "Shutdown";
+        case FlightEvent::AllocateParameters: return "AllocateParameters";
+        case FlightEvent::GetCapabilityParameters: return "GetCapabilityParameters";
+        case FlightEvent::DestroyParameters: return "DestroyParameters";
+        case FlightEvent::ParameterSetULL: return "Parameter_SetULL";
+        case FlightEvent::ParameterSetF: return "Parameter_SetF";
+        case FlightEvent::ParameterSetD: return "Parameter_SetD";
+        case FlightEvent::ParameterSetUI: return "Parameter_SetUI";
+        case FlightEvent::ParameterSetI: return "Parameter_SetI";
+        case FlightEvent::ParameterSetD3d12Resource: return "Parameter_SetD3d12Resource";
+        case FlightEvent::ParameterSetVoidPointer: return "Parameter_SetVoidPointer";
+        case FlightEvent::ParameterGetULL: return "Parameter_GetULL";
+        case FlightEvent::ParameterGetF: return "Parameter_GetF";
+        case FlightEvent::ParameterGetD: return "Parameter_GetD";
+        case FlightEvent::ParameterGetUI: return "Parameter_GetUI";
+        case FlightEvent::ParameterGetI: return "Parameter_GetI";
+        case FlightEvent::ParameterGetD3d12Resource: return "Parameter_GetD3d12Resource";
+        case FlightEvent::ParameterGetVoidPointer: return "Parameter_GetVoidPointer";
+        case FlightEvent::AllocateFeatureHandle: return "AllocateFeatureHandle";
+        case FlightEvent::FreeFeatureHandle: return "FreeFeatureHandle";
+        case FlightEvent::GetErrorCounters: return "GetErrorCounters";
+        case FlightEvent::ParameterSetTexture: return "Parameter_SetTexture";
+        case FlightEvent::ParameterSetTextureId: return "Parameter_SetTextureId";
+        case FlightEvent::RegisterTexture: return "RegisterTexture";
+        case FlightEvent::UnregisterTexture: return "UnregisterTexture";
+        case FlightEvent::CreateBindingSet: return "CreateBindingSet";
+        case FlightEvent::UpdateBindingSet: return "UpdateBindingSet";
+        case FlightEvent::DestroyBindingSet: return "DestroyBindingSet";
+        case FlightEvent::RenderEventRejected: return "RenderEventRejected";
+        case FlightEvent::CreateFeature: return "CreateFeature";
+        case FlightEvent::EvaluateFeature: return "EvaluateFeature";
+        case FlightEvent::DestroyFeature: return "DestroyFeature";
+        case FlightEvent::EndFrame: return "EndFrame";
+        case FlightEvent::UnknownRenderEvent: return "UnknownRenderEvent";
+        case FlightEvent::EvaluateBypassed: return "EvaluateBypassed";
+        case FlightEvent::BreakerOpened: return "BreakerOpened";
+        case FlightEvent::BreakerClosed: return "BreakerClosed";
+        case FlightEvent::TextureUnresolved: return "TextureUnresolved";
+        case FlightEvent::BeginTrace: return "BeginTrace";
+        case FlightEvent::EndTrace: return "EndTrace";
+        case FlightEvent::BeginCapture: return "BeginCapture";
+        case FlightEvent::EndCapture: return "EndCapture";
+        case FlightEvent::DrsConfigure: return "DrsConfigure";
+        case FlightEvent::DrsUpdate: return "DrsUpdate";
+        case FlightEvent::SetOptimalSettingsResolutions: return "SetOptimalSettingsResolutions";
+        case FlightEvent::GetOptimalSettingsTable: return "GetOptimalSettingsTable";
+        case FlightEvent::LookupOptimalSettings: return "LookupOptimalSettings";
+        case FlightEvent::QueryCapabilities: return "QueryCapabilities";
+        case FlightEvent::InitAsync: return "InitAsync";
+        case FlightEvent::GetInitState: return "GetInitState";
+        case FlightEvent::GetJitterOffset: return "GetJitterOffset";
+        case FlightEvent::GetJitterSequence: return "GetJitterSequence";
+        case FlightEvent::RunCalibration: return "RunCalibration";
+        case FlightEvent::GetCalibrationTable: return "GetCalibrationTable";
+        case FlightEvent::SetCircuitBreakerSettings: return "SetCircuitBreakerSettings";
+        case FlightEvent::GetFeatureHealth: return "GetFeatureHealth";
+        case FlightEvent::ResetFeatureHealth: return "ResetFeatureHealth";
+        case FlightEvent::GetGraphicsApi: return "GetGraphicsApi";
+        case FlightEvent::UnityRenderEventFunc: return "UnityRenderEventFunc";
+        case FlightEvent::GetGpuTimings: return "GetGpuTimings";
+        case FlightEvent::GetTelemetry: return "GetTelemetry";
+        case FlightEvent::ResetTelemetry: return "ResetTelemetry";
+        default: return "Unknown";
+    }
+}
+
+/// One ring entry (32 bytes).
+struct FlightRecord
+{
+    uint64_t timestamp;     // ReadTimestamp() ticks
+    uint32_t frameIndex;    // Render-thread frame counter
+    uint16_t eventId;       // FlightEvent
+    uint16_t threadTag;     // Small per-thread id (1 = first thread that recorded)
+    int32_t handle;         // Feature handle or DLSS_INVALID_FEATURE_HANDLE
+    int32_t result;         // NGX result or event-specific value
+    uint64_t arg;           // Event-specific payload (see FlightEvent)
+};
+static_assert(sizeof(FlightRecord) == 32, "FlightRecord must stay 32 bytes");
+
+/// Header written before the records in a dump (file or buffer).
+struct FlightRecorderDumpHeader
+{
+    uint32_t magic;             // kFlightRecorderMagic
+    uint16_t version;           // kFlightRecorderVersion
+    uint16_t recordSize;        // sizeof(FlightRecord)
+    uint32_t recordCount;       // Records following the header, oldest first
+    uint32_t reserved;
+    uint64_t totalRecorded;     // Records written since load (older ones were overwritten)
+    double ticksPerSecond;      // Timestamp tick rate
+};
+static_assert(sizeof(FlightRecorderDumpHeader) == 32, "FlightRecorderDumpHeader must stay 32 bytes");
+
+constexpr uint32_t kFlightRecorderMagic = 0x52464C44; // 'DLFR'
+constexpr uint16_t kFlightRecorderVersion = 1;
+
+class FlightRecorder
+{
+public:
+    static FlightRecorder& Instance();
+
+    // Non-copyable
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /// Ring capacity in records (power of two).
+    static constexpr uint32_t kCapacity = 8192;
+
+    /// Append one record. Lock-free, safe from any thread.
+    void Record(FlightEvent eventId, int32_t handle, int32_t result, uint64_t arg);
+
+    /// Size in bytes of a full dump (header + records).
+    size_t GetDumpSize() const;
+
+    /// Serialize header + records (oldest first) into buffer.
+    /// @return Bytes written, or 0 if bufferSize is too small.
+    size_t Dump(void* buffer, size_t bufferSize) const;
+
+    /// Write a dump to a file.
+    /// @return Number of records written, or -1 on failure.
+    int DumpToFile(const char* path) const;
+
+private:
+    FlightRecorder();
+
+    static uint16_t GetThreadTag();
+
+    FlightRecord m_records[kCapacity] = {};
+    std::atomic<uint64_t> m_writeIndex{0};
+};
+
+/// Shorthand used at instrumentation sites.
+inline void RecordFlightEvent(FlightEvent eventId, int32_t handle, int32_t result, uint64_t arg = 0)
+{
+    FlightRecorder::Instance().Record(eventId, handle, result, arg);
+}
+
+} // namespace dlss
@@ -0,0 +1,634 @@
+//------------------------------------------------------------------------------
+// DLSSFrameSequence.cpp - Streaming reader of RGBA frame sequences
+//------------------------------------------------------------------------------
+
+#include "DLSSFrameSequence.h"
+#include "DLSSThreadPool.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace dlss
+{
+
+namespace
+{
+
+constexpr uint32_t kDecodeBandHeight = 32;
+
+// OpenEXR version field flags
+constexpr uint32_t kExrTiled = 0x200;
+constexpr uint32_t kExrNonImage = 0x800;
+constexpr uint32_t kExrMultiPart = 0x1000;
+
+enum ExrPixelType : int32_t
+{
+    kExrUint = 0,
+    kExrHalf = 1,
+    kExrFloat = 2,
+};
+
+struct ExrChannel
+{
+    std::string name;
+    int32_t type = kExrFloat;
+    uint32_t lineOffset = 0;            // Byte offset of this channel within a scanline
+};
+
+struct ExrLayout
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    int32_t minY = 0;
+    uint64_t lineBytes = 0;
+    uint64_t tableOffset = 0;           // Scanline offset table, one uint64 per line
+    std::vector<ExrChannel> channels;   // In file order (sorted by name)
+    int slots[4] = {-1, -1, -1, -1};    // Channel feeding R, G, B and A
+};
+
+template <typename T>
+T ReadValue(const uint8_t* p)
+{
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+// Null-terminated string starting at pos; false if it runs off the end
+bool ReadString(const uint8_t* data, uint64_t size, uint64_t& pos, std::string& out)
+{
+    if (pos >= size)
+    {
+        return false;
+    }
+    const uint8_t* end = static_cast<const uint8_t*>(std::memchr(data + pos, 0, static_cast<size_t>(size - pos)));
+    if (!end)
+    {
+        return false;
+    }
+    out.assign(reinterpret_cast<const char*>(data + pos), end - (data + pos));
+    pos = static_cast<uint64_t>(end - data) + 1;
+    return true;
+}
+
+float HalfToFloat(uint16_t half)
+{
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1f;
+    const uint32_t mantissa = half & 0x3ff;
+    if (exponent == 0)
+    {
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -value : value;
+    }
+    const uint32_t bits = exponent == 31 ?
+        sign | 0x7f800000u | (mantissa << 13) :
+        sign | ((exponent + 112) << 23) | (mantissa << 13);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+bool ParseExrChannels(const uint8_t* data, uint64_t end, uint64_t pos, ExrLayout& layout, std::string& outError)
+{
+    for (;;)
+    {
+        std::string name;
+        if (!ReadString(data, end, pos, name))
+        {
+            break;
+        }
+        if (name.empty())
+        {
+            return true;
+        }
+        if (end - pos < 16)
+        {
+            break;
+        }
+        ExrChannel channel;
+        channel.name = name;
+        channel.type = ReadValue<int32_t>(data + pos);
+        const int32_t xSampling = ReadValue<int32_t>(data + pos + 8);
+        const int32_t ySampling = ReadValue<int32_t>(data + pos + 12);
+        pos += 16;
+        if (channel.type != kExrHalf && channel.type != kExrFloat)
+        {
+            outError = "channel " + name + " is not HALF or FLOAT";
+            return false;
+        }
+        if (xSampling != 1 || ySampling != 1)
+        {
+            outError = "channel " + name + " is subsampled";
+            return false;
+        }
+        layout.channels.push_back(channel);
+    }
+    outError = "truncated channel list";
+    return false;
+}
+
+bool ParseExrHeader(const uint8_t* data, uint64_t size, ExrLayout& layout, std::string& outError)
+{
+    if (size < 8 || data[0] != 0x76 || data[1] != 0x2f || data[2] != 0x31 || data[3] != 0x01)
+    {
+        outError = "not an OpenEXR file";
+        return false;
+    }
+    const uint32_t version = ReadValue<uint32_t>(data + 4);
+    if ((version & 0xff) != 2 || (version & (kExrTiled | kExrNonImage | kExrMultiPart)))
+    {
+        outError = "only single-part scanline OpenEXR files are supported";
+        return false;
+    }
+
+    bool haveChannels = false;
+    bool haveWindow = false;
+    uint8_t compression = 0xff;
+    int32_t window[4] = {};
+    uint64_t pos = 8;
+    for (;;)
+    {
+        std::string name;
+        std::string type;
+        if (!ReadString(data, size, pos, name))
+        {
+            outError = "truncated header";
+            return false;
+        }
+        if (name.empty())
+        {
+            break;
+        }
+        if (!ReadString(data, size, pos, type) || size - pos < 4)
+        {
+            outError = "truncated header";
+            return false;
+        }
+        const int32_t attributeSize = ReadValue<int32_t>(data + pos);
+        pos += 4;
+        if (attributeSize < 0 || size - pos < static_cast<uint64_t>(attributeSize))
+        {
+            outError = "truncated attribute " + name;
+            return false;
+        }
+
+        if (name == "channels" && type == "chlist")
+        {
+            if (!ParseExrChannels(data, pos + attributeSize, pos, layout, outError))
+            {
+                return false;
+            }
+            haveChannels = true;
+        }
+        else if (name == "compression" && attributeSize >= 1)
+        {
+            compression = data[pos];
+        }
+        else if (name == "dataWindow" && type == "box2i" && attributeSize >= 16)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                window[i] = ReadValue<int32_t>(data + pos + 4 * i);
+            }
+            haveWindow = true;
+        }
+        pos += attributeSize;
+    }
+
+    if (!haveChannels || !haveWindow)
+    {
+        outError = "header has no channels or dataWindow";
+        return false;
+    }
+    if (compression != 0)
+    {
+        outError = "compressed OpenEXR (type " + std::to_string(compression) + ") is not supported; save with NONE";
+        return false;
+    }
+    if (window[2] < window[0] || window[3] < window[1])
+    {
+        outError = "empty dataWindow";
+        return false;
+    }
+
+    layout.width = static_cast<uint32_t>(window[2] - window[0] + 1);
+    layout.height = static_cast<uint32_t>(window[3] - window[1] + 1);
+    layout.minY = window[1];
+    layout.tableOffset = pos;
+
+    // Channels are stored one after another in each scanline, in file order
+    const char* names[4] = {"R", "G", "B", "A"};
+    for (size_t c = 0; c < layout.channels.size(); ++c)
+    {
+        ExrChannel& channel = layout.channels[c];
+        channel.lineOffset = static_cast<uint32_t>(layout.lineBytes);
+        layout.lineBytes += static_cast<uint64_t>(layout.width) * (channel.type == kExrHalf ? 2 : 4);
+        for (int slot = 0; slot < 4; ++slot)
+        {
+            if (channel.name == names[slot])
+            {
+                layout.slots[slot] = static_cast<int>(c);
+            }
+        }
+    }
+    if (layout.slots[0] < 0)
+    {
+        // Luminance-only images become grey
+        for (size_t c = 0; c < layout.channels.size(); ++c)
+        {
+            if (layout.channels[c].name == "Y")
+            {
+                layout.slots[0] = layout.slots[1] = layout.slots[2] = static_cast<int>(c);
+            }
+        }
+    }
+    if (layout.slots[0] < 0)
+    {
+        outError = "no R or Y channel";
+        return false;
+    }
+
+    if (size - layout.tableOffset < 8ull * layout.height)
+    {
+        outError = "truncated offset table";
+        return false;
+    }
+    return true;
+}
+
+bool HasExrExtension(const std::string& path)
+{
+    return path.size() >= 4 &&
+        std::equal(path.end() - 4, path.end(), ".exr", [](char a, char b) { return std::tolower(a) == b; });
+}
+
+void AppendBytes(std::vector<uint8_t>& out, const void* data, size_t size)
+{
+    const size_t offset = out.size();
+    out.resize(offset + size);
+    std::memcpy(out.data() + offset, data, size);
+}
+
+template <typename T>
+void AppendValue(std::vector<uint8_t>& out, T value)
+{
+    AppendBytes(out, &value, sizeof(T));
+}
+
+void AppendAttribute(std::vector<uint8_t>& out, const char* name, const char* type, const std::vector<uint8_t>& value)
+{
+    AppendBytes(out, name, std::strlen(name) + 1);
+    AppendBytes(out, type, std::strlen(type) + 1);
+    AppendValue(out, static_cast<int32_t>(value.size()));
+    AppendBytes(out, value.data(), value.size());
+}
+
+bool WriteExr(FILE* file, const MetricImage& image)
+{
+    const uint32_t width = image.width;
+    const uint32_t height = image.height;
+    std::vector<uint8_t> header;
+    AppendValue(header, 0x01312f76u);                  // Magic
+    AppendValue(header, 2u);                           // Version 2, single-part scanline
+
+    // Channels in name order: A, B, G, R
+    std::vector<uint8_t> channels;
+    for (const char* name : {"A", "B", "G", "R"})
+    {
+        AppendBytes(channels, name, 2);
+        AppendValue(channels, static_cast<int32_t>(kExrFloat));
+        AppendValue(channels, 0u);                     // pLinear and reserved
+        AppendValue(channels, 1);                      // x and y sampling
+        AppendValue(channels, 1);
+    }
+    channels.push_back(0);
+
+    std::vector<uint8_t> window;
+    for (int32_t value : {0, 0, static_cast<int32_t>(width) - 1, static_cast<int32_t>(height) - 1})
+    {
+        AppendValue(window, value);
+    }
+    std::vector<uint8_t> one;
+    AppendValue(one, 1.0f);
+    std::vector<uint8_t> center;
+    AppendValue(center, 0.0f);
+    AppendValue(center, 0.0f);
+
+    AppendAttribute(header, "channels", "chlist", channels);
+    AppendAttribute(header, "compression", "compression", {0});
+    AppendAttribute(header, "dataWindow", "box2i", window);
+    AppendAttribute(header, "displayWindow", "box2i", window);
+    AppendAttribute(header, "lineOrder", "lineOrder", {0});
+    AppendAttribute(header, "pixelAspectRatio", "float", one);
+    AppendAttribute(header, "screenWindowCenter", "v2f", center);
+    AppendAttribute(header, "screenWindowWidth", "float", one);
+    header.push_back(0);
+
+    // Offset table, then one chunk per scanline
+    const uint64_t lineBytes = 4ull * width * sizeof(float);
+    const uint64_t firstChunk = header.size() + 8ull * height;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        AppendValue(header, firstChunk + y * (8 + lineBytes));
+    }
+    if (std::fwrite(header.data(), 1, header.size(), file) != header.size())
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> line;
+    line.reserve(8 + lineBytes);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        line.clear();
+        AppendValue(line, static_cast<int32_t>(y));
+        AppendValue(line, static_cast<int32_t>(lineBytes));
+        const float* row = image.data + static_cast<size_t>(y) * image.rowPitch;
+        for (int slot : {3, 2, 1, 0})
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                AppendValue(line, row[4 * x + slot]);
+            }
+        }
+        if (std::fwrite(line.data(), 1, line.size(), file) != line.size())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool WriteFrameFile(const std::string& path, const MetricImage& image, bool append, std::string& outError)
+{
+    const bool exr = HasExrExtension(path);
+    FILE* file = std::fopen(path.c_str(), exr || !append ? "wb" : "ab");
+    if (!file)
+    {
+        outError = "cannot write " + path;
+        return false;
+    }
+
+    bool written = true;
+    if (exr)
+    {
+        written = WriteExr(file, image);
+    }
+    else
+    {
+        for (uint32_t y = 0; y < image.height && written; ++y)
+        {
+            const size_t floats = 4 * static_cast<size_t>(image.width);
+            written = std::fwrite(image.data + static_cast<size_t>(y) * image.rowPitch, sizeof(float), floats, file) ==
+                floats;
+        }
+    }
+    if (std::fclose(file) != 0 || !written)
+    {
+        outError = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+bool FrameSequence::IsPattern() const
+{
+    return m_desc.path.find('%') != std::string::npos;
+}
+
+std::string FrameSequence::GetFramePath(uint32_t index) const
+{
+    if (!IsPattern())
+    {
+        return m_desc.path;
+    }
+    char path[1024];
+    std::snprintf(path, sizeof(path), m_desc.path.c_str(), static_cast<int>(m_desc.first + index));
+    return path;
+}
+
+bool FrameSequence::MapFrameFile(uint32_t index, std::string& outError)
+{
+    const std::string path = GetFramePath(index);
+    if (m_file.IsOpen() && m_file.GetPath() == path)
+    {
+        return true;
+    }
+    return m_file.Open(path, outError);
+}
+
+bool FrameSequence::Open(const FrameSequenceDesc& desc, std::string& outError)
+{
+    m_desc = desc;
+    m_frameCount = 0;
+    m_released = 0;
+    m_file.Close();
+
+    const std::string& path = desc.path;
+    m_exr = HasExrExtension(path);
+    if (!m_exr && (desc.width == 0 || desc.height == 0 || desc.channels == 0 || desc.channels > 4))
+    {
+        outError = path + ": raw frames need a size and 1 to 4 channels";
+        return false;
+    }
+
+    if (IsPattern())
+    {
+        m_frameCount = desc.count;
+        if (m_frameCount == 0)
+        {
+            // Count files until the first gap
+            while (FILE* file = std::fopen(GetFramePath(m_frameCount).c_str(), "rb"))
+            {
+                std::fclose(file);
+                ++m_frameCount;
+            }
+            if (m_frameCount == 0)
+            {
+                outError = "no file " + GetFramePath(0);
+                return false;
+            }
+        }
+    }
+    if (!MapFrameFile(0, outError))
+    {
+        return false;
+    }
+
+    if (m_exr)
+    {
+        ExrLayout layout;
+        if (!ParseExrHeader(m_file.GetData(), m_file.GetSize(), layout, outError))
+        {
+            outError = m_file.GetPath() + ": " + outError;
+            return false;
+        }
+        m_width = layout.width;
+        m_height = layout.height;
+        if (!IsPattern())
+        {
+            if (desc.first != 0 || desc.count > 1)
+            {
+                outError = path + " holds a single frame";
+                return false;
+            }
+            m_frameCount = 1;
+        }
+        return true;
+    }
+
+    m_width = desc.width;
+    m_height = desc.height;
+    const uint64_t frameBytes = static_cast<uint64_t>(m_width) * m_height * m_desc.channels * sizeof(float);
+    if (m_file.GetSize() % frameBytes != 0)
+    {
+        outError = m_file.GetPath() + " is not a whole number of " + std::to_string(m_width) + "x" +
+            std::to_string(m_height) + "x" + std::to_string(m_desc.channels) + " float frames";
+        return false;
+    }
+    if (!IsPattern())
+    {
+        const uint64_t available = m_file.GetSize() / frameBytes;
+        if (desc.first >= available || desc.count > available - desc.first)
+        {
+            outError = path + " holds only " + std::to_string(available) + " frames";
+            return false;
+        }
+        m_frameCount = desc.count ? desc.count : static_cast<uint32_t>(available - desc.first);
+    }
+    return true;
+}
+
+bool FrameSequence::ReadFrame(uint32_t index, ThreadPool& pool, MetricImage& outImage, std::string& outError)
+{
+    if (index >= m_frameCount)
+    {
+        outError = "frame " + std::to_string(index) + " is past the end of " + m_desc.path;
+        return false;
+    }
+    if (!MapFrameFile(index, outError))
+    {
+        return false;
+    }
+
+    if (m_exr)
+    {
+        if (!DecodeExr(pool, outError))
+        {
+            outError = m_file.GetPath() + ": " + outError;
+            return false;
+        }
+        outImage = {m_pixels.data(), m_width, m_height, 4 * m_width};
+        return true;
+    }
+
+    const uint64_t frameBytes = static_cast<uint64_t>(m_width) * m_height * m_desc.channels * sizeof(float);
+    uint64_t offset = 0;
+    if (IsPattern())
+    {
+        if (m_file.GetSize() != frameBytes)
+        {
+            outError = m_file.GetPath() + " is not one " + std::to_string(m_width) + "x" +
+                std::to_string(m_height) + "x" + std::to_string(m_desc.channels) + " float frame";
+            return false;
+        }
+    }
+    else
+    {
+        // Frames before this one will not be read again
+        offset = (m_desc.first + static_cast<uint64_t>(index)) * frameBytes;
+        if (offset > m_released)
+        {
+            m_file.Release(m_released, offset - m_released);
+            m_released = offset;
+        }
+    }
+    outImage = {reinterpret_cast<const float*>(m_file.GetData() + offset), m_width, m_height,
+        m_desc.channels * m_width};
+    return true;
+}
+
+bool FrameSequence::DecodeExr(ThreadPool& pool, std::string& outError)
+{
+    const uint8_t* data = m_file.GetData();
+    const uint64_t size = m_file.GetSize();
+    ExrLayout layout;
+    if (!ParseExrHeader(data, size, layout, outError))
+    {
+        return false;
+    }
+    if (layout.width != m_width || layout.height != m_height)
+    {
+        outError = "size " + std::to_string(layout.width) + "x" + std::to_string(layout.height) +
+            " differs from the first frame";
+        return false;
+    }
+
+    // Every chunk is one scanline: int32 y, int32 byte count, then the channels
+    for (uint32_t line = 0; line < layout.height; ++line)
+    {
+        const uint64_t offset = ReadValue<uint64_t>(data + layout.tableOffset + 8ull * line);
+        if (offset > size || size - offset < 8 + layout.lineBytes ||
+            ReadValue<int32_t>(data + offset + 4) != static_cast<int32_t>(layout.lineBytes))
+        {
+            outError = "bad chunk for scanline " + std::to_string(line);
+            return false;
+        }
+        const int64_t row = static_cast<int64_t>(ReadValue<int32_t>(data + offset)) - layout.minY;
+        if (row < 0 || row >= layout.height)
+        {
+            outError = "chunk outside the dataWindow";
+            return false;
+        }
+    }
+
+    m_pixels.resize(static_cast<size_t>(m_width) * m_height * 4);
+    const uint32_t bandCount = (layout.height + kDecodeBandHeight - 1) / kDecodeBandHeight;
+    pool.ParallelFor(bandCount, [&](uint32_t band) {
+        const uint32_t end = std::min((band + 1) * kDecodeBandHeight, layout.height);
+        for (uint32_t line = band * kDecodeBandHeight; line < end; ++line)
+        {
+            const uint64_t offset = ReadValue<uint64_t>(data + layout.tableOffset + 8ull * line);
+            const uint32_t row = static_cast<uint32_t>(ReadValue<int32_t>(data + offset) - layout.minY);
+            const uint8_t* scanline = data + offset + 8;
+            float* out = m_pixels.data() + static_cast<size_t>(row) * m_width * 4;
+            for (int slot = 0; slot < 4; ++slot)
+            {
+                if (layout.slots[slot] < 0)
+                {
+                    const float fill = slot == 3 ? 1.0f : 0.0f;
+                    for (uint32_t x = 0; x < m_width; ++x)
+                    {
+                        out[4 * x + slot] = fill;
+                    }
+                    continue;
+                }
+                const ExrChannel& channel = layout.channels[layout.slots[slot]];
+                const uint8_t* in = scanline + channel.lineOffset;
+                if (channel.type == kExrHalf)
+                {
+                    for (uint32_t x = 0; x < m_width; ++x)
+                    {
+                        out[4 * x + slot] = HalfToFloat(ReadValue<uint16_t>(in + 2 * x));
+                    }
+                }
+                else
+                {
+                    for (uint32_t x = 0; x < m_width; ++x)
+                    {
+                        out[4 * x + slot] = ReadValue<float>(in + 4 * x);
+                    }
+                }
+            }
+        }
+    });
+    return true;
+}
+
+} // namespace dlss
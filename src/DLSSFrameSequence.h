@@ -0,0 +1,93 @@
+//------------------------------------------------------------------------------
+// DLSSFrameSequence.h - Streaming reader of RGBA frame sequences
+//------------------------------------------------------------------------------
+// Feeds the image-quality tools one frame at a time from memory-mapped files:
+//
+//   - Raw: 32-bit float pixels (RGBA unless the caller gives another channel
+//     count), rows top to bottom, frames back to back with no header. The
+//     size comes from the caller. One file may hold the whole sequence; frames
+//     are used in place, without a copy.
+//   - OpenEXR: single-part scanline images with NONE compression and HALF or
+//     FLOAT channels R, G, B and A (G and B default to 0 and A to 1), or a
+//     single Y channel. Pixels are converted to RGBA float on a ThreadPool.
+//
+// A path containing a printf integer conversion (e.g. "frames/%04d.exr") names
+// one file per frame starting at the first index; any other path is a single
+// file. The format is picked from the ".exr" extension.
+//
+// WriteFrameFile writes frames in the same two formats.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "DLSSImageMetrics.h"
+#include "DLSSMappedFile.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace dlss
+{
+
+class ThreadPool;
+
+struct FrameSequenceDesc
+{
+    std::string path;                   // File or printf pattern
+    uint32_t first = 0;                 // First frame index (file number for patterns)
+    uint32_t count = 0;                 // Frames to read; 0 reads all of a raw file, or until a pattern's file is missing
+    uint32_t width = 0;                 // Raw frames only
+    uint32_t height = 0;
+    uint32_t channels = 4;              // Raw frames only: floats per pixel, 1 to 4
+};
+
+class FrameSequence
+{
+public:
+    FrameSequence() = default;
+
+    // Non-copyable
+    FrameSequence(const FrameSequence&) = delete;
+    FrameSequence& operator=(const FrameSequence&) = delete;
+
+    /// Open the first frame to learn the image size and frame count.
+    /// @return false with outError set if it cannot be read.
+    bool Open(const FrameSequenceDesc& desc, std::string& outError);
+
+    uint32_t GetFrameCount() const { return m_frameCount; }
+    uint32_t GetWidth() const { return m_width; }
+    uint32_t GetHeight() const { return m_height; }
+
+    /// Floats per pixel of the images ReadFrame returns: 4 for OpenEXR, FrameSequenceDesc::channels for raw.
+    uint32_t GetChannels() const { return m_exr ? 4 : m_desc.channels; }
+
+    /// Read frame index (0-based within the sequence). The image stays valid
+    /// until the next ReadFrame. Frames are expected in increasing order;
+    /// earlier frames of a raw file are released from memory as it advances.
+    /// @return false with outError set on a missing, malformed or differently sized frame.
+    bool ReadFrame(uint32_t index, ThreadPool& pool, MetricImage& outImage, std::string& outError);
+
+private:
+    bool IsPattern() const;
+    std::string GetFramePath(uint32_t index) const;
+    bool MapFrameFile(uint32_t index, std::string& outError);
+    bool DecodeExr(ThreadPool& pool, std::string& outError);
+
+    FrameSequenceDesc m_desc;
+    bool m_exr = false;
+    uint32_t m_frameCount = 0;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    MappedFile m_file;
+    uint64_t m_released = 0;            // Raw single file: bytes before this have been released
+    std::vector<float> m_pixels;        // Decoded EXR frame
+};
+
+/// Write an RGBA float image to path: uncompressed FLOAT OpenEXR if it ends in
+/// ".exr", raw floats otherwise. With append, a raw frame is added to the end
+/// of the file, building a single-file raw sequence.
+/// @return false with outError set if the file cannot be written.
+bool WriteFrameFile(const std::string& path, const MetricImage& image, bool append, std::string& outError);
+
+} // namespace dlss
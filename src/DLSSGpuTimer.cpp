@@ -0,0 +1,293 @@
+//------------------------------------------------------------------------------
+// DLSSGpuTimer.cpp - GPU timestamps around EvaluateFeature
+//------------------------------------------------------------------------------
+
+#include "DLSSGpuTimer.h"
+#include "DLSSTiming.h"
+#include "DLSSTrace.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace dlss
+{
+
+//------------------------------------------------------------------------------
+// CPU backend
+//------------------------------------------------------------------------------
+
+class CpuGpuQueryBackend : public GpuQueryBackend
+{
+public:
+    CpuGpuQueryBackend(uint32_t queryCount, uint32_t latencyFrames)
+        : m_written(queryCount)
+        , m_resolved(queryCount)
+        , m_latencyFrames(latencyFrames)
+    {
+    }
+
+    uint64_t GetTimestampFrequency() const override
+    {
+        return 1000000000ull;
+    }
+
+    void WriteTimestamp(void*, uint32_t queryIndex) override
+    {
+        if (queryIndex < m_written.size())
+        {
+            m_written[queryIndex] = MonotonicNs();
+        }
+    }
+
+    void ResolveTimestamps(void*, uint32_t firstQuery, uint32_t queryCount) override
+    {
+        if (static_cast<size_t>(firstQuery) + queryCount <= m_written.size())
+        {
+            std::copy_n(m_written.begin() + firstQuery, queryCount, m_resolved.begin() + firstQuery);
+        }
+    }
+
+    bool ReadTimestamps(uint32_t firstQuery, uint32_t queryCount, uint64_t* outTicks) override
+    {
+        if (static_cast<size_t>(firstQuery) + queryCount > m_resolved.size())
+        {
+            return false;
+        }
+        std::copy_n(m_resolved.begin() + firstQuery, queryCount, outTicks);
+        return true;
+    }
+
+    uint64_t GetFrameFenceValue() override
+    {
+        return m_submittedFrames + 1;
+    }
+
+    uint64_t GetCompletedFenceValue() override
+    {
+        ++m_submittedFrames;
+        return m_submittedFrames > m_latencyFrames ? m_submittedFrames - m_latencyFrames : 0;
+    }
+
+private:
+    std::vector<uint64_t> m_written;
+    std::vector<uint64_t> m_resolved;
+    uint64_t m_latencyFrames;
+    uint64_t m_submittedFrames = 0;
+};
+
+std::unique_ptr<GpuQueryBackend> CreateCpuGpuQueryBackend(uint32_t queryCount, uint32_t latencyFrames)
+{
+    return std::make_unique<CpuGpuQueryBackend>(queryCount, latencyFrames);
+}
+
+//------------------------------------------------------------------------------
+// Timer
+//------------------------------------------------------------------------------
+
+GpuTimer& GpuTimer::Instance()
+{
+    static GpuTimer instance;
+    return instance;
+}
+
+void GpuTimer::SetBackend(std::unique_ptr<GpuQueryBackend> backend)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_backend = std::move(backend);
+    ResetSlots();
+    m_stats.clear();
+}
+
+int GpuTimer::BeginEvaluate(void* commandList, int handle, int feature)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_backend)
+    {
+        return -1;
+    }
+
+    FrameSlot& slot = m_slots[m_currentSlot];
+    if (slot.count >= kMaxEvaluatesPerFrame)
+    {
+        return -1;
+    }
+
+    const uint32_t index = slot.count++;
+    slot.handles[index] = handle;
+    slot.features[index] = feature;
+    slot.cpuTicks[index] = ReadTimestamp();
+
+    const uint32_t pair = m_currentSlot * kMaxEvaluatesPerFrame + index;
+    m_backend->WriteTimestamp(commandList, pair * 2);
+    return static_cast<int>(pair);
+}
+
+void GpuTimer::EndEvaluate(void* commandList, int token)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_backend || token < 0)
+    {
+        return;
+    }
+
+    const uint32_t firstQuery = static_cast<uint32_t>(token) * 2;
+    m_backend->WriteTimestamp(commandList, firstQuery + 1);
+    m_backend->ResolveTimestamps(commandList, firstQuery, 2);
+}
+
+void GpuTimer::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_backend)
+    {
+        return;
+    }
+
+    FrameSlot& current = m_slots[m_currentSlot];
+    if (current.count > 0)
+    {
+        current.fenceValue = m_backend->GetFrameFenceValue();
+        current.submitted = true;
+    }
+
+    // Non-blocking: pick up whatever the GPU has finished
+    const uint64_t completed = m_backend->GetCompletedFenceValue();
+    for (uint32_t i = 0; i < kFramesInFlight; ++i)
+    {
+        if (m_slots[i].submitted && completed >= m_slots[i].fenceValue)
+        {
+            CollectSlot(i);
+        }
+    }
+
+    m_currentSlot = (m_currentSlot + 1) % kFramesInFlight;
+
+    // The GPU is more than kFramesInFlight frames behind; drop the oldest results
+    // rather than wait for them.
+    FrameSlot& next = m_slots[m_currentSlot];
+    next = FrameSlot();
+}
+
+void GpuTimer::RemoveHandle(int handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.erase(handle);
+
+    for (FrameSlot& slot : m_slots)
+    {
+        for (uint32_t i = 0; i < slot.count; ++i)
+        {
+            if (slot.handles[i] == handle)
+            {
+                slot.handles[i] = DLSS_INVALID_FEATURE_HANDLE;
+            }
+        }
+    }
+}
+
+bool GpuTimer::GetLatestMs(int handle, float* outMs) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_stats.find(handle);
+    if (it == m_stats.end() || it->second.count == 0)
+    {
+        return false;
+    }
+
+    const HandleStats& stats = it->second;
+    *outMs = stats.samples[(stats.next + kHistorySize - 1) % kHistorySize];
+    return true;
+}
+
+int GpuTimer::Snapshot(DLSSGpuTiming* outTimings, int maxCount) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    int written = 0;
+    std::vector<float> sorted;
+    for (const auto& pair : m_stats)
+    {
+        if (!outTimings || written >= maxCount)
+        {
+            break;
+        }
+
+        const HandleStats& stats = pair.second;
+        DLSSGpuTiming& timing = outTimings[written++];
+        timing = {};
+        timing.handle = pair.first;
+        timing.feature = stats.feature;
+        timing.sampleCount = stats.count;
+        if (stats.count == 0)
+        {
+            continue;
+        }
+
+        sorted.assign(stats.samples, stats.samples + stats.count);
+        std::sort(sorted.begin(), sorted.end());
+
+        double sum = 0.0;
+        for (float sample : sorted)
+        {
+            sum += sample;
+        }
+
+        const size_t p95Index = (sorted.size() * 95 + 99) / 100 - 1;
+        timing.minMs = sorted.front();
+        timing.maxMs = sorted.back();
+        timing.avgMs = static_cast<float>(sum / static_cast<double>(sorted.size()));
+        timing.p95Ms = sorted[p95Index];
+    }
+
+    return static_cast<int>(m_stats.size());
+}
+
+void GpuTimer::CollectSlot(uint32_t slotIndex)
+{
+    FrameSlot& slot = m_slots[slotIndex];
+    const uint64_t frequency = m_backend->GetTimestampFrequency();
+
+    uint64_t ticks[kMaxEvaluatesPerFrame * 2] = {};
+    const uint32_t firstQuery = slotIndex * kMaxEvaluatesPerFrame * 2;
+    if (frequency != 0 && m_backend->ReadTimestamps(firstQuery, slot.count * 2, ticks))
+    {
+        for (uint32_t i = 0; i < slot.count; ++i)
+        {
+            const uint64_t begin = ticks[i * 2];
+            const uint64_t end = ticks[i * 2 + 1];
+            if (slot.handles[i] == DLSS_INVALID_FEATURE_HANDLE || end < begin)
+            {
+                continue;
+            }
+
+            const double ms = static_cast<double>(end - begin) * 1000.0 / static_cast<double>(frequency);
+
+            HandleStats& stats = m_stats[slot.handles[i]];
+            stats.feature = slot.features[i];
+            stats.samples[stats.next] = static_cast<float>(ms);
+            stats.next = (stats.next + 1) % kHistorySize;
+            if (stats.count < kHistorySize)
+            {
+                stats.count++;
+            }
+
+            if (Tracer::IsActive())
+            {
+                Tracer::Instance().RecordCounter("GPU EvaluateFeature (ms)", slot.cpuTicks[i], slot.handles[i], ms);
+            }
+        }
+    }
+
+    slot = FrameSlot();
+}
+
+void GpuTimer::ResetSlots()
+{
+    for (FrameSlot& slot : m_slots)
+    {
+        slot = FrameSlot();
+    }
+    m_currentSlot = 0;
+}
+
+} // namespace dlss
@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+// DLSSGpuTimer.h - GPU timestamps around EvaluateFeature
+//------------------------------------------------------------------------------
+// Brackets every NGX evaluate with a pair of timestamp queries taken from a
+// small ring of per-frame query slots. Each pair is resolved right after the
+// end timestamp into a readback buffer, and a slot is only read back once the
+// frame fence shows the GPU is done with it (kFramesInFlight frames later at
+// most), so collecting results never stalls. Results feed rolling per-handle
+// statistics exposed through DLSS_GetGpuTimings.
+//
+// The graphics API is hidden behind GpuQueryBackend so the slot/resolve
+// bookkeeping has no D3D12 dependency. The null NGX backend drives it with
+// the CPU-clock backend (CreateCpuGpuQueryBackend), which tools/
+// dlss_gpu_timer_check uses to check slot wrap, overflow and readback latency.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+/// Graphics-API side of the GPU timer.
+class GpuQueryBackend
+{
+public:
+    virtual ~GpuQueryBackend() = default;
+
+    /// Timestamp tick rate in Hz.
+    virtual uint64_t GetTimestampFrequency() const = 0;
+
+    /// Record a timestamp into queryIndex on the given command list.
+    virtual void WriteTimestamp(void* commandList, uint32_t queryIndex) = 0;
+
+    /// Copy queryCount timestamps starting at firstQuery into the readback buffer (same offsets).
+    virtual void ResolveTimestamps(void* commandList, uint32_t firstQuery, uint32_t queryCount) = 0;
+
+    /// Read resolved timestamps. Only called once the owning frame's fence has completed.
+    virtual bool ReadTimestamps(uint32_t firstQuery, uint32_t queryCount, uint64_t* outTicks) = 0;
+
+    /// Fence value that will be reached once the work recorded this frame has executed.
+    virtual uint64_t GetFrameFenceValue() = 0;
+
+    /// Last fence value reached by the GPU.
+    virtual uint64_t GetCompletedFenceValue() = 0;
+};
+
+/// Backend that reads the CPU clock instead of GPU timestamps and records into no command list.
+/// Each GetCompletedFenceValue call (one per GpuTimer::EndFrame) submits a frame, whose fence
+/// completes latencyFrames frames later, as on a GPU running that far behind.
+/// Used with the null NGX backend, where evaluates do no GPU work.
+std::unique_ptr<GpuQueryBackend> CreateCpuGpuQueryBackend(uint32_t queryCount, uint32_t latencyFrames);
+
+class GpuTimer
+{
+public:
+    static GpuTimer& Instance();
+
+    GpuTimer() = default;
+
+    // Non-copyable
+    GpuTimer(const GpuTimer&) = delete;
+    GpuTimer& operator=(const GpuTimer&) = delete;
+
+    /// Frames a query slot may stay in flight before its results are dropped.
+    static constexpr uint32_t kFramesInFlight = 4;
+
+    /// Timed evaluates per frame; further evaluates in the same frame are not timed.
+    static constexpr uint32_t kMaxEvaluatesPerFrame = 16;
+
+    /// Timestamp queries the backend must provide.
+    static constexpr uint32_t kQueryCount = kFramesInFlight * kMaxEvaluatesPerFrame * 2;
+
+    /// Samples kept per handle for the rolling statistics.
+    static constexpr uint32_t kHistorySize = 128;
+
+    /// Install a backend (nullptr disables timing). Drops all pending queries and statistics.
+    void SetBackend(std::unique_ptr<GpuQueryBackend> backend);
+
+    /// Write the begin timestamp for an evaluate. commandList is the one from
+    /// GraphicsBackend::BeginCommands (null on backends that record nothing).
+    /// @return Token for EndEvaluate, or -1 if this evaluate is not timed.
+    int BeginEvaluate(void* commandList, int handle, int feature);
+
+    /// Write the end timestamp and resolve the pair. Ignores token -1.
+    void EndEvaluate(void* commandList, int token);
+
+    /// Close the current frame slot and collect every slot whose fence has completed.
+    void EndFrame();
+
+    /// Forget a handle's statistics and any of its queries still in flight.
+    void RemoveHandle(int handle);
+
+    /// Most recent sample of a handle.
+    /// @return false if the handle has no samples yet.
+    bool GetLatestMs(int handle, float* outMs) const;
+
+    /// Copy per-handle statistics into a caller-provided array.
+    /// @return Total number of handles with statistics (may exceed maxCount).
+    int Snapshot(DLSSGpuTiming* outTimings, int maxCount) const;
+
+private:
+    struct FrameSlot
+    {
+        uint64_t fenceValue = 0;
+        uint32_t count = 0;
+        bool submitted = false;
+        int handles[kMaxEvaluatesPerFrame] = {};
+        int features[kMaxEvaluatesPerFrame] = {};
+        uint64_t cpuTicks[kMaxEvaluatesPerFrame] = {};  // CPU time of the evaluate, for trace output
+    };
+
+    struct HandleStats
+    {
+        int feature = 0;
+        uint32_t count = 0;         // Valid samples (<= kHistorySize)
+        uint32_t next = 0;          // Next write position
+        float samples[kHistorySize] = {};
+    };
+
+    void CollectSlot(uint32_t slotIndex);
+    void ResetSlots();
+
+    std::unique_ptr<GpuQueryBackend> m_backend;
+    FrameSlot m_slots[kFramesInFlight];
+    uint32_t m_currentSlot = 0;
+    std::unordered_map<int, HandleStats> m_stats;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace dlss
@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+// DLSSGpuTimerD3D12.cpp - D3D12 timestamp query backend for the GPU timer
+//------------------------------------------------------------------------------
+
+#include <d3d12.h>
+#include <wrl/client.h>
+#include <cstring>
+
+#include "DLSSGpuTimerD3D12.h"
+#include "IUnityGraphicsD3D12.h"
+
+using Microsoft::WRL::ComPtr;
+
+namespace dlss
+{
+
+class D3D12GpuQueryBackend : public GpuQueryBackend
+{
+public:
+    D3D12GpuQueryBackend(IUnityGraphicsD3D12v8* graphics, ComPtr<ID3D12QueryHeap> queryHeap,
+        ComPtr<ID3D12Resource> readback, uint64_t frequency)
+        : m_graphics(graphics)
+        , m_queryHeap(std::move(queryHeap))
+        , m_readback(std::move(readback))
+        , m_frequency(frequency)
+    {
+    }
+
+    uint64_t GetTimestampFrequency() const override
+    {
+        return m_frequency;
+    }
+
+    void WriteTimestamp(void* commandList, uint32_t queryIndex) override
+    {
+        if (!commandList)
+        {
+            return;
+        }
+        static_cast<ID3D12GraphicsCommandList*>(commandList)->EndQuery(
+            m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, queryIndex);
+    }
+
+    void ResolveTimestamps(void* commandList, uint32_t firstQuery, uint32_t queryCount) override
+    {
+        if (!commandList)
+        {
+            return;
+        }
+        static_cast<ID3D12GraphicsCommandList*>(commandList)->ResolveQueryData(
+            m_queryHeap.Get(), D3D12_QUERY_TYPE_TIMESTAMP, firstQuery, queryCount,
+            m_readback.Get(), static_cast<UINT64>(firstQuery) * sizeof(uint64_t));
+    }
+
+    bool ReadTimestamps(uint32_t firstQuery, uint32_t queryCount, uint64_t* outTicks) override
+    {
+        D3D12_RANGE readRange = {};
+        readRange.Begin = static_cast<SIZE_T>(firstQuery) * sizeof(uint64_t);
+        readRange.End = readRange.Begin + static_cast<SIZE_T>(queryCount) * sizeof(uint64_t);
+
+        void* mapped = nullptr;
+        if (FAILED(m_readback->Map(0, &readRange, &mapped)))
+        {
+            return false;
+        }
+
+        std::memcpy(outTicks, static_cast<const uint8_t*>(mapped) + readRange.Begin,
+            static_cast<size_t>(queryCount) * sizeof(uint64_t));
+
+        D3D12_RANGE writeRange = {};
+        m_readback->Unmap(0, &writeRange);
+        return true;
+    }
+
+    uint64_t GetFrameFenceValue() override
+    {
+        return m_graphics->GetNextFrameFenceValue();
+    }
+
+    uint64_t GetCompletedFenceValue() override
+    {
+        ID3D12Fence* fence = m_graphics->GetFrameFence();
+        return fence ? fence->GetCompletedValue() : 0;
+    }
+
+private:
+    IUnityGraphicsD3D12v8* m_graphics;
+    ComPtr<ID3D12QueryHeap> m_queryHeap;
+    ComPtr<ID3D12Resource> m_readback;
+    uint64_t m_frequency;
+};
+
+std::unique_ptr<GpuQueryBackend> CreateD3D12GpuQueryBackend(IUnityGraphicsD3D12v8* graphics, uint32_t queryCount)
+{
+    if (!graphics)
+    {
+        return nullptr;
+    }
+
+    ID3D12Device* device = graphics->GetDevice();
+    ID3D12CommandQueue* queue = graphics->GetCommandQueue();
+    if (!device || !queue)
+    {
+        return nullptr;
+    }
+
+    UINT64 frequency = 0;
+    if (FAILED(queue->GetTimestampFrequency(&frequency)) || frequency == 0)
+    {
+        return nullptr;
+    }
+
+    D3D12_QUERY_HEAP_DESC heapDesc = {};
+    heapDesc.Type = D3D12_QUERY_HEAP_TYPE_TIMESTAMP;
+    heapDesc.Count = queryCount;
+
+    ComPtr<ID3D12QueryHeap> queryHeap;
+    if (FAILED(device->CreateQueryHeap(&heapDesc, IID_PPV_ARGS(&queryHeap))))
+    {
+        return nullptr;
+    }
+
+    D3D12_HEAP_PROPERTIES heapProps = {};
+    heapProps.Type = D3D12_HEAP_TYPE_READBACK;
+
+    D3D12_RESOURCE_DESC bufferDesc = {};
+    bufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+    bufferDesc.Width = static_cast<UINT64>(queryCount) * sizeof(uint64_t);
+    bufferDesc.Height = 1;
+    bufferDesc.DepthOrArraySize = 1;
+    bufferDesc.MipLevels = 1;
+    bufferDesc.SampleDesc.Count = 1;
+    bufferDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+    ComPtr<ID3D12Resource> readback;
+    if (FAILED(device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &bufferDesc,
+            D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&readback))))
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<D3D12GpuQueryBackend>(graphics, std::move(queryHeap), std::move(readback),
+        static_cast<uint64_t>(frequency));
+}
+
+} // namespace dlss
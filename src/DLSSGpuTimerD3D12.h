@@ -0,0 +1,20 @@
+//------------------------------------------------------------------------------
+// DLSSGpuTimerD3D12.h - D3D12 timestamp query backend for the GPU timer
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "DLSSGpuTimer.h"
+
+struct IUnityGraphicsD3D12v8;
+
+namespace dlss
+{
+
+/// Create a timestamp query heap and readback buffer on Unity's D3D12 device.
+/// @return Backend, or nullptr if the device or queue is not available.
+std::unique_ptr<GpuQueryBackend> CreateD3D12GpuQueryBackend(IUnityGraphicsD3D12v8* graphics, uint32_t queryCount);
+
+} // namespace dlss
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackend.cpp - Graphics-API side of the Lite exports
+//------------------------------------------------------------------------------
+
+#include "DLSSGraphicsBackend.h"
+#include "DLSSGraphicsBackendD3D11.h"
+#include "DLSSGraphicsBackendD3D12.h"
+#if DLSS_VULKAN_BACKEND
+#include "DLSSGraphicsBackendVulkan.h"
+#endif
+
+namespace dlss
+{
+
+std::unique_ptr<GpuQueryBackend> GraphicsBackend::CreateGpuQueryBackend(uint32_t queryCount)
+{
+#if DLSS_BACKEND_NULL
+    // Results arrive two frames late, as from a GPU two frames behind the render thread
+    return CreateCpuGpuQueryBackend(queryCount, 2);
+#else
+    (void)queryCount;
+    return nullptr;
+#endif
+}
+
+std::unique_ptr<CalibrationBackend> GraphicsBackend::CreateCalibrationBackend(unsigned int, unsigned int, bool,
+    uint32_t queryCount)
+{
+#if DLSS_BACKEND_NULL
+    return CreateCpuCalibrationBackend(queryCount);
+#else
+    (void)queryCount;
+    return nullptr;
+#endif
+}
+
+bool GraphicsBackend::RecordFallbackCopy(void*, NVSDK_NGX_Parameter*)
+{
+    return false;
+}
+
+std::unique_ptr<GraphicsBackend> CreateGraphicsBackend(UnityGfxRenderer renderer, IUnityInterfaces* interfaces)
+{
+    if (!interfaces)
+    {
+        return nullptr;
+    }
+
+    switch (renderer)
+    {
+    case kUnityGfxRendererD3D11:
+        return CreateD3D11GraphicsBackend(interfaces->Get<IUnityGraphicsD3D11>());
+    case kUnityGfxRendererD3D12:
+        return CreateD3D12GraphicsBackend(interfaces->Get<IUnityGraphicsD3D12v8>());
+#if DLSS_VULKAN_BACKEND
+    case kUnityGfxRendererVulkan:
+        return CreateVulkanGraphicsBackend(interfaces->Get<IUnityGraphicsVulkanV2>());
+#endif
+    default:
+#if DLSS_BACKEND_NULL
+        // The null D3D12 path needs no device, so headless players and CI keep working
+        return CreateD3D12GraphicsBackend(nullptr);
+#else
+        return nullptr;
+#endif
+    }
+}
+
+} // namespace dlss
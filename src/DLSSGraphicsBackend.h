@@ -0,0 +1,101 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackend.h - Graphics-API side of the Lite exports
+//------------------------------------------------------------------------------
+// The Lite exports, the feature handle table and the render event protocol
+// are the same for every graphics API; what differs is the NVSDK_NGX_<API>_*
+// entry point family, the Unity device and command list, and how a Unity
+// texture becomes an NGX resource. GraphicsBackend holds those differences.
+// Plugin.cpp creates the backend for Unity's renderer at
+// kUnityGfxDeviceEventInitialize and drops it at kUnityGfxDeviceEventShutdown;
+// DLSSPluginLite.cpp calls NGX only through it.
+// Internal use only - exposed to C# through DLSS_GetGraphicsApi.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "DLSSBackend.h"
+#include "DLSSCalibration.h"
+#include "DLSSCapabilityCache.h"
+#include "DLSSGpuTimer.h"
+#include "DLSSPluginLite.h"
+#include "IUnityGraphics.h"
+
+namespace dlss
+{
+
+/// NGX entry points called through a backend, for log messages.
+enum class NgxCall
+{
+    Init,
+    Shutdown,
+    AllocateParameters,
+    GetCapabilityParameters,
+    DestroyParameters,
+    CreateFeature,
+    EvaluateFeature,
+    ReleaseFeature,
+    Count
+};
+
+class GraphicsBackend
+{
+public:
+    virtual ~GraphicsBackend() = default;
+
+    /// DLSSGraphicsApi value reported by DLSS_GetGraphicsApi.
+    virtual DLSSGraphicsApi GetApi() const = 0;
+
+    /// SDK name of an entry point, e.g. "NVSDK_NGX_D3D12_CreateFeature".
+    virtual const char* GetCallName(NgxCall call) const = 0;
+
+    /// Check that Unity's device can be handed to NGX.
+    /// @return NVSDK_NGX_Result_Success, or the failure init should report.
+    virtual NVSDK_NGX_Result CheckDevice() const = 0;
+
+    /// Key of the capability cache and calibration table for this device.
+    virtual CapabilityCacheKey MakeCapabilityCacheKey() const = 0;
+
+    virtual NVSDK_NGX_Result Init(const DLSSInitParams& params, const NVSDK_NGX_FeatureCommonInfo* featureInfo) = 0;
+    virtual NVSDK_NGX_Result Shutdown() = 0;
+
+    virtual NVSDK_NGX_Result AllocateParameters(NVSDK_NGX_Parameter** outParameters) = 0;
+    virtual NVSDK_NGX_Result GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters) = 0;
+    virtual NVSDK_NGX_Result DestroyParameters(NVSDK_NGX_Parameter* parameters) = 0;
+
+    /// Bind a Unity native texture (Texture.GetNativeTexturePtr) to a resource parameter.
+    /// Backends whose resources need render-thread work defer it to BeginCommands.
+    virtual void SetTexture(NVSDK_NGX_Parameter* parameters, const char* name, void* nativeTexture) = 0;
+
+    /// Render thread: finish the texture bindings of parameters (may be null) and get
+    /// Unity's current command list (ID3D12GraphicsCommandList*, VkCommandBuffer).
+    /// @return false if Unity has no command list to record into.
+    virtual bool BeginCommands(NVSDK_NGX_Parameter* parameters, void** outCommandList) = 0;
+
+    virtual NVSDK_NGX_Result CreateFeature(void* commandList, NVSDK_NGX_Feature feature,
+        NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle) = 0;
+    virtual NVSDK_NGX_Result EvaluateFeature(void* commandList, const NVSDK_NGX_Handle* handle,
+        const NVSDK_NGX_Parameter* parameters) = 0;
+    virtual NVSDK_NGX_Result ReleaseFeature(NVSDK_NGX_Handle* handle) = 0;
+
+    /// GPU timestamps for DLSS_GetGpuTimings. The default is the CPU-clock backend
+    /// on the null NGX backend and nullptr (no timings) otherwise.
+    virtual std::unique_ptr<GpuQueryBackend> CreateGpuQueryBackend(uint32_t queryCount);
+
+    /// Private queue and synthetic inputs for DLSS_RunCalibration. The default is the
+    /// CPU-clock backend on the null NGX backend and nullptr (unsupported) otherwise.
+    virtual std::unique_ptr<CalibrationBackend> CreateCalibrationBackend(unsigned int width, unsigned int height,
+        bool rayReconstruction, uint32_t queryCount);
+
+    /// Circuit breaker fallback: copy Color into Output when their sizes and formats match.
+    /// @return true if a copy was recorded; the default records nothing.
+    virtual bool RecordFallbackCopy(void* commandList, NVSDK_NGX_Parameter* parameters);
+};
+
+/// Create the backend for Unity's renderer.
+/// @return Backend, or nullptr if DLSS does not support the renderer or Unity lacks its interface.
+std::unique_ptr<GraphicsBackend> CreateGraphicsBackend(UnityGfxRenderer renderer, IUnityInterfaces* interfaces);
+
+} // namespace dlss
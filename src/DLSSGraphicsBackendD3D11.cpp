@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendD3D11.cpp - D3D11 backend of the Lite exports
+//------------------------------------------------------------------------------
+
+#include "DLSSGraphicsBackendD3D11.h"
+#if !DLSS_BACKEND_NULL
+#include <wrl/client.h>
+#include "DLSSCapabilityCacheD3D12.h"
+#endif
+
+namespace dlss
+{
+
+// Indexed by NgxCall
+static const char* const kD3D11CallNames[] = {
+    "NVSDK_NGX_D3D11_Init_with_ProjectID",
+    "NVSDK_NGX_D3D11_Shutdown1",
+    "NVSDK_NGX_D3D11_AllocateParameters",
+    "NVSDK_NGX_D3D11_GetCapabilityParameters",
+    "NVSDK_NGX_D3D11_DestroyParameters",
+    "NVSDK_NGX_D3D11_CreateFeature",
+    "NVSDK_NGX_D3D11_EvaluateFeature",
+    "NVSDK_NGX_D3D11_ReleaseFeature",
+};
+static_assert(sizeof(kD3D11CallNames) / sizeof(kD3D11CallNames[0]) == static_cast<size_t>(NgxCall::Count),
+    "kD3D11CallNames must cover every NgxCall");
+
+class D3D11GraphicsBackend : public GraphicsBackend
+{
+public:
+    explicit D3D11GraphicsBackend(IUnityGraphicsD3D11* graphics)
+        : m_graphics(graphics)
+    {
+#if !DLSS_BACKEND_NULL
+        // The immediate context lives as long as the device, which outlives the backend
+        if (ID3D11Device* device = GetDevice())
+        {
+            device->GetImmediateContext(&m_context);
+        }
+#endif
+    }
+
+    DLSSGraphicsApi GetApi() const override
+    {
+        return DLSS_GraphicsApi_D3D11;
+    }
+
+    const char* GetCallName(NgxCall call) const override
+    {
+        return kD3D11CallNames[static_cast<size_t>(call)];
+    }
+
+    NVSDK_NGX_Result CheckDevice() const override
+    {
+#if DLSS_BACKEND_NULL
+        return NVSDK_NGX_Result_Success;
+#else
+        return GetDevice() && m_context.Get() ? NVSDK_NGX_Result_Success : NVSDK_NGX_Result_FAIL_PlatformError;
+#endif
+    }
+
+    CapabilityCacheKey MakeCapabilityCacheKey() const override
+    {
+#if DLSS_BACKEND_NULL
+        return {};
+#else
+        return MakeD3D11CapabilityCacheKey(GetDevice());
+#endif
+    }
+
+    NVSDK_NGX_Result Init(const DLSSInitParams& params, const NVSDK_NGX_FeatureCommonInfo* featureInfo) override
+    {
+        return NVSDK_NGX_D3D11_Init_with_ProjectID(
+            params.projectId,
+            static_cast<NVSDK_NGX_EngineType>(params.engineType),
+            params.engineVersion,
+            params.applicationDataPath,
+            GetDevice(),
+            featureInfo,
+            NVSDK_NGX_Version_API);
+    }
+
+    NVSDK_NGX_Result Shutdown() override
+    {
+        return NVSDK_NGX_D3D11_Shutdown1(GetDevice());
+    }
+
+    NVSDK_NGX_Result AllocateParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_D3D11_AllocateParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_D3D11_GetCapabilityParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result DestroyParameters(NVSDK_NGX_Parameter* parameters) override
+    {
+        return NVSDK_NGX_D3D11_DestroyParameters(parameters);
+    }
+
+    void SetTexture(NVSDK_NGX_Parameter* parameters, const char* name, void* nativeTexture) override
+    {
+        // On D3D11, Texture.GetNativeTexturePtr is the ID3D11Texture2D*, an ID3D11Resource
+        NVSDK_NGX_Parameter_SetD3d11Resource(parameters, name, static_cast<ID3D11Resource*>(nativeTexture));
+    }
+
+    bool BeginCommands(NVSDK_NGX_Parameter*, void** outCommandList) override
+    {
+#if DLSS_BACKEND_NULL
+        // The null backend records nothing, so it needs no context
+        *outCommandList = nullptr;
+        return true;
+#else
+        *outCommandList = m_context.Get();
+        return *outCommandList != nullptr;
+#endif
+    }
+
+    NVSDK_NGX_Result CreateFeature(void* commandList, NVSDK_NGX_Feature feature,
+        NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle) override
+    {
+        return NVSDK_NGX_D3D11_CreateFeature(static_cast<ID3D11DeviceContext*>(commandList), feature,
+            parameters, outHandle);
+    }
+
+    NVSDK_NGX_Result EvaluateFeature(void* commandList, const NVSDK_NGX_Handle* handle,
+        const NVSDK_NGX_Parameter* parameters) override
+    {
+        return NVSDK_NGX_D3D11_EvaluateFeature(static_cast<ID3D11DeviceContext*>(commandList), handle,
+            parameters, nullptr);
+    }
+
+    NVSDK_NGX_Result ReleaseFeature(NVSDK_NGX_Handle* handle) override
+    {
+        return NVSDK_NGX_D3D11_ReleaseFeature(handle);
+    }
+
+private:
+    ID3D11Device* GetDevice() const
+    {
+        return m_graphics ? m_graphics->GetDevice() : nullptr;
+    }
+
+    IUnityGraphicsD3D11* m_graphics;
+#if !DLSS_BACKEND_NULL
+    Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_context;
+#endif
+};
+
+std::unique_ptr<GraphicsBackend> CreateD3D11GraphicsBackend(IUnityGraphicsD3D11* graphics)
+{
+#if !DLSS_BACKEND_NULL
+    if (!graphics)
+    {
+        return nullptr;
+    }
+#endif
+    return std::make_unique<D3D11GraphicsBackend>(graphics);
+}
+
+} // namespace dlss
@@ -0,0 +1,22 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendD3D11.h - D3D11 backend of the Lite exports
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "DLSSGraphicsBackend.h"
+#include "IUnityGraphicsD3D11.h"
+
+namespace dlss
+{
+
+/// Backend for Unity's D3D11 renderer (NVSDK_NGX_D3D11_*). Textures are bound
+/// as ID3D11Resource* right away; NGX records into the device's immediate context,
+/// which Unity's render thread owns while it runs a plugin event.
+/// On the null NGX backend graphics may be null: the device and context are never used.
+/// @return Backend, or nullptr if graphics is null on a real NGX build.
+std::unique_ptr<GraphicsBackend> CreateD3D11GraphicsBackend(IUnityGraphicsD3D11* graphics);
+
+} // namespace dlss
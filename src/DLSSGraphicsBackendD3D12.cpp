@@ -0,0 +1,184 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendD3D12.cpp - D3D12 backend of the Lite exports
+//------------------------------------------------------------------------------
+
+#include "DLSSGraphicsBackendD3D12.h"
+#if !DLSS_BACKEND_NULL
+#include "DLSSCalibrationD3D12.h"
+#include "DLSSCapabilityCacheD3D12.h"
+#include "DLSSFallbackD3D12.h"
+#include "DLSSGpuTimerD3D12.h"
+#endif
+
+namespace dlss
+{
+
+// Indexed by NgxCall
+static const char* const kD3D12CallNames[] = {
+    "NVSDK_NGX_D3D12_Init_with_ProjectID",
+    "NVSDK_NGX_D3D12_Shutdown1",
+    "NVSDK_NGX_D3D12_AllocateParameters",
+    "NVSDK_NGX_D3D12_GetCapabilityParameters",
+    "NVSDK_NGX_D3D12_DestroyParameters",
+    "NVSDK_NGX_D3D12_CreateFeature",
+    "NVSDK_NGX_D3D12_EvaluateFeature",
+    "NVSDK_NGX_D3D12_ReleaseFeature",
+};
+static_assert(sizeof(kD3D12CallNames) / sizeof(kD3D12CallNames[0]) == static_cast<size_t>(NgxCall::Count),
+    "kD3D12CallNames must cover every NgxCall");
+
+class D3D12GraphicsBackend : public GraphicsBackend
+{
+public:
+    explicit D3D12GraphicsBackend(IUnityGraphicsD3D12v8* graphics)
+        : m_graphics(graphics)
+    {
+    }
+
+    DLSSGraphicsApi GetApi() const override
+    {
+        return DLSS_GraphicsApi_D3D12;
+    }
+
+    const char* GetCallName(NgxCall call) const override
+    {
+        return kD3D12CallNames[static_cast<size_t>(call)];
+    }
+
+    NVSDK_NGX_Result CheckDevice() const override
+    {
+        return GetDevice() || DLSS_BACKEND_NULL ? NVSDK_NGX_Result_Success : NVSDK_NGX_Result_FAIL_PlatformError;
+    }
+
+    CapabilityCacheKey MakeCapabilityCacheKey() const override
+    {
+#if DLSS_BACKEND_NULL
+        return {};
+#else
+        return MakeD3D12CapabilityCacheKey(GetDevice());
+#endif
+    }
+
+    NVSDK_NGX_Result Init(const DLSSInitParams& params, const NVSDK_NGX_FeatureCommonInfo* featureInfo) override
+    {
+        return NVSDK_NGX_D3D12_Init_with_ProjectID(
+            params.projectId,
+            static_cast<NVSDK_NGX_EngineType>(params.engineType),
+            params.engineVersion,
+            params.applicationDataPath,
+            GetDevice(),
+            featureInfo,
+            NVSDK_NGX_Version_API);
+    }
+
+    NVSDK_NGX_Result Shutdown() override
+    {
+        return NVSDK_NGX_D3D12_Shutdown1(GetDevice());
+    }
+
+    NVSDK_NGX_Result AllocateParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_D3D12_AllocateParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_D3D12_GetCapabilityParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result DestroyParameters(NVSDK_NGX_Parameter* parameters) override
+    {
+        return NVSDK_NGX_D3D12_DestroyParameters(parameters);
+    }
+
+    void SetTexture(NVSDK_NGX_Parameter* parameters, const char* name, void* nativeTexture) override
+    {
+        // On D3D12, Texture.GetNativeTexturePtr is the ID3D12Resource*
+        NVSDK_NGX_Parameter_SetD3d12Resource(parameters, name, static_cast<ID3D12Resource*>(nativeTexture));
+    }
+
+    bool BeginCommands(NVSDK_NGX_Parameter*, void** outCommandList) override
+    {
+        *outCommandList = nullptr;
+#if !DLSS_BACKEND_NULL
+        // The null backend records nothing, so it needs no command list
+        UnityGraphicsD3D12RecordingState recordingState = {};
+        if (!m_graphics->CommandRecordingState(&recordingState) || !recordingState.commandList)
+        {
+            return false;
+        }
+        *outCommandList = recordingState.commandList;
+#endif
+        return true;
+    }
+
+    NVSDK_NGX_Result CreateFeature(void* commandList, NVSDK_NGX_Feature feature,
+        NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle) override
+    {
+        return NVSDK_NGX_D3D12_CreateFeature(static_cast<ID3D12GraphicsCommandList*>(commandList), feature,
+            parameters, outHandle);
+    }
+
+    NVSDK_NGX_Result EvaluateFeature(void* commandList, const NVSDK_NGX_Handle* handle,
+        const NVSDK_NGX_Parameter* parameters) override
+    {
+        return NVSDK_NGX_D3D12_EvaluateFeature(static_cast<ID3D12GraphicsCommandList*>(commandList), handle,
+            parameters, nullptr);
+    }
+
+    NVSDK_NGX_Result ReleaseFeature(NVSDK_NGX_Handle* handle) override
+    {
+        return NVSDK_NGX_D3D12_ReleaseFeature(handle);
+    }
+
+#if !DLSS_BACKEND_NULL
+    std::unique_ptr<GpuQueryBackend> CreateGpuQueryBackend(uint32_t queryCount) override
+    {
+        return CreateD3D12GpuQueryBackend(m_graphics, queryCount);
+    }
+
+    std::unique_ptr<CalibrationBackend> CreateCalibrationBackend(unsigned int width, unsigned int height,
+        bool rayReconstruction, uint32_t queryCount) override
+    {
+        return CreateD3D12CalibrationBackend(GetDevice(), width, height, rayReconstruction, queryCount);
+    }
+
+    bool RecordFallbackCopy(void* commandList, NVSDK_NGX_Parameter* parameters) override
+    {
+        ID3D12Resource* color = nullptr;
+        ID3D12Resource* output = nullptr;
+        unsigned int renderWidth = 0;
+        unsigned int renderHeight = 0;
+        if (parameters)
+        {
+            NVSDK_NGX_Parameter_GetD3d12Resource(parameters, NVSDK_NGX_Parameter_Color, &color);
+            NVSDK_NGX_Parameter_GetD3d12Resource(parameters, NVSDK_NGX_Parameter_Output, &output);
+            NVSDK_NGX_Parameter_GetUI(parameters, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &renderWidth);
+            NVSDK_NGX_Parameter_GetUI(parameters, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, &renderHeight);
+        }
+        return dlss::RecordFallbackCopy(static_cast<ID3D12GraphicsCommandList*>(commandList), color, output,
+            renderWidth, renderHeight);
+    }
+#endif
+
+private:
+    ID3D12Device* GetDevice() const
+    {
+        return m_graphics ? m_graphics->GetDevice() : nullptr;
+    }
+
+    IUnityGraphicsD3D12v8* m_graphics;
+};
+
+std::unique_ptr<GraphicsBackend> CreateD3D12GraphicsBackend(IUnityGraphicsD3D12v8* graphics)
+{
+#if !DLSS_BACKEND_NULL
+    if (!graphics)
+    {
+        return nullptr;
+    }
+#endif
+    return std::make_unique<D3D12GraphicsBackend>(graphics);
+}
+
+} // namespace dlss
@@ -0,0 +1,21 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendD3D12.h - D3D12 backend of the Lite exports
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "DLSSGraphicsBackend.h"
+#include "IUnityGraphicsD3D12.h"
+
+namespace dlss
+{
+
+/// Backend for Unity's D3D12 renderer (NVSDK_NGX_D3D12_*). Textures are bound
+/// as ID3D12Resource* right away; the command list is Unity's current one.
+/// On the null NGX backend graphics may be null: the device and command list are never used.
+/// @return Backend, or nullptr if graphics is null on a real NGX build.
+std::unique_ptr<GraphicsBackend> CreateD3D12GraphicsBackend(IUnityGraphicsD3D12v8* graphics);
+
+} // namespace dlss
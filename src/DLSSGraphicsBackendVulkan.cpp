@@ -0,0 +1,506 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendVulkan.cpp - Vulkan backend of the Lite exports
+//------------------------------------------------------------------------------
+
+#include "DLSSGraphicsBackendVulkan.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dlss
+{
+
+//------------------------------------------------------------------------------
+// Initialization intercept
+//------------------------------------------------------------------------------
+
+static PFN_vkGetInstanceProcAddr g_loaderGetInstanceProcAddr = nullptr;
+static VkInstance g_interceptedInstance = VK_NULL_HANDLE;
+
+template <typename Enumerate>
+static std::vector<VkExtensionProperties> EnumerateExtensions(Enumerate enumerate)
+{
+    uint32_t count = 0;
+    if (enumerate(&count, nullptr) != VK_SUCCESS)
+    {
+        return {};
+    }
+    std::vector<VkExtensionProperties> properties(count);
+    if (enumerate(&count, properties.data()) < 0)
+    {
+        return {};
+    }
+    properties.resize(count);
+    return properties;
+}
+
+// Enabled extensions plus the required ones that are available and not enabled yet.
+// Unavailable ones are left out: NGX init then fails with a result C# can report,
+// instead of Unity failing to create the device.
+static std::vector<const char*> AppendExtensions(uint32_t enabledCount, const char* const* enabled,
+    unsigned int requiredCount, const char* const* required, const std::vector<VkExtensionProperties>& available)
+{
+    std::vector<const char*> extensions(enabled, enabled + enabledCount);
+    for (unsigned int i = 0; i < requiredCount; ++i)
+    {
+        auto matches = [&](const char* name) { return std::strcmp(name, required[i]) == 0; };
+        const bool isAvailable = std::any_of(available.begin(), available.end(),
+            [&](const VkExtensionProperties& properties) { return matches(properties.extensionName); });
+        if (isAvailable && std::none_of(extensions.begin(), extensions.end(), matches))
+        {
+            extensions.push_back(required[i]);
+        }
+    }
+    return extensions;
+}
+
+static VkResult VKAPI_CALL InterceptCreateInstance(const VkInstanceCreateInfo* createInfo,
+    const VkAllocationCallbacks* allocator, VkInstance* outInstance)
+{
+    auto createInstance = reinterpret_cast<PFN_vkCreateInstance>(
+        g_loaderGetInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+    auto enumerateExtensions = reinterpret_cast<PFN_vkEnumerateInstanceExtensionProperties>(
+        g_loaderGetInstanceProcAddr(VK_NULL_HANDLE, "vkEnumerateInstanceExtensionProperties"));
+    if (!createInstance)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    unsigned int instanceExtensionCount = 0;
+    const char** instanceExtensions = nullptr;
+    unsigned int deviceExtensionCount = 0;
+    const char** deviceExtensions = nullptr;
+
+    VkInstanceCreateInfo info = *createInfo;
+    std::vector<const char*> extensions;
+    if (enumerateExtensions && NVSDK_NGX_SUCCEED(NVSDK_NGX_VULKAN_RequiredExtensions(
+            &instanceExtensionCount, &instanceExtensions, &deviceExtensionCount, &deviceExtensions)))
+    {
+        extensions = AppendExtensions(info.enabledExtensionCount, info.ppEnabledExtensionNames,
+            instanceExtensionCount, instanceExtensions,
+            EnumerateExtensions([&](uint32_t* count, VkExtensionProperties* properties) {
+                return enumerateExtensions(nullptr, count, properties);
+            }));
+        info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+        info.ppEnabledExtensionNames = extensions.data();
+    }
+
+    const VkResult result = createInstance(&info, allocator, outInstance);
+    if (result == VK_SUCCESS)
+    {
+        g_interceptedInstance = *outInstance;
+    }
+    return result;
+}
+
+static VkResult VKAPI_CALL InterceptCreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* createInfo,
+    const VkAllocationCallbacks* allocator, VkDevice* outDevice)
+{
+    auto createDevice = reinterpret_cast<PFN_vkCreateDevice>(
+        g_loaderGetInstanceProcAddr(g_interceptedInstance, "vkCreateDevice"));
+    auto enumerateExtensions = reinterpret_cast<PFN_vkEnumerateDeviceExtensionProperties>(
+        g_loaderGetInstanceProcAddr(g_interceptedInstance, "vkEnumerateDeviceExtensionProperties"));
+    if (!createDevice)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    unsigned int instanceExtensionCount = 0;
+    const char** instanceExtensions = nullptr;
+    unsigned int deviceExtensionCount = 0;
+    const char** deviceExtensions = nullptr;
+
+    VkDeviceCreateInfo info = *createInfo;
+    std::vector<const char*> extensions;
+    if (enumerateExtensions && NVSDK_NGX_SUCCEED(NVSDK_NGX_VULKAN_RequiredExtensions(
+            &instanceExtensionCount, &instanceExtensions, &deviceExtensionCount, &deviceExtensions)))
+    {
+        extensions = AppendExtensions(info.enabledExtensionCount, info.ppEnabledExtensionNames,
+            deviceExtensionCount, deviceExtensions,
+            EnumerateExtensions([&](uint32_t* count, VkExtensionProperties* properties) {
+                return enumerateExtensions(physicalDevice, nullptr, count, properties);
+            }));
+        info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+        info.ppEnabledExtensionNames = extensions.data();
+    }
+    return createDevice(physicalDevice, &info, allocator, outDevice);
+}
+
+static PFN_vkVoidFunction VKAPI_CALL InterceptGetInstanceProcAddr(VkInstance instance, const char* name)
+{
+    if (std::strcmp(name, "vkCreateInstance") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&InterceptCreateInstance);
+    }
+    if (std::strcmp(name, "vkCreateDevice") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&InterceptCreateDevice);
+    }
+    return g_loaderGetInstanceProcAddr(instance, name);
+}
+
+static PFN_vkGetInstanceProcAddr UNITY_INTERFACE_API OnVulkanInitialization(
+    PFN_vkGetInstanceProcAddr getInstanceProcAddr, void*)
+{
+    g_loaderGetInstanceProcAddr = getInstanceProcAddr;
+    return &InterceptGetInstanceProcAddr;
+}
+
+bool InterceptVulkanInitialization(IUnityGraphicsVulkanV2* graphics)
+{
+    return graphics && graphics->AddInterceptInitialization(&OnVulkanInitialization, nullptr, 0);
+}
+
+//------------------------------------------------------------------------------
+// VulkanGraphicsBackend
+//------------------------------------------------------------------------------
+
+// Indexed by NgxCall
+static const char* const kVulkanCallNames[] = {
+    "NVSDK_NGX_VULKAN_Init_with_ProjectID",
+    "NVSDK_NGX_VULKAN_Shutdown1",
+    "NVSDK_NGX_VULKAN_AllocateParameters",
+    "NVSDK_NGX_VULKAN_GetCapabilityParameters",
+    "NVSDK_NGX_VULKAN_DestroyParameters",
+    "NVSDK_NGX_VULKAN_CreateFeature1",
+    "NVSDK_NGX_VULKAN_EvaluateFeature",
+    "NVSDK_NGX_VULKAN_ReleaseFeature",
+};
+static_assert(sizeof(kVulkanCallNames) / sizeof(kVulkanCallNames[0]) == static_cast<size_t>(NgxCall::Count),
+    "kVulkanCallNames must cover every NgxCall");
+
+class VulkanGraphicsBackend : public GraphicsBackend
+{
+public:
+    explicit VulkanGraphicsBackend(IUnityGraphicsVulkanV2* graphics)
+        : m_graphics(graphics)
+        , m_instance(graphics->Instance())
+    {
+        // NGX records compute work, which Vulkan does not allow inside a render pass
+        UnityVulkanPluginEventConfig config = {};
+        config.renderPassPrecondition = kUnityVulkanRenderPass_EnsureOutside;
+        config.graphicsQueueAccess = kUnityVulkanGraphicsQueueAccess_DontCare;
+        config.flags = kUnityVulkanEventConfigFlag_EnsurePreviousFrameSubmission |
+            kUnityVulkanEventConfigFlag_ModifiesCommandBuffersState;
+        for (int eventId = DLSS_Event_CreateFeature; eventId <= DLSS_Event_EvaluateFeatureBound; ++eventId)
+        {
+            m_graphics->ConfigureEvent(eventId, &config);
+        }
+
+        if (m_instance.getInstanceProcAddr && m_instance.instance)
+        {
+            m_getDeviceProcAddr = reinterpret_cast<PFN_vkGetDeviceProcAddr>(
+                m_instance.getInstanceProcAddr(m_instance.instance, "vkGetDeviceProcAddr"));
+        }
+        if (m_getDeviceProcAddr && m_instance.device)
+        {
+            m_createImageView = reinterpret_cast<PFN_vkCreateImageView>(
+                m_getDeviceProcAddr(m_instance.device, "vkCreateImageView"));
+            m_destroyImageView = reinterpret_cast<PFN_vkDestroyImageView>(
+                m_getDeviceProcAddr(m_instance.device, "vkDestroyImageView"));
+        }
+    }
+
+    ~VulkanGraphicsBackend() override
+    {
+        // Unity idles the device before kUnityGfxDeviceEventShutdown, so no view is in flight
+        for (const auto& pair : m_imageViews)
+        {
+            m_destroyImageView(m_instance.device, pair.second.view, nullptr);
+        }
+    }
+
+    // Non-copyable
+    VulkanGraphicsBackend(const VulkanGraphicsBackend&) = delete;
+    VulkanGraphicsBackend& operator=(const VulkanGraphicsBackend&) = delete;
+
+    DLSSGraphicsApi GetApi() const override
+    {
+        return DLSS_GraphicsApi_Vulkan;
+    }
+
+    const char* GetCallName(NgxCall call) const override
+    {
+        return kVulkanCallNames[static_cast<size_t>(call)];
+    }
+
+    NVSDK_NGX_Result CheckDevice() const override
+    {
+        const bool valid = m_instance.instance && m_instance.physicalDevice && m_instance.device &&
+            m_createImageView && m_destroyImageView;
+        return valid ? NVSDK_NGX_Result_Success : NVSDK_NGX_Result_FAIL_PlatformError;
+    }
+
+    CapabilityCacheKey MakeCapabilityCacheKey() const override
+    {
+        CapabilityCacheKey key;
+#if !DLSS_BACKEND_NULL
+        auto getProperties = m_instance.getInstanceProcAddr ? reinterpret_cast<PFN_vkGetPhysicalDeviceProperties>(
+            m_instance.getInstanceProcAddr(m_instance.instance, "vkGetPhysicalDeviceProperties")) : nullptr;
+        if (getProperties && m_instance.physicalDevice)
+        {
+            VkPhysicalDeviceProperties properties = {};
+            getProperties(m_instance.physicalDevice, &properties);
+
+            // Vulkan 1.0 has no adapter LUID; vendor and device ID tell the GPUs apart.
+            // Snippet versions stay 0, the background revalidation catches DLSS updates.
+            key.adapterLuid = (static_cast<uint64_t>(properties.vendorID) << 32) | properties.deviceID;
+            key.driverVersion = properties.driverVersion;
+        }
+#endif
+        return key;
+    }
+
+    NVSDK_NGX_Result Init(const DLSSInitParams& params, const NVSDK_NGX_FeatureCommonInfo* featureInfo) override
+    {
+        return NVSDK_NGX_VULKAN_Init_with_ProjectID(
+            params.projectId,
+            static_cast<NVSDK_NGX_EngineType>(params.engineType),
+            params.engineVersion,
+            params.applicationDataPath,
+            m_instance.instance,
+            m_instance.physicalDevice,
+            m_instance.device,
+            m_instance.getInstanceProcAddr,
+            m_getDeviceProcAddr,
+            featureInfo,
+            NVSDK_NGX_Version_API);
+    }
+
+    NVSDK_NGX_Result Shutdown() override
+    {
+        return NVSDK_NGX_VULKAN_Shutdown1(m_instance.device);
+    }
+
+    NVSDK_NGX_Result AllocateParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_VULKAN_AllocateParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters) override
+    {
+        return NVSDK_NGX_VULKAN_GetCapabilityParameters(outParameters);
+    }
+
+    NVSDK_NGX_Result DestroyParameters(NVSDK_NGX_Parameter* parameters) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_bindings.erase(parameters);
+        }
+        return NVSDK_NGX_VULKAN_DestroyParameters(parameters);
+    }
+
+    void SetTexture(NVSDK_NGX_Parameter* parameters, const char* name, void* nativeTexture) override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& bindings = m_bindings[parameters];
+        if (!nativeTexture)
+        {
+            bindings.erase(name);
+            NVSDK_NGX_Parameter_SetVoidPointer(parameters, name, nullptr);
+            return;
+        }
+
+        // The descriptor lives in the map node, which stays put until the binding is erased;
+        // BeginCommands fills it on the render thread
+        TextureBinding& binding = bindings[name];
+        binding.nativeTexture = nativeTexture;
+        NVSDK_NGX_Parameter_SetVoidPointer(parameters, name, &binding.resource);
+    }
+
+    bool BeginCommands(NVSDK_NGX_Parameter* parameters, void** outCommandList) override
+    {
+        *outCommandList = nullptr;
+        UnityVulkanRecordingState recordingState = {};
+        if (!m_graphics->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+        {
+            return false;
+        }
+        ReleaseImageViews(recordingState.safeFrameNumber);
+
+        if (parameters)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_bindings.find(parameters);
+            if (it != m_bindings.end() && !it->second.empty())
+            {
+                for (auto& pair : it->second)
+                {
+                    ResolveTexture(pair.first, pair.second, recordingState.currentFrameNumber);
+                }
+
+                // Resource access records barriers, which invalidates the recording state
+                if (!m_graphics->CommandRecordingState(&recordingState, kUnityVulkanGraphicsQueueAccess_DontCare))
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (!recordingState.commandBuffer)
+        {
+            return false;
+        }
+        *outCommandList = recordingState.commandBuffer;
+        return true;
+    }
+
+    NVSDK_NGX_Result CreateFeature(void* commandList, NVSDK_NGX_Feature feature,
+        NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle) override
+    {
+        return NVSDK_NGX_VULKAN_CreateFeature1(m_instance.device, static_cast<VkCommandBuffer>(commandList), feature,
+            parameters, outHandle);
+    }
+
+    NVSDK_NGX_Result EvaluateFeature(void* commandList, const NVSDK_NGX_Handle* handle,
+        const NVSDK_NGX_Parameter* parameters) override
+    {
+        return NVSDK_NGX_VULKAN_EvaluateFeature(static_cast<VkCommandBuffer>(commandList), handle, parameters, nullptr);
+    }
+
+    NVSDK_NGX_Result ReleaseFeature(NVSDK_NGX_Handle* handle) override
+    {
+        return NVSDK_NGX_VULKAN_ReleaseFeature(handle);
+    }
+
+    std::unique_ptr<CalibrationBackend> CreateCalibrationBackend(unsigned int, unsigned int, bool, uint32_t) override
+    {
+        // Calibration binds its synthetic inputs as D3D12 resources; not available on Vulkan yet
+        return nullptr;
+    }
+
+private:
+    struct TextureBinding
+    {
+        void* nativeTexture = nullptr;          // Texture.GetNativeTexturePtr
+        NVSDK_NGX_Resource_VK resource = {};    // What the NGX parameter points at
+    };
+
+    struct ImageViewKey
+    {
+        VkImage image;
+        VkFormat format;
+        VkImageAspectFlags aspect;
+
+        auto operator<=>(const ImageViewKey&) const = default;
+    };
+
+    struct CachedImageView
+    {
+        VkImageView view;
+        unsigned long long lastUsedFrame;       // UnityVulkanRecordingState::currentFrameNumber
+    };
+
+    // Render thread, m_mutex held
+    void ResolveTexture(const std::string& name, TextureBinding& binding, unsigned long long frameNumber)
+    {
+        // NGX writes Output from compute shaders and only reads the other inputs
+        const bool readWrite = name == NVSDK_NGX_Parameter_Output;
+
+        binding.resource = {};
+        UnityVulkanImage image = {};
+        if (!m_graphics->AccessTexture(binding.nativeTexture, UnityVulkanWholeImage,
+                readWrite ? VK_IMAGE_LAYOUT_GENERAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+                readWrite ? VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT : VK_ACCESS_SHADER_READ_BIT,
+                kUnityVulkanResourceAccess_PipelineBarrier, &image) ||
+            !image.image)
+        {
+            // An empty descriptor: NGX rejects the call with an invalid parameter result
+            return;
+        }
+
+        const VkImageAspectFlags aspect = (image.aspect & VK_IMAGE_ASPECT_DEPTH_BIT) ?
+            VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+        const VkImageView view = GetImageView(image.image, image.format, aspect, frameNumber);
+        if (!view)
+        {
+            return;
+        }
+
+        NVSDK_NGX_ImageViewInfo_VK& info = binding.resource.Resource.ImageViewInfo;
+        info.ImageView = view;
+        info.Image = image.image;
+        info.SubresourceRange = {aspect, 0, 1, 0, 1};
+        info.Format = image.format;
+        info.Width = image.extent.width;
+        info.Height = image.extent.height;
+        binding.resource.Type = NVSDK_NGX_RESOURCE_VK_TYPE_VK_IMAGEVIEW;
+        binding.resource.ReadWrite = readWrite;
+    }
+
+    // Render thread
+    VkImageView GetImageView(VkImage image, VkFormat format, VkImageAspectFlags aspect, unsigned long long frameNumber)
+    {
+        if (!m_createImageView || !m_destroyImageView)
+        {
+            return VK_NULL_HANDLE;
+        }
+
+        const ImageViewKey key = {image, format, aspect};
+        auto it = m_imageViews.find(key);
+        if (it == m_imageViews.end())
+        {
+            VkImageViewCreateInfo createInfo = {};
+            createInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+            createInfo.image = image;
+            createInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            createInfo.format = format;
+            createInfo.subresourceRange = {aspect, 0, 1, 0, 1};
+
+            VkImageView view = VK_NULL_HANDLE;
+            if (m_createImageView(m_instance.device, &createInfo, nullptr, &view) != VK_SUCCESS)
+            {
+                return VK_NULL_HANDLE;
+            }
+            it = m_imageViews.emplace(key, CachedImageView{view, frameNumber}).first;
+        }
+        it->second.lastUsedFrame = frameNumber;
+        return it->second.view;
+    }
+
+    // Render thread: destroy the views no submitted frame still uses
+    void ReleaseImageViews(unsigned long long safeFrameNumber)
+    {
+        for (auto it = m_imageViews.begin(); it != m_imageViews.end();)
+        {
+            if (it->second.lastUsedFrame <= safeFrameNumber)
+            {
+                m_destroyImageView(m_instance.device, it->second.view, nullptr);
+                it = m_imageViews.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    IUnityGraphicsVulkanV2* m_graphics;
+    UnityVulkanInstance m_instance;                 // Fixed between device initialize and shutdown
+    PFN_vkGetDeviceProcAddr m_getDeviceProcAddr = nullptr;
+    PFN_vkCreateImageView m_createImageView = nullptr;
+    PFN_vkDestroyImageView m_destroyImageView = nullptr;
+
+    std::unordered_map<NVSDK_NGX_Parameter*, std::map<std::string, TextureBinding>> m_bindings;
+    std::mutex m_mutex;                             // Guards m_bindings
+
+    std::map<ImageViewKey, CachedImageView> m_imageViews;   // Render thread only
+};
+
+std::unique_ptr<GraphicsBackend> CreateVulkanGraphicsBackend(IUnityGraphicsVulkanV2* graphics)
+{
+    if (!graphics)
+    {
+        return nullptr;
+    }
+    return std::make_unique<VulkanGraphicsBackend>(graphics);
+}
+
+} // namespace dlss
@@ -0,0 +1,36 @@
+//------------------------------------------------------------------------------
+// DLSSGraphicsBackendVulkan.h - Vulkan backend of the Lite exports
+//------------------------------------------------------------------------------
+// NGX on Vulkan needs instance and device extensions that Unity does not
+// enable, so the plugin hooks Vulkan initialization when it is loaded as a
+// preload plugin (InterceptVulkanInitialization) and appends them.
+//
+// NGX takes NVSDK_NGX_Resource_VK descriptors (image view, image, format,
+// size) instead of API objects. SetTexture only records the Unity native
+// texture and points the parameter at a descriptor owned by the backend; the
+// render thread fills the descriptor in BeginCommands, where AccessTexture
+// transitions the image for compute and the backend creates the image view.
+// Views are cached per image and destroyed once Unity reports the last frame
+// that used them complete.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "DLSSGraphicsBackend.h"
+#include "IUnityGraphicsVulkan.h"
+
+namespace dlss
+{
+
+/// Backend for Unity's Vulkan renderer (NVSDK_NGX_VULKAN_*).
+/// @return Backend, or nullptr if graphics is null.
+std::unique_ptr<GraphicsBackend> CreateVulkanGraphicsBackend(IUnityGraphicsVulkanV2* graphics);
+
+/// Preload only (before kUnityGfxDeviceEventInitialize): make Unity create its
+/// Vulkan instance and device with the extensions NGX requires, where available.
+/// @return false if graphics is null or Unity rejected the hook (called too late).
+bool InterceptVulkanInitialization(IUnityGraphicsVulkanV2* graphics);
+
+} // namespace dlss
@@ -0,0 +1,509 @@
+//------------------------------------------------------------------------------
+// DLSSImageMetrics.cpp - Image-quality metrics between an output and ground truth
+//------------------------------------------------------------------------------
+
+#include "DLSSImageMetrics.h"
+#include "DLSSMetricKernels.h"
+#include "DLSSThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace dlss
+{
+
+namespace
+{
+
+constexpr uint32_t kBandHeight = 32;
+constexpr uint32_t kSsimRadius = 3;                 // 7x7 windows
+constexpr float kSsimK1 = 0.01f;
+constexpr float kSsimK2 = 0.03f;
+constexpr float kPi = 3.14159265358979f;
+
+// FLIP (LDR) constants from the paper
+constexpr float kFlipQc = 0.7f;                     // Colour error exponent
+constexpr float kFlipPc = 0.4f;                     // Colour error compression knee...
+constexpr float kFlipPt = 0.95f;                    // ...and the value it maps to
+constexpr float kFlipQf = 0.5f;                     // Feature error exponent
+constexpr float kFlipFeatureWidth = 0.082f;         // Feature detector width in degrees
+
+// Linear sRGB <-> CIE XYZ (D65)
+constexpr float kRgbToXyz[3][3] = {
+    {0.4124564f, 0.3575761f, 0.1804375f},
+    {0.2126729f, 0.7151522f, 0.0721750f},
+    {0.0193339f, 0.1191920f, 0.9503041f},
+};
+constexpr float kXyzToRgb[3][3] = {
+    {3.2404542f, -1.5371385f, -0.4985314f},
+    {-0.9692660f, 1.8760108f, 0.0415560f},
+    {0.0556434f, -0.2040259f, 1.0572252f},
+};
+constexpr float kWhiteX = 0.9504700f;               // XYZ of linear RGB (1, 1, 1)
+constexpr float kWhiteY = 1.0000000f;
+constexpr float kWhiteZ = 1.0888300f;
+
+struct BandSums
+{
+    double squaredError[4] = {};
+    double ssim = 0.0;
+    uint64_t ssimWindows = 0;
+    double flip = 0.0;
+};
+
+//------------------------------------------------------------------------------
+// FLIP filters
+//------------------------------------------------------------------------------
+
+struct Kernel1D
+{
+    std::vector<float> weights;
+    uint32_t radius = 0;
+};
+
+// exp(-pi^2 x^2 / b) over x in degrees, the 1D factor of a CSF Gaussian; normalized to sum 1
+Kernel1D MakeCsfKernel(float b, float pixelsPerDegree, float* outUnnormalizedSum)
+{
+    Kernel1D kernel;
+    kernel.radius = static_cast<uint32_t>(std::ceil(3.0f * std::sqrt(b / (2.0f * kPi * kPi)) * pixelsPerDegree));
+    kernel.weights.resize(2 * kernel.radius + 1);
+    float sum = 0.0f;
+    for (uint32_t i = 0; i < kernel.weights.size(); ++i)
+    {
+        const float x = (static_cast<float>(i) - static_cast<float>(kernel.radius)) / pixelsPerDegree;
+        kernel.weights[i] = std::exp(-kPi * kPi * x * x / b);
+        sum += kernel.weights[i];
+    }
+    for (float& weight : kernel.weights)
+    {
+        weight /= sum;
+    }
+    *outUnnormalizedSum = sum;
+    return kernel;
+}
+
+struct FlipFilters
+{
+    Kernel1D y;                 // CSF of the achromatic channel
+    Kernel1D cx;                // Red-green
+    Kernel1D cz1;               // Blue-yellow is the sum of two Gaussians...
+    Kernel1D cz2;
+    float cz1Weight = 0.0f;     // ...mixed with these weights
+    float cz2Weight = 0.0f;
+    Kernel1D gauss;             // Feature detection: Gaussian, first and second derivative
+    Kernel1D edge;
+    Kernel1D point;
+    uint32_t halo = 0;          // Largest radius
+    float maxColorError = 0.0f; // HyAB distance between green and blue, after the exponent
+};
+
+struct Lab
+{
+    float l;
+    float a;
+    float b;
+};
+
+float LabF(float t)
+{
+    constexpr float kDelta = 6.0f / 29.0f;
+    return t > kDelta * kDelta * kDelta ? std::cbrt(t) : t / (3.0f * kDelta * kDelta) + 4.0f / 29.0f;
+}
+
+// Hunt-adjusted L*a*b* of linear RGB in [0, 1]
+Lab HuntLab(float r, float g, float b)
+{
+    const float fx = LabF((kRgbToXyz[0][0] * r + kRgbToXyz[0][1] * g + kRgbToXyz[0][2] * b) / kWhiteX);
+    const float fy = LabF((kRgbToXyz[1][0] * r + kRgbToXyz[1][1] * g + kRgbToXyz[1][2] * b) / kWhiteY);
+    const float fz = LabF((kRgbToXyz[2][0] * r + kRgbToXyz[2][1] * g + kRgbToXyz[2][2] * b) / kWhiteZ);
+    const float l = 116.0f * fy - 16.0f;
+    return {l, 0.01f * l * 500.0f * (fx - fy), 0.01f * l * 200.0f * (fy - fz)};
+}
+
+float HyAB(const Lab& p, const Lab& q)
+{
+    return std::fabs(p.l - q.l) + std::sqrt((p.a - q.a) * (p.a - q.a) + (p.b - q.b) * (p.b - q.b));
+}
+
+FlipFilters MakeFlipFilters(float pixelsPerDegree)
+{
+    FlipFilters filters;
+    float unused = 0.0f;
+    filters.y = MakeCsfKernel(0.0047f, pixelsPerDegree, &unused);
+    filters.cx = MakeCsfKernel(0.0053f, pixelsPerDegree, &unused);
+
+    // 2D weight of a*(pi/b)*exp(-pi^2 r^2 / b) is a*(pi/b)*(1D sum)^2
+    float sum1 = 0.0f;
+    float sum2 = 0.0f;
+    filters.cz1 = MakeCsfKernel(0.04f, pixelsPerDegree, &sum1);
+    filters.cz2 = MakeCsfKernel(0.025f, pixelsPerDegree, &sum2);
+    const float weight1 = 34.1f * (kPi / 0.04f) * sum1 * sum1;
+    const float weight2 = 13.5f * (kPi / 0.025f) * sum2 * sum2;
+    filters.cz1Weight = weight1 / (weight1 + weight2);
+    filters.cz2Weight = weight2 / (weight1 + weight2);
+
+    // Feature kernels: derivatives normalized so their positive weights sum to 1 and negative to -1
+    const float sigma = 0.5f * kFlipFeatureWidth * pixelsPerDegree;
+    const uint32_t radius = static_cast<uint32_t>(std::ceil(3.0f * sigma));
+    filters.gauss.radius = filters.edge.radius = filters.point.radius = radius;
+    filters.gauss.weights.resize(2 * radius + 1);
+    filters.edge.weights.resize(2 * radius + 1);
+    filters.point.weights.resize(2 * radius + 1);
+    float gaussSum = 0.0f;
+    float edgePositive = 0.0f;
+    float pointPositive = 0.0f;
+    float pointNegative = 0.0f;
+    for (uint32_t i = 0; i <= 2 * radius; ++i)
+    {
+        const float x = static_cast<float>(i) - static_cast<float>(radius);
+        const float g = std::exp(-x * x / (2.0f * sigma * sigma));
+        filters.gauss.weights[i] = g;
+        filters.edge.weights[i] = -x * g;
+        filters.point.weights[i] = (x * x / (sigma * sigma) - 1.0f) * g;
+        gaussSum += g;
+        edgePositive += std::max(filters.edge.weights[i], 0.0f);
+        pointPositive += std::max(filters.point.weights[i], 0.0f);
+        pointNegative -= std::min(filters.point.weights[i], 0.0f);
+    }
+    for (uint32_t i = 0; i <= 2 * radius; ++i)
+    {
+        filters.gauss.weights[i] /= gaussSum;
+        filters.edge.weights[i] /= edgePositive;
+        float& point = filters.point.weights[i];
+        point /= point > 0.0f ? pointPositive : pointNegative;
+    }
+
+    filters.halo = std::max({filters.y.radius, filters.cx.radius, filters.cz1.radius, filters.cz2.radius, radius});
+    filters.maxColorError = std::pow(HyAB(HuntLab(0.0f, 1.0f, 0.0f), HuntLab(0.0f, 0.0f, 1.0f)), kFlipQc);
+    return filters;
+}
+
+// Horizontally filtered planes of one image over a band and its halo rows
+enum FlipPlane
+{
+    kPlaneY,
+    kPlaneCx,
+    kPlaneCz1,
+    kPlaneCz2,
+    kPlaneGauss,                // Luminance, for the vertical derivatives
+    kPlaneEdge,                 // Luminance, horizontal first derivative
+    kPlanePoint,                // Luminance, horizontal second derivative
+    kPlaneCount
+};
+
+// Vertically filtered values of one image on one output row
+enum FlipRow
+{
+    kRowY,
+    kRowCx,
+    kRowCz,
+    kRowEdgeX,
+    kRowEdgeY,
+    kRowPointX,
+    kRowPointY,
+    kRowCount
+};
+
+struct FlipScratch
+{
+    std::vector<float> planes[2][kPlaneCount];      // [image][plane], (band rows + 2 * halo) * width
+    std::vector<float> rows[2][kRowCount];          // [image][row], width
+    std::vector<float> opponent[4];                 // Y, Cx, Cz and luminance of one source row
+    std::vector<float> cz2;                         // Second blue-yellow Gaussian of one output row
+    std::vector<const float*> taps;                 // Row pointers of a vertical pass
+};
+
+// Convert one source row to YCxCz and luminance, then filter it horizontally into the band planes
+void FilterSourceRow(const float* rgba, uint32_t width, const FlipFilters& filters, const MetricKernels& kernels,
+    FlipScratch& scratch, std::vector<float>* planes, size_t planeRow)
+{
+    float* y = scratch.opponent[0].data();
+    float* cx = scratch.opponent[1].data();
+    float* cz = scratch.opponent[2].data();
+    float* luminance = scratch.opponent[3].data();
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        const float r = std::clamp(rgba[4 * x], 0.0f, 1.0f);
+        const float g = std::clamp(rgba[4 * x + 1], 0.0f, 1.0f);
+        const float b = std::clamp(rgba[4 * x + 2], 0.0f, 1.0f);
+        const float xn = (kRgbToXyz[0][0] * r + kRgbToXyz[0][1] * g + kRgbToXyz[0][2] * b) / kWhiteX;
+        const float yn = (kRgbToXyz[1][0] * r + kRgbToXyz[1][1] * g + kRgbToXyz[1][2] * b) / kWhiteY;
+        const float zn = (kRgbToXyz[2][0] * r + kRgbToXyz[2][1] * g + kRgbToXyz[2][2] * b) / kWhiteZ;
+        y[x] = 116.0f * yn - 16.0f;
+        cx[x] = 500.0f * (xn - yn);
+        cz[x] = 200.0f * (yn - zn);
+        luminance[x] = yn;
+    }
+
+    const size_t offset = planeRow * width;
+    kernels.convolveRow(y, width, filters.y.weights.data(), filters.y.radius, planes[kPlaneY].data() + offset);
+    kernels.convolveRow(cx, width, filters.cx.weights.data(), filters.cx.radius, planes[kPlaneCx].data() + offset);
+    kernels.convolveRow(cz, width, filters.cz1.weights.data(), filters.cz1.radius, planes[kPlaneCz1].data() + offset);
+    kernels.convolveRow(cz, width, filters.cz2.weights.data(), filters.cz2.radius, planes[kPlaneCz2].data() + offset);
+    kernels.convolveRow(luminance, width, filters.gauss.weights.data(), filters.gauss.radius,
+        planes[kPlaneGauss].data() + offset);
+    kernels.convolveRow(luminance, width, filters.edge.weights.data(), filters.edge.radius,
+        planes[kPlaneEdge].data() + offset);
+    kernels.convolveRow(luminance, width, filters.point.weights.data(), filters.point.radius,
+        planes[kPlanePoint].data() + offset);
+}
+
+// Vertical pass of plane with kernel for output row (planeRow is the row's index in the band planes)
+void FilterColumn(const std::vector<float>& plane, uint32_t width, size_t planeRow, const Kernel1D& kernel,
+    const MetricKernels& kernels, std::vector<const float*>& taps, float* out)
+{
+    taps.resize(kernel.weights.size());
+    for (size_t k = 0; k < taps.size(); ++k)
+    {
+        taps[k] = plane.data() + (planeRow - kernel.radius + k) * width;
+    }
+    kernels.weightedSumRows(taps.data(), kernel.weights.data(), static_cast<uint32_t>(taps.size()), width, out);
+}
+
+// FLIP over output rows [y0, y1); returns the sum of the per-pixel errors
+double FlipBand(const MetricImage& reference, const MetricImage& test, const FlipFilters& filters,
+    const MetricKernels& kernels, uint32_t y0, uint32_t y1, float* flipMap)
+{
+    const uint32_t width = reference.width;
+    const uint32_t halo = filters.halo;
+    const size_t planeRows = (y1 - y0) + 2 * static_cast<size_t>(halo);
+
+    thread_local FlipScratch scratch;
+    for (int image = 0; image < 2; ++image)
+    {
+        for (std::vector<float>& plane : scratch.planes[image])
+        {
+            plane.resize(planeRows * width);
+        }
+        for (std::vector<float>& row : scratch.rows[image])
+        {
+            row.resize(width);
+        }
+    }
+    for (std::vector<float>& row : scratch.opponent)
+    {
+        row.resize(width);
+    }
+    scratch.cz2.resize(width);
+
+    // Rows above and below the image repeat the edge rows
+    const MetricImage* images[2] = {&reference, &test};
+    for (int image = 0; image < 2; ++image)
+    {
+        for (size_t planeRow = 0; planeRow < planeRows; ++planeRow)
+        {
+            const int64_t source = std::clamp<int64_t>(static_cast<int64_t>(y0) + static_cast<int64_t>(planeRow) - halo,
+                0, static_cast<int64_t>(images[image]->height) - 1);
+            const float* rgba = images[image]->data + static_cast<size_t>(source) * images[image]->rowPitch;
+            FilterSourceRow(rgba, width, filters, kernels, scratch, scratch.planes[image], planeRow);
+        }
+    }
+
+    double total = 0.0;
+    for (uint32_t y = y0; y < y1; ++y)
+    {
+        const size_t planeRow = (y - y0) + halo;
+        for (int image = 0; image < 2; ++image)
+        {
+            const std::vector<float>* planes = scratch.planes[image];
+            std::vector<float>* rows = scratch.rows[image];
+            FilterColumn(planes[kPlaneY], width, planeRow, filters.y, kernels, scratch.taps, rows[kRowY].data());
+            FilterColumn(planes[kPlaneCx], width, planeRow, filters.cx, kernels, scratch.taps, rows[kRowCx].data());
+            FilterColumn(planes[kPlaneCz1], width, planeRow, filters.cz1, kernels, scratch.taps, rows[kRowCz].data());
+            FilterColumn(planes[kPlaneCz2], width, planeRow, filters.cz2, kernels, scratch.taps, scratch.cz2.data());
+            FilterColumn(planes[kPlaneEdge], width, planeRow, filters.gauss, kernels, scratch.taps, rows[kRowEdgeX].data());
+            FilterColumn(planes[kPlaneGauss], width, planeRow, filters.edge, kernels, scratch.taps, rows[kRowEdgeY].data());
+            FilterColumn(planes[kPlanePoint], width, planeRow, filters.gauss, kernels, scratch.taps, rows[kRowPointX].data());
+            FilterColumn(planes[kPlaneGauss], width, planeRow, filters.point, kernels, scratch.taps, rows[kRowPointY].data());
+
+            float* cz = rows[kRowCz].data();
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                cz[x] = filters.cz1Weight * cz[x] + filters.cz2Weight * scratch.cz2[x];
+            }
+        }
+
+        const std::vector<float>* ref = scratch.rows[0];
+        const std::vector<float>* tst = scratch.rows[1];
+        float* mapRow = flipMap ? flipMap + static_cast<size_t>(y) * width : nullptr;
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            // Filtered YCxCz back to linear RGB, clamped, then Hunt-adjusted L*a*b*
+            Lab lab[2];
+            for (int image = 0; image < 2; ++image)
+            {
+                const std::vector<float>* rows = scratch.rows[image];
+                const float yn = (rows[kRowY][x] + 16.0f) / 116.0f;
+                const float cx = kWhiteX * (rows[kRowCx][x] / 500.0f + yn);
+                const float cy = kWhiteY * yn;
+                const float cz = kWhiteZ * (yn - rows[kRowCz][x] / 200.0f);
+                float rgb[3];
+                for (int c = 0; c < 3; ++c)
+                {
+                    rgb[c] = std::clamp(kXyzToRgb[c][0] * cx + kXyzToRgb[c][1] * cy + kXyzToRgb[c][2] * cz, 0.0f, 1.0f);
+                }
+                lab[image] = HuntLab(rgb[0], rgb[1], rgb[2]);
+            }
+
+            const float colorError = std::pow(HyAB(lab[0], lab[1]), kFlipQc);
+            const float knee = kFlipPc * filters.maxColorError;
+            const float mappedColor = colorError < knee ?
+                kFlipPt * colorError / knee :
+                kFlipPt + (colorError - knee) / (filters.maxColorError - knee) * (1.0f - kFlipPt);
+
+            const float edgeRef = std::hypot(ref[kRowEdgeX][x], ref[kRowEdgeY][x]);
+            const float edgeTest = std::hypot(tst[kRowEdgeX][x], tst[kRowEdgeY][x]);
+            const float pointRef = std::hypot(ref[kRowPointX][x], ref[kRowPointY][x]);
+            const float pointTest = std::hypot(tst[kRowPointX][x], tst[kRowPointY][x]);
+            const float featureDifference = std::max(std::fabs(edgeRef - edgeTest), std::fabs(pointRef - pointTest));
+            const float featureError = std::pow(featureDifference / std::sqrt(2.0f), kFlipQf);
+
+            const float error = std::pow(std::min(mappedColor, 1.0f), 1.0f - std::min(featureError, 1.0f));
+            total += error;
+            if (mapRow)
+            {
+                mapRow[x] = error;
+            }
+        }
+    }
+    return total;
+}
+
+//------------------------------------------------------------------------------
+// SSIM
+//------------------------------------------------------------------------------
+
+struct SsimScratch
+{
+    std::vector<float> luma[2];         // (band rows + 2 * radius) * width
+    std::vector<float> sums[5];         // width
+};
+
+// SSIM over the windows centered on rows [y0, y1), all of which lie inside the image
+void SsimBand(const MetricImage& reference, const MetricImage& test, const MetricKernels& kernels, float c1, float c2,
+    uint32_t y0, uint32_t y1, BandSums& sums)
+{
+    const uint32_t width = reference.width;
+    const uint32_t lumaRows = (y1 - y0) + 2 * kSsimRadius;
+
+    thread_local SsimScratch scratch;
+    const MetricImage* images[2] = {&reference, &test};
+    for (int image = 0; image < 2; ++image)
+    {
+        scratch.luma[image].resize(static_cast<size_t>(lumaRows) * width);
+        for (uint32_t row = 0; row < lumaRows; ++row)
+        {
+            const float* rgba = images[image]->data + static_cast<size_t>(y0 - kSsimRadius + row) * images[image]->rowPitch;
+            kernels.lumaRow(rgba, width, scratch.luma[image].data() + static_cast<size_t>(row) * width);
+        }
+    }
+    float* columnSums[5];
+    for (int q = 0; q < 5; ++q)
+    {
+        scratch.sums[q].resize(width);
+        columnSums[q] = scratch.sums[q].data();
+    }
+
+    const float* rowsA[2 * kSsimRadius + 1];
+    const float* rowsB[2 * kSsimRadius + 1];
+    for (uint32_t y = y0; y < y1; ++y)
+    {
+        for (uint32_t k = 0; k <= 2 * kSsimRadius; ++k)
+        {
+            const size_t offset = static_cast<size_t>(y - y0 + k) * width;
+            rowsA[k] = scratch.luma[0].data() + offset;
+            rowsB[k] = scratch.luma[1].data() + offset;
+        }
+        kernels.momentsRow(rowsA, rowsB, 2 * kSsimRadius + 1, width, columnSums);
+        sums.ssim += kernels.ssimRow(columnSums, kSsimRadius, width - kSsimRadius, kSsimRadius, c1, c2);
+        sums.ssimWindows += width - 2 * kSsimRadius;
+    }
+}
+
+} // namespace
+
+bool CompareImages(const MetricImage& reference, const MetricImage& test, const MetricOptions& options,
+    ThreadPool& pool, FrameMetrics& outMetrics)
+{
+    outMetrics = FrameMetrics();
+    if (!reference.data || !test.data || reference.width == 0 || reference.height == 0 ||
+        reference.width != test.width || reference.height != test.height ||
+        reference.rowPitch < 4 * reference.width || test.rowPitch < 4 * test.width)
+    {
+        return false;
+    }
+
+    const uint32_t width = reference.width;
+    const uint32_t height = reference.height;
+    const MetricKernels& kernels = GetMetricKernels();
+    const bool ssim = options.ssim && width > 2 * kSsimRadius && height > 2 * kSsimRadius;
+    const float c1 = (kSsimK1 * options.peak) * (kSsimK1 * options.peak);
+    const float c2 = (kSsimK2 * options.peak) * (kSsimK2 * options.peak);
+    const FlipFilters filters = options.flip ? MakeFlipFilters(options.pixelsPerDegree) : FlipFilters();
+
+    const uint32_t bandCount = (height + kBandHeight - 1) / kBandHeight;
+    std::vector<BandSums> bands(bandCount);
+    pool.ParallelFor(bandCount, [&](uint32_t band) {
+        const uint32_t y0 = band * kBandHeight;
+        const uint32_t y1 = std::min(y0 + kBandHeight, height);
+        BandSums& sums = bands[band];
+
+        if (options.psnr)
+        {
+            for (uint32_t y = y0; y < y1; ++y)
+            {
+                kernels.squaredErrorRow(reference.data + static_cast<size_t>(y) * reference.rowPitch,
+                    test.data + static_cast<size_t>(y) * test.rowPitch, width, sums.squaredError);
+            }
+        }
+        if (ssim)
+        {
+            const uint32_t ssimY0 = std::max(y0, kSsimRadius);
+            const uint32_t ssimY1 = std::min(y1, height - kSsimRadius);
+            if (ssimY0 < ssimY1)
+            {
+                SsimBand(reference, test, kernels, c1, c2, ssimY0, ssimY1, sums);
+            }
+        }
+        if (options.flip)
+        {
+            sums.flip = FlipBand(reference, test, filters, kernels, y0, y1, options.flipMap);
+        }
+    });
+
+    // Reduce in band order so the result is the same for any thread count
+    BandSums total;
+    for (const BandSums& band : bands)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            total.squaredError[c] += band.squaredError[c];
+        }
+        total.ssim += band.ssim;
+        total.ssimWindows += band.ssimWindows;
+        total.flip += band.flip;
+    }
+
+    const double pixels = static_cast<double>(width) * height;
+    if (options.psnr)
+    {
+        outMetrics.mse = (total.squaredError[0] + total.squaredError[1] + total.squaredError[2]) / (3.0 * pixels);
+        outMetrics.psnr = outMetrics.mse > 0.0 ?
+            10.0 * std::log10(static_cast<double>(options.peak) * options.peak / outMetrics.mse) :
+            std::numeric_limits<double>::infinity();
+    }
+    if (options.ssim)
+    {
+        outMetrics.ssim = total.ssimWindows ? total.ssim / static_cast<double>(total.ssimWindows) :
+            std::numeric_limits<double>::quiet_NaN();
+    }
+    if (options.flip)
+    {
+        outMetrics.flip = total.flip / pixels;
+    }
+    return true;
+}
+
+} // namespace dlss
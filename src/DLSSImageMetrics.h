@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+// DLSSImageMetrics.h - Image-quality metrics between an output and ground truth
+//------------------------------------------------------------------------------
+// Compares a test image (e.g. a DLSS output capture) with a reference (e.g. a
+// supersampled render of the same frame):
+//
+//   - PSNR over RGB, from the mean squared error
+//   - SSIM on Rec. 709 luminance, 7x7 uniform windows (Wang et al. 2004
+//     constants; windows that leave the image are skipped)
+//   - A FLIP-style perceptual error map (Andersson et al. 2020, LDR): CSF
+//     filtering in YCxCz, Hunt-adjusted HyAB colour difference and an
+//     edge/point feature difference, combined per pixel into [0, 1]
+//
+// The FLIP variant is a separable approximation of the published metric:
+// each CSF filter is applied as one or two separable Gaussians, and inputs are
+// treated as linear RGB clamped to [0, 1]. Its numbers track FLIP closely but
+// are not interchangeable with the reference implementation's.
+//
+// Frames are split into bands of rows processed on a ThreadPool. Each band
+// reduces into its own partial sums and the partials are added in band order,
+// so results do not depend on the thread count.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace dlss
+{
+
+class ThreadPool;
+
+/// An RGBA float image in memory.
+struct MetricImage
+{
+    const float* data;
+    uint32_t width;
+    uint32_t height;
+    uint32_t rowPitch;          // In floats, at least 4 * width
+};
+
+struct MetricOptions
+{
+    bool psnr = true;
+    bool ssim = true;
+    bool flip = false;                  // By far the most expensive of the three
+    float peak = 1.0f;                  // Signal range for PSNR and SSIM
+    float pixelsPerDegree = 67.0f;      // FLIP viewing condition; 67 is a 0.7 m wide 4K display at 0.7 m
+    float* flipMap = nullptr;           // Optional per-pixel FLIP error, width * height floats
+};
+
+struct FrameMetrics
+{
+    double mse = 0.0;                   // Mean over RGB
+    double psnr = 0.0;                  // dB; infinity when the images are identical
+    double ssim = 0.0;                  // Mean over windows; NaN if the image is smaller than a window
+    double flip = 0.0;                  // Mean FLIP error
+};
+
+/// Compare test against reference; both must have the same size.
+/// Metrics not selected in options are left at 0.
+/// @return false if the sizes differ or an image is empty.
+bool CompareImages(const MetricImage& reference, const MetricImage& test, const MetricOptions& options,
+    ThreadPool& pool, FrameMetrics& outMetrics);
+
+} // namespace dlss
@@ -0,0 +1,31 @@
+//------------------------------------------------------------------------------
+// DLSSInitEvent.h - IUnityEventQueue notification for DLSS_InitAsync
+//------------------------------------------------------------------------------
+// When DLSS_InitAsync finishes, the worker thread sends DLSSInitCompletedEvent
+// through Unity's global event queue (if the editor/player provides one).
+// Native plugins that depend on DLSS can register a handler for it instead of
+// polling DLSS_GetInitState:
+//
+//   static void OnDlssInit(const DLSSInitCompletedEvent& e) { ... }
+//   static UnityEventQueue::StaticFunctionEventHandler<DLSSInitCompletedEvent> s_handler(&OnDlssInit);
+//   interfaces->Get<UnityEventQueue::IUnityEventQueue>()->AddHandler(&s_handler);
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include "DLSSPluginLite.h"
+
+// IUnityEventQueue.h leaves Assert to the host
+#ifndef Assert
+#define Assert(condition) ((void)0)
+#endif
+#include "IUnityEventQueue.h"
+
+/// Payload of the DLSS_InitAsync completion event.
+struct DLSSInitCompletedEvent
+{
+    int state;                          // DLSS_InitState_Ready or DLSS_InitState_Failed
+    int result;                         // NGX result of the init
+};
+
+REGISTER_EVENT_ID(0x4F61346D453859B2ULL, 0xE0FD882171D83A08ULL, DLSSInitCompletedEvent)
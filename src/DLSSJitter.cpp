@@ -0,0 +1,73 @@
+//------------------------------------------------------------------------------
+// DLSSJitter.cpp - Precomputed Halton(2,3) jitter sequences
+//------------------------------------------------------------------------------
+
+#include "DLSSJitter.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dlss
+{
+
+static constexpr uint32_t kBasePhaseCount = 8;
+
+// Radical inverse of index in the given base, in [0, 1)
+static float Halton(uint32_t index, uint32_t base)
+{
+    float result = 0.0f;
+    float fraction = 1.0f;
+    while (index > 0)
+    {
+        fraction /= static_cast<float>(base);
+        result += fraction * static_cast<float>(index % base);
+        index /= base;
+    }
+    return result;
+}
+
+JitterTables& JitterTables::Instance()
+{
+    static JitterTables instance;
+    return instance;
+}
+
+uint32_t JitterTables::PhaseCount(unsigned int renderWidth, unsigned int renderHeight,
+    unsigned int outputWidth, unsigned int outputHeight)
+{
+    if (renderWidth == 0 || renderHeight == 0 || outputWidth == 0 || outputHeight == 0)
+    {
+        return 0;
+    }
+
+    const double areaRatio = (static_cast<double>(outputWidth) * outputHeight) /
+        (static_cast<double>(renderWidth) * renderHeight);
+    const double phases = std::round(kBasePhaseCount * areaRatio);
+    return static_cast<uint32_t>(std::clamp(phases, static_cast<double>(kBasePhaseCount),
+        static_cast<double>(DLSS_MAX_JITTER_PHASES)));
+}
+
+const JitterTable* JitterTables::Get(uint32_t phaseCount)
+{
+    if (phaseCount == 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<const JitterTable>& slot = m_tables[phaseCount];
+    if (!slot)
+    {
+        // Index 0 of the Halton sequence is (0, 0) in every base; start at 1
+        auto table = std::make_unique<JitterTable>(phaseCount);
+        for (uint32_t i = 0; i < phaseCount; ++i)
+        {
+            (*table)[i].x = Halton(i + 1, 2) - 0.5f;
+            (*table)[i].y = Halton(i + 1, 3) - 0.5f;
+        }
+        slot = std::move(table);
+    }
+    return slot.get();
+}
+
+} // namespace dlss
@@ -0,0 +1,60 @@
+//------------------------------------------------------------------------------
+// DLSSJitter.h - Precomputed Halton(2,3) jitter sequences
+//------------------------------------------------------------------------------
+// DLSS wants a low-discrepancy sub-pixel jitter whose period grows with the
+// upscale ratio: 8 x (output area / render area) phases. Each phase count has
+// one shared table of Halton(2,3) offsets in render pixels, built on first use
+// (at the latest when a feature is created) and never changed or freed
+// afterwards, so a frame's jitter is a table index. Features keep a pointer to
+// their table; the render thread reads it without taking the lock.
+// Internal use only - exposed to C# through DLSS_GetJitterOffset,
+// DLSS_GetJitterSequence and DLSS_Event_EvaluateFeatureJittered.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+using JitterTable = std::vector<DLSSJitterOffset>;
+
+class JitterTables
+{
+public:
+    static JitterTables& Instance();
+
+    // Non-copyable
+    JitterTables(const JitterTables&) = delete;
+    JitterTables& operator=(const JitterTables&) = delete;
+
+    /// Phase count for an upscale: 8 x (output area / render area), rounded,
+    /// at least 8 and at most DLSS_MAX_JITTER_PHASES. 0 if any size is 0.
+    static uint32_t PhaseCount(unsigned int renderWidth, unsigned int renderHeight,
+        unsigned int outputWidth, unsigned int outputHeight);
+
+    /// Table of phaseCount offsets, built on first request and valid until unload.
+    /// Null if phaseCount is 0.
+    const JitterTable* Get(uint32_t phaseCount);
+
+    /// Offset of a frame; the sequence repeats every table->size() frames.
+    static DLSSJitterOffset At(const JitterTable& table, uint64_t frameIndex)
+    {
+        return table[frameIndex % table.size()];
+    }
+
+private:
+    JitterTables() = default;
+
+    std::unordered_map<uint32_t, std::unique_ptr<const JitterTable>> m_tables;  // Phase count -> offsets
+    std::mutex m_mutex;
+};
+
+} // namespace dlss
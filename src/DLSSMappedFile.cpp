@@ -0,0 +1,154 @@
+//------------------------------------------------------------------------------
+// DLSSMappedFile.cpp - Read-only memory-mapped file
+//------------------------------------------------------------------------------
+
+#include "DLSSMappedFile.h"
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+
+namespace dlss
+{
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path, std::string& outError)
+{
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        outError = "cannot open " + path + " (error " + std::to_string(GetLastError()) + ")";
+        return false;
+    }
+
+    LARGE_INTEGER size = {};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        outError = path + " is empty";
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!data)
+    {
+        outError = "cannot map " + path + " (error " + std::to_string(GetLastError()) + ")";
+        if (mapping)
+        {
+            CloseHandle(mapping);
+        }
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<uint64_t>(size.QuadPart);
+    m_path = path;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        CloseHandle(m_file);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_file = nullptr;
+    m_mapping = nullptr;
+    m_path.clear();
+}
+
+void MappedFile::Release(uint64_t, uint64_t)
+{
+    // Clean pages of a read-only view are trimmed from the working set as needed
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path, std::string& outError)
+{
+    Close();
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        outError = "cannot open " + path + " (" + std::strerror(errno) + ")";
+        return false;
+    }
+
+    struct stat info = {};
+    if (fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        outError = path + " is empty";
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        outError = "cannot map " + path + " (" + std::strerror(errno) + ")";
+        return false;
+    }
+    madvise(data, static_cast<size_t>(info.st_size), MADV_SEQUENTIAL);
+
+    m_data = static_cast<const uint8_t*>(data);
+    m_size = static_cast<uint64_t>(info.st_size);
+    m_path = path;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data)
+    {
+        munmap(const_cast<uint8_t*>(m_data), static_cast<size_t>(m_size));
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_path.clear();
+}
+
+void MappedFile::Release(uint64_t offset, uint64_t size)
+{
+    // Whole pages inside the range only
+    const uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t begin = (offset + page - 1) / page * page;
+    const uint64_t end = (offset + size) / page * page;
+    if (m_data && begin < end && end <= m_size)
+    {
+        madvise(const_cast<uint8_t*>(m_data) + begin, static_cast<size_t>(end - begin), MADV_DONTNEED);
+    }
+}
+
+#endif
+
+} // namespace dlss
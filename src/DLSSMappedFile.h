@@ -0,0 +1,51 @@
+//------------------------------------------------------------------------------
+// DLSSMappedFile.h - Read-only memory-mapped file
+//------------------------------------------------------------------------------
+// Frame sequences for the image-quality tools are tens of gigabytes, far more
+// than fits in memory. Mapping them lets the OS page frames in ahead of the
+// reader (the mapping is hinted as sequential) and drop them once read,
+// without a copy through a read buffer.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace dlss
+{
+
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // Non-copyable
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// Map path for reading, closing any file mapped before.
+    /// @return false with outError set if the file cannot be opened or mapped.
+    bool Open(const std::string& path, std::string& outError);
+    void Close();
+
+    bool IsOpen() const { return m_data != nullptr; }
+    const uint8_t* GetData() const { return m_data; }
+    uint64_t GetSize() const { return m_size; }
+    const std::string& GetPath() const { return m_path; }
+
+    /// Tell the OS that [offset, offset + size) will not be read again soon.
+    void Release(uint64_t offset, uint64_t size);
+
+private:
+    const uint8_t* m_data = nullptr;
+    uint64_t m_size = 0;
+    std::string m_path;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+} // namespace dlss
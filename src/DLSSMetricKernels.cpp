@@ -0,0 +1,585 @@
+//------------------------------------------------------------------------------
+// DLSSMetricKernels.cpp - Row kernels of the image-quality metrics
+//------------------------------------------------------------------------------
+
+#include "DLSSMetricKernels.h"
+#include "DLSSSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace dlss
+{
+
+namespace
+{
+
+constexpr float kLumaR = 0.2126f;
+constexpr float kLumaG = 0.7152f;
+constexpr float kLumaB = 0.0722f;
+
+// SSIM of the window centered on x; shared by the scalar kernel and the SIMD tails
+inline float SsimAt(const float* const* sums, uint32_t x, uint32_t radius, float invArea, float c1, float c2)
+{
+    float s[5] = {};
+    for (uint32_t k = x - radius; k <= x + radius; ++k)
+    {
+        for (int q = 0; q < 5; ++q)
+        {
+            s[q] += sums[q][k];
+        }
+    }
+    const float meanA = s[0] * invArea;
+    const float meanB = s[1] * invArea;
+    const float varA = s[2] * invArea - meanA * meanA;
+    const float varB = s[3] * invArea - meanB * meanB;
+    const float covariance = s[4] * invArea - meanA * meanB;
+    return ((2.0f * meanA * meanB + c1) * (2.0f * covariance + c2)) /
+        ((meanA * meanA + meanB * meanB + c1) * (varA + varB + c2));
+}
+
+// Window sums of column x; shared by the scalar kernel and the SIMD tails
+inline void MomentsAt(const float* const* rowsA, const float* const* rowsB, uint32_t rowCount, uint32_t x,
+    float* const* sums)
+{
+    float s[5] = {};
+    for (uint32_t k = 0; k < rowCount; ++k)
+    {
+        const float a = rowsA[k][x];
+        const float b = rowsB[k][x];
+        s[0] += a;
+        s[1] += b;
+        s[2] += a * a;
+        s[3] += b * b;
+        s[4] += a * b;
+    }
+    for (int q = 0; q < 5; ++q)
+    {
+        sums[q][x] = s[q];
+    }
+}
+
+// Convolution at x with reads clamped to the row; used where the footprint leaves the row
+inline float ConvolveClampedAt(const float* in, uint32_t width, const float* kernel, uint32_t radius, uint32_t x)
+{
+    const int32_t last = static_cast<int32_t>(width) - 1;
+    float sum = 0.0f;
+    for (uint32_t k = 0; k <= 2 * radius; ++k)
+    {
+        const int32_t source = std::clamp(static_cast<int32_t>(x + k) - static_cast<int32_t>(radius), 0, last);
+        sum += kernel[k] * in[source];
+    }
+    return sum;
+}
+
+// First x whose footprint leaves the row on the right, or radius if the row is too short for an interior
+inline uint32_t InteriorEnd(uint32_t width, uint32_t radius)
+{
+    return width > 2 * radius ? width - radius : radius;
+}
+
+//------------------------------------------------------------------------------
+// Scalar
+//------------------------------------------------------------------------------
+
+void SquaredErrorRowScalar(const float* a, const float* b, uint32_t pixels, double* sums)
+{
+    float partial[4] = {};
+    for (uint32_t i = 0; i < pixels; ++i)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const float d = a[4 * i + c] - b[4 * i + c];
+            partial[c] += d * d;
+        }
+    }
+    for (int c = 0; c < 4; ++c)
+    {
+        sums[c] += partial[c];
+    }
+}
+
+void LumaRowScalar(const float* rgba, uint32_t pixels, float* luma)
+{
+    for (uint32_t i = 0; i < pixels; ++i)
+    {
+        luma[i] = kLumaR * rgba[4 * i] + kLumaG * rgba[4 * i + 1] + kLumaB * rgba[4 * i + 2];
+    }
+}
+
+void MomentsRowScalar(const float* const* rowsA, const float* const* rowsB, uint32_t rowCount, uint32_t width,
+    float* const* sums)
+{
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        MomentsAt(rowsA, rowsB, rowCount, x, sums);
+    }
+}
+
+double SsimRowScalar(const float* const* sums, uint32_t begin, uint32_t end, uint32_t radius, float c1, float c2)
+{
+    const float side = static_cast<float>(2 * radius + 1);
+    const float invArea = 1.0f / (side * side);
+    double total = 0.0;
+    for (uint32_t x = begin; x < end; ++x)
+    {
+        total += SsimAt(sums, x, radius, invArea, c1, c2);
+    }
+    return total;
+}
+
+void ConvolveRowScalar(const float* in, uint32_t width, const float* kernel, uint32_t radius, float* out)
+{
+    const uint32_t interiorEnd = InteriorEnd(width, radius);
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        if (x < radius || x >= interiorEnd)
+        {
+            out[x] = ConvolveClampedAt(in, width, kernel, radius, x);
+            continue;
+        }
+        float sum = 0.0f;
+        const float* source = in + x - radius;
+        for (uint32_t k = 0; k <= 2 * radius; ++k)
+        {
+            sum += kernel[k] * source[k];
+        }
+        out[x] = sum;
+    }
+}
+
+void WeightedSumRowsScalar(const float* const* rows, const float* weights, uint32_t count, uint32_t width, float* out)
+{
+    for (uint32_t x = 0; x < width; ++x)
+    {
+        float sum = 0.0f;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            sum += weights[k] * rows[k][x];
+        }
+        out[x] = sum;
+    }
+}
+
+//------------------------------------------------------------------------------
+// AVX2 + FMA: 8 floats per register
+//------------------------------------------------------------------------------
+
+#if DLSS_SIMD_X64
+
+DLSS_TARGET_AVX2 inline float HorizontalSum(__m256 v)
+{
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+    return _mm_cvtss_f32(sum);
+}
+
+DLSS_TARGET_AVX2 void SquaredErrorRowAvx2(const float* a, const float* b, uint32_t pixels, double* sums)
+{
+    // Two RGBA pixels per register, so lanes i and i + 4 hold the same channel
+    __m256 partial = _mm256_setzero_ps();
+    uint32_t i = 0;
+    for (; i + 2 <= pixels; i += 2)
+    {
+        const __m256 d = _mm256_sub_ps(_mm256_loadu_ps(a + 4 * i), _mm256_loadu_ps(b + 4 * i));
+        partial = _mm256_fmadd_ps(d, d, partial);
+    }
+    float lanes[8];
+    _mm256_storeu_ps(lanes, partial);
+    for (int c = 0; c < 4; ++c)
+    {
+        sums[c] += static_cast<double>(lanes[c]) + lanes[c + 4];
+    }
+    if (i < pixels)
+    {
+        SquaredErrorRowScalar(a + 4 * i, b + 4 * i, pixels - i, sums);
+    }
+}
+
+DLSS_TARGET_AVX2 void LumaRowAvx2(const float* rgba, uint32_t pixels, float* luma)
+{
+    const __m256 weights = _mm256_setr_ps(kLumaR, kLumaG, kLumaB, 0.0f, kLumaR, kLumaG, kLumaB, 0.0f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    uint32_t i = 0;
+    for (; i + 8 <= pixels; i += 8)
+    {
+        const float* p = rgba + 4 * i;
+        const __m256 p01 = _mm256_mul_ps(_mm256_loadu_ps(p), weights);
+        const __m256 p23 = _mm256_mul_ps(_mm256_loadu_ps(p + 8), weights);
+        const __m256 p45 = _mm256_mul_ps(_mm256_loadu_ps(p + 16), weights);
+        const __m256 p67 = _mm256_mul_ps(_mm256_loadu_ps(p + 24), weights);
+
+        // Pairwise sums leave pixels in the order 0 2 4 6 | 1 3 5 7
+        const __m256 sums = _mm256_hadd_ps(_mm256_hadd_ps(p01, p23), _mm256_hadd_ps(p45, p67));
+        _mm256_storeu_ps(luma + i, _mm256_permutevar8x32_ps(sums, order));
+    }
+    LumaRowScalar(rgba + 4 * i, pixels - i, luma + i);
+}
+
+DLSS_TARGET_AVX2 void MomentsRowAvx2(const float* const* rowsA, const float* const* rowsB, uint32_t rowCount,
+    uint32_t width, float* const* sums)
+{
+    uint32_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256 s0 = _mm256_setzero_ps();
+        __m256 s1 = _mm256_setzero_ps();
+        __m256 s2 = _mm256_setzero_ps();
+        __m256 s3 = _mm256_setzero_ps();
+        __m256 s4 = _mm256_setzero_ps();
+        for (uint32_t k = 0; k < rowCount; ++k)
+        {
+            const __m256 a = _mm256_loadu_ps(rowsA[k] + x);
+            const __m256 b = _mm256_loadu_ps(rowsB[k] + x);
+            s0 = _mm256_add_ps(s0, a);
+            s1 = _mm256_add_ps(s1, b);
+            s2 = _mm256_fmadd_ps(a, a, s2);
+            s3 = _mm256_fmadd_ps(b, b, s3);
+            s4 = _mm256_fmadd_ps(a, b, s4);
+        }
+        _mm256_storeu_ps(sums[0] + x, s0);
+        _mm256_storeu_ps(sums[1] + x, s1);
+        _mm256_storeu_ps(sums[2] + x, s2);
+        _mm256_storeu_ps(sums[3] + x, s3);
+        _mm256_storeu_ps(sums[4] + x, s4);
+    }
+    for (; x < width; ++x)
+    {
+        MomentsAt(rowsA, rowsB, rowCount, x, sums);
+    }
+}
+
+DLSS_TARGET_AVX2 double SsimRowAvx2(const float* const* sums, uint32_t begin, uint32_t end, uint32_t radius,
+    float c1, float c2)
+{
+    const float side = static_cast<float>(2 * radius + 1);
+    const float invAreaScalar = 1.0f / (side * side);
+    const __m256 invArea = _mm256_set1_ps(invAreaScalar);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 vc1 = _mm256_set1_ps(c1);
+    const __m256 vc2 = _mm256_set1_ps(c2);
+
+    __m256 total = _mm256_setzero_ps();
+    uint32_t x = begin;
+    for (; x + 8 <= end; x += 8)
+    {
+        __m256 s[5];
+        for (int q = 0; q < 5; ++q)
+        {
+            const float* column = sums[q] + x - radius;
+            __m256 sum = _mm256_loadu_ps(column);
+            for (uint32_t k = 1; k <= 2 * radius; ++k)
+            {
+                sum = _mm256_add_ps(sum, _mm256_loadu_ps(column + k));
+            }
+            s[q] = _mm256_mul_ps(sum, invArea);
+        }
+        const __m256 meanAB = _mm256_mul_ps(s[0], s[1]);
+        const __m256 meanAA = _mm256_mul_ps(s[0], s[0]);
+        const __m256 meanBB = _mm256_mul_ps(s[1], s[1]);
+        const __m256 variances = _mm256_sub_ps(_mm256_add_ps(s[2], s[3]), _mm256_add_ps(meanAA, meanBB));
+        const __m256 covariance = _mm256_sub_ps(s[4], meanAB);
+        const __m256 numerator = _mm256_mul_ps(_mm256_fmadd_ps(two, meanAB, vc1), _mm256_fmadd_ps(two, covariance, vc2));
+        const __m256 denominator = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(meanAA, meanBB), vc1),
+            _mm256_add_ps(variances, vc2));
+        total = _mm256_add_ps(total, _mm256_div_ps(numerator, denominator));
+    }
+
+    double result = HorizontalSum(total);
+    for (; x < end; ++x)
+    {
+        result += SsimAt(sums, x, radius, invAreaScalar, c1, c2);
+    }
+    return result;
+}
+
+DLSS_TARGET_AVX2 void ConvolveRowAvx2(const float* in, uint32_t width, const float* kernel, uint32_t radius, float* out)
+{
+    const uint32_t interiorEnd = InteriorEnd(width, radius);
+    uint32_t x = 0;
+    for (; x < std::min(radius, width); ++x)
+    {
+        out[x] = ConvolveClampedAt(in, width, kernel, radius, x);
+    }
+    for (; x + 8 <= interiorEnd; x += 8)
+    {
+        const float* source = in + x - radius;
+        __m256 sum = _mm256_mul_ps(_mm256_set1_ps(kernel[0]), _mm256_loadu_ps(source));
+        for (uint32_t k = 1; k <= 2 * radius; ++k)
+        {
+            sum = _mm256_fmadd_ps(_mm256_set1_ps(kernel[k]), _mm256_loadu_ps(source + k), sum);
+        }
+        _mm256_storeu_ps(out + x, sum);
+    }
+    for (; x < width; ++x)
+    {
+        out[x] = ConvolveClampedAt(in, width, kernel, radius, x);
+    }
+}
+
+DLSS_TARGET_AVX2 void WeightedSumRowsAvx2(const float* const* rows, const float* weights, uint32_t count,
+    uint32_t width, float* out)
+{
+    uint32_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256 sum = _mm256_setzero_ps();
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            sum = _mm256_fmadd_ps(_mm256_set1_ps(weights[k]), _mm256_loadu_ps(rows[k] + x), sum);
+        }
+        _mm256_storeu_ps(out + x, sum);
+    }
+    for (; x < width; ++x)
+    {
+        float sum = 0.0f;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            sum += weights[k] * rows[k][x];
+        }
+        out[x] = sum;
+    }
+}
+
+#endif // DLSS_SIMD_X64
+
+//------------------------------------------------------------------------------
+// NEON: 4 floats per register
+//------------------------------------------------------------------------------
+
+#if DLSS_SIMD_NEON
+
+void SquaredErrorRowNeon(const float* a, const float* b, uint32_t pixels, double* sums)
+{
+    float32x4_t partial = vdupq_n_f32(0.0f);
+    for (uint32_t i = 0; i < pixels; ++i)
+    {
+        const float32x4_t d = vsubq_f32(vld1q_f32(a + 4 * i), vld1q_f32(b + 4 * i));
+        partial = vfmaq_f32(partial, d, d);
+    }
+    float lanes[4];
+    vst1q_f32(lanes, partial);
+    for (int c = 0; c < 4; ++c)
+    {
+        sums[c] += lanes[c];
+    }
+}
+
+void LumaRowNeon(const float* rgba, uint32_t pixels, float* luma)
+{
+    uint32_t i = 0;
+    for (; i + 4 <= pixels; i += 4)
+    {
+        const float32x4x4_t p = vld4q_f32(rgba + 4 * i);
+        float32x4_t y = vmulq_n_f32(p.val[0], kLumaR);
+        y = vfmaq_n_f32(y, p.val[1], kLumaG);
+        y = vfmaq_n_f32(y, p.val[2], kLumaB);
+        vst1q_f32(luma + i, y);
+    }
+    LumaRowScalar(rgba + 4 * i, pixels - i, luma + i);
+}
+
+void MomentsRowNeon(const float* const* rowsA, const float* const* rowsB, uint32_t rowCount, uint32_t width,
+    float* const* sums)
+{
+    uint32_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        float32x4_t s[5];
+        for (float32x4_t& sum : s)
+        {
+            sum = vdupq_n_f32(0.0f);
+        }
+        for (uint32_t k = 0; k < rowCount; ++k)
+        {
+            const float32x4_t a = vld1q_f32(rowsA[k] + x);
+            const float32x4_t b = vld1q_f32(rowsB[k] + x);
+            s[0] = vaddq_f32(s[0], a);
+            s[1] = vaddq_f32(s[1], b);
+            s[2] = vfmaq_f32(s[2], a, a);
+            s[3] = vfmaq_f32(s[3], b, b);
+            s[4] = vfmaq_f32(s[4], a, b);
+        }
+        for (int q = 0; q < 5; ++q)
+        {
+            vst1q_f32(sums[q] + x, s[q]);
+        }
+    }
+    for (; x < width; ++x)
+    {
+        MomentsAt(rowsA, rowsB, rowCount, x, sums);
+    }
+}
+
+double SsimRowNeon(const float* const* sums, uint32_t begin, uint32_t end, uint32_t radius, float c1, float c2)
+{
+    const float side = static_cast<float>(2 * radius + 1);
+    const float invArea = 1.0f / (side * side);
+    const float32x4_t vc1 = vdupq_n_f32(c1);
+    const float32x4_t vc2 = vdupq_n_f32(c2);
+
+    float32x4_t total = vdupq_n_f32(0.0f);
+    uint32_t x = begin;
+    for (; x + 4 <= end; x += 4)
+    {
+        float32x4_t s[5];
+        for (int q = 0; q < 5; ++q)
+        {
+            const float* column = sums[q] + x - radius;
+            float32x4_t sum = vld1q_f32(column);
+            for (uint32_t k = 1; k <= 2 * radius; ++k)
+            {
+                sum = vaddq_f32(sum, vld1q_f32(column + k));
+            }
+            s[q] = vmulq_n_f32(sum, invArea);
+        }
+        const float32x4_t meanAB = vmulq_f32(s[0], s[1]);
+        const float32x4_t meanSquares = vfmaq_f32(vmulq_f32(s[0], s[0]), s[1], s[1]);
+        const float32x4_t variances = vsubq_f32(vaddq_f32(s[2], s[3]), meanSquares);
+        const float32x4_t covariance = vsubq_f32(s[4], meanAB);
+        const float32x4_t numerator = vmulq_f32(vfmaq_n_f32(vc1, meanAB, 2.0f), vfmaq_n_f32(vc2, covariance, 2.0f));
+        const float32x4_t denominator = vmulq_f32(vaddq_f32(meanSquares, vc1), vaddq_f32(variances, vc2));
+        total = vaddq_f32(total, vdivq_f32(numerator, denominator));
+    }
+
+    double result = vaddvq_f32(total);
+    for (; x < end; ++x)
+    {
+        result += SsimAt(sums, x, radius, invArea, c1, c2);
+    }
+    return result;
+}
+
+void ConvolveRowNeon(const float* in, uint32_t width, const float* kernel, uint32_t radius, float* out)
+{
+    const uint32_t interiorEnd = InteriorEnd(width, radius);
+    uint32_t x = 0;
+    for (; x < std::min(radius, width); ++x)
+    {
+        out[x] = ConvolveClampedAt(in, width, kernel, radius, x);
+    }
+    for (; x + 4 <= interiorEnd; x += 4)
+    {
+        const float* source = in + x - radius;
+        float32x4_t sum = vmulq_n_f32(vld1q_f32(source), kernel[0]);
+        for (uint32_t k = 1; k <= 2 * radius; ++k)
+        {
+            sum = vfmaq_n_f32(sum, vld1q_f32(source + k), kernel[k]);
+        }
+        vst1q_f32(out + x, sum);
+    }
+    for (; x < width; ++x)
+    {
+        out[x] = ConvolveClampedAt(in, width, kernel, radius, x);
+    }
+}
+
+void WeightedSumRowsNeon(const float* const* rows, const float* weights, uint32_t count, uint32_t width, float* out)
+{
+    uint32_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        float32x4_t sum = vdupq_n_f32(0.0f);
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            sum = vfmaq_n_f32(sum, vld1q_f32(rows[k] + x), weights[k]);
+        }
+        vst1q_f32(out + x, sum);
+    }
+    for (; x < width; ++x)
+    {
+        float sum = 0.0f;
+        for (uint32_t k = 0; k < count; ++k)
+        {
+            sum += weights[k] * rows[k][x];
+        }
+        out[x] = sum;
+    }
+}
+
+#endif // DLSS_SIMD_NEON
+
+//------------------------------------------------------------------------------
+// Dispatch
+//------------------------------------------------------------------------------
+
+const MetricKernels kScalarKernels = {
+    "scalar", SquaredErrorRowScalar, LumaRowScalar, MomentsRowScalar, SsimRowScalar, ConvolveRowScalar,
+    WeightedSumRowsScalar,
+};
+#if DLSS_SIMD_X64
+const MetricKernels kAvx2Kernels = {
+    "avx2", SquaredErrorRowAvx2, LumaRowAvx2, MomentsRowAvx2, SsimRowAvx2, ConvolveRowAvx2, WeightedSumRowsAvx2,
+};
+#endif
+#if DLSS_SIMD_NEON
+const MetricKernels kNeonKernels = {
+    "neon", SquaredErrorRowNeon, LumaRowNeon, MomentsRowNeon, SsimRowNeon, ConvolveRowNeon, WeightedSumRowsNeon,
+};
+#endif
+
+const MetricKernels* FindKernels(const char* name)
+{
+    if (std::strcmp(name, kScalarKernels.name) == 0)
+    {
+        return &kScalarKernels;
+    }
+#if DLSS_SIMD_X64
+    if (std::strcmp(name, kAvx2Kernels.name) == 0 && CpuSupportsAvx2())
+    {
+        return &kAvx2Kernels;
+    }
+#endif
+#if DLSS_SIMD_NEON
+    if (std::strcmp(name, kNeonKernels.name) == 0)
+    {
+        return &kNeonKernels;
+    }
+#endif
+    return nullptr;
+}
+
+const MetricKernels* DetectKernels()
+{
+#if DLSS_SIMD_X64
+    if (CpuSupportsAvx2())
+    {
+        return &kAvx2Kernels;
+    }
+#elif DLSS_SIMD_NEON
+    return &kNeonKernels;
+#endif
+    return &kScalarKernels;
+}
+
+std::atomic<const MetricKernels*> g_kernels{nullptr};
+
+} // namespace
+
+const MetricKernels& GetMetricKernels()
+{
+    const MetricKernels* kernels = g_kernels.load(std::memory_order_acquire);
+    if (!kernels)
+    {
+        // Detection is idempotent, so racing first calls agree
+        const MetricKernels* detected = DetectKernels();
+        g_kernels.compare_exchange_strong(kernels, detected, std::memory_order_acq_rel);
+        kernels = g_kernels.load(std::memory_order_acquire);
+    }
+    return *kernels;
+}
+
+bool SelectMetricKernels(const char* name)
+{
+    const MetricKernels* kernels = name ? FindKernels(name) : nullptr;
+    if (!kernels)
+    {
+        return false;
+    }
+    g_kernels.store(kernels, std::memory_order_release);
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// DLSSMetricKernels.h - Row kernels of the image-quality metrics
+//------------------------------------------------------------------------------
+// DLSSImageMetrics.cpp splits each frame into bands of rows and calls these
+// for every row, so everything per-pixel that is not a colour-space
+// conversion runs here: squared error (PSNR), luminance, the windowed
+// moments and SSIM (SSIM), and the separable convolutions of the FLIP
+// contrast-sensitivity and feature filters. AVX2 (x86-64, chosen at runtime)
+// and NEON (ARM64) variants process 8 and 4 floats per instruction; the
+// scalar variant is the portable fallback.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace dlss
+{
+
+struct MetricKernels
+{
+    const char* name;                   // "avx2", "neon" or "scalar"
+
+    /// Add the squared differences of pixels RGBA pixels to sums[0..3], per channel.
+    void (*squaredErrorRow)(const float* a, const float* b, uint32_t pixels, double* sums);
+
+    /// Rec. 709 luminance of pixels RGBA pixels.
+    void (*lumaRow)(const float* rgba, uint32_t pixels, float* luma);
+
+    /// Column sums over rowCount rows of a, b, a*a, b*b and a*b, written to sums[0..4].
+    void (*momentsRow)(const float* const* rowsA, const float* const* rowsB, uint32_t rowCount, uint32_t width,
+        float* const* sums);
+
+    /// Sum of SSIM at x in [begin, end) over (2 * radius + 1)^2 windows of column sums from momentsRow.
+    /// x - radius and x + radius must lie inside the row.
+    double (*ssimRow)(const float* const* sums, uint32_t begin, uint32_t end, uint32_t radius, float c1, float c2);
+
+    /// out[x] = sum over k of kernel[k] * in[x + k - radius], clamping reads to the row.
+    void (*convolveRow)(const float* in, uint32_t width, const float* kernel, uint32_t radius, float* out);
+
+    /// out[x] = sum over k < count of weights[k] * rows[k][x].
+    void (*weightedSumRows)(const float* const* rows, const float* weights, uint32_t count, uint32_t width,
+        float* out);
+};
+
+/// Kernels in use: the best variant the CPU supports unless SelectMetricKernels chose another.
+const MetricKernels& GetMetricKernels();
+
+/// Force a variant, e.g. to compare a SIMD variant with the scalar one.
+/// @return false if name is unknown or not supported on this CPU; the selection is unchanged.
+bool SelectMetricKernels(const char* name);
+
+} // namespace dlss
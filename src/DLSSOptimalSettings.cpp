@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+// DLSSOptimalSettings.cpp - Precomputed DLSS optimal settings table
+//------------------------------------------------------------------------------
+
+#include "DLSSOptimalSettings.h"
+
+#include <algorithm>
+
+namespace dlss
+{
+
+// Common 16:9, 16:10 and ultrawide outputs
+static const DLSSResolution kDefaultResolutions[] = {
+    {1280, 720},
+    {1600, 900},
+    {1920, 1080},
+    {1920, 1200},
+    {2560, 1080},
+    {2560, 1440},
+    {2560, 1600},
+    {3440, 1440},
+    {3840, 1600},
+    {3840, 2160},
+    {5120, 2160},
+    {7680, 4320},
+};
+
+OptimalSettingsTable& OptimalSettingsTable::Instance()
+{
+    static OptimalSettingsTable instance;
+    return instance;
+}
+
+OptimalSettingsTable::OptimalSettingsTable()
+    : m_resolutions(std::begin(kDefaultResolutions), std::end(kDefaultResolutions))
+{
+}
+
+bool OptimalSettingsTable::SetResolutions(const DLSSResolution* resolutions, int count)
+{
+    std::vector<DLSSResolution> unique;
+    for (int i = 0; resolutions && i < count; ++i)
+    {
+        const DLSSResolution& resolution = resolutions[i];
+        const bool duplicate = std::any_of(unique.begin(), unique.end(), [&](const DLSSResolution& other)
+        {
+            return other.width == resolution.width && other.height == resolution.height;
+        });
+        if (resolution.width > 0 && resolution.height > 0 && !duplicate)
+        {
+            unique.push_back(resolution);
+        }
+    }
+
+    if (unique.size() > DLSS_MAX_OPTIMAL_SETTINGS_RESOLUTIONS)
+    {
+        return false;
+    }
+    if (unique.empty())
+    {
+        unique.assign(std::begin(kDefaultResolutions), std::end(kDefaultResolutions));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_resolutions = std::move(unique);
+    return true;
+}
+
+std::vector<DLSSResolution> OptimalSettingsTable::GetResolutions() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_resolutions;
+}
+
+void OptimalSettingsTable::Store(std::vector<DLSSOptimalSettings> rows)
+{
+    std::unordered_map<uint64_t, uint32_t> firstRow;
+    firstRow.reserve(rows.size() / DLSS_PERF_QUALITY_COUNT);
+    for (size_t i = 0; i + DLSS_PERF_QUALITY_COUNT <= rows.size(); i += DLSS_PERF_QUALITY_COUNT)
+    {
+        firstRow.emplace(MakeKey(rows[i].outputWidth, rows[i].outputHeight), static_cast<uint32_t>(i));
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_rows = std::move(rows);
+    m_firstRow = std::move(firstRow);
+}
+
+void OptimalSettingsTable::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_rows.clear();
+    m_firstRow.clear();
+}
+
+int OptimalSettingsTable::Snapshot(DLSSOptimalSettings* outSettings, int maxCount) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const int count = static_cast<int>(m_rows.size());
+    if (outSettings && maxCount > 0)
+    {
+        std::copy_n(m_rows.begin(), std::min(count, maxCount), outSettings);
+    }
+    return count;
+}
+
+bool OptimalSettingsTable::Lookup(unsigned int outputWidth, unsigned int outputHeight, int perfQuality,
+    DLSSOptimalSettings* outSettings) const
+{
+    if (!outSettings || perfQuality < 0 || perfQuality >= DLSS_PERF_QUALITY_COUNT)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_firstRow.find(MakeKey(outputWidth, outputHeight));
+    if (it == m_firstRow.end())
+    {
+        return false;
+    }
+
+    const DLSSOptimalSettings& row = m_rows[it->second + perfQuality];
+    if (row.renderWidth == 0 || row.renderHeight == 0)
+    {
+        return false;
+    }
+    *outSettings = row;
+    return true;
+}
+
+} // namespace dlss
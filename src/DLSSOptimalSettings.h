@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// DLSSOptimalSettings.h - Precomputed DLSS optimal settings table
+//------------------------------------------------------------------------------
+// Holds the NGX optimal-settings answers (optimal, min and max render size and
+// sharpness) for every PerfQualityValue at a configurable list of output
+// resolutions. The plugin fills the table once after NGX init; lookups are a
+// hash probe on the output size plus the quality index, with no NGX calls.
+// Rows are stored resolution-major, DLSS_PERF_QUALITY_COUNT rows per
+// resolution in PerfQualityValue order, which is also the order
+// DLSS_GetOptimalSettingsTable returns them in.
+// Internal use only - exposed to C# through DLSS_GetOptimalSettingsTable and
+// DLSS_LookupOptimalSettings.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+class OptimalSettingsTable
+{
+public:
+    static OptimalSettingsTable& Instance();
+
+    // Non-copyable
+    OptimalSettingsTable(const OptimalSettingsTable&) = delete;
+    OptimalSettingsTable& operator=(const OptimalSettingsTable&) = delete;
+
+    /// Replace the output resolutions the next Build covers. Duplicates and
+    /// zero sizes are dropped; an empty list restores the defaults.
+    /// @return false if more than DLSS_MAX_OPTIMAL_SETTINGS_RESOLUTIONS remain.
+    bool SetResolutions(const DLSSResolution* resolutions, int count);
+
+    std::vector<DLSSResolution> GetResolutions() const;
+
+    /// Replace the table. rows must hold DLSS_PERF_QUALITY_COUNT entries per
+    /// resolution in PerfQualityValue order.
+    void Store(std::vector<DLSSOptimalSettings> rows);
+
+    /// Drop the table (called on shutdown). The resolution list is kept.
+    void Clear();
+
+    /// Copy rows into a caller-provided array.
+    /// @return Total number of rows (may exceed maxCount).
+    int Snapshot(DLSSOptimalSettings* outSettings, int maxCount) const;
+
+    /// @return false if the output size is not in the table or its NGX query failed.
+    bool Lookup(unsigned int outputWidth, unsigned int outputHeight, int perfQuality, DLSSOptimalSettings* outSettings) const;
+
+private:
+    OptimalSettingsTable();
+
+    static uint64_t MakeKey(unsigned int width, unsigned int height)
+    {
+        return (static_cast<uint64_t>(width) << 32) | height;
+    }
+
+    std::vector<DLSSResolution> m_resolutions;
+    std::vector<DLSSOptimalSettings> m_rows;
+    std::unordered_map<uint64_t, uint32_t> m_firstRow;     // Output size -> index of its MaxPerf row
+    mutable std::mutex m_mutex;
+};
+
+} // namespace dlss
@@ -8,22 +8,47 @@
 
 
 
-#include <d3d12.h>
+#include <algorithm>
+#include <atomic>
+#include <string>
 #include <unordered_map>
 #include <sstream>
-
-// NGX SDK headers
-#include <nvsdk_ngx.h>
-#include <nvsdk_ngx_defs.h>
-#include <nvsdk_ngx_params.h>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// Graphics API + NGX SDK headers (or the null backend)
+#include "DLSSBackend.h"
 #include "DLSSPluginLite.h"
-#include "IUnityGraphicsD3D12.h"
+#include "DLSSBindingSet.h"
+#include "DLSSCalibration.h"
+#include "DLSSCapabilities.h"
+#include "DLSSCapabilityCache.h"
+#include "DLSSCapture.h"
+#include "DLSSCircuitBreaker.h"
+#include "DLSSDynamicResolution.h"
+#include "DLSSErrorTracker.h"
+#include "DLSSFlightRecorder.h"
+#include "DLSSGpuTimer.h"
+#include "DLSSGraphicsBackend.h"
+#include "DLSSInitEvent.h"
+#include "DLSSJitter.h"
+#include "DLSSOptimalSettings.h"
+#include "DLSSProfiler.h"
+#include "DLSSTelemetry.h"
+#include "DLSSTextureRegistry.h"
+#include "DLSSTrace.h"
+#include "DLSSTiming.h"
 #include "IUnityLog.h"
 //------------------------------------------------------------------------------
 // External Unity interfaces (defined in Plugin.cpp)
 //------------------------------------------------------------------------------
-extern IUnityGraphicsD3D12v8* g_unityGraphics_D3D12;
+extern std::unique_ptr<dlss::GraphicsBackend> g_graphicsBackend;
 extern IUnityLog* g_unityLog;
+extern UnityEventQueue::IUnityEventQueue* g_unityEventQueue;
 
 //------------------------------------------------------------------------------
 // Logging Helpers
@@ -53,21 +78,34 @@ static void LogError(const char* msg)
     }
 }
 
-static void LogDlssResult(NVSDK_NGX_Result result, const char* functionName)
+static void LogDlssResult(NVSDK_NGX_Result result, const char* functionName,
+    int handle = DLSS_INVALID_FEATURE_HANDLE)
 {
     if (!NVSDK_NGX_SUCCEED(result))
     {
+        // Repeated failures are rate-limited per (handle, result) pair
+        uint64_t suppressed = 0;
+        if (!dlss::ErrorTracker::Instance().Record(handle, static_cast<int>(result), &suppressed))
+        {
+            return;
+        }
+
         std::ostringstream oss;
         oss << "[DLSS] " << functionName << " failed with error code: 0x"
             << std::hex << result << std::dec;
 
+        if (handle != DLSS_INVALID_FEATURE_HANDLE)
+        {
+            oss << " (handle=" << handle << ")";
+        }
+
         switch (result)
         {
         case NVSDK_NGX_Result_FAIL_FeatureNotSupported:
             oss << " - Feature not supported on current hardware";
             break;
         case NVSDK_NGX_Result_FAIL_PlatformError:
-            oss << " - Platform error, check D3D12 debug layer for more info";
+            oss << " - Platform error, check the D3D12 debug layer or Vulkan validation layers for more info";
             break;
         case NVSDK_NGX_Result_FAIL_FeatureAlreadyExists:
             oss << " - Feature with given parameters already exists";
@@ -122,10 +160,27 @@ static void LogDlssResult(NVSDK_NGX_Result result, const char* functionName)
             break;
         }
 
+        if (suppressed > 0)
+        {
+            oss << " [repeated " << suppressed << " more times since last report]";
+        }
+
         LogError(oss.str().c_str());
     }
 }
 
+// Backend for Unity's renderer, or null (with an error logged) before device
+// initialization, after device shutdown and on renderers DLSS does not support
+static dlss::GraphicsBackend* GetGraphicsBackend(const char* caller)
+{
+    if (!g_graphicsBackend)
+    {
+        LogError((std::string(caller) + ": DLSS does not support Unity's graphics API").c_str());
+        return nullptr;
+    }
+    return g_graphicsBackend.get();
+}
+
 // Helper function to convert NVSDK_NGX_Feature to string
 static const char* GetFeatureString(NVSDK_NGX_Feature feature)
 {
@@ -148,6 +203,11 @@ static const char* GetFeatureString(NVSDK_NGX_Feature feature)
 
 static void NVSDK_CONV NGXLogCallback(const char* message, NVSDK_NGX_Logging_Level loggingLevel, NVSDK_NGX_Feature sourceComponent)
 {
+    if (dlss::Tracer::IsActive())
+    {
+        dlss::Tracer::Instance().RecordLog("NGX", message);
+    }
+
     std::ostringstream oss;
     oss << "[NGX][" << GetFeatureString(sourceComponent) << "]: " << message;
 
@@ -169,401 +229,2226 @@ static void NVSDK_CONV NGXLogCallback(const char* message, NVSDK_NGX_Logging_Lev
 // Feature Handle Management
 //------------------------------------------------------------------------------
 
+/// Per-handle state. ngxHandle is null until the CreateFeature render event succeeds.
+struct FeatureEntry
+{
+    NVSDK_NGX_Handle* ngxHandle = nullptr;
+    NVSDK_NGX_Feature feature = NVSDK_NGX_Feature_SuperSampling;
+    unsigned int renderWidth = 0;
+    unsigned int renderHeight = 0;
+    unsigned int outputWidth = 0;
+    unsigned int outputHeight = 0;
+    const dlss::JitterTable* jitter = nullptr;          // Halton table for the creation size
+};
+
 static uint32_t g_featureHandleCounter = 0;
-static std::unordered_map<int, NVSDK_NGX_Handle*> g_featureHandles;
+static std::unordered_map<int, FeatureEntry> g_featureHandles;
 
 //------------------------------------------------------------------------------
-// Initialization/Shutdown
+// Init State
 //------------------------------------------------------------------------------
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Init_with_ProjectID_D3D12(
-    const DLSSInitParams* params)
+// DLSSInitState; the thread that runs NGX init stores Ready or Failed with release
+// semantics, so the globals it set are visible to whoever observes the new state
+static std::atomic<int> g_initState{DLSS_InitState_NotInitialized};
+static std::atomic<int> g_initResult{0};
+static std::thread g_initThread;
+
+// DLSS_RunCalibration creates, evaluates and releases features through the same NGX context
+// and queue as the render thread. It holds g_calibrationMutex for the whole run; render events
+// only try to take it and are dropped with DLSS_RESULT_FAIL_NOT_READY while a run holds it,
+// so the render thread never waits for a calibration. g_calibrationRunning turns a second
+// caller away instead of queueing it behind the first.
+static std::mutex g_calibrationMutex;
+static std::atomic<bool> g_calibrationRunning{false};
+
+// Exports that need NGX fail fast with DLSS_RESULT_FAIL_NOT_READY instead of waiting for the init
+static bool IsInitializing()
 {
-    if (!params)
-    {
-        LogError("DLSS_Init_with_ProjectID_D3D12: params is null");
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
-    }
+    return g_initState.load(std::memory_order_acquire) == DLSS_InitState_Initializing;
+}
 
-    if (!g_unityGraphics_D3D12)
+static void JoinInitThread()
+{
+    if (g_initThread.joinable())
     {
-        LogError("DLSS_Init_with_ProjectID_D3D12: Unity D3D12 interface not available");
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+        g_initThread.join();
     }
+}
 
-    ID3D12Device* device = g_unityGraphics_D3D12->GetDevice();
-    if (!device)
-    {
-        LogError("DLSS_Init_with_ProjectID_D3D12: D3D12 device not available");
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
-    }
+//------------------------------------------------------------------------------
+// Profiler Counters
+//------------------------------------------------------------------------------
 
-    // Create feature common info for logging
-    NVSDK_NGX_FeatureCommonInfo featureInfo = {};
-    featureInfo.LoggingInfo.LoggingCallback = NGXLogCallback;
-    featureInfo.LoggingInfo.MinimumLoggingLevel = static_cast<NVSDK_NGX_Logging_Level>(params->loggingLevel);
-    featureInfo.LoggingInfo.DisableOtherLoggingSinks = true;
+// Render-thread only. liveFeatures persists across frames, the rest is per frame.
+static dlss::ProfilerFrameCounters g_frameCounters;
 
-    // Initialize NGX
-    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_Init_with_ProjectID(
-        params->projectId,
-        static_cast<NVSDK_NGX_EngineType>(params->engineType),
-        params->engineVersion,
-        params->applicationDataPath,
-        device,
-        &featureInfo,
-        NVSDK_NGX_Version_API);
+// Render-thread only. Ray Reconstruction features among liveFeatures, whose VRAM NGX reports separately.
+static uint32_t g_liveRayReconstructionFeatures = 0;
 
-    LogDlssResult(result, "NVSDK_NGX_D3D12_Init_with_ProjectID");
+// Set by DLSS_Shutdown_D3D12 after it released every feature on the calling thread; the render
+// thread zeroes its live counts when it sees it, so g_frameCounters stays render-thread only
+static std::atomic<bool> g_liveFeaturesReleased{false};
 
-    if (NVSDK_NGX_SUCCEED(result))
+// Capability parameter block kept alive for NGX VRAM statistics. Guarded by g_statsMutex:
+// EndFrame runs the stats callbacks on it while DLSS_Shutdown_D3D12 may be destroying it.
+static std::mutex g_statsMutex;
+static NVSDK_NGX_Parameter* g_statsParameters = nullptr;
+
+// One NGX VRAM statistics query, as NGX_DLSS_GET_STATS / NGX_DLSSD_GET_STATS do it: SizeInBytes
+// only holds the current allocation size right after the feature's stats callback has run
+static unsigned long long QueryVramBytes(NVSDK_NGX_Parameter* capabilities, const char* callbackName)
+{
+    void* callbackPointer = nullptr;
+    NVSDK_NGX_Parameter_GetVoidPointer(capabilities, callbackName, &callbackPointer);
+    auto callback = reinterpret_cast<PFN_NVSDK_NGX_DLSS_GetStatsCallback>(callbackPointer);
+
+    unsigned long long vramBytes = 0;
+    if (callback && NVSDK_NGX_SUCCEED(callback(capabilities)))
     {
-        LogMessage("[DLSS] Initialized successfully");
+        NVSDK_NGX_Parameter_GetULL(capabilities, NVSDK_NGX_Parameter_SizeInBytes, &vramBytes);
     }
-
-    return static_cast<int>(result);
+    return vramBytes;
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Shutdown_D3D12(void)
+static void ApplyReleasedFeatures()
 {
-    if (!g_unityGraphics_D3D12)
+    if (g_liveFeaturesReleased.exchange(false, std::memory_order_acq_rel))
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+        g_frameCounters.liveFeatures = 0;
+        g_liveRayReconstructionFeatures = 0;
     }
+}
 
-    ID3D12Device* device = g_unityGraphics_D3D12->GetDevice();
-
-    // Release all feature handles
-    for (auto& pair : g_featureHandles)
+static void FlushFrameCounters(const DLSSEndFrameParams* params)
+{
+    // Also feeds the VRAM fields of DLSS_QueryCapabilities, so read even with the profiler off
+    g_frameCounters.ngxVramBytes = 0;
+    std::lock_guard<std::mutex> lock(g_statsMutex);
+    if (!IsInitializing() && g_statsParameters)
     {
-        if (pair.second != nullptr)
+        unsigned long long vramBytes = QueryVramBytes(g_statsParameters, NVSDK_NGX_Parameter_DLSSGetStatsCallback);
+        if (g_liveRayReconstructionFeatures > 0)
         {
-            NVSDK_NGX_D3D12_ReleaseFeature(pair.second);
+            vramBytes += QueryVramBytes(g_statsParameters, NVSDK_NGX_Parameter_DLSSDGetStatsCallback);
         }
+        g_frameCounters.ngxVramBytes = vramBytes;
+        dlss::Capabilities::Instance().UpdateVram(vramBytes);
     }
-    g_featureHandles.clear();
-    g_featureHandleCounter = 0;
-
-    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_Shutdown1(device);
-    LogDlssResult(result, "NVSDK_NGX_D3D12_Shutdown1");
-
-    LogMessage("[DLSS] Shutdown complete");
-    return static_cast<int>(result);
-}
-
-//------------------------------------------------------------------------------
-// Parameter Management
-//------------------------------------------------------------------------------
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_AllocateParameters_D3D12(void** ppOutParameters)
-{
-    if (!ppOutParameters)
+    dlss::Profiler& profiler = dlss::Profiler::Instance();
+    if (profiler.IsEnabled())
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        g_frameCounters.ringBufferBytesUsed = params ? params->ringBufferBytesUsed : 0;
+        profiler.FlushFrameCounters(g_frameCounters);
     }
 
-    NVSDK_NGX_Parameter* params = nullptr;
-    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_AllocateParameters(&params);
-    *ppOutParameters = params;
-
-    LogDlssResult(result, "NVSDK_NGX_D3D12_AllocateParameters");
-    return static_cast<int>(result);
+    g_frameCounters.evaluates = 0;
+    g_frameCounters.creates = 0;
+    g_frameCounters.destroys = 0;
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetCapabilityParameters_D3D12(void** ppOutParameters)
+static dlss::ProfilerSampleInfo MakeSampleInfo(int handle, const FeatureEntry& entry)
 {
-    if (!ppOutParameters)
-    {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
-    }
-
-    NVSDK_NGX_Parameter* params = nullptr;
-    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_GetCapabilityParameters(&params);
-    *ppOutParameters = params;
-
-    LogDlssResult(result, "NVSDK_NGX_D3D12_GetCapabilityParameters");
-    return static_cast<int>(result);
+    dlss::ProfilerSampleInfo info;
+    info.handle = handle;
+    info.feature = static_cast<int>(entry.feature);
+    info.renderWidth = entry.renderWidth;
+    info.renderHeight = entry.renderHeight;
+    info.outputWidth = entry.outputWidth;
+    info.outputHeight = entry.outputHeight;
+    return info;
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DestroyParameters_D3D12(void* pInParameters)
+// Dynamic resolution range of a new feature: the DLSS.Get.Dynamic.* values the
+// optimal-settings query leaves in the parameter block, else the creation size
+// down to a third of the output size (Ultra Performance).
+static dlss::DrsRange GetDrsRange(NVSDK_NGX_Parameter* ngxParams, const FeatureEntry& entry)
 {
-    if (!pInParameters)
+    dlss::DrsRange range;
+    range.maxWidth = entry.renderWidth;
+    range.maxHeight = entry.renderHeight;
+    range.minWidth = entry.outputWidth > 0 ? (entry.outputWidth + 2) / 3 : entry.renderWidth / 2;
+    range.minHeight = entry.outputHeight > 0 ? (entry.outputHeight + 2) / 3 : entry.renderHeight / 2;
+
+    if (ngxParams)
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, &range.maxWidth);
+        NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, &range.maxHeight);
+        NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, &range.minWidth);
+        NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, &range.minHeight);
     }
 
-    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_DestroyParameters(
-        static_cast<NVSDK_NGX_Parameter*>(pInParameters));
-
-    LogDlssResult(result, "NVSDK_NGX_D3D12_DestroyParameters");
-    return static_cast<int>(result);
+    // The feature cannot render above its creation size
+    if (entry.renderWidth > 0 && entry.renderHeight > 0)
+    {
+        range.maxWidth = std::min(range.maxWidth, entry.renderWidth);
+        range.maxHeight = std::min(range.maxHeight, entry.renderHeight);
+    }
+    return range;
 }
 
 //------------------------------------------------------------------------------
-// Parameter Setters
+// Capabilities
 //------------------------------------------------------------------------------
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetULL(
-    void* pParameters, const char* paramName, unsigned long long value)
+// Missing parameters (older drivers, features NGX does not know) read as zero
+static DLSSFeatureCapability ReadFeatureCapability(NVSDK_NGX_Parameter* capabilities, const char* available,
+    const char* needsUpdatedDriver, const char* minDriverVersionMajor, const char* minDriverVersionMinor,
+    const char* featureInitResult)
 {
-    if (pParameters && paramName)
-    {
-        NVSDK_NGX_Parameter_SetULL(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
-    }
+    DLSSFeatureCapability feature = {};
+    NVSDK_NGX_Parameter_GetI(capabilities, available, &feature.available);
+    NVSDK_NGX_Parameter_GetI(capabilities, needsUpdatedDriver, &feature.needsUpdatedDriver);
+    NVSDK_NGX_Parameter_GetUI(capabilities, minDriverVersionMajor, &feature.minDriverVersionMajor);
+    NVSDK_NGX_Parameter_GetUI(capabilities, minDriverVersionMinor, &feature.minDriverVersionMinor);
+    NVSDK_NGX_Parameter_GetI(capabilities, featureInitResult, &feature.featureInitResult);
+    return feature;
 }
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetF(
-    void* pParameters, const char* paramName, float value)
+static DLSSCapabilityInfo ReadCapabilities(NVSDK_NGX_Result initResult, NVSDK_NGX_Result capabilityResult,
+    NVSDK_NGX_Parameter* capabilities)
 {
-    if (pParameters && paramName)
+    DLSSCapabilityInfo info = {};
+    info.initResult = static_cast<int>(initResult);
+    info.capabilityResult = static_cast<int>(capabilityResult);
+    if (capabilities)
     {
-        NVSDK_NGX_Parameter_SetF(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+        info.superResolution = ReadFeatureCapability(capabilities,
+            NVSDK_NGX_Parameter_SuperSampling_Available,
+            NVSDK_NGX_Parameter_SuperSampling_NeedsUpdatedDriver,
+            NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMajor,
+            NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMinor,
+            NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult);
+        info.rayReconstruction = ReadFeatureCapability(capabilities,
+            NVSDK_NGX_Parameter_SuperSamplingDenoising_Available,
+            NVSDK_NGX_Parameter_SuperSamplingDenoising_NeedsUpdatedDriver,
+            NVSDK_NGX_Parameter_SuperSamplingDenoising_MinDriverVersionMajor,
+            NVSDK_NGX_Parameter_SuperSamplingDenoising_MinDriverVersionMinor,
+            NVSDK_NGX_Parameter_SuperSamplingDenoising_FeatureInitResult);
+        info.frameGeneration = ReadFeatureCapability(capabilities,
+            NVSDK_NGX_Parameter_FrameGeneration_Available,
+            NVSDK_NGX_Parameter_FrameGeneration_NeedsUpdatedDriver,
+            NVSDK_NGX_Parameter_FrameGeneration_MinDriverVersionMajor,
+            NVSDK_NGX_Parameter_FrameGeneration_MinDriverVersionMinor,
+            NVSDK_NGX_Parameter_FrameGeneration_FeatureInitResult);
     }
+    return info;
 }
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetD(
-    void* pParameters, const char* paramName, double value)
+static void StoreCapabilities(const DLSSCapabilityInfo& info)
 {
-    if (pParameters && paramName)
+    dlss::Capabilities::Instance().Store(info);
+
+    if (info.superResolution.needsUpdatedDriver || info.rayReconstruction.needsUpdatedDriver)
     {
-        NVSDK_NGX_Parameter_SetD(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+        const DLSSFeatureCapability& feature = info.superResolution.needsUpdatedDriver ? info.superResolution : info.rayReconstruction;
+        std::ostringstream oss;
+        oss << "[DLSS] Driver update required, minimum driver version " << feature.minDriverVersionMajor << "."
+            << feature.minDriverVersionMinor;
+        LogWarning(oss.str().c_str());
     }
 }
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetUI(
-    void* pParameters, const char* paramName, unsigned int value)
+//------------------------------------------------------------------------------
+// Optimal Settings Table
+//------------------------------------------------------------------------------
+
+// One NGX optimal-settings query, as NGX_DLSS_GET_OPTIMAL_SETTINGS does it
+static NVSDK_NGX_Result QueryOptimalSettings(NVSDK_NGX_Parameter* capabilities,
+    PFN_NVSDK_NGX_DLSS_GetOptimalSettingsCallback callback, DLSSOptimalSettings* row)
 {
-    if (pParameters && paramName)
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_Width, row->outputWidth);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_Height, row->outputHeight);
+    NVSDK_NGX_Parameter_SetI(capabilities, NVSDK_NGX_Parameter_PerfQualityValue, row->perfQuality);
+    NVSDK_NGX_Parameter_SetI(capabilities, NVSDK_NGX_Parameter_RTXValue, 0);
+
+    // Outputs left over from the previous quality must not leak into this row
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_OutWidth, 0);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_OutHeight, 0);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, 0);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, 0);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, 0);
+    NVSDK_NGX_Parameter_SetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, 0);
+    NVSDK_NGX_Parameter_SetF(capabilities, NVSDK_NGX_Parameter_Sharpness, 0.0f);
+
+    NVSDK_NGX_Result result = callback(capabilities);
+    row->result = static_cast<int>(result);
+    if (NVSDK_NGX_SUCCEED(result))
     {
-        NVSDK_NGX_Parameter_SetUI(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_OutWidth, &row->renderWidth);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_OutHeight, &row->renderHeight);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, &row->maxRenderWidth);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, &row->maxRenderHeight);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, &row->minRenderWidth);
+        NVSDK_NGX_Parameter_GetUI(capabilities, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, &row->minRenderHeight);
+        NVSDK_NGX_Parameter_GetF(capabilities, NVSDK_NGX_Parameter_Sharpness, &row->sharpness);
     }
-}
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetI(
-    void* pParameters, const char* paramName, int value)
-{
-    if (pParameters && paramName)
+    // Modes the driver does not support succeed with a zero size on some versions
+    if (!NVSDK_NGX_SUCCEED(result) || row->renderWidth == 0 || row->renderHeight == 0)
     {
-        NVSDK_NGX_Parameter_SetI(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+        DLSSOptimalSettings failed = {};
+        failed.outputWidth = row->outputWidth;
+        failed.outputHeight = row->outputHeight;
+        failed.perfQuality = row->perfQuality;
+        failed.result = row->result;
+        *row = failed;
     }
+    return result;
 }
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetD3d12Resource(
-    void* pParameters, const char* paramName, void* value)
+// Query every (output resolution, quality) pair once so lookups never reach NGX
+static void ComputeOptimalSettings(NVSDK_NGX_Parameter* capabilities, const std::vector<DLSSResolution>& resolutions,
+    std::vector<DLSSOptimalSettings>* outRows)
 {
-    if (pParameters && paramName)
+    outRows->clear();
+
+    void* callbackPointer = nullptr;
+    NVSDK_NGX_Parameter_GetVoidPointer(capabilities, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, &callbackPointer);
+    auto callback = reinterpret_cast<PFN_NVSDK_NGX_DLSS_GetOptimalSettingsCallback>(callbackPointer);
+    if (!callback)
     {
-        NVSDK_NGX_Parameter_SetD3d12Resource(
-            static_cast<NVSDK_NGX_Parameter*>(pParameters),
-            paramName,
-            static_cast<ID3D12Resource*>(value));
+        LogWarning("[DLSS] NGX optimal settings callback not available, the optimal settings table is empty");
+        return;
     }
-}
 
-void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetVoidPointer(
-    void* pParameters, const char* paramName, void* value)
-{
-    if (pParameters && paramName)
+    const uint64_t startNs = dlss::MonotonicNs();
+    outRows->reserve(resolutions.size() * DLSS_PERF_QUALITY_COUNT);
+    int failures = 0;
+    for (const DLSSResolution& resolution : resolutions)
     {
-        NVSDK_NGX_Parameter_SetVoidPointer(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+        for (int quality = 0; quality < DLSS_PERF_QUALITY_COUNT; ++quality)
+        {
+            DLSSOptimalSettings row = {};
+            row.outputWidth = resolution.width;
+            row.outputHeight = resolution.height;
+            row.perfQuality = quality;
+            QueryOptimalSettings(capabilities, callback, &row);
+            failures += row.renderWidth == 0 ? 1 : 0;
+            outRows->push_back(row);
+        }
     }
+
+    std::ostringstream oss;
+    oss << "[DLSS] Optimal settings table: " << outRows->size() << " entries for " << resolutions.size()
+        << " resolutions (" << failures << " unsupported) in "
+        << static_cast<double>(dlss::MonotonicNs() - startNs) / 1e6 << " ms";
+    LogMessage(oss.str().c_str());
 }
 
 //------------------------------------------------------------------------------
-// Parameter Getters
+// Capability Cache
 //------------------------------------------------------------------------------
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetULL(
-    void* pParameters, const char* paramName, unsigned long long* pValue)
+// Set by init before any reader starts; empty when no applicationDataPath was given
+static std::filesystem::path g_capabilityCachePath;
+static dlss::CapabilityCacheKey g_capabilityCacheKey;
+static std::thread g_capabilityCacheRevalidation;
+
+// Capabilities and optimal settings straight from NGX. Uses its own capability
+// block: g_statsParameters is read on the render thread.
+static NVSDK_NGX_Result ComputeCapabilityData(dlss::GraphicsBackend& backend, NVSDK_NGX_Result initResult,
+    dlss::CapabilityCacheData* outData)
 {
-    if (!pParameters || !paramName || !pValue)
+    NVSDK_NGX_Parameter* capabilities = nullptr;
+    NVSDK_NGX_Result result = backend.GetCapabilityParameters(&capabilities);
+    LogDlssResult(result, backend.GetCallName(dlss::NgxCall::GetCapabilityParameters));
+
+    outData->capabilities = ReadCapabilities(initResult, result, NVSDK_NGX_SUCCEED(result) ? capabilities : nullptr);
+    outData->resolutions = dlss::OptimalSettingsTable::Instance().GetResolutions();
+    outData->optimalSettings.clear();
+    if (NVSDK_NGX_SUCCEED(result))
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        ComputeOptimalSettings(capabilities, outData->resolutions, &outData->optimalSettings);
+        backend.DestroyParameters(capabilities);
     }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetULL(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue));
+    return result;
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetF(
-    void* pParameters, const char* paramName, float* pValue)
+static void ApplyCapabilityData(const dlss::CapabilityCacheData& data)
 {
-    if (!pParameters || !paramName || !pValue)
-    {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
-    }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetF(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue));
+    StoreCapabilities(data.capabilities);
+    dlss::OptimalSettingsTable::Instance().Store(data.optimalSettings);
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetD(
-    void* pParameters, const char* paramName, double* pValue)
+static void WriteCapabilityCache(const dlss::CapabilityCacheData& data)
 {
-    if (!pParameters || !paramName || !pValue)
+    if (!g_capabilityCachePath.empty() && !dlss::SaveCapabilityCache(g_capabilityCachePath, g_capabilityCacheKey, data))
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        LogWarning("[DLSS] Failed to write the capability cache");
     }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetD(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue));
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetUI(
-    void* pParameters, const char* paramName, unsigned int* pValue)
+// Compute from NGX, publish and write the cache (cache miss or a new resolution list)
+static void RefreshCapabilityData(dlss::GraphicsBackend& backend, NVSDK_NGX_Result initResult)
 {
-    if (!pParameters || !paramName || !pValue)
+    dlss::CapabilityCacheData data;
+    const bool computed = NVSDK_NGX_SUCCEED(ComputeCapabilityData(backend, initResult, &data));
+    ApplyCapabilityData(data);
+    if (computed)
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        WriteCapabilityCache(data);
     }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetUI(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue));
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetI(
-    void* pParameters, const char* paramName, int* pValue)
+// Runs on g_capabilityCacheRevalidation after init was served from the cache
+static void RevalidateCapabilityCache(dlss::GraphicsBackend* backend, dlss::CapabilityCacheData cached)
 {
-    if (!pParameters || !paramName || !pValue)
+    dlss::CapabilityCacheData fresh;
+    if (!NVSDK_NGX_SUCCEED(ComputeCapabilityData(*backend, NVSDK_NGX_Result_Success, &fresh)))
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        return;
     }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetI(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue));
-}
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetD3d12Resource(
-    void* pParameters, const char* paramName, void** ppValue)
-{
-    if (!pParameters || !paramName || !ppValue)
+    if (dlss::IsSameCapabilityData(cached, fresh))
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        LogMessage("[DLSS] Capability cache revalidated, no changes");
+        return;
     }
-    ID3D12Resource* resource = nullptr;
-    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetD3d12Resource(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, &resource);
-    *ppValue = resource;
-    return static_cast<int>(result);
+
+    ApplyCapabilityData(fresh);
+    WriteCapabilityCache(fresh);
+    LogMessage("[DLSS] Capability cache was stale and has been refreshed");
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetVoidPointer(
-    void* pParameters, const char* paramName, void** ppValue)
+static void JoinCapabilityCacheRevalidation()
 {
-    if (!pParameters || !paramName || !ppValue)
+    if (g_capabilityCacheRevalidation.joinable())
     {
-        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        g_capabilityCacheRevalidation.join();
     }
-    return static_cast<int>(NVSDK_NGX_Parameter_GetVoidPointer(
-        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, ppValue));
 }
 
-//------------------------------------------------------------------------------
-// Feature Handle Management
-//------------------------------------------------------------------------------
-
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_AllocateFeatureHandle(void)
+// Serve DLSS_QueryCapabilities and the optimal settings table from disk before NGX is up
+static bool ReadCapabilityCache(const dlss::GraphicsBackend& backend, const wchar_t* applicationDataPath,
+    dlss::CapabilityCacheData* outData)
 {
-    // Find next available handle (wrap around at 1024)
-    int handle = static_cast<int>(g_featureHandleCounter % 1024);
+    g_capabilityCachePath.clear();
+    if (!applicationDataPath || applicationDataPath[0] == L'\0')
+    {
+        return false;
+    }
 
-    if (g_featureHandles.find(handle) != g_featureHandles.end())
+    g_capabilityCachePath = std::filesystem::path(applicationDataPath) / dlss::kCapabilityCacheFileName;
+    g_capabilityCacheKey = backend.MakeCapabilityCacheKey();
+
+    if (!dlss::LoadCapabilityCache(g_capabilityCachePath, g_capabilityCacheKey,
+            dlss::OptimalSettingsTable::Instance().GetResolutions(), outData))
     {
-        LogError("DLSS_AllocateFeatureHandle: handle already exists");
-        return DLSS_INVALID_FEATURE_HANDLE;
+        return false;
     }
 
-    g_featureHandles[handle] = nullptr;
-    g_featureHandleCounter++;
-    return handle;
+    ApplyCapabilityData(*outData);
+    LogMessage("[DLSS] Capabilities and optimal settings loaded from the capability cache");
+    return true;
 }
 
-int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_FreeFeatureHandle(int handle)
+// DLSS_RunCalibration results live next to the capability cache and share its key
+static std::filesystem::path GetCalibrationPath()
 {
-    auto it = g_featureHandles.find(handle);
-    if (it == g_featureHandles.end())
+    return g_capabilityCachePath.empty() ? std::filesystem::path() :
+        g_capabilityCachePath.parent_path() / dlss::kCalibrationFileName;
+}
+
+static void LoadCalibrationTable()
+{
+    dlss::CalibrationTable& table = dlss::CalibrationTable::Instance();
+    table.Clear();
+
+    const std::filesystem::path path = GetCalibrationPath();
+    if (!path.empty() && table.Load(path, g_capabilityCacheKey))
     {
-        LogError("DLSS_FreeFeatureHandle: handle does not exist");
-        return -1;
+        std::ostringstream oss;
+        oss << "[DLSS] " << table.Snapshot(nullptr, 0) << " calibration results loaded from disk";
+        LogMessage(oss.str().c_str());
     }
-
-    g_featureHandles.erase(it);
-    return 0;
 }
 
 //------------------------------------------------------------------------------
-// Render Event Handler
+// Initialization/Shutdown
 //------------------------------------------------------------------------------
 
-static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
+// DLSSInitParams with owned strings, so DLSS_InitAsync can return before the worker reads them
+class InitParamsCopy
 {
-    if (!data)
+public:
+    explicit InitParamsCopy(const DLSSInitParams& params)
+        : m_params(params)
+        , m_projectId(params.projectId ? params.projectId : "")
+        , m_engineVersion(params.engineVersion ? params.engineVersion : "")
+        , m_applicationDataPath(params.applicationDataPath ? params.applicationDataPath : L"")
     {
-        LogError("OnDLSSRenderEvent: data is null");
-        return;
     }
 
-    if (!g_unityGraphics_D3D12)
+    DLSSInitParams Get() const
     {
-        LogError("OnDLSSRenderEvent: Unity D3D12 interface not available");
-        return;
+        DLSSInitParams params = m_params;
+        params.projectId = m_params.projectId ? m_projectId.c_str() : nullptr;
+        params.engineVersion = m_params.engineVersion ? m_engineVersion.c_str() : nullptr;
+        params.applicationDataPath = m_params.applicationDataPath ? m_applicationDataPath.c_str() : nullptr;
+        return params;
     }
 
-    // Get command list from Unity
-    UnityGraphicsD3D12RecordingState recordingState = {};
-    if (!g_unityGraphics_D3D12->CommandRecordingState(&recordingState) || !recordingState.commandList)
-    {
-        LogError("OnDLSSRenderEvent: Failed to get command list from Unity");
-        return;
-    }
+private:
+    DLSSInitParams m_params;
+    std::string m_projectId;
+    std::string m_engineVersion;
+    std::wstring m_applicationDataPath;
+};
 
-    ID3D12GraphicsCommandList* cmdList = recordingState.commandList;
+static void RecordInitRejected(NVSDK_NGX_Result result)
+{
+    dlss::RecordFlightEvent(dlss::FlightEvent::Init, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result));
+}
 
-    switch (eventId)
-    {
-    case DLSS_Event_CreateFeature:
+// Checks shared by the synchronous and asynchronous init; on success outBackend is
+// the backend for Unity's renderer, whose device can be handed to NGX
+static int ValidateInit(const char* caller, const DLSSInitParams* params, dlss::GraphicsBackend** outBackend)
+{
+    *outBackend = nullptr;
+    if (!params)
     {
-        DLSSCreateFeatureParams* params = static_cast<DLSSCreateFeatureParams*>(data);
-        NVSDK_NGX_Parameter* ngxParams = static_cast<NVSDK_NGX_Parameter*>(params->parameters);
+        LogError((std::string(caller) + ": params is null").c_str());
+        RecordInitRejected(NVSDK_NGX_Result_FAIL_InvalidParameter);
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
 
-        NVSDK_NGX_Handle* ngxHandle = nullptr;
-        NVSDK_NGX_Feature feature = static_cast<NVSDK_NGX_Feature>(params->feature);
+    dlss::GraphicsBackend* backend = GetGraphicsBackend(caller);
+    if (!backend)
+    {
+        RecordInitRejected(NVSDK_NGX_Result_FAIL_PlatformError);
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+    }
 
-        NVSDK_NGX_Result result = NVSDK_NGX_D3D12_CreateFeature(
-            cmdList, feature, ngxParams, &ngxHandle);
+    const NVSDK_NGX_Result deviceResult = backend->CheckDevice();
+    if (!NVSDK_NGX_SUCCEED(deviceResult))
+    {
+        LogError((std::string(caller) + ": graphics device not available").c_str());
+        RecordInitRejected(deviceResult);
+        return static_cast<int>(deviceResult);
+    }
 
-        LogDlssResult(result, "NVSDK_NGX_D3D12_CreateFeature");
+    *outBackend = backend;
+    return static_cast<int>(NVSDK_NGX_Result_Success);
+}
 
-        if (NVSDK_NGX_SUCCEED(result))
+// Move to Initializing from NotInitialized or Failed. A running init or a live NGX
+// context (Ready, until DLSS_Shutdown_D3D12) turns the caller away. A capability cache
+// hit is applied here, on the caller's thread, so queries are answered while NGX initializes.
+static bool BeginInit(const char* caller, const DLSSInitParams& params, const dlss::GraphicsBackend& backend,
+    std::optional<dlss::CapabilityCacheData>* outCached)
+{
+    int state = g_initState.load(std::memory_order_acquire);
+    do
+    {
+        if (state != DLSS_InitState_NotInitialized && state != DLSS_InitState_Failed)
         {
-            g_featureHandles[params->handle] = ngxHandle;
-
-            std::ostringstream oss;
-            oss << "[DLSS] Created " << GetFeatureString(feature) << " feature, handle=" << params->handle;
-            LogMessage(oss.str().c_str());
+            LogWarning((std::string(caller) + (state == DLSS_InitState_Initializing ?
+                ": DLSS_InitAsync is still running" : ": already initialized, call DLSS_Shutdown_D3D12 first")).c_str());
+            dlss::RecordFlightEvent(dlss::FlightEvent::Init, DLSS_INVALID_FEATURE_HANDLE, DLSS_RESULT_FAIL_NOT_READY,
+                static_cast<uint64_t>(state));
+            return false;
         }
-        break;
-    }
+    } while (!g_initState.compare_exchange_weak(state, DLSS_InitState_Initializing, std::memory_order_acq_rel));
 
-    case DLSS_Event_EvaluateFeature:
+    // A previous DLSS_InitAsync worker has finished but may not have been joined yet
+    JoinInitThread();
+    dlss::ErrorTracker::Instance().Reset();
+    JoinCapabilityCacheRevalidation();
+
+    dlss::CapabilityCacheData cached;
+    if (ReadCapabilityCache(backend, params.applicationDataPath, &cached))
     {
-        DLSSEvaluateFeatureParams* params = static_cast<DLSSEvaluateFeatureParams*>(data);
+        *outCached = std::move(cached);
+    }
+    LoadCalibrationTable();
+    return true;
+}
+
+// NGX init and everything that depends on it. Runs on the caller's thread for
+// DLSS_Init_with_ProjectID_D3D12 and on g_initThread for DLSS_InitAsync.
+// cached holds the capability cache contents if BeginInit found a valid file.
+static NVSDK_NGX_Result InitializeNGX(dlss::GraphicsBackend* backend, const DLSSInitParams& params,
+    std::optional<dlss::CapabilityCacheData> cached)
+{
+    // Create feature common info for logging
+    NVSDK_NGX_FeatureCommonInfo featureInfo = {};
+    featureInfo.LoggingInfo.LoggingCallback = NGXLogCallback;
+    featureInfo.LoggingInfo.MinimumLoggingLevel = static_cast<NVSDK_NGX_Logging_Level>(params.loggingLevel);
+    featureInfo.LoggingInfo.DisableOtherLoggingSinks = true;
+
+    // Initialize NGX
+    dlss::ProfilerScope profilerScope(dlss::ProfilerMarker::Init);
+    NVSDK_NGX_Result result = backend->Init(params, &featureInfo);
+    profilerScope.SetResult(static_cast<int>(result));
+
+    LogDlssResult(result, backend->GetCallName(dlss::NgxCall::Init));
+    dlss::RecordFlightEvent(dlss::FlightEvent::Init, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result));
+
+    if (NVSDK_NGX_SUCCEED(result))
+    {
+        LogMessage("[DLSS] Initialized successfully");
+
+        // EndFrame runs the DLSS / DLSSD stats callbacks on this block to read NGX VRAM usage
+        NVSDK_NGX_Parameter* statsParameters = nullptr;
+        NVSDK_NGX_Result capabilityResult = backend->GetCapabilityParameters(&statsParameters);
+        if (!NVSDK_NGX_SUCCEED(capabilityResult))
+        {
+            LogDlssResult(capabilityResult, backend->GetCallName(dlss::NgxCall::GetCapabilityParameters));
+            statsParameters = nullptr;
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_statsMutex);
+            g_statsParameters = statsParameters;
+        }
+
+        if (cached)
+        {
+            g_capabilityCacheRevalidation = std::thread(RevalidateCapabilityCache, backend, std::move(*cached));
+        }
+        else
+        {
+            RefreshCapabilityData(*backend, result);
+        }
+
+        auto gpuQueries = backend->CreateGpuQueryBackend(dlss::GpuTimer::kQueryCount);
+        if (!gpuQueries)
+        {
+            LogWarning("[DLSS] GPU timestamp queries not available, DLSS_GetGpuTimings will be empty");
+        }
+        dlss::GpuTimer::Instance().SetBackend(std::move(gpuQueries));
+    }
+    else
+    {
+        StoreCapabilities(ReadCapabilities(result, NVSDK_NGX_Result_FAIL_NotInitialized, nullptr));
+        dlss::OptimalSettingsTable::Instance().Clear();
+    }
+
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordResult(dlss::CaptureRecordType::Init, static_cast<int>(result));
+    }
+
+    // Publishes the globals set above to the threads that check IsInitializing()
+    g_initResult.store(static_cast<int>(result), std::memory_order_relaxed);
+    g_initState.store(NVSDK_NGX_SUCCEED(result) ? DLSS_InitState_Ready : DLSS_InitState_Failed,
+        std::memory_order_release);
+    return result;
+}
+
+// Tell listeners on Unity's event queue that DLSS_InitAsync has finished (see DLSSInitEvent.h)
+static void NotifyInitCompleted(NVSDK_NGX_Result result)
+{
+    if (g_unityEventQueue)
+    {
+        DLSSInitCompletedEvent completed = {};
+        completed.state = NVSDK_NGX_SUCCEED(result) ? DLSS_InitState_Ready : DLSS_InitState_Failed;
+        completed.result = static_cast<int>(result);
+        g_unityEventQueue->SendEvent(completed);
+    }
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Init_with_ProjectID_D3D12(
+    const DLSSInitParams* params)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Init);
+    dlss::GraphicsBackend* backend = nullptr;
+    int validation = ValidateInit("DLSS_Init_with_ProjectID_D3D12", params, &backend);
+    if (!NVSDK_NGX_SUCCEED(validation))
+    {
+        return validation;
+    }
+    std::optional<dlss::CapabilityCacheData> cached;
+    if (!BeginInit("DLSS_Init_with_ProjectID_D3D12", *params, *backend, &cached))
+    {
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+
+    return static_cast<int>(InitializeNGX(backend, *params, std::move(cached)));
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_InitAsync(const DLSSInitParams* params)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_InitAsync);
+    dlss::GraphicsBackend* backend = nullptr;
+    int validation = ValidateInit("DLSS_InitAsync", params, &backend);
+    if (!NVSDK_NGX_SUCCEED(validation))
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::InitAsync, DLSS_INVALID_FEATURE_HANDLE, validation);
+        return validation;
+    }
+    std::optional<dlss::CapabilityCacheData> cached;
+    if (!BeginInit("DLSS_InitAsync", *params, *backend, &cached))
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::InitAsync, DLSS_INVALID_FEATURE_HANDLE, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+
+    // The backend lives until device shutdown, which C# precedes with DLSS_Shutdown_D3D12 (joins this thread)
+    g_initThread = std::thread([paramsCopy = InitParamsCopy(*params), backend, cached = std::move(cached)]() mutable
+    {
+        NVSDK_NGX_Result result;
+        {
+            dlss::LatencyScope latency(DLSS_Telemetry_Init);
+            result = InitializeNGX(backend, paramsCopy.Get(), std::move(cached));
+        }
+        NotifyInitCompleted(result);
+    });
+    dlss::RecordFlightEvent(dlss::FlightEvent::InitAsync, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(NVSDK_NGX_Result_Success));
+    return static_cast<int>(NVSDK_NGX_Result_Success);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetInitState(int* outResult)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetInitState);
+    const int state = g_initState.load(std::memory_order_acquire);
+    const int result = g_initResult.load(std::memory_order_relaxed);
+    if (outResult)
+    {
+        *outResult = result;
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetInitState, DLSS_INVALID_FEATURE_HANDLE, state,
+        static_cast<uint32_t>(result));
+    return state;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetGraphicsApi(void)
+{
+    const int api = g_graphicsBackend ? static_cast<int>(g_graphicsBackend->GetApi()) : DLSS_GraphicsApi_None;
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetGraphicsApi, DLSS_INVALID_FEATURE_HANDLE, api);
+    return api;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Shutdown_D3D12(void)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Shutdown);
+    dlss::GraphicsBackend* backend = GetGraphicsBackend("DLSS_Shutdown_D3D12");
+    if (!backend)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::Shutdown, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+    }
+    dlss::ProfilerScope profilerScope(dlss::ProfilerMarker::Shutdown);
+
+    // NGX init cannot be cancelled; let a running DLSS_InitAsync finish so its state can be released
+    JoinInitThread();
+    JoinCapabilityCacheRevalidation();
+
+    // Release all feature handles
+    for (auto& pair : g_featureHandles)
+    {
+        if (pair.second.ngxHandle != nullptr)
+        {
+            backend->ReleaseFeature(pair.second.ngxHandle);
+        }
+    }
+    g_featureHandles.clear();
+    g_featureHandleCounter = 0;
+    g_liveFeaturesReleased.store(true, std::memory_order_release);
+    dlss::GpuTimer::Instance().SetBackend(nullptr);
+    dlss::DynamicResolution::Instance().Clear();
+    dlss::FeatureHealth::Instance().Clear();
+    dlss::ErrorTracker::Instance().Reset();
+    dlss::OptimalSettingsTable::Instance().Clear();
+    dlss::CalibrationTable::Instance().Clear();
+    dlss::Capabilities::Instance().Reset();
+    dlss::TextureRegistry::Instance().ClearBindings();
+
+    // Detach under the lock so an EndFrame on the render thread never sees a destroyed block
+    NVSDK_NGX_Parameter* statsParameters = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_statsMutex);
+        statsParameters = g_statsParameters;
+        g_statsParameters = nullptr;
+    }
+    if (statsParameters)
+    {
+        backend->DestroyParameters(statsParameters);
+    }
+
+    NVSDK_NGX_Result result = backend->Shutdown();
+    profilerScope.SetResult(static_cast<int>(result));
+    g_initResult.store(0, std::memory_order_relaxed);
+    g_initState.store(DLSS_InitState_NotInitialized, std::memory_order_release);
+    LogDlssResult(result, backend->GetCallName(dlss::NgxCall::Shutdown));
+    dlss::RecordFlightEvent(dlss::FlightEvent::Shutdown, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordResult(dlss::CaptureRecordType::Shutdown, static_cast<int>(result));
+    }
+
+    LogMessage("[DLSS] Shutdown complete");
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_QueryCapabilities(DLSSCapabilityInfo* outInfo)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_QueryCapabilities);
+    const int result = outInfo && dlss::Capabilities::Instance().Snapshot(outInfo) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::QueryCapabilities, DLSS_INVALID_FEATURE_HANDLE, result);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Parameter Management
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_AllocateParameters_D3D12(void** ppOutParameters)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_AllocateParameters);
+    if (!ppOutParameters)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::AllocateParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    if (IsInitializing())
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::AllocateParameters, DLSS_INVALID_FEATURE_HANDLE, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+    dlss::GraphicsBackend* backend = GetGraphicsBackend("DLSS_AllocateParameters_D3D12");
+    if (!backend)
+    {
+        *ppOutParameters = nullptr;
+        dlss::RecordFlightEvent(dlss::FlightEvent::AllocateParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+    }
+
+    NVSDK_NGX_Parameter* params = nullptr;
+    NVSDK_NGX_Result result = backend->AllocateParameters(&params);
+    *ppOutParameters = params;
+
+    LogDlssResult(result, backend->GetCallName(dlss::NgxCall::AllocateParameters));
+    dlss::RecordFlightEvent(dlss::FlightEvent::AllocateParameters, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result),
+        reinterpret_cast<uint64_t>(params));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordParameters(dlss::CaptureRecordType::AllocateParameters, params, static_cast<int>(result));
+    }
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetCapabilityParameters_D3D12(void** ppOutParameters)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetCapabilityParameters);
+    if (!ppOutParameters)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetCapabilityParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    if (IsInitializing())
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetCapabilityParameters, DLSS_INVALID_FEATURE_HANDLE, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+    dlss::GraphicsBackend* backend = GetGraphicsBackend("DLSS_GetCapabilityParameters_D3D12");
+    if (!backend)
+    {
+        *ppOutParameters = nullptr;
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetCapabilityParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+    }
+
+    NVSDK_NGX_Parameter* params = nullptr;
+    NVSDK_NGX_Result result = backend->GetCapabilityParameters(&params);
+    *ppOutParameters = params;
+
+    LogDlssResult(result, backend->GetCallName(dlss::NgxCall::GetCapabilityParameters));
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetCapabilityParameters, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result),
+        reinterpret_cast<uint64_t>(params));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordParameters(dlss::CaptureRecordType::GetCapabilityParameters, params, static_cast<int>(result));
+    }
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DestroyParameters_D3D12(void* pInParameters)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_DestroyParameters);
+    if (!pInParameters)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::DestroyParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    if (IsInitializing())
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::DestroyParameters, DLSS_INVALID_FEATURE_HANDLE, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+    dlss::GraphicsBackend* backend = GetGraphicsBackend("DLSS_DestroyParameters_D3D12");
+    if (!backend)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::DestroyParameters, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+    }
+
+    dlss::TextureRegistry::Instance().RemoveParameters(static_cast<NVSDK_NGX_Parameter*>(pInParameters));
+    NVSDK_NGX_Result result = backend->DestroyParameters(static_cast<NVSDK_NGX_Parameter*>(pInParameters));
+
+    LogDlssResult(result, backend->GetCallName(dlss::NgxCall::DestroyParameters));
+    dlss::RecordFlightEvent(dlss::FlightEvent::DestroyParameters, DLSS_INVALID_FEATURE_HANDLE, static_cast<int>(result),
+        reinterpret_cast<uint64_t>(pInParameters));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordParameters(dlss::CaptureRecordType::DestroyParameters, pInParameters,
+            static_cast<int>(result));
+    }
+    return static_cast<int>(result);
+}
+
+//------------------------------------------------------------------------------
+// Parameter Setters
+//------------------------------------------------------------------------------
+
+// Raw bits of a parameter value (pointers become their address)
+template <typename T>
+static uint64_t ValueBits(T value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(T) < sizeof(bits) ? sizeof(T) : sizeof(bits));
+    return bits;
+}
+
+// Low 32 bits of a parameter value, stored in flight recorder entries
+template <typename T>
+static int32_t FlightValueBits(T value)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(ValueBits(value)));
+}
+
+template <typename T>
+static void CaptureParameterSet(void* pParameters, const char* paramName, dlss::CaptureValueType valueType, T value)
+{
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordParameterSet(pParameters, paramName, valueType, ValueBits(value));
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetULL(
+    void* pParameters, const char* paramName, unsigned long long value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetULL);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetULL, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::ULL, value);
+
+    if (pParameters && paramName)
+    {
+        NVSDK_NGX_Parameter_SetULL(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetF(
+    void* pParameters, const char* paramName, float value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetF);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetF, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::F, value);
+
+    if (pParameters && paramName)
+    {
+        NVSDK_NGX_Parameter_SetF(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetD(
+    void* pParameters, const char* paramName, double value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetD);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetD, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::D, value);
+
+    if (pParameters && paramName)
+    {
+        NVSDK_NGX_Parameter_SetD(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetUI(
+    void* pParameters, const char* paramName, unsigned int value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetUI);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetUI, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::UI, value);
+
+    if (pParameters && paramName)
+    {
+        NVSDK_NGX_Parameter_SetUI(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetI(
+    void* pParameters, const char* paramName, int value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetI);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetI, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::I, value);
+
+    if (pParameters && paramName)
+    {
+        NVSDK_NGX_Parameter_SetI(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetD3d12Resource(
+    void* pParameters, const char* paramName, void* value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetD3d12Resource);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetD3d12Resource, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::D3d12Resource, value);
+
+    if (pParameters && paramName)
+    {
+        dlss::TextureRegistry::Instance().Unbind(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName);
+        NVSDK_NGX_Parameter_SetD3d12Resource(
+            static_cast<NVSDK_NGX_Parameter*>(pParameters),
+            paramName,
+            static_cast<ID3D12Resource*>(value));
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetVoidPointer(
+    void* pParameters, const char* paramName, void* value)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetVoidPointer);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetVoidPointer, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(value), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::VoidPointer, value);
+
+    if (pParameters && paramName)
+    {
+        dlss::TextureRegistry::Instance().Unbind(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName);
+        NVSDK_NGX_Parameter_SetVoidPointer(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, value);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetTexture(
+    void* pParameters, const char* paramName, void* nativeTexture)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetTexture);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetTexture, DLSS_INVALID_FEATURE_HANDLE,
+        FlightValueBits(nativeTexture), reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::Texture, nativeTexture);
+
+    // Without a backend there is no NGX either: the next NGX call reports the error
+    if (pParameters && paramName && g_graphicsBackend)
+    {
+        dlss::TextureRegistry::Instance().Unbind(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName);
+        g_graphicsBackend->SetTexture(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, nativeTexture);
+    }
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetTextureId(
+    void* pParameters, const char* paramName, int textureId)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_SetTextureId);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterSetTextureId, DLSS_INVALID_FEATURE_HANDLE,
+        textureId, reinterpret_cast<uint64_t>(pParameters));
+    CaptureParameterSet(pParameters, paramName, dlss::CaptureValueType::TextureId, textureId);
+
+    // Resolved on the render thread when an event uses the parameters
+    dlss::TextureRegistry::Instance().Bind(static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, textureId);
+}
+
+//------------------------------------------------------------------------------
+// Texture Registry
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_RegisterTexture(int textureId, void* nativeTexture)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_RegisterTexture);
+    const int result = dlss::TextureRegistry::Instance().Register(textureId, nativeTexture) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::RegisterTexture, DLSS_INVALID_FEATURE_HANDLE, textureId,
+        reinterpret_cast<uint64_t>(nativeTexture));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordTexture(dlss::CaptureRecordType::RegisterTexture, textureId, nativeTexture,
+            result);
+    }
+    return result;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UnregisterTexture(int textureId)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_UnregisterTexture);
+    const int result = dlss::TextureRegistry::Instance().Unregister(textureId) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::UnregisterTexture, DLSS_INVALID_FEATURE_HANDLE, textureId,
+        result == 0 ? 1 : 0);
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordTexture(dlss::CaptureRecordType::UnregisterTexture, textureId, nullptr,
+            result);
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Binding Sets
+//------------------------------------------------------------------------------
+
+static void LogBindingSetError(const char* functionName, const std::string& error)
+{
+    std::ostringstream oss;
+    oss << "[DLSS] " << functionName << ": " << error;
+    LogError(oss.str().c_str());
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_CreateBindingSet(
+    const DLSSBindingSetInfo* info, const DLSSBindingDesc* bindings, int bindingCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_CreateBindingSet);
+    std::string error = "info is null";
+    int bindingSet = -1;
+    if (info && dlss::ValidateBindingSet(*info, bindings, bindingCount, error))
+    {
+        const int created = dlss::TextureRegistry::Instance().CreateSet(bindings, bindingCount, error);
+        bindingSet = created > 0 ? created : -1;
+    }
+    if (bindingSet < 0)
+    {
+        LogBindingSetError("DLSS_CreateBindingSet", error);
+    }
+
+    dlss::RecordFlightEvent(dlss::FlightEvent::CreateBindingSet, DLSS_INVALID_FEATURE_HANDLE, bindingSet,
+        static_cast<uint64_t>(bindingCount));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordBindingSet(dlss::CaptureRecordType::CreateBindingSet, bindingSet, info,
+            bindings, bindingCount, bindingSet);
+    }
+    return bindingSet;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UpdateBindingSet(
+    int bindingSet, const DLSSBindingSetInfo* info, const DLSSBindingDesc* bindings, int bindingCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_UpdateBindingSet);
+    std::string error = "info is null";
+    int result = -1;
+    if (info && dlss::ValidateBindingSet(*info, bindings, bindingCount, error) &&
+        dlss::TextureRegistry::Instance().UpdateSet(bindingSet, bindings, bindingCount, error))
+    {
+        result = 0;
+    }
+    if (result != 0)
+    {
+        LogBindingSetError("DLSS_UpdateBindingSet", error);
+    }
+
+    dlss::RecordFlightEvent(dlss::FlightEvent::UpdateBindingSet, DLSS_INVALID_FEATURE_HANDLE, result,
+        static_cast<uint64_t>(bindingSet));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordBindingSet(dlss::CaptureRecordType::UpdateBindingSet, bindingSet, info,
+            bindings, bindingCount, result);
+    }
+    return result;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DestroyBindingSet(int bindingSet)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_DestroyBindingSet);
+    const int result = dlss::TextureRegistry::Instance().DestroySet(bindingSet) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::DestroyBindingSet, DLSS_INVALID_FEATURE_HANDLE, result,
+        static_cast<uint64_t>(bindingSet));
+    if (dlss::Capture::IsActive())
+    {
+        // The record format is CaptureFeatureHandle with the set ID in its handle field
+        dlss::Capture::Instance().RecordFeatureHandle(dlss::CaptureRecordType::DestroyBindingSet, bindingSet, result);
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Parameter Getters
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetULL(
+    void* pParameters, const char* paramName, unsigned long long* pValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetULL);
+    if (!pParameters || !paramName || !pValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetULL, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetULL(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetULL, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetF(
+    void* pParameters, const char* paramName, float* pValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetF);
+    if (!pParameters || !paramName || !pValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetF, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetF(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetF, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetD(
+    void* pParameters, const char* paramName, double* pValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetD);
+    if (!pParameters || !paramName || !pValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetD, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetD(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetD, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetUI(
+    void* pParameters, const char* paramName, unsigned int* pValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetUI);
+    if (!pParameters || !paramName || !pValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetUI, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetUI(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetUI, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetI(
+    void* pParameters, const char* paramName, int* pValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetI);
+    if (!pParameters || !paramName || !pValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetI, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetI(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, pValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetI, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetD3d12Resource(
+    void* pParameters, const char* paramName, void** ppValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetD3d12Resource);
+    if (!pParameters || !paramName || !ppValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetD3d12Resource, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    ID3D12Resource* resource = nullptr;
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetD3d12Resource(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, &resource);
+    *ppValue = resource;
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetD3d12Resource, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetVoidPointer(
+    void* pParameters, const char* paramName, void** ppValue)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_Parameter_GetVoidPointer);
+    if (!pParameters || !paramName || !ppValue)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetVoidPointer, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), reinterpret_cast<uint64_t>(pParameters));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    NVSDK_NGX_Result result = NVSDK_NGX_Parameter_GetVoidPointer(
+        static_cast<NVSDK_NGX_Parameter*>(pParameters), paramName, ppValue);
+    dlss::RecordFlightEvent(dlss::FlightEvent::ParameterGetVoidPointer, DLSS_INVALID_FEATURE_HANDLE,
+        static_cast<int>(result), reinterpret_cast<uint64_t>(pParameters));
+    return static_cast<int>(result);
+}
+
+//------------------------------------------------------------------------------
+// Feature Handle Management
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_AllocateFeatureHandle(void)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_AllocateFeatureHandle);
+    // Find next available handle (wrap around at 1024)
+    int handle = static_cast<int>(g_featureHandleCounter % 1024);
+
+    if (g_featureHandles.find(handle) != g_featureHandles.end())
+    {
+        LogError("DLSS_AllocateFeatureHandle: handle already exists");
+        dlss::RecordFlightEvent(dlss::FlightEvent::AllocateFeatureHandle, DLSS_INVALID_FEATURE_HANDLE, -1,
+            static_cast<uint64_t>(handle));
+        if (dlss::Capture::IsActive())
+        {
+            dlss::Capture::Instance().RecordFeatureHandle(dlss::CaptureRecordType::AllocateFeatureHandle,
+                handle, DLSS_INVALID_FEATURE_HANDLE);
+        }
+        return DLSS_INVALID_FEATURE_HANDLE;
+    }
+
+    g_featureHandles[handle] = FeatureEntry();
+    g_featureHandleCounter++;
+    dlss::RecordFlightEvent(dlss::FlightEvent::AllocateFeatureHandle, handle, 0);
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordFeatureHandle(dlss::CaptureRecordType::AllocateFeatureHandle, handle, handle);
+    }
+    return handle;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_FreeFeatureHandle(int handle)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_FreeFeatureHandle);
+    auto it = g_featureHandles.find(handle);
+    if (it == g_featureHandles.end())
+    {
+        LogError("DLSS_FreeFeatureHandle: handle does not exist");
+        dlss::RecordFlightEvent(dlss::FlightEvent::FreeFeatureHandle, handle, -1);
+        if (dlss::Capture::IsActive())
+        {
+            dlss::Capture::Instance().RecordFeatureHandle(dlss::CaptureRecordType::FreeFeatureHandle, handle, -1);
+        }
+        return -1;
+    }
+
+    g_featureHandles.erase(it);
+    dlss::DynamicResolution::Instance().RemoveFeature(handle);
+    dlss::FeatureHealth::Instance().RemoveFeature(handle);
+    dlss::ErrorTracker::Instance().RemoveHandle(handle);
+    dlss::RecordFlightEvent(dlss::FlightEvent::FreeFeatureHandle, handle, 0);
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordFeatureHandle(dlss::CaptureRecordType::FreeFeatureHandle, handle, 0);
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Dynamic Resolution
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DrsConfigure(int handle, const DLSSDrsSettings* settings)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_DrsConfigure);
+    if (handle == DLSS_INVALID_FEATURE_HANDLE || !settings || !(settings->targetFrameMs > 0.0f))
+    {
+        LogError("DLSS_DrsConfigure: invalid handle or settings");
+        dlss::RecordFlightEvent(dlss::FlightEvent::DrsConfigure, handle, -1);
+        return -1;
+    }
+
+    dlss::DynamicResolution::Instance().Configure(handle, *settings);
+    dlss::RecordFlightEvent(dlss::FlightEvent::DrsConfigure, handle, 0);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DrsUpdate(int handle, float frameMs, DLSSDrsResult* outResult)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_DrsUpdate);
+    if (!outResult)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::DrsUpdate, handle, -1);
+        return -1;
+    }
+
+    // The evaluate runs at output resolution, so the controller treats it as fixed cost
+    float dlssMs = 0.0f;
+    dlss::GpuTimer::Instance().GetLatestMs(handle, &dlssMs);
+
+    if (!dlss::DynamicResolution::Instance().Update(handle, frameMs, dlssMs, outResult))
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::DrsUpdate, handle, -1);
+        return -1;
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::DrsUpdate, handle, 0,
+        static_cast<uint64_t>(outResult->renderWidth) << 32 | outResult->renderHeight);
+
+    if (dlss::Tracer::IsActive())
+    {
+        dlss::Tracer::Instance().RecordCounter("DRS render scale", dlss::ReadTimestamp(), handle, outResult->scale);
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Optimal Settings
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_SetOptimalSettingsResolutions(
+    const DLSSResolution* resolutions, int count)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_SetOptimalSettingsResolutions);
+    const uint64_t flightArg = static_cast<uint64_t>(count < 0 ? 0 : count);
+
+    // The init worker builds the table from the current list; changing it underneath would race
+    if (IsInitializing())
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::SetOptimalSettingsResolutions, DLSS_INVALID_FEATURE_HANDLE,
+            DLSS_RESULT_FAIL_NOT_READY, flightArg);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+
+    if (!dlss::OptimalSettingsTable::Instance().SetResolutions(resolutions, count))
+    {
+        LogError("DLSS_SetOptimalSettingsResolutions: too many resolutions");
+        dlss::RecordFlightEvent(dlss::FlightEvent::SetOptimalSettingsResolutions, DLSS_INVALID_FEATURE_HANDLE, -1,
+            flightArg);
+        return -1;
+    }
+
+    // g_statsParameters is only set while NGX is initialized and answering capability queries
+    bool ngxReady = false;
+    {
+        std::lock_guard<std::mutex> lock(g_statsMutex);
+        ngxReady = g_statsParameters != nullptr;
+    }
+    if (ngxReady && g_graphicsBackend)
+    {
+        JoinCapabilityCacheRevalidation();
+        RefreshCapabilityData(*g_graphicsBackend, NVSDK_NGX_Result_Success);
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::SetOptimalSettingsResolutions, DLSS_INVALID_FEATURE_HANDLE, 0,
+        flightArg);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetOptimalSettingsTable(
+    DLSSOptimalSettings* outSettings, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetOptimalSettingsTable);
+    const int rows = dlss::OptimalSettingsTable::Instance().Snapshot(outSettings, maxCount);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetOptimalSettingsTable, DLSS_INVALID_FEATURE_HANDLE, rows);
+    return rows;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_LookupOptimalSettings(
+    unsigned int outputWidth, unsigned int outputHeight, int perfQuality, DLSSOptimalSettings* outSettings)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_LookupOptimalSettings);
+    const int result =
+        dlss::OptimalSettingsTable::Instance().Lookup(outputWidth, outputHeight, perfQuality, outSettings) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::LookupOptimalSettings, DLSS_INVALID_FEATURE_HANDLE, result,
+        static_cast<uint64_t>(outputWidth) << 32 | outputHeight);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Jitter
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetJitterOffset(
+    unsigned int renderWidth, unsigned int renderHeight, unsigned int outputWidth, unsigned int outputHeight,
+    unsigned long long frameIndex, DLSSJitterOffset* outOffset)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetJitterOffset);
+    const dlss::JitterTable* table = outOffset ? dlss::JitterTables::Instance().Get(
+        dlss::JitterTables::PhaseCount(renderWidth, renderHeight, outputWidth, outputHeight)) : nullptr;
+    if (!table)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetJitterOffset, DLSS_INVALID_FEATURE_HANDLE, -1, frameIndex);
+        return -1;
+    }
+    *outOffset = dlss::JitterTables::At(*table, frameIndex);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetJitterOffset, DLSS_INVALID_FEATURE_HANDLE, 0, frameIndex);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetJitterSequence(
+    unsigned int renderWidth, unsigned int renderHeight, unsigned int outputWidth, unsigned int outputHeight,
+    DLSSJitterOffset* outOffsets, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetJitterSequence);
+    const dlss::JitterTable* table = dlss::JitterTables::Instance().Get(
+        dlss::JitterTables::PhaseCount(renderWidth, renderHeight, outputWidth, outputHeight));
+    if (!table)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetJitterSequence, DLSS_INVALID_FEATURE_HANDLE, 0);
+        return 0;
+    }
+
+    const int count = static_cast<int>(table->size());
+    if (outOffsets && maxCount > 0)
+    {
+        std::copy_n(table->begin(), std::min(count, maxCount), outOffsets);
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetJitterSequence, DLSS_INVALID_FEATURE_HANDLE, count);
+    return count;
+}
+
+//------------------------------------------------------------------------------
+// Calibration
+//------------------------------------------------------------------------------
+
+// Render preset hints are per quality mode; candidates set all of them to their preset
+static const char* const kSrPresetHints[] = {
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_DLAA,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Quality,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Balanced,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Performance,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraPerformance,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraQuality,
+};
+
+static const char* const kRrPresetHints[] = {
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_DLAA,
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Quality,
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Balanced,
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Performance,
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_UltraPerformance,
+    NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_UltraQuality,
+};
+
+static bool IsValidCalibrationParams(const DLSSCalibrationParams* params)
+{
+    return params && params->outputWidth != 0 && params->outputHeight != 0 &&
+        (params->srPresetMask != 0 || params->rrPresetMask != 0) &&
+        (params->perfQualityMask & DLSS_CALIBRATION_QUALITIES_DEFAULT) != 0 &&
+        params->frameCount != 0 && params->frameCount <= DLSS_MAX_CALIBRATION_FRAMES;
+}
+
+// Optimal render size of a candidate's quality mode: from the table when the
+// output size is in it, else asked from NGX
+static bool GetCalibrationRenderSize(NVSDK_NGX_Parameter* capabilities, DLSSCalibrationResult* candidate)
+{
+    DLSSOptimalSettings row = {};
+    if (!dlss::OptimalSettingsTable::Instance().Lookup(candidate->outputWidth, candidate->outputHeight,
+            candidate->perfQuality, &row))
+    {
+        void* callbackPointer = nullptr;
+        if (capabilities)
+        {
+            NVSDK_NGX_Parameter_GetVoidPointer(capabilities, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, &callbackPointer);
+        }
+        auto callback = reinterpret_cast<PFN_NVSDK_NGX_DLSS_GetOptimalSettingsCallback>(callbackPointer);
+        if (!callback)
+        {
+            return false;
+        }
+
+        row.outputWidth = candidate->outputWidth;
+        row.outputHeight = candidate->outputHeight;
+        row.perfQuality = candidate->perfQuality;
+        QueryOptimalSettings(capabilities, callback, &row);
+    }
+
+    candidate->renderWidth = row.renderWidth;
+    candidate->renderHeight = row.renderHeight;
+    return row.renderWidth != 0 && row.renderHeight != 0;
+}
+
+static void SetCalibrationCreateParams(NVSDK_NGX_Parameter* ngxParams, const DLSSCalibrationParams& params,
+    const DLSSCalibrationResult& candidate)
+{
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_CreationNodeMask, 1);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_VisibilityNodeMask, 1);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_Width, candidate.renderWidth);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_Height, candidate.renderHeight);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_OutWidth, candidate.outputWidth);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_OutHeight, candidate.outputHeight);
+    NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_PerfQualityValue, candidate.perfQuality);
+    NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, params.featureFlags);
+    NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects, 0);
+
+    const bool rayReconstruction = candidate.feature == NVSDK_NGX_Feature_RayReconstruction;
+    for (const char* hint : rayReconstruction ? kRrPresetHints : kSrPresetHints)
+    {
+        NVSDK_NGX_Parameter_SetUI(ngxParams, hint, candidate.preset);
+    }
+
+    if (rayReconstruction)
+    {
+        // Same defaults as DLSSRayReconstruction.cs: DL unified denoiser, separate roughness, hardware depth
+        NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_DLSS_Denoise_Mode, 1);
+        NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_DLSS_Roughness_Mode, 0);
+        NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_Use_HW_Depth, 1);
+    }
+}
+
+// Inputs are allocated at the output size; the render subrect selects the candidate's render size
+static void SetCalibrationEvalParams(const dlss::CalibrationBackend& backend, NVSDK_NGX_Parameter* ngxParams,
+    const DLSSCalibrationResult& candidate)
+{
+    static float identity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    auto texture = [&backend](dlss::CalibrationTexture kind)
+    {
+        return static_cast<ID3D12Resource*>(backend.GetTexture(kind));
+    };
+
+    NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_Color, texture(dlss::CalibrationTexture::Color));
+    NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_Output, texture(dlss::CalibrationTexture::Output));
+    NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_Depth, texture(dlss::CalibrationTexture::Depth));
+    NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_MotionVectors, texture(dlss::CalibrationTexture::MotionVectors));
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_MV_Scale_X, 1.0f);
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_MV_Scale_Y, 1.0f);
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_Jitter_Offset_X, 0.0f);
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_Jitter_Offset_Y, 0.0f);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, candidate.renderWidth);
+    NVSDK_NGX_Parameter_SetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, candidate.renderHeight);
+
+    if (candidate.feature == NVSDK_NGX_Feature_RayReconstruction)
+    {
+        NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_DiffuseAlbedo, texture(dlss::CalibrationTexture::DiffuseAlbedo));
+        NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_SpecularAlbedo, texture(dlss::CalibrationTexture::SpecularAlbedo));
+        NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_GBuffer_Normals, texture(dlss::CalibrationTexture::Normals));
+        NVSDK_NGX_Parameter_SetD3d12Resource(ngxParams, NVSDK_NGX_Parameter_GBuffer_Roughness, texture(dlss::CalibrationTexture::Roughness));
+        NVSDK_NGX_Parameter_SetVoidPointer(ngxParams, NVSDK_NGX_Parameter_WorldToViewMatrix, identity);
+        NVSDK_NGX_Parameter_SetVoidPointer(ngxParams, NVSDK_NGX_Parameter_ViewToClipMatrix, identity);
+    }
+}
+
+// Create, evaluate warmupFrames + frameCount times and release one candidate,
+// all in one submission so the timed evaluates run back to back on the GPU
+static void MeasureCalibrationCandidate(dlss::GraphicsBackend& graphics, dlss::CalibrationBackend& backend,
+    const DLSSCalibrationParams& params, DLSSCalibrationResult* candidate)
+{
+    NVSDK_NGX_Parameter* ngxParams = nullptr;
+    NVSDK_NGX_Result result = graphics.AllocateParameters(&ngxParams);
+    if (!NVSDK_NGX_SUCCEED(result))
+    {
+        candidate->result = static_cast<int>(result);
+        return;
+    }
+    SetCalibrationCreateParams(ngxParams, params, *candidate);
+
+    void* commandList = nullptr;
+    if (!backend.BeginCommands(&commandList))
+    {
+        graphics.DestroyParameters(ngxParams);
+        candidate->result = static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError);
+        return;
+    }
+
+    NVSDK_NGX_Handle* ngxHandle = nullptr;
+    result = graphics.CreateFeature(commandList, static_cast<NVSDK_NGX_Feature>(candidate->feature), ngxParams, &ngxHandle);
+    if (NVSDK_NGX_SUCCEED(result))
+    {
+        SetCalibrationEvalParams(backend, ngxParams, *candidate);
+        for (uint32_t frame = 0; frame < params.warmupFrames + params.frameCount && NVSDK_NGX_SUCCEED(result); ++frame)
+        {
+            const bool timed = frame >= params.warmupFrames;
+            const uint32_t query = timed ? (frame - params.warmupFrames) * 2 : 0;
+            NVSDK_NGX_Parameter_SetI(ngxParams, NVSDK_NGX_Parameter_Reset, frame == 0 ? 1 : 0);
+            if (timed)
+            {
+                backend.WriteTimestamp(commandList, query);
+            }
+            result = graphics.EvaluateFeature(commandList, ngxHandle, ngxParams);
+            if (timed)
+            {
+                backend.WriteTimestamp(commandList, query + 1);
+            }
+        }
+    }
+
+    // Always submit: the command list is open and may hold creation work
+    const uint32_t queryCount = NVSDK_NGX_SUCCEED(result) ? params.frameCount * 2 : 0;
+    std::vector<uint64_t> ticks(queryCount);
+    if (!backend.SubmitAndWait(commandList, queryCount, ticks.data()) && NVSDK_NGX_SUCCEED(result))
+    {
+        result = NVSDK_NGX_Result_FAIL_PlatformError;
+    }
+
+    if (ngxHandle)
+    {
+        graphics.ReleaseFeature(ngxHandle);
+    }
+    graphics.DestroyParameters(ngxParams);
+
+    candidate->result = static_cast<int>(result);
+    if (!NVSDK_NGX_SUCCEED(result))
+    {
+        return;
+    }
+
+    const double msPerTick = 1000.0 / static_cast<double>(backend.GetTimestampFrequency());
+    std::vector<float> samples;
+    samples.reserve(params.frameCount);
+    for (uint32_t i = 0; i < params.frameCount; ++i)
+    {
+        const uint64_t begin = ticks[i * 2];
+        const uint64_t end = ticks[i * 2 + 1];
+        if (end >= begin)
+        {
+            samples.push_back(static_cast<float>(static_cast<double>(end - begin) * msPerTick));
+        }
+    }
+    dlss::SetCalibrationStats(std::move(samples), candidate);
+}
+
+static NVSDK_NGX_Result RunCalibration(const DLSSCalibrationParams& params, std::vector<DLSSCalibrationResult>* outResults)
+{
+    dlss::GraphicsBackend* graphics = GetGraphicsBackend("DLSS_RunCalibration");
+    if (!graphics)
+    {
+        return NVSDK_NGX_Result_FAIL_PlatformError;
+    }
+
+    const uint32_t queryCount = params.frameCount * 2;
+    std::unique_ptr<dlss::CalibrationBackend> backend = graphics->CreateCalibrationBackend(
+        params.outputWidth, params.outputHeight, params.rrPresetMask != 0, queryCount);
+    if (!backend)
+    {
+        LogError("DLSS_RunCalibration: failed to create the calibration queue and inputs");
+        return NVSDK_NGX_Result_FAIL_PlatformError;
+    }
+
+    DLSSCapabilityInfo capabilityInfo = {};
+    dlss::Capabilities::Instance().Snapshot(&capabilityInfo);
+
+    // Only needed for output sizes missing from the optimal settings table
+    NVSDK_NGX_Parameter* capabilities = nullptr;
+    if (!NVSDK_NGX_SUCCEED(graphics->GetCapabilityParameters(&capabilities)))
+    {
+        capabilities = nullptr;
+    }
+
+    const struct
+    {
+        NVSDK_NGX_Feature feature;
+        unsigned int presetMask;
+        bool available;
+    } features[] = {
+        {NVSDK_NGX_Feature_SuperSampling, params.srPresetMask, capabilityInfo.superResolution.available != 0},
+        {NVSDK_NGX_Feature_RayReconstruction, params.rrPresetMask, capabilityInfo.rayReconstruction.available != 0},
+    };
+
+    for (const auto& feature : features)
+    {
+        for (unsigned int preset = 0; preset < 32; ++preset)
+        {
+            if ((feature.presetMask & (1u << preset)) == 0)
+            {
+                continue;
+            }
+
+            for (int quality = 0; quality < DLSS_PERF_QUALITY_COUNT; ++quality)
+            {
+                if ((params.perfQualityMask & (1u << quality)) == 0)
+                {
+                    continue;
+                }
+
+                DLSSCalibrationResult candidate = {};
+                candidate.outputWidth = params.outputWidth;
+                candidate.outputHeight = params.outputHeight;
+                candidate.feature = static_cast<int>(feature.feature);
+                candidate.preset = preset;
+                candidate.perfQuality = quality;
+                if (!feature.available || !GetCalibrationRenderSize(capabilities, &candidate))
+                {
+                    candidate.result = static_cast<int>(NVSDK_NGX_Result_FAIL_FeatureNotSupported);
+                }
+                else
+                {
+                    MeasureCalibrationCandidate(*graphics, *backend, params, &candidate);
+                }
+                outResults->push_back(candidate);
+            }
+        }
+    }
+
+    if (capabilities)
+    {
+        graphics->DestroyParameters(capabilities);
+    }
+
+    dlss::RankCalibrationResults(outResults);
+    return NVSDK_NGX_Result_Success;
+}
+
+static void RecordCalibrationEvent(const DLSSCalibrationParams* params, int result)
+{
+    const uint64_t size = params ? static_cast<uint64_t>(params->outputWidth) << 32 | params->outputHeight : 0;
+    dlss::RecordFlightEvent(dlss::FlightEvent::RunCalibration, DLSS_INVALID_FEATURE_HANDLE, result, size);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_RunCalibration(
+    const DLSSCalibrationParams* params, DLSSCalibrationResult* outResults, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_RunCalibration);
+    if (!IsValidCalibrationParams(params))
+    {
+        LogError("DLSS_RunCalibration: invalid params (output size, masks or frameCount)");
+        RecordCalibrationEvent(params, static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter);
+    }
+    if (IsInitializing())
+    {
+        RecordCalibrationEvent(params, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+    if (g_initState.load(std::memory_order_acquire) != DLSS_InitState_Ready)
+    {
+        LogError("DLSS_RunCalibration: DLSS is not initialized");
+        RecordCalibrationEvent(params, static_cast<int>(NVSDK_NGX_Result_FAIL_NotInitialized));
+        return static_cast<int>(NVSDK_NGX_Result_FAIL_NotInitialized);
+    }
+
+    bool idle = false;
+    if (!g_calibrationRunning.compare_exchange_strong(idle, true, std::memory_order_acquire))
+    {
+        LogWarning("DLSS_RunCalibration: another calibration is still running");
+        RecordCalibrationEvent(params, DLSS_RESULT_FAIL_NOT_READY);
+        return DLSS_RESULT_FAIL_NOT_READY;
+    }
+
+    const uint64_t startNs = dlss::MonotonicNs();
+    std::vector<DLSSCalibrationResult> results;
+    NVSDK_NGX_Result result;
+    {
+        // Waits for a render event already using NGX; later ones are dropped until the run ends
+        std::lock_guard<std::mutex> lock(g_calibrationMutex);
+        LogMessage("[DLSS] Calibration running, render events are dropped until it finishes");
+        result = RunCalibration(*params, &results);
+    }
+    g_calibrationRunning.store(false, std::memory_order_release);
+    if (!NVSDK_NGX_SUCCEED(result))
+    {
+        RecordCalibrationEvent(params, static_cast<int>(result));
+        return static_cast<int>(result);
+    }
+
+    dlss::CalibrationTable& table = dlss::CalibrationTable::Instance();
+    table.Store(params->outputWidth, params->outputHeight, results);
+    const std::filesystem::path path = GetCalibrationPath();
+    if (!path.empty() && !table.Save(path, g_capabilityCacheKey))
+    {
+        LogWarning("[DLSS] Failed to write the calibration results");
+    }
+
+    const int count = static_cast<int>(results.size());
+    const int measured = static_cast<int>(std::count_if(results.begin(), results.end(),
+        [](const DLSSCalibrationResult& row) { return row.sampleCount > 0; }));
+    std::ostringstream oss;
+    oss << "[DLSS] Calibration at " << params->outputWidth << "x" << params->outputHeight << ": "
+        << measured << " of " << count << " candidates measured in "
+        << static_cast<double>(dlss::MonotonicNs() - startNs) / 1e6 << " ms";
+    if (measured > 0)
+    {
+        oss << ", cheapest " << GetFeatureString(static_cast<NVSDK_NGX_Feature>(results[0].feature))
+            << " preset " << results[0].preset << " quality " << results[0].perfQuality
+            << " at " << results[0].medianMs << " ms";
+    }
+    LogMessage(oss.str().c_str());
+
+    if (outResults && maxCount > 0)
+    {
+        std::copy_n(results.begin(), std::min(count, maxCount), outResults);
+    }
+    RecordCalibrationEvent(params, count);
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetCalibrationTable(
+    DLSSCalibrationResult* outResults, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetCalibrationTable);
+    const int rows = dlss::CalibrationTable::Instance().Snapshot(outResults, maxCount);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetCalibrationTable, DLSS_INVALID_FEATURE_HANDLE, rows);
+    return rows;
+}
+
+//------------------------------------------------------------------------------
+// Circuit Breaker
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_SetCircuitBreakerSettings(const DLSSCircuitBreakerSettings* settings)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_SetCircuitBreakerSettings);
+    dlss::FeatureHealth::Instance().Configure(settings ? *settings : DLSSCircuitBreakerSettings{});
+    dlss::RecordFlightEvent(dlss::FlightEvent::SetCircuitBreakerSettings, DLSS_INVALID_FEATURE_HANDLE, 0,
+        settings ? settings->failureThreshold : 0);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetFeatureHealth(int handle, DLSSFeatureHealth* outHealth)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetFeatureHealth);
+    if (!outHealth || !dlss::FeatureHealth::Instance().Get(handle, outHealth))
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::GetFeatureHealth, handle, -1);
+        return -1;
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetFeatureHealth, handle, 0, static_cast<uint64_t>(outHealth->state));
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_ResetFeatureHealth(int handle)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_ResetFeatureHealth);
+    const int result = dlss::FeatureHealth::Instance().Reset(handle) ? 0 : -1;
+    dlss::RecordFlightEvent(dlss::FlightEvent::ResetFeatureHealth, handle, result);
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Render Event Handler
+//------------------------------------------------------------------------------
+
+static DLSSTelemetryPoint GetRenderEventTelemetryPoint(int eventId)
+{
+    switch (eventId)
+    {
+        case DLSS_Event_CreateFeature: return DLSS_Telemetry_RenderCreateFeature;
+        case DLSS_Event_EvaluateFeature:
+        case DLSS_Event_EvaluateFeatureJittered:
+        case DLSS_Event_EvaluateFeatureBound: return DLSS_Telemetry_RenderEvaluateFeature;
+        case DLSS_Event_DestroyFeature: return DLSS_Telemetry_RenderDestroyFeature;
+        case DLSS_Event_EndFrame: return DLSS_Telemetry_RenderEndFrame;
+        default: return DLSS_Telemetry_Count;   // Not recorded
+    }
+}
+
+// Write the Halton jitter of jitterFrameIndex into the parameter block. The phase
+// count follows the render subrect when C# sets one (dynamic resolution), else the creation size.
+static void ApplyJitter(const FeatureEntry& entry, NVSDK_NGX_Parameter* ngxParams, uint64_t jitterFrameIndex)
+{
+    if (!ngxParams)
+    {
+        return;
+    }
+
+    unsigned int renderWidth = 0;
+    unsigned int renderHeight = 0;
+    const dlss::JitterTable* table = entry.jitter;
+    if (NVSDK_NGX_SUCCEED(NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &renderWidth)) &&
+        NVSDK_NGX_SUCCEED(NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, &renderHeight)))
+    {
+        const uint32_t phaseCount = dlss::JitterTables::PhaseCount(renderWidth, renderHeight, entry.outputWidth, entry.outputHeight);
+        if (phaseCount != 0 && (!table || table->size() != phaseCount))
+        {
+            table = dlss::JitterTables::Instance().Get(phaseCount);
+        }
+    }
+    if (!table)
+    {
+        return;
+    }
+
+    const DLSSJitterOffset offset = dlss::JitterTables::At(*table, jitterFrameIndex);
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_Jitter_Offset_X, offset.x);
+    NVSDK_NGX_Parameter_SetF(ngxParams, NVSDK_NGX_Parameter_Jitter_Offset_Y, offset.y);
+}
+
+// Stand-in for an evaluate the circuit breaker bypassed: no NGX call and no logging
+static void RunEvaluateFallback(dlss::GraphicsBackend& backend, void* cmdList, int handle,
+    NVSDK_NGX_Parameter* ngxParams)
+{
+    const bool copied = backend.RecordFallbackCopy(cmdList, ngxParams);
+    if (copied)
+    {
+        dlss::FeatureHealth::Instance().RecordFallbackCopy(handle);
+    }
+    dlss::RecordFlightEvent(dlss::FlightEvent::EvaluateBypassed, handle, copied ? 1 : 0);
+}
+
+static void LogBreakerTransition(int handle, dlss::BreakerTransition transition)
+{
+    DLSSFeatureHealth health = {};
+    if (transition == dlss::BreakerTransition::None || !dlss::FeatureHealth::Instance().Get(handle, &health))
+    {
+        return;
+    }
+
+    std::ostringstream oss;
+    switch (transition)
+    {
+    case dlss::BreakerTransition::Tripped:
+        oss << "[DLSS] EvaluateFeature failed " << health.consecutiveFailures << " times in a row, handle=" << handle
+            << "; bypassing NGX for " << health.backoff << " evaluates";
+        LogWarning(oss.str().c_str());
+        dlss::RecordFlightEvent(dlss::FlightEvent::BreakerOpened, handle, health.lastResult, health.backoff);
+        break;
+    case dlss::BreakerTransition::Reopened:
+        oss << "[DLSS] EvaluateFeature retry failed, handle=" << handle
+            << "; bypassing NGX for " << health.backoff << " evaluates";
+        LogWarning(oss.str().c_str());
+        dlss::RecordFlightEvent(dlss::FlightEvent::BreakerOpened, handle, health.lastResult, health.backoff);
+        break;
+    case dlss::BreakerTransition::Recovered:
+        oss << "[DLSS] EvaluateFeature recovered, handle=" << handle
+            << " (" << health.bypassedEvaluates << " evaluates bypassed so far)";
+        LogMessage(oss.str().c_str());
+        dlss::RecordFlightEvent(dlss::FlightEvent::BreakerClosed, handle, health.lastResult, health.bypassedEvaluates);
+        break;
+    default:
+        break;
+    }
+}
+
+// Shared by both evaluate events; jitterFrameIndex is null for DLSS_Event_EvaluateFeature
+static void EvaluateFeature(dlss::GraphicsBackend& backend, void* cmdList, int handle, NVSDK_NGX_Parameter* ngxParams,
+    const unsigned long long* jitterFrameIndex)
+{
+    auto it = g_featureHandles.find(handle);
+    if (it == g_featureHandles.end() || it->second.ngxHandle == nullptr)
+    {
+        // Issued every frame by C# until the view is recreated, so rate-limit it too
+        LogDlssResult(NVSDK_NGX_Result_FAIL_FeatureNotFound, "OnDLSSRenderEvent: EvaluateFeature", handle);
+        dlss::RecordFlightEvent(dlss::FlightEvent::EvaluateFeature, handle,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_FeatureNotFound));
+        return;
+    }
+
+    dlss::FeatureHealth& health = dlss::FeatureHealth::Instance();
+    if (health.BeginEvaluate(handle) == dlss::EvaluateDecision::Bypass)
+    {
+        RunEvaluateFallback(backend, cmdList, handle, ngxParams);
+        return;
+    }
+
+    if (jitterFrameIndex)
+    {
+        ApplyJitter(it->second, ngxParams, *jitterFrameIndex);
+    }
+
+    NVSDK_NGX_Handle* ngxHandle = it->second.ngxHandle;
+    dlss::ProfilerScope profilerScope(dlss::ProfilerMarker::EvaluateFeature, MakeSampleInfo(handle, it->second));
+    dlss::GpuTimer& gpuTimer = dlss::GpuTimer::Instance();
+    int gpuToken = gpuTimer.BeginEvaluate(cmdList, handle, static_cast<int>(it->second.feature));
+    NVSDK_NGX_Result result = backend.EvaluateFeature(cmdList, ngxHandle, ngxParams);
+    gpuTimer.EndEvaluate(cmdList, gpuToken);
+    profilerScope.SetResult(static_cast<int>(result));
+    g_frameCounters.evaluates++;
+    dlss::RecordFlightEvent(dlss::FlightEvent::EvaluateFeature, handle, static_cast<int>(result));
+
+    if (!NVSDK_NGX_SUCCEED(result))
+    {
+        LogDlssResult(result, backend.GetCallName(dlss::NgxCall::EvaluateFeature), handle);
+    }
+    LogBreakerTransition(handle, health.EndEvaluate(handle, static_cast<int>(result), NVSDK_NGX_SUCCEED(result)));
+}
+
+// Parameter block a render event passes to NGX, whose textures the backend prepares first
+static NVSDK_NGX_Parameter* GetRenderEventParameters(int eventId, void* data)
+{
+    switch (eventId)
+    {
+    case DLSS_Event_CreateFeature:
+        return static_cast<NVSDK_NGX_Parameter*>(static_cast<DLSSCreateFeatureParams*>(data)->parameters);
+    case DLSS_Event_EvaluateFeature:
+        return static_cast<NVSDK_NGX_Parameter*>(static_cast<DLSSEvaluateFeatureParams*>(data)->parameters);
+    case DLSS_Event_EvaluateFeatureJittered:
+        return static_cast<NVSDK_NGX_Parameter*>(static_cast<DLSSEvaluateJitteredParams*>(data)->parameters);
+    case DLSS_Event_EvaluateFeatureBound:
+        return static_cast<NVSDK_NGX_Parameter*>(static_cast<DLSSEvaluateBoundParams*>(data)->parameters);
+    default:
+        return nullptr;
+    }
+}
+
+// Hand changed DLSS_Parameter_SetTextureId bindings of parameters to the backend, then
+// the binding set of a bound evaluate. Returns false if that binding set does not exist.
+static bool ApplyTextureBindings(int eventId, void* data, NVSDK_NGX_Parameter* parameters,
+    dlss::GraphicsBackend& backend)
+{
+    dlss::TextureRegistry& registry = dlss::TextureRegistry::Instance();
+    std::vector<std::pair<std::string, int>> unresolved;
+    registry.Apply(parameters, backend, &unresolved);
+    bool bound = true;
+    if (eventId == DLSS_Event_EvaluateFeatureBound)
+    {
+        const DLSSEvaluateBoundParams* params = static_cast<const DLSSEvaluateBoundParams*>(data);
+        bound = registry.ApplySet(params->bindingSet, parameters, backend, &unresolved);
+    }
+    // The registry reports a binding once until it resolves or is rebound, however often it is applied
+    for (const auto& binding : unresolved)
+    {
+        std::ostringstream oss;
+        oss << "[DLSS] " << binding.first << " is bound to texture id " << binding.second
+            << ", which is not registered";
+        LogWarning(oss.str().c_str());
+        dlss::RecordFlightEvent(dlss::FlightEvent::TextureUnresolved, DLSS_INVALID_FEATURE_HANDLE, binding.second,
+            reinterpret_cast<uint64_t>(parameters));
+    }
+    return bound;
+}
+
+static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
+{
+    dlss::LatencyScope latency(GetRenderEventTelemetryPoint(eventId));
+    if (dlss::Capture::IsActive())
+    {
+        dlss::Capture::Instance().RecordRenderEvent(eventId, data);
+    }
+    ApplyReleasedFeatures();
+
+    // End of frame carries no data and needs no command list
+    if (eventId == DLSS_Event_EndFrame)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::EndFrame, DLSS_INVALID_FEATURE_HANDLE, 0,
+            dlss::CurrentFrameIndex());
+        FlushFrameCounters(static_cast<const DLSSEndFrameParams*>(data));
+        dlss::GpuTimer::Instance().EndFrame();
+        dlss::AdvanceFrameIndex();
+        return;
+    }
+
+    if (!data)
+    {
+        LogError("OnDLSSRenderEvent: data is null");
+        dlss::RecordFlightEvent(dlss::FlightEvent::RenderEventRejected, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), static_cast<uint64_t>(eventId));
+        return;
+    }
+
+    // Features cannot be created or evaluated before NGX is up, or while DLSS_RunCalibration
+    // uses it; drop the event rather than stall the render thread
+    std::unique_lock<std::mutex> calibrationLock(g_calibrationMutex, std::try_to_lock);
+    if (IsInitializing() || !calibrationLock.owns_lock())
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::RenderEventRejected, DLSS_INVALID_FEATURE_HANDLE,
+            DLSS_RESULT_FAIL_NOT_READY, static_cast<uint64_t>(eventId));
+        return;
+    }
+
+    dlss::GraphicsBackend* backend = GetGraphicsBackend("OnDLSSRenderEvent");
+    if (!backend)
+    {
+        dlss::RecordFlightEvent(dlss::FlightEvent::RenderEventRejected, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError), static_cast<uint64_t>(eventId));
+        return;
+    }
+
+    // Registered textures go to the backend first so BeginCommands sees them
+    NVSDK_NGX_Parameter* eventParameters = GetRenderEventParameters(eventId, data);
+    if (!ApplyTextureBindings(eventId, data, eventParameters, *backend))
+    {
+        // Issued every frame by C# like the evaluate it belongs to, so rate-limit it too
+        const int handle = static_cast<DLSSEvaluateBoundParams*>(data)->handle;
+        LogDlssResult(NVSDK_NGX_Result_FAIL_InvalidParameter,
+            "OnDLSSRenderEvent: EvaluateFeatureBound (unknown binding set)", handle);
+        dlss::RecordFlightEvent(dlss::FlightEvent::RenderEventRejected, handle,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_InvalidParameter), static_cast<uint64_t>(eventId));
+        return;
+    }
+
+    // Get command list from Unity (null on the null D3D12 path, which records nothing)
+    void* cmdList = nullptr;
+    if (!backend->BeginCommands(eventParameters, &cmdList))
+    {
+        LogError("OnDLSSRenderEvent: Failed to get command list from Unity");
+        dlss::RecordFlightEvent(dlss::FlightEvent::RenderEventRejected, DLSS_INVALID_FEATURE_HANDLE,
+            static_cast<int>(NVSDK_NGX_Result_FAIL_PlatformError), static_cast<uint64_t>(eventId));
+        return;
+    }
+
+    switch (eventId)
+    {
+    case DLSS_Event_CreateFeature:
+    {
+        DLSSCreateFeatureParams* params = static_cast<DLSSCreateFeatureParams*>(data);
         NVSDK_NGX_Parameter* ngxParams = static_cast<NVSDK_NGX_Parameter*>(params->parameters);
 
-        auto it = g_featureHandles.find(params->handle);
-        if (it == g_featureHandles.end() || it->second == nullptr)
+        NVSDK_NGX_Handle* ngxHandle = nullptr;
+        FeatureEntry entry;
+        entry.feature = static_cast<NVSDK_NGX_Feature>(params->feature);
+
+        // Keep the creation resolution around for profiler metadata
+        if (ngxParams)
         {
-            std::ostringstream oss;
-            oss << "OnDLSSRenderEvent: EvaluateFeature - handle " << params->handle << " not found";
-            LogError(oss.str().c_str());
-            return;
+            NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_Width, &entry.renderWidth);
+            NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_Height, &entry.renderHeight);
+            NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_OutWidth, &entry.outputWidth);
+            NVSDK_NGX_Parameter_GetUI(ngxParams, NVSDK_NGX_Parameter_OutHeight, &entry.outputHeight);
         }
 
-        NVSDK_NGX_Handle* ngxHandle = it->second;
-        NVSDK_NGX_Result result = NVSDK_NGX_D3D12_EvaluateFeature(cmdList, ngxHandle, ngxParams, nullptr);
+        dlss::ProfilerScope profilerScope(dlss::ProfilerMarker::CreateFeature, MakeSampleInfo(params->handle, entry));
+        NVSDK_NGX_Result result = backend->CreateFeature(cmdList, entry.feature, ngxParams, &ngxHandle);
+        profilerScope.SetResult(static_cast<int>(result));
+        g_frameCounters.creates++;
 
-        if (!NVSDK_NGX_SUCCEED(result))
+        LogDlssResult(result, backend->GetCallName(dlss::NgxCall::CreateFeature), params->handle);
+        dlss::RecordFlightEvent(dlss::FlightEvent::CreateFeature, params->handle, static_cast<int>(result),
+            static_cast<uint64_t>(entry.feature));
+
+        if (NVSDK_NGX_SUCCEED(result))
         {
-            LogDlssResult(result, "NVSDK_NGX_D3D12_EvaluateFeature");
+            entry.ngxHandle = ngxHandle;
+            entry.jitter = dlss::JitterTables::Instance().Get(dlss::JitterTables::PhaseCount(
+                entry.renderWidth, entry.renderHeight, entry.outputWidth, entry.outputHeight));
+            FeatureEntry& slot = g_featureHandles[params->handle];
+            if (slot.ngxHandle == nullptr)
+            {
+                g_frameCounters.liveFeatures++;
+            }
+            else if (slot.feature == NVSDK_NGX_Feature_RayReconstruction && g_liveRayReconstructionFeatures > 0)
+            {
+                g_liveRayReconstructionFeatures--;
+            }
+            if (entry.feature == NVSDK_NGX_Feature_RayReconstruction)
+            {
+                g_liveRayReconstructionFeatures++;
+            }
+            slot = entry;
+            dlss::DynamicResolution::Instance().AddFeature(params->handle, GetDrsRange(ngxParams, entry));
+            dlss::FeatureHealth::Instance().AddFeature(params->handle);
+
+            std::ostringstream oss;
+            oss << "[DLSS] Created " << GetFeatureString(entry.feature) << " feature, handle=" << params->handle;
+            LogMessage(oss.str().c_str());
         }
         break;
     }
 
+    case DLSS_Event_EvaluateFeature:
+    {
+        DLSSEvaluateFeatureParams* params = static_cast<DLSSEvaluateFeatureParams*>(data);
+        EvaluateFeature(*backend, cmdList, params->handle, static_cast<NVSDK_NGX_Parameter*>(params->parameters), nullptr);
+        break;
+    }
+
+    case DLSS_Event_EvaluateFeatureBound:
+    {
+        DLSSEvaluateBoundParams* params = static_cast<DLSSEvaluateBoundParams*>(data);
+        EvaluateFeature(*backend, cmdList, params->handle, static_cast<NVSDK_NGX_Parameter*>(params->parameters), nullptr);
+        break;
+    }
+
+    case DLSS_Event_EvaluateFeatureJittered:
+    {
+        DLSSEvaluateJitteredParams* params = static_cast<DLSSEvaluateJitteredParams*>(data);
+        EvaluateFeature(*backend, cmdList, params->handle, static_cast<NVSDK_NGX_Parameter*>(params->parameters),
+            &params->jitterFrameIndex);
+        break;
+    }
+
     case DLSS_Event_DestroyFeature:
     {
         DLSSDestroyFeatureParams* params = static_cast<DLSSDestroyFeatureParams*>(data);
@@ -574,14 +2459,27 @@ static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
             std::ostringstream oss;
             oss << "OnDLSSRenderEvent: DestroyFeature - handle " << params->handle << " not found";
             LogError(oss.str().c_str());
+            dlss::RecordFlightEvent(dlss::FlightEvent::DestroyFeature, params->handle,
+                static_cast<int>(NVSDK_NGX_Result_FAIL_FeatureNotFound));
             return;
         }
 
-        NVSDK_NGX_Handle* ngxHandle = it->second;
+        NVSDK_NGX_Handle* ngxHandle = it->second.ngxHandle;
+        NVSDK_NGX_Result result = NVSDK_NGX_Result_Success;
         if (ngxHandle != nullptr)
         {
-            NVSDK_NGX_Result result = NVSDK_NGX_D3D12_ReleaseFeature(ngxHandle);
-            LogDlssResult(result, "NVSDK_NGX_D3D12_ReleaseFeature");
+            dlss::ProfilerScope profilerScope(dlss::ProfilerMarker::ReleaseFeature, MakeSampleInfo(params->handle, it->second));
+            result = backend->ReleaseFeature(ngxHandle);
+            profilerScope.SetResult(static_cast<int>(result));
+            if (g_frameCounters.liveFeatures > 0)
+            {
+                g_frameCounters.liveFeatures--;
+            }
+            if (it->second.feature == NVSDK_NGX_Feature_RayReconstruction && g_liveRayReconstructionFeatures > 0)
+            {
+                g_liveRayReconstructionFeatures--;
+            }
+            LogDlssResult(result, backend->GetCallName(dlss::NgxCall::ReleaseFeature), params->handle);
 
             if (NVSDK_NGX_SUCCEED(result))
             {
@@ -592,6 +2490,12 @@ static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
         }
 
         g_featureHandles.erase(it);
+        g_frameCounters.destroys++;
+        dlss::GpuTimer::Instance().RemoveHandle(params->handle);
+        dlss::DynamicResolution::Instance().RemoveFeature(params->handle);
+        dlss::FeatureHealth::Instance().RemoveFeature(params->handle);
+        dlss::ErrorTracker::Instance().RemoveHandle(params->handle);
+        dlss::RecordFlightEvent(dlss::FlightEvent::DestroyFeature, params->handle, static_cast<int>(result));
         break;
     }
 
@@ -599,6 +2503,8 @@ static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
         {
             std::ostringstream oss;
             oss << "OnDLSSRenderEvent: Unknown eventId " << eventId;
+            dlss::RecordFlightEvent(dlss::FlightEvent::UnknownRenderEvent, DLSS_INVALID_FEATURE_HANDLE, 0,
+                static_cast<uint64_t>(eventId));
             LogWarning(oss.str().c_str());
         }
         break;
@@ -607,5 +2513,139 @@ static void UNITY_INTERFACE_API OnDLSSRenderEvent(int eventId, void* data)
 
 UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UnityRenderEventFunc(void)
 {
+    dlss::RecordFlightEvent(dlss::FlightEvent::UnityRenderEventFunc, DLSS_INVALID_FEATURE_HANDLE, 0);
     return OnDLSSRenderEvent;
 }
+
+//------------------------------------------------------------------------------
+// Diagnostics
+//------------------------------------------------------------------------------
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetErrorCounters(
+    DLSSErrorCounter* outCounters, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetErrorCounters);
+    if (maxCount < 0)
+    {
+        maxCount = 0;
+    }
+    int count = dlss::ErrorTracker::Instance().Snapshot(outCounters, maxCount);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetErrorCounters, DLSS_INVALID_FEATURE_HANDLE, count);
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetGpuTimings(
+    DLSSGpuTiming* outTimings, int maxCount)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_GetGpuTimings);
+    if (maxCount < 0)
+    {
+        maxCount = 0;
+    }
+    const int count = dlss::GpuTimer::Instance().Snapshot(outTimings, maxCount);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetGpuTimings, DLSS_INVALID_FEATURE_HANDLE, count);
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetTelemetry(
+    DLSSLatencyStats* outStats, int maxCount)
+{
+    if (maxCount < 0)
+    {
+        maxCount = 0;
+    }
+    const int count = dlss::Telemetry::Instance().Snapshot(outStats, maxCount);
+    dlss::RecordFlightEvent(dlss::FlightEvent::GetTelemetry, DLSS_INVALID_FEATURE_HANDLE, count);
+    return count;
+}
+
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_ResetTelemetry(void)
+{
+    dlss::Telemetry::Instance().Reset();
+    dlss::RecordFlightEvent(dlss::FlightEvent::ResetTelemetry, DLSS_INVALID_FEATURE_HANDLE, 0);
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_BeginTrace(const char* path)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_BeginTrace);
+    if (!dlss::Tracer::Instance().Begin(path))
+    {
+        LogError("DLSS_BeginTrace: trace already running or output file could not be created");
+        dlss::RecordFlightEvent(dlss::FlightEvent::BeginTrace, DLSS_INVALID_FEATURE_HANDLE, -1);
+        return -1;
+    }
+    LogMessage("[DLSS] Trace started");
+    dlss::RecordFlightEvent(dlss::FlightEvent::BeginTrace, DLSS_INVALID_FEATURE_HANDLE, 0);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_EndTrace(void)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_EndTrace);
+    int count = dlss::Tracer::Instance().End();
+    dlss::RecordFlightEvent(dlss::FlightEvent::EndTrace, DLSS_INVALID_FEATURE_HANDLE, count);
+    if (count >= 0)
+    {
+        std::ostringstream oss;
+        oss << "[DLSS] Trace finished, " << count << " events written";
+        LogMessage(oss.str().c_str());
+    }
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_BeginCapture(const char* path)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_BeginCapture);
+    if (!dlss::Capture::Instance().Begin(path))
+    {
+        LogError("DLSS_BeginCapture: capture already running or output file could not be created");
+        dlss::RecordFlightEvent(dlss::FlightEvent::BeginCapture, DLSS_INVALID_FEATURE_HANDLE, -1);
+        return -1;
+    }
+    LogMessage("[DLSS] Capture started");
+    dlss::RecordFlightEvent(dlss::FlightEvent::BeginCapture, DLSS_INVALID_FEATURE_HANDLE, 0);
+    return 0;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_EndCapture(void)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_EndCapture);
+    int count = dlss::Capture::Instance().End();
+    dlss::RecordFlightEvent(dlss::FlightEvent::EndCapture, DLSS_INVALID_FEATURE_HANDLE, count);
+    if (count >= 0)
+    {
+        std::ostringstream oss;
+        oss << "[DLSS] Capture finished, " << count << " records written";
+        LogMessage(oss.str().c_str());
+    }
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DumpFlightRecorder(const char* path)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_DumpFlightRecorder);
+    int count = dlss::FlightRecorder::Instance().DumpToFile(path);
+    if (count < 0)
+    {
+        LogError("DLSS_DumpFlightRecorder: failed to write flight recorder dump");
+    }
+    return count;
+}
+
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_CopyFlightRecorder(void* buffer, int bufferSize)
+{
+    dlss::LatencyScope latency(DLSS_Telemetry_CopyFlightRecorder);
+    const dlss::FlightRecorder& recorder = dlss::FlightRecorder::Instance();
+    size_t required = recorder.GetDumpSize();
+    if (buffer && bufferSize > 0)
+    {
+        size_t written = recorder.Dump(buffer, static_cast<size_t>(bufferSize));
+        if (written != 0)
+        {
+            return static_cast<int>(written);
+        }
+        // Ring advanced between the size query and the copy; report the new size
+        required = recorder.GetDumpSize();
+    }
+    return static_cast<int>(required);
+}
@@ -7,8 +7,11 @@
 //------------------------------------------------------------------------------
 
 #pragma once
+#include <stdint.h>
+#ifdef _WIN32
 #include <dxgi.h>
 #include <dxgi1_4.h>
+#endif
 #include "IUnityGraphics.h"
 #include "IUnityRenderingExtensions.h"
 
@@ -43,10 +46,32 @@ typedef struct DLSSInitParams
     const char* projectId;              // Application project ID (can be NULL)
     DLSSEngineType engineType;          // Engine type
     const char* engineVersion;          // Engine version string
-    const wchar_t* applicationDataPath; // Path for NGX logs (can be NULL)
+    const wchar_t* applicationDataPath; // Path for NGX logs, the capability cache and calibration results (can be NULL)
     DLSSLoggingLevel loggingLevel;      // NGX logging verbosity
 } DLSSInitParams;
 
+/// Initialization state returned by DLSS_GetInitState
+typedef enum DLSSInitState
+{
+    DLSS_InitState_NotInitialized = 0,  // Before the first init and after shutdown
+    DLSS_InitState_Initializing = 1,    // NGX init is running (on the worker thread for DLSS_InitAsync)
+    DLSS_InitState_Ready = 2,           // NGX init succeeded
+    DLSS_InitState_Failed = 3           // NGX init failed, see the result of DLSS_GetInitState
+} DLSSInitState;
+
+/// Graphics API the plugin drives NGX with, returned by DLSS_GetGraphicsApi
+typedef enum DLSSGraphicsApi
+{
+    DLSS_GraphicsApi_None = 0,          // Unity's renderer is not supported (or no device yet)
+    DLSS_GraphicsApi_D3D12 = 1,
+    DLSS_GraphicsApi_Vulkan = 2,
+    DLSS_GraphicsApi_D3D11 = 3
+} DLSSGraphicsApi;
+
+/// Returned by exports that need NGX while DLSS_InitAsync is still running, instead of blocking.
+/// Uses the NGX failure prefix, so NVSDK_NGX_FAILED() holds; no NGX result has this value.
+#define DLSS_RESULT_FAIL_NOT_READY ((int)0xBAD0FF01)
+
 //------------------------------------------------------------------------------
 // NGX Feature Types
 //------------------------------------------------------------------------------
@@ -67,7 +92,10 @@ typedef enum DLSSRenderEventId
 {
     DLSS_Event_CreateFeature = 0,
     DLSS_Event_EvaluateFeature = 1,
-    DLSS_Event_DestroyFeature = 2
+    DLSS_Event_DestroyFeature = 2,
+    DLSS_Event_EndFrame = 3,            // Issue once per frame (data is DLSSEndFrameParams* or NULL)
+    DLSS_Event_EvaluateFeatureJittered = 4, // Evaluate with the plugin's jitter (data is DLSSEvaluateJitteredParams*)
+    DLSS_Event_EvaluateFeatureBound = 5     // Evaluate with a binding set's resources (data is DLSSEvaluateBoundParams*)
 } DLSSRenderEventId;
 
 /// Parameters for create feature render event
@@ -85,12 +113,349 @@ typedef struct DLSSEvaluateFeatureParams
     void* parameters;   // NVSDK_NGX_Parameter*
 } DLSSEvaluateFeatureParams;
 
+/// Parameters for the jittered evaluate render event. The plugin writes
+/// Jitter.Offset.X/Y from its Halton table before evaluating; the render size is
+/// DLSS.Render.Subrect.Dimensions if set in the parameter block, else the creation size.
+typedef struct DLSSEvaluateJitteredParams
+{
+    int handle;
+    void* parameters;   // NVSDK_NGX_Parameter*
+    unsigned long long jitterFrameIndex;    // Index also passed to DLSS_GetJitterOffset for the projection matrix
+} DLSSEvaluateJitteredParams;
+
+/// Parameters for the bound evaluate render event. The resources of the binding
+/// set (DLSS_CreateBindingSet) are bound to the parameter block before evaluating;
+/// the remaining parameters (jitter, matrices, reset, ...) are set as for DLSSEvaluateFeatureParams.
+typedef struct DLSSEvaluateBoundParams
+{
+    int handle;
+    int bindingSet;     // Id returned by DLSS_CreateBindingSet
+    void* parameters;   // NVSDK_NGX_Parameter*
+} DLSSEvaluateBoundParams;
+
 /// Parameters for destroy feature render event
 typedef struct DLSSDestroyFeatureParams
 {
     int handle;
 } DLSSDestroyFeatureParams;
 
+/// Optional parameters for end frame render event
+typedef struct DLSSEndFrameParams
+{
+    unsigned long long ringBufferBytesUsed;  // Render-event payload bytes allocated by C# this frame
+} DLSSEndFrameParams;
+
+//------------------------------------------------------------------------------
+// Binding Set Structures
+//------------------------------------------------------------------------------
+
+/// DLSSBindingDesc flags, taken from the Unity texture a binding refers to.
+typedef enum DLSSBindingFlags
+{
+    DLSS_Binding_RandomWrite = 1 << 0,  // RenderTexture.enableRandomWrite; required for Output
+    DLSS_Binding_DepthFormat = 1 << 1   // Depth or depth-stencil format
+} DLSSBindingFlags;
+
+/// One resource parameter of a binding set.
+typedef struct DLSSBindingDesc
+{
+    const char* name;           // Resource parameter, e.g. "Color"
+    int textureId;              // Id registered with DLSS_RegisterTexture
+    unsigned int width;
+    unsigned int height;
+    unsigned int channels;      // Colour channels of the format (1-4); 0 skips the format checks
+    unsigned int flags;         // DLSSBindingFlags
+} DLSSBindingDesc;
+
+/// The feature a binding set is validated against.
+typedef struct DLSSBindingSetInfo
+{
+    DLSSNGXFeature feature;
+    int createFlags;            // DLSS.Feature.Create.Flags the feature was created with
+    unsigned int renderWidth;
+    unsigned int renderHeight;
+    unsigned int outputWidth;
+    unsigned int outputHeight;
+} DLSSBindingSetInfo;
+
+//------------------------------------------------------------------------------
+// Diagnostics Structures
+//------------------------------------------------------------------------------
+
+/// Aggregated failure count for one (handle, NGX result) pair.
+typedef struct DLSSErrorCounter
+{
+    int handle;                         // Feature handle, or DLSS_INVALID_FEATURE_HANDLE for global calls
+    int result;                         // NGX result code
+    unsigned long long count;           // Total number of occurrences
+    unsigned long long reportedCount;   // Occurrences written to the Unity log
+} DLSSErrorCounter;
+
+/// Instrumented entry points for DLSS_GetTelemetry (one latency histogram each).
+typedef enum DLSSTelemetryPoint
+{
+    DLSS_Telemetry_Init = 0,
+    DLSS_Telemetry_Shutdown,
+    DLSS_Telemetry_AllocateParameters,
+    DLSS_Telemetry_GetCapabilityParameters,
+    DLSS_Telemetry_DestroyParameters,
+    DLSS_Telemetry_Parameter_SetULL,
+    DLSS_Telemetry_Parameter_SetF,
+    DLSS_Telemetry_Parameter_SetD,
+    DLSS_Telemetry_Parameter_SetUI,
+    DLSS_Telemetry_Parameter_SetI,
+    DLSS_Telemetry_Parameter_SetD3d12Resource,
+    DLSS_Telemetry_Parameter_SetVoidPointer,
+    DLSS_Telemetry_Parameter_GetULL,
+    DLSS_Telemetry_Parameter_GetF,
+    DLSS_Telemetry_Parameter_GetD,
+    DLSS_Telemetry_Parameter_GetUI,
+    DLSS_Telemetry_Parameter_GetI,
+    DLSS_Telemetry_Parameter_GetD3d12Resource,
+    DLSS_Telemetry_Parameter_GetVoidPointer,
+    DLSS_Telemetry_AllocateFeatureHandle,
+    DLSS_Telemetry_FreeFeatureHandle,
+    DLSS_Telemetry_GetErrorCounters,
+    DLSS_Telemetry_GetGpuTimings,
+    DLSS_Telemetry_DumpFlightRecorder,
+    DLSS_Telemetry_CopyFlightRecorder,
+    DLSS_Telemetry_RenderCreateFeature,     // Whole render event, including command list lookup
+    DLSS_Telemetry_RenderEvaluateFeature,
+    DLSS_Telemetry_RenderDestroyFeature,
+    DLSS_Telemetry_RenderEndFrame,
+    DLSS_Telemetry_Parameter_SetTexture,
+    DLSS_Telemetry_Parameter_SetTextureId,
+    DLSS_Telemetry_RegisterTexture,
+    DLSS_Telemetry_CreateBindingSet,
+    DLSS_Telemetry_UpdateBindingSet,
+    DLSS_Telemetry_BeginTrace,
+    DLSS_Telemetry_EndTrace,
+    DLSS_Telemetry_BeginCapture,
+    DLSS_Telemetry_EndCapture,
+    DLSS_Telemetry_DrsConfigure,
+    DLSS_Telemetry_DrsUpdate,
+    DLSS_Telemetry_SetOptimalSettingsResolutions,
+    DLSS_Telemetry_GetOptimalSettingsTable,
+    DLSS_Telemetry_LookupOptimalSettings,
+    DLSS_Telemetry_QueryCapabilities,
+    DLSS_Telemetry_InitAsync,
+    DLSS_Telemetry_GetInitState,
+    DLSS_Telemetry_GetJitterOffset,
+    DLSS_Telemetry_GetJitterSequence,
+    DLSS_Telemetry_RunCalibration,
+    DLSS_Telemetry_GetCalibrationTable,
+    DLSS_Telemetry_SetCircuitBreakerSettings,
+    DLSS_Telemetry_GetFeatureHealth,
+    DLSS_Telemetry_ResetFeatureHealth,
+    DLSS_Telemetry_UnregisterTexture,
+    DLSS_Telemetry_DestroyBindingSet,
+    DLSS_Telemetry_Count
+} DLSSTelemetryPoint;
+
+/// CPU latency distribution of one entry point since load (or the last reset).
+typedef struct DLSSLatencyStats
+{
+    int point;                          // DLSSTelemetryPoint
+    int reserved;
+    unsigned long long count;           // Number of calls
+    float meanUs;
+    float p50Us;
+    float p90Us;
+    float p99Us;
+    float p999Us;
+    float maxUs;
+} DLSSLatencyStats;
+
+/// Rolling GPU time of EvaluateFeature for one feature handle.
+typedef struct DLSSGpuTiming
+{
+    int handle;                         // Feature handle
+    int feature;                        // DLSSNGXFeature
+    unsigned int sampleCount;           // Samples in the rolling window
+    float minMs;
+    float avgMs;
+    float p95Ms;
+    float maxMs;
+} DLSSGpuTiming;
+
+//------------------------------------------------------------------------------
+// Capability Structures
+//------------------------------------------------------------------------------
+
+/// NGX capability report of one feature.
+typedef struct DLSSFeatureCapability
+{
+    int available;                      // Nonzero if NGX reports the feature as available
+    int needsUpdatedDriver;             // Nonzero if the installed driver is too old for the feature
+    unsigned int minDriverVersionMajor; // Driver version the feature requires (set with needsUpdatedDriver)
+    unsigned int minDriverVersionMinor;
+    int featureInitResult;              // NGX result of the feature's init probe (0 if not reported)
+} DLSSFeatureCapability;
+
+/// Capability snapshot taken at init, returned by DLSS_QueryCapabilities.
+typedef struct DLSSCapabilityInfo
+{
+    int initResult;                     // NGX result of DLSS_Init_with_ProjectID_D3D12
+    int capabilityResult;               // NGX result of the capability parameter query
+    unsigned long long ngxVramBytes;    // VRAM allocated by NGX, refreshed on each DLSS_Event_EndFrame
+    unsigned long long ngxVramPeakBytes;// Largest ngxVramBytes seen since init
+    DLSSFeatureCapability superResolution;      // DLSS-SR (SuperSampling)
+    DLSSFeatureCapability rayReconstruction;    // DLSS-RR (SuperSamplingDenoising)
+    DLSSFeatureCapability frameGeneration;      // DLSS-FG (reported only; the plugin does not create it)
+    int reserved;
+} DLSSCapabilityInfo;
+
+//------------------------------------------------------------------------------
+// Dynamic Resolution Structures
+//------------------------------------------------------------------------------
+
+/// Controller settings for DLSS_DrsConfigure. Zero selects the default for every field except targetFrameMs.
+typedef struct DLSSDrsSettings
+{
+    float targetFrameMs;                // GPU frame time to hold (required)
+    float kp;                           // Proportional gain (default 0.1)
+    float ki;                           // Integral gain per frame (default 0.4)
+    float maxStep;                      // Largest change of the log render scale per update (default 0.08, about 8%)
+    float deadband;                     // Log-scale error treated as on target (default 0.01)
+    int latencyFrames;                  // Frames between rendering a frame and passing its time to DLSS_DrsUpdate (default 2, max 8)
+} DLSSDrsSettings;
+
+/// Output of DLSS_DrsUpdate.
+typedef struct DLSSDrsResult
+{
+    unsigned int renderWidth;           // Next render size: multiple of 8 within the feature's dynamic range
+    unsigned int renderHeight;
+    float scale;                        // Continuous per-axis scale relative to the maximum render size
+    float dlssMs;                       // DLSS evaluate GPU time used by this update (0 until measured)
+    float errorMs;                      // frameMs - targetFrameMs
+} DLSSDrsResult;
+
+//------------------------------------------------------------------------------
+// Optimal Settings Structures
+//------------------------------------------------------------------------------
+
+/// Number of NVSDK_NGX_PerfQuality_Value entries (MaxPerf .. DLAA) in each table row group.
+#define DLSS_PERF_QUALITY_COUNT 6
+
+/// Largest resolution list accepted by DLSS_SetOptimalSettingsResolutions.
+#define DLSS_MAX_OPTIMAL_SETTINGS_RESOLUTIONS 64
+
+/// Output resolution for DLSS_SetOptimalSettingsResolutions.
+typedef struct DLSSResolution
+{
+    unsigned int width;
+    unsigned int height;
+} DLSSResolution;
+
+/// DLSS-SR optimal settings for one (output resolution, PerfQualityValue) pair, as
+/// answered by the NGX optimal-settings query at init.
+typedef struct DLSSOptimalSettings
+{
+    unsigned int outputWidth;
+    unsigned int outputHeight;
+    int perfQuality;                    // NVSDK_NGX_PerfQuality_Value
+    int result;                         // NGX result of the query; the sizes below are zero if it failed
+    unsigned int renderWidth;           // Optimal render size
+    unsigned int renderHeight;
+    unsigned int minRenderWidth;        // Dynamic resolution range (DLSS.Get.Dynamic.Min/Max.Render.*)
+    unsigned int minRenderHeight;
+    unsigned int maxRenderWidth;
+    unsigned int maxRenderHeight;
+    float sharpness;                    // Deprecated by NGX, normally 0
+} DLSSOptimalSettings;
+
+//------------------------------------------------------------------------------
+// Jitter Structures
+//------------------------------------------------------------------------------
+
+/// Longest jitter sequence (phase count) the plugin generates.
+#define DLSS_MAX_JITTER_PHASES 1024
+
+/// Sub-pixel jitter in render pixels, each component in [-0.5, 0.5).
+typedef struct DLSSJitterOffset
+{
+    float x;
+    float y;
+} DLSSJitterOffset;
+
+//------------------------------------------------------------------------------
+// Calibration Structures
+//------------------------------------------------------------------------------
+
+/// Largest frameCount accepted by DLSS_RunCalibration.
+#define DLSS_MAX_CALIBRATION_FRAMES 256
+
+/// Default candidate masks: bit n selects render preset n (NVSDK_NGX_DLSS_Hint_Render_Preset)
+/// or NVSDK_NGX_PerfQuality_Value n.
+#define DLSS_CALIBRATION_SR_PRESETS_DEFAULT ((1u << 10) | (1u << 11) | (1u << 12) | (1u << 13))   // J, K, L, M
+#define DLSS_CALIBRATION_RR_PRESETS_DEFAULT ((1u << 4) | (1u << 5))                              // D, E
+#define DLSS_CALIBRATION_QUALITIES_DEFAULT ((1u << DLSS_PERF_QUALITY_COUNT) - 1)                // All modes
+
+/// Candidates and sample counts for DLSS_RunCalibration.
+typedef struct DLSSCalibrationParams
+{
+    unsigned int outputWidth;           // Output size the candidates are created for
+    unsigned int outputHeight;
+    unsigned int srPresetMask;          // DLSS-SR render presets to measure; 0 skips SR
+    unsigned int rrPresetMask;          // DLSS-RR render presets to measure; 0 skips RR
+    unsigned int perfQualityMask;       // Quality modes to measure with every preset
+    int featureFlags;                   // NVSDK_NGX_DLSS_Feature_Flags used at creation
+    unsigned int warmupFrames;          // Untimed evaluates per candidate before measuring
+    unsigned int frameCount;            // Timed evaluates per candidate (1 .. DLSS_MAX_CALIBRATION_FRAMES)
+} DLSSCalibrationParams;
+
+/// Measured GPU cost of one (feature, preset, quality) candidate at one output size.
+typedef struct DLSSCalibrationResult
+{
+    unsigned int outputWidth;
+    unsigned int outputHeight;
+    int feature;                        // NVSDK_NGX_Feature_SuperSampling or NVSDK_NGX_Feature_RayReconstruction
+    unsigned int preset;                // Render preset value (DLSSSRPreset / DLSSRRPreset on the C# side)
+    int perfQuality;                    // NVSDK_NGX_PerfQuality_Value
+    int result;                         // NGX result of create/evaluate; the timings below are zero if it failed
+    unsigned int renderWidth;           // Optimal render size of the quality mode
+    unsigned int renderHeight;
+    unsigned int sampleCount;
+    float minMs;                        // GPU time of one evaluate
+    float medianMs;                     // Ranking key
+    float avgMs;
+    float p95Ms;
+    float maxMs;
+} DLSSCalibrationResult;
+
+//------------------------------------------------------------------------------
+// Circuit Breaker Structures
+//------------------------------------------------------------------------------
+
+/// Evaluate health of a feature handle, as reported by DLSS_GetFeatureHealth.
+typedef enum DLSSFeatureHealthState
+{
+    DLSS_FeatureHealth_Healthy = 0,     // Evaluates run normally
+    DLSS_FeatureHealth_Bypassed = 1,    // Tripped: evaluate events skip NGX and run the fallback
+    DLSS_FeatureHealth_Probing = 2      // Back-off elapsed: the next evaluate event retries NGX
+} DLSSFeatureHealthState;
+
+/// Circuit breaker settings for DLSS_SetCircuitBreakerSettings. Zero selects the default for every field.
+typedef struct DLSSCircuitBreakerSettings
+{
+    unsigned int failureThreshold;      // Consecutive failed evaluates that trip a feature (default 3)
+    unsigned int initialBackoff;        // Evaluate events bypassed before the first retry (default 8)
+    unsigned int maxBackoff;            // Cap of the back-off, which doubles after every failed retry (default 512)
+} DLSSCircuitBreakerSettings;
+
+/// Circuit breaker state of one feature handle since its creation.
+typedef struct DLSSFeatureHealth
+{
+    int state;                          // DLSSFeatureHealthState
+    int lastResult;                     // NGX result of the last evaluate that reached NGX
+    unsigned int consecutiveFailures;
+    unsigned int trips;                 // Times the breaker opened
+    unsigned int backoff;               // Current back-off in evaluate events (0 while healthy)
+    unsigned int evaluatesUntilRetry;   // Bypassed evaluate events left before the next retry
+    unsigned long long bypassedEvaluates;   // Evaluate events served by the fallback
+    unsigned long long fallbackCopies;  // Of those, events that copied color into output
+} DLSSFeatureHealth;
+
 //------------------------------------------------------------------------------
 // Exported Functions
 //------------------------------------------------------------------------------
@@ -99,34 +464,64 @@ typedef struct DLSSDestroyFeatureParams
 #define DLSS_INVALID_FEATURE_HANDLE (-1)
 
 //--- Initialization/Shutdown ---
+// The _D3D12 suffix of the init, shutdown and parameter exports is historical:
+// they act on the graphics API selected for Unity's renderer (DLSS_GetGraphicsApi).
 
-/// Initialize DLSS with project ID for D3D12.
+/// Get the graphics API selected at kUnityGfxDeviceEventInitialize.
+/// @return DLSSGraphicsApi value; DLSS_GraphicsApi_None makes every NGX export fail.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetGraphicsApi(void);
+
+/// Initialize DLSS with project ID.
 /// @param params Initialization parameters.
-/// @return NGX result code (0 = success).
+/// @return NGX result code (0 = success), DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running
+///         or if already initialized (call DLSS_Shutdown_D3D12 first).
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Init_with_ProjectID_D3D12(
     const DLSSInitParams* params);
 
-/// Shutdown DLSS for D3D12.
+/// Start DLSS_Init_with_ProjectID_D3D12 on a worker thread and return immediately.
+/// The params strings are copied. Poll DLSS_GetInitState, or listen for
+/// DLSSInitCompletedEvent on IUnityEventQueue (DLSSInitEvent.h). Until init completes,
+/// exports that need NGX return DLSS_RESULT_FAIL_NOT_READY and render events are dropped;
+/// DLSS_QueryCapabilities and the optimal settings lookups answer from the capability cache.
+/// @param params Initialization parameters.
+/// @return NVSDK_NGX_Result_Success if the worker was started, DLSS_RESULT_FAIL_NOT_READY if an
+///         init is already running or has succeeded, or the NGX failure of the parameter/device checks.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_InitAsync(const DLSSInitParams* params);
+
+/// Get the initialization state without blocking.
+/// @param outResult Receives the NGX result of the last completed init (0 if none). Can be NULL.
+/// @return DLSSInitState value.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetInitState(int* outResult);
+
+/// Shutdown DLSS. Waits for a running DLSS_InitAsync to finish first.
 /// @return NGX result code.
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Shutdown_D3D12(void);
 
+/// Get the capability snapshot taken at the last init (also kept when NGX init fails, see initResult).
+/// Copies a cached struct and makes no NGX calls, so it is cheap to poll. When the
+/// capability cache in applicationDataPath matches the adapter and driver, the snapshot
+/// comes from disk and is refreshed by a background revalidation shortly after init.
+/// @param outInfo Receives the snapshot.
+/// @return 0 on success, -1 if DLSS has not been initialized (outInfo is zeroed).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_QueryCapabilities(DLSSCapabilityInfo* outInfo);
+
 //--- Parameter Management ---
 
 /// Allocate NGX parameters structure.
 /// @param ppOutParameters Receives pointer to allocated parameters.
-/// @return NGX result code.
+/// @return NGX result code, DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running.
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_AllocateParameters_D3D12(
     void** ppOutParameters);
 
 /// Get capability parameters from NGX (for querying feature support).
 /// @param ppOutParameters Receives pointer to capability parameters.
-/// @return NGX result code.
+/// @return NGX result code, DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running.
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetCapabilityParameters_D3D12(
     void** ppOutParameters);
 
 /// Destroy NGX parameters structure.
 /// @param pInParameters Parameters to destroy.
-/// @return NGX result code.
+/// @return NGX result code, DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running.
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DestroyParameters_D3D12(
     void* pInParameters);
 
@@ -153,6 +548,56 @@ void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetD3d12Resource(
 void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetVoidPointer(
     void* pParameters, const char* paramName, void* value);
 
+/// Bind a texture resource (Color, Output, Depth, ...) on any graphics API.
+/// On Vulkan the image view is created and the image transitioned on the render
+/// thread, when an event uses the parameters; the texture must outlive that event.
+/// @param nativeTexture Texture.GetNativeTexturePtr(), or NULL to unbind.
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetTexture(
+    void* pParameters, const char* paramName, void* nativeTexture);
+
+/// Bind a texture resource to a texture registered with DLSS_RegisterTexture.
+/// The native texture is looked up on the render thread when an event uses the
+/// parameters, so the ID may be registered or re-registered after this call; the
+/// backend is only rebound when the registration changed since the last event.
+/// Setting the parameter with DLSS_Parameter_SetTexture (or SetD3d12Resource,
+/// SetVoidPointer) replaces the binding.
+/// @param textureId Unity instance ID (Texture.GetInstanceID()), or 0 to unbind.
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_SetTextureId(
+    void* pParameters, const char* paramName, int textureId);
+
+//--- Texture Registry ---
+
+/// Register the native texture of a Unity texture under its instance ID, replacing
+/// any earlier registration. Call when the texture is created or recreated, not per
+/// frame; the native texture must stay valid until it is re-registered or unregistered.
+/// @param nativeTexture Texture.GetNativeTexturePtr().
+/// @return 0 on success, -1 if textureId is 0 or nativeTexture is NULL.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_RegisterTexture(int textureId, void* nativeTexture);
+
+/// Forget a registered texture; parameters still bound to the ID evaluate with no texture.
+/// @return 0 on success, -1 if the ID is not registered.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UnregisterTexture(int textureId);
+
+//--- Binding Sets ---
+
+/// Store the resource parameters of a view (Color, Output, Depth, ... all registered
+/// textures) for DLSS_Event_EvaluateFeatureBound. The set is validated once here: the
+/// feature's required resources must be present, every texture registered and large
+/// enough for the render or output size, Output writable, MotionVectors two-channel
+/// (at render size with MVLowRes, else at output size) and Depth single-channel or a
+/// depth format. Failures are logged with the offending binding.
+/// @return Binding set id (> 0), or -1 if validation failed.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_CreateBindingSet(
+    const DLSSBindingSetInfo* info, const DLSSBindingDesc* bindings, int bindingCount);
+
+/// Replace the bindings of a set, e.g. after a resize. The set is unchanged if validation fails.
+/// @return 0 on success, -1 if the set does not exist or validation failed.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UpdateBindingSet(
+    int bindingSet, const DLSSBindingSetInfo* info, const DLSSBindingDesc* bindings, int bindingCount);
+
+/// @return 0 on success, -1 if the set does not exist.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DestroyBindingSet(int bindingSet);
+
 //--- Parameter Getters (direct pass-through to NGX) ---
 
 int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_Parameter_GetULL(
@@ -192,9 +637,195 @@ int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_FreeFeatureHandle(int handle
 /// Get the render event callback function for use with IssuePluginEventAndData.
 /// Use with DLSSRenderEventId values as eventId.
 /// Data should be pointer to DLSSCreateFeatureParams/DLSSEvaluateFeatureParams/DLSSDestroyFeatureParams.
+/// DLSS_Event_EndFrame advances the plugin's frame counter and flushes the Unity Profiler
+/// counters; its data is an optional DLSSEndFrameParams*.
 /// @return UnityRenderingEventAndData function pointer.
 UnityRenderingEventAndData UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_UnityRenderEventFunc(void);
 
+//--- Dynamic Resolution ---
+
+/// Set the dynamic resolution target and gains for a feature handle.
+/// May be called before the create event has run on the render thread.
+/// Settings and controller state are dropped when the feature is destroyed.
+/// @param handle Feature handle.
+/// @param settings Controller settings.
+/// @return 0 on success, -1 on invalid arguments.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DrsConfigure(int handle, const DLSSDrsSettings* settings);
+
+/// Feed the GPU time of the last completed frame and get the render size for the next one.
+/// The range is the feature's DLSS.Get.Dynamic.Min/Max.Render.Width/Height parameters at
+/// creation, defaulting to the creation size down to a third of the output size. The
+/// feature's own GPU timing (see DLSS_GetGpuTimings) is subtracted as fixed cost.
+/// @param handle Feature handle.
+/// @param frameMs Measured GPU frame time in milliseconds.
+/// @param outResult Receives the next render size.
+/// @return 0 on success, -1 if the feature has not been created or configured.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DrsUpdate(int handle, float frameMs, DLSSDrsResult* outResult);
+
+//--- Optimal Settings ---
+
+/// Set the output resolutions covered by the optimal settings table.
+/// Takes effect at the next init, or immediately if DLSS is already initialized.
+/// The default list covers common 16:9, 16:10 and ultrawide outputs from 720p to 8K.
+/// @param resolutions Output resolutions (NULL or count 0 restores the defaults).
+/// @param count Number of entries, at most DLSS_MAX_OPTIMAL_SETTINGS_RESOLUTIONS after duplicates are removed.
+/// @return 0 on success, -1 if the list is too long, DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_SetOptimalSettingsResolutions(
+    const DLSSResolution* resolutions, int count);
+
+/// Get the whole optimal settings table computed at init: DLSS_PERF_QUALITY_COUNT
+/// rows per output resolution, in PerfQualityValue order. Empty before init.
+/// @param outSettings Array receiving the rows (can be NULL to query the count).
+/// @param maxCount Capacity of outSettings.
+/// @return Total number of rows (may exceed maxCount).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetOptimalSettingsTable(
+    DLSSOptimalSettings* outSettings, int maxCount);
+
+/// Look up the optimal settings of one output resolution and quality mode without calling NGX.
+/// @param outputWidth Output width.
+/// @param outputHeight Output height.
+/// @param perfQuality NVSDK_NGX_PerfQuality_Value.
+/// @param outSettings Receives the row.
+/// @return 0 on success, -1 if the resolution is not in the table or NGX does not support the mode.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_LookupOptimalSettings(
+    unsigned int outputWidth, unsigned int outputHeight, int perfQuality, DLSSOptimalSettings* outSettings);
+
+//--- Jitter ---
+
+/// Get the jitter of a frame: Halton(2,3) with 8 x (output area / render area) phases.
+/// Tables are built once per phase count, so repeated calls are a table lookup.
+/// @param frameIndex Any increasing frame counter; the sequence repeats every phase count frames.
+/// @param outOffset Receives the offset in render pixels (apply it to the projection matrix).
+/// @return 0 on success, -1 if a size is 0 or outOffset is NULL.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetJitterOffset(
+    unsigned int renderWidth, unsigned int renderHeight, unsigned int outputWidth, unsigned int outputHeight,
+    unsigned long long frameIndex, DLSSJitterOffset* outOffset);
+
+/// Copy the whole jitter sequence for an upscale, e.g. to index it from C# without per-frame calls.
+/// @param outOffsets Receives up to maxCount offsets (can be NULL to query the phase count).
+/// @return Phase count (may exceed maxCount), 0 if a size is 0.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetJitterSequence(
+    unsigned int renderWidth, unsigned int renderHeight, unsigned int outputWidth, unsigned int outputHeight,
+    DLSSJitterOffset* outOffsets, int maxCount);
+
+//--- Calibration ---
+
+/// Measure the GPU cost of every requested preset and quality combination at one output
+/// size: each candidate is created on synthetic inputs, evaluated warmupFrames + frameCount
+/// times on a private command queue and timed with GPU timestamps. Blocks until done
+/// (typically well under a second per candidate). NGX is used from the calling thread: the run
+/// waits for a render event already in progress, and render events issued while it runs are
+/// dropped (recorded as RenderEventRejected with DLSS_RESULT_FAIL_NOT_READY), so frames
+/// rendered meanwhile get no DLSS output. Call it at startup or behind a loading screen.
+/// The results replace earlier results for the same output size and are written next to the
+/// capability cache (see DLSSInitParams::applicationDataPath), keyed by adapter, driver and
+/// DLSS snippet versions, so the next launch reads them with DLSS_GetCalibrationTable.
+/// @param params Candidates to measure.
+/// @param outResults Receives this run's candidates, cheapest first, failed ones last (can be NULL).
+/// @param maxCount Capacity of outResults.
+/// @return Number of candidates (may exceed maxCount), or a negative NGX result if the run could
+///         not start (DLSS_RESULT_FAIL_NOT_READY while DLSS_InitAsync is running or another
+///         calibration is in progress).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_RunCalibration(
+    const DLSSCalibrationParams* params, DLSSCalibrationResult* outResults, int maxCount);
+
+/// Get every calibration result measured on this machine, grouped by output size and
+/// ranked cheapest first within each size. Empty until a calibration has run or a
+/// persisted table matching the current adapter and driver was loaded at init.
+/// @param outResults Array receiving the results (can be NULL to query the count).
+/// @param maxCount Capacity of outResults.
+/// @return Total number of results (may exceed maxCount).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetCalibrationTable(
+    DLSSCalibrationResult* outResults, int maxCount);
+
+//--- Circuit Breaker ---
+
+/// Set how many consecutive failed evaluates trip a feature and how long it stays bypassed.
+/// Applies to every feature handle, including ones already created.
+/// While a handle is tripped, its evaluate events skip NGX: the plugin copies color into
+/// output when both have the same size and format, and leaves output untouched otherwise.
+/// After the back-off one evaluate retries NGX; a success restores the handle, a failure
+/// doubles the back-off. Poll DLSS_GetFeatureHealth to switch the pipeline to another
+/// upscaler while a handle is not healthy.
+/// @param settings Breaker settings (NULL restores the defaults).
+/// @return 0 on success.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_SetCircuitBreakerSettings(const DLSSCircuitBreakerSettings* settings);
+
+/// Get the circuit breaker state of a feature handle.
+/// @param handle Feature handle.
+/// @param outHealth Receives the state.
+/// @return 0 on success, -1 if the create event has not succeeded for the handle.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetFeatureHealth(int handle, DLSSFeatureHealth* outHealth);
+
+/// Close a handle's breaker so its next evaluate goes to NGX, e.g. after fixing the inputs
+/// that made it fail. Trip and bypass counts are kept.
+/// @return 0 on success, -1 if the create event has not succeeded for the handle.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_ResetFeatureHealth(int handle);
+
+//--- Diagnostics ---
+
+/// Get deduplicated NGX failure counters.
+/// Repeated failures of the same (handle, result) pair are logged once in full,
+/// then at most once per second with a repeat count. A handle's counters are dropped
+/// when it is destroyed or freed, and all of them at init and shutdown.
+/// @param outCounters Array receiving the counters (can be NULL to query the count).
+/// @param maxCount Capacity of outCounters.
+/// @return Total number of tracked pairs (may exceed maxCount).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetErrorCounters(
+    DLSSErrorCounter* outCounters, int maxCount);
+
+/// Get rolling GPU timings of EvaluateFeature per feature handle.
+/// Timestamps are read back a few frames late without stalling, so a new
+/// handle reports no samples for its first frames.
+/// @param outTimings Array receiving the timings (can be NULL to query the count).
+/// @param maxCount Capacity of outTimings.
+/// @return Total number of handles with timings (may exceed maxCount).
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetGpuTimings(
+    DLSSGpuTiming* outTimings, int maxCount);
+
+/// Get CPU latency statistics of every instrumented entry point.
+/// Histograms are always on; percentiles are accurate to about 6%.
+/// @param outStats Array indexed by DLSSTelemetryPoint (can be NULL to query the count).
+/// @param maxCount Capacity of outStats.
+/// @return DLSS_Telemetry_Count.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_GetTelemetry(
+    DLSSLatencyStats* outStats, int maxCount);
+
+/// Clear all latency histograms.
+void UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_ResetTelemetry(void);
+
+/// Start writing a Chrome Trace Event JSON file (open in chrome://tracing or ui.perfetto.dev).
+/// Covers exports, render events, NGX log lines and GPU evaluate timings.
+/// @param path Output file path.
+/// @return 0 on success, -1 if a trace is already running or the file cannot be created.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_BeginTrace(const char* path);
+
+/// Stop the running trace and close the file.
+/// @return Number of events written, or -1 if no trace was running.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_EndTrace(void);
+
+/// Start recording render events and parameter writes to a binary capture file.
+/// Replay it offline with the dlss_replay tool.
+/// @param path Output file path.
+/// @return 0 on success, -1 if a capture is already running or the file cannot be created.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_BeginCapture(const char* path);
+
+/// Stop the running capture and close the file.
+/// @return Number of records written, or -1 if no capture was running.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_EndCapture(void);
+
+/// Write the flight recorder (last 8192 plugin events, 32 bytes each) to a file.
+/// Decode with the dlss_flight_decode tool.
+/// @param path Output file path.
+/// @return Number of records written, or -1 on failure.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_DumpFlightRecorder(const char* path);
+
+/// Copy the flight recorder into a buffer, in the same format as the file dump.
+/// @param buffer Destination buffer (can be NULL to query the size).
+/// @param bufferSize Size of buffer in bytes.
+/// @return Bytes written, or the required size if buffer is NULL or too small.
+int UNITY_INTERFACE_EXPORT UNITY_INTERFACE_API DLSS_CopyFlightRecorder(void* buffer, int bufferSize);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
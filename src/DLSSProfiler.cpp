@@ -0,0 +1,189 @@
+//------------------------------------------------------------------------------
+// DLSSProfiler.cpp - Unity Profiler markers for NGX calls
+//------------------------------------------------------------------------------
+
+#include "DLSSProfiler.h"
+
+namespace dlss
+{
+
+static const char* const kMarkerNames[static_cast<int>(ProfilerMarker::Count)] = {
+    "DLSS.Init",
+    "DLSS.Shutdown",
+    "DLSS.CreateFeature",
+    "DLSS.EvaluateFeature",
+    "DLSS.ReleaseFeature",
+};
+
+// Metadata layout of the operation markers (order matches BeginSample)
+static constexpr int kSampleMetadataCount = 6;
+
+Profiler& Profiler::Instance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+template<typename T>
+T* Profiler::CreateCounter(const char* name, UnityProfilerMarkerDataUnit unit)
+{
+    void* value = m_profiler->CreateCounterValue(kUnityProfilerCategoryRender, name,
+        kUnityProfilerMarkerFlagCounter, UnityProfilerDataUnitHelper<T>::GetProfilerType(), unit,
+        sizeof(T), kUnityProfilerCounterFlagNone, nullptr, nullptr, nullptr);
+    return static_cast<T*>(value);
+}
+
+template<typename T>
+void Profiler::FlushCounter(T* counter, T value)
+{
+    if (counter)
+    {
+        *counter = value;
+        m_profiler->FlushCounterValue(counter);
+    }
+}
+
+void Profiler::Initialize(IUnityInterfaces* unityInterfaces)
+{
+    m_profiler = unityInterfaces ? unityInterfaces->Get<IUnityProfilerV2>() : nullptr;
+    if (!m_profiler)
+    {
+        return;
+    }
+
+    // Release players compile the profiler out; don't bother creating markers
+    if (!m_profiler->IsAvailable())
+    {
+        m_profiler = nullptr;
+        return;
+    }
+
+    for (int i = 0; i < static_cast<int>(ProfilerMarker::Count); ++i)
+    {
+        const UnityProfilerMarkerDesc* desc = nullptr;
+        if (m_profiler->CreateMarker(&desc, kMarkerNames[i], kUnityProfilerCategoryRender,
+                kUnityProfilerMarkerFlagDefault, kSampleMetadataCount) != 0)
+        {
+            continue;
+        }
+
+        m_profiler->SetMarkerMetadataName(desc, 0, "Handle", kUnityProfilerMarkerDataTypeInt32, kUnityProfilerMarkerDataUnitUndefined);
+        m_profiler->SetMarkerMetadataName(desc, 1, "Feature", kUnityProfilerMarkerDataTypeInt32, kUnityProfilerMarkerDataUnitUndefined);
+        m_profiler->SetMarkerMetadataName(desc, 2, "RenderWidth", kUnityProfilerMarkerDataTypeUInt32, kUnityProfilerMarkerDataUnitCount);
+        m_profiler->SetMarkerMetadataName(desc, 3, "RenderHeight", kUnityProfilerMarkerDataTypeUInt32, kUnityProfilerMarkerDataUnitCount);
+        m_profiler->SetMarkerMetadataName(desc, 4, "OutputWidth", kUnityProfilerMarkerDataTypeUInt32, kUnityProfilerMarkerDataUnitCount);
+        m_profiler->SetMarkerMetadataName(desc, 5, "OutputHeight", kUnityProfilerMarkerDataTypeUInt32, kUnityProfilerMarkerDataUnitCount);
+        m_markers[i] = desc;
+    }
+
+    m_liveFeaturesCounter = CreateCounter<uint32_t>("DLSS Live Features", kUnityProfilerMarkerDataUnitCount);
+    m_evaluatesCounter = CreateCounter<uint32_t>("DLSS Evaluates", kUnityProfilerMarkerDataUnitCount);
+    m_createsCounter = CreateCounter<uint32_t>("DLSS Creates", kUnityProfilerMarkerDataUnitCount);
+    m_destroysCounter = CreateCounter<uint32_t>("DLSS Destroys", kUnityProfilerMarkerDataUnitCount);
+    m_ngxVramCounter = CreateCounter<uint64_t>("DLSS NGX VRAM", kUnityProfilerMarkerDataUnitBytes);
+    m_ringBufferBytesCounter = CreateCounter<uint64_t>("DLSS Ring Buffer Used", kUnityProfilerMarkerDataUnitBytes);
+
+    if (m_profiler->CreateMarker(&m_resultMarker, "DLSS.NGXResult", kUnityProfilerCategoryRender,
+            kUnityProfilerMarkerFlagDefault, 2) == 0)
+    {
+        m_profiler->SetMarkerMetadataName(m_resultMarker, 0, "Handle", kUnityProfilerMarkerDataTypeInt32, kUnityProfilerMarkerDataUnitUndefined);
+        m_profiler->SetMarkerMetadataName(m_resultMarker, 1, "Result", kUnityProfilerMarkerDataTypeUInt32, kUnityProfilerMarkerDataUnitUndefined);
+    }
+    else
+    {
+        m_resultMarker = nullptr;
+    }
+}
+
+void Profiler::Shutdown()
+{
+    m_profiler = nullptr;
+    m_resultMarker = nullptr;
+    m_liveFeaturesCounter = nullptr;
+    m_evaluatesCounter = nullptr;
+    m_createsCounter = nullptr;
+    m_destroysCounter = nullptr;
+    m_ngxVramCounter = nullptr;
+    m_ringBufferBytesCounter = nullptr;
+    for (const UnityProfilerMarkerDesc*& marker : m_markers)
+    {
+        marker = nullptr;
+    }
+}
+
+const UnityProfilerMarkerDesc* Profiler::BeginSample(ProfilerMarker marker, const ProfilerSampleInfo& info)
+{
+    const UnityProfilerMarkerDesc* desc = m_profiler ? m_markers[static_cast<int>(marker)] : nullptr;
+    if (!desc)
+    {
+        return nullptr;
+    }
+
+    UnityProfilerMarkerData data[kSampleMetadataCount] = {};
+    data[0].type = kUnityProfilerMarkerDataTypeInt32;
+    data[0].size = sizeof(info.handle);
+    data[0].ptr = &info.handle;
+    data[1].type = kUnityProfilerMarkerDataTypeInt32;
+    data[1].size = sizeof(info.feature);
+    data[1].ptr = &info.feature;
+    data[2].type = kUnityProfilerMarkerDataTypeUInt32;
+    data[2].size = sizeof(info.renderWidth);
+    data[2].ptr = &info.renderWidth;
+    data[3].type = kUnityProfilerMarkerDataTypeUInt32;
+    data[3].size = sizeof(info.renderHeight);
+    data[3].ptr = &info.renderHeight;
+    data[4].type = kUnityProfilerMarkerDataTypeUInt32;
+    data[4].size = sizeof(info.outputWidth);
+    data[4].ptr = &info.outputWidth;
+    data[5].type = kUnityProfilerMarkerDataTypeUInt32;
+    data[5].size = sizeof(info.outputHeight);
+    data[5].ptr = &info.outputHeight;
+
+    m_profiler->BeginSample(desc, kSampleMetadataCount, data);
+    return desc;
+}
+
+void Profiler::EmitResult(int handle, int result)
+{
+    if (!m_profiler || !m_resultMarker)
+    {
+        return;
+    }
+
+    const uint32_t resultBits = static_cast<uint32_t>(result);
+
+    UnityProfilerMarkerData data[2] = {};
+    data[0].type = kUnityProfilerMarkerDataTypeInt32;
+    data[0].size = sizeof(handle);
+    data[0].ptr = &handle;
+    data[1].type = kUnityProfilerMarkerDataTypeUInt32;
+    data[1].size = sizeof(resultBits);
+    data[1].ptr = &resultBits;
+
+    m_profiler->EmitEvent(m_resultMarker, kUnityProfilerMarkerEventTypeSingle, 2, data);
+}
+
+void Profiler::EndSample(const UnityProfilerMarkerDesc* marker)
+{
+    if (m_profiler && marker)
+    {
+        m_profiler->EndSample(marker);
+    }
+}
+
+void Profiler::FlushFrameCounters(const ProfilerFrameCounters& counters)
+{
+    if (!m_profiler)
+    {
+        return;
+    }
+
+    FlushCounter(m_liveFeaturesCounter, counters.liveFeatures);
+    FlushCounter(m_evaluatesCounter, counters.evaluates);
+    FlushCounter(m_createsCounter, counters.creates);
+    FlushCounter(m_destroysCounter, counters.destroys);
+    FlushCounter(m_ngxVramCounter, counters.ngxVramBytes);
+    FlushCounter(m_ringBufferBytesCounter, counters.ringBufferBytesUsed);
+}
+
+} // namespace dlss
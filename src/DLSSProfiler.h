@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+// DLSSProfiler.h - Unity Profiler markers for NGX calls
+//------------------------------------------------------------------------------
+// Wraps IUnityProfilerV2 so NGX work shows up as named samples in the Unity
+// Profiler timeline instead of an opaque plugin event. Markers are created
+// once at plugin load; samples are only emitted while the profiler is
+// enabled, so the disabled cost is a single IsEnabled() call per scope.
+// Per-frame DLSS counters are published alongside and flushed on
+// DLSS_Event_EndFrame.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "IUnityInterface.h"
+#include "IUnityProfiler.h"
+
+namespace dlss
+{
+
+/// Profiled plugin operations.
+enum class ProfilerMarker
+{
+    Init,
+    Shutdown,
+    CreateFeature,
+    EvaluateFeature,
+    ReleaseFeature,
+
+    Count
+};
+
+/// Metadata attached to the begin event of a sample.
+struct ProfilerSampleInfo
+{
+    int handle = -1;                // Feature handle, or DLSS_INVALID_FEATURE_HANDLE
+    int feature = 0;                // NVSDK_NGX_Feature, 0 if not applicable
+    uint32_t renderWidth = 0;       // Input resolution the feature was created with
+    uint32_t renderHeight = 0;
+    uint32_t outputWidth = 0;       // Output resolution the feature was created with
+    uint32_t outputHeight = 0;
+};
+
+/// Values published to the Unity Profiler counters once per frame.
+struct ProfilerFrameCounters
+{
+    uint32_t liveFeatures = 0;          // Features currently created
+    uint32_t evaluates = 0;             // EvaluateFeature calls this frame
+    uint32_t creates = 0;               // CreateFeature calls this frame
+    uint32_t destroys = 0;              // DestroyFeature calls this frame
+    uint64_t ngxVramBytes = 0;          // NGX-reported VRAM allocated by all features
+    uint64_t ringBufferBytesUsed = 0;   // Render-event payload bytes written by C# this frame
+};
+
+class Profiler
+{
+public:
+    static Profiler& Instance();
+
+    // Non-copyable
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    /// Acquire IUnityProfilerV2 and create the markers (called from UnityPluginLoad).
+    void Initialize(IUnityInterfaces* unityInterfaces);
+
+    /// Drop the profiler interface (called from UnityPluginUnload).
+    void Shutdown();
+
+    /// @return true if a profiler is attached and currently recording.
+    bool IsEnabled() const
+    {
+        return m_profiler && m_profiler->IsEnabled() != 0;
+    }
+
+    /// Emit the begin event of a sample with its metadata.
+    /// @return Marker to pass to EndSample, or nullptr if nothing was emitted.
+    const UnityProfilerMarkerDesc* BeginSample(ProfilerMarker marker, const ProfilerSampleInfo& info);
+
+    /// Emit the NGX result as an instant event nested inside the open sample.
+    void EmitResult(int handle, int result);
+
+    /// Close a sample opened with BeginSample.
+    void EndSample(const UnityProfilerMarkerDesc* marker);
+
+    /// Write and flush the per-frame counters (render thread, end of frame).
+    void FlushFrameCounters(const ProfilerFrameCounters& counters);
+
+private:
+    Profiler() = default;
+
+    template<typename T>
+    T* CreateCounter(const char* name, UnityProfilerMarkerDataUnit unit);
+
+    template<typename T>
+    void FlushCounter(T* counter, T value);
+
+    IUnityProfilerV2* m_profiler = nullptr;
+    const UnityProfilerMarkerDesc* m_markers[static_cast<int>(ProfilerMarker::Count)] = {};
+    const UnityProfilerMarkerDesc* m_resultMarker = nullptr;
+
+    // Counter value storage owned by Unity (null if creation failed)
+    uint32_t* m_liveFeaturesCounter = nullptr;
+    uint32_t* m_evaluatesCounter = nullptr;
+    uint32_t* m_createsCounter = nullptr;
+    uint32_t* m_destroysCounter = nullptr;
+    uint64_t* m_ngxVramCounter = nullptr;
+    uint64_t* m_ringBufferBytesCounter = nullptr;
+};
+
+/// RAII sample scope used at instrumentation sites.
+class ProfilerScope
+{
+public:
+    explicit ProfilerScope(ProfilerMarker marker, const ProfilerSampleInfo& info = ProfilerSampleInfo())
+        : m_handle(info.handle)
+    {
+        Profiler& profiler = Profiler::Instance();
+        if (profiler.IsEnabled())
+        {
+            m_marker = profiler.BeginSample(marker, info);
+        }
+    }
+
+    ~ProfilerScope()
+    {
+        if (m_marker)
+        {
+            Profiler::Instance().EndSample(m_marker);
+        }
+    }
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+
+    /// Attach the NGX result to this sample (no-op if the sample was not emitted).
+    void SetResult(int result)
+    {
+        if (m_marker)
+        {
+            Profiler::Instance().EmitResult(m_handle, result);
+        }
+    }
+
+private:
+    const UnityProfilerMarkerDesc* m_marker = nullptr;
+    int m_handle;
+};
+
+} // namespace dlss
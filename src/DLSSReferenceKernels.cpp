@@ -0,0 +1,344 @@
+//------------------------------------------------------------------------------
+// DLSSReferenceKernels.cpp - Per-pixel kernels of the CPU reference upscaler
+//------------------------------------------------------------------------------
+
+#include "DLSSReferenceKernels.h"
+#include "DLSSSimd.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+
+namespace dlss
+{
+
+namespace
+{
+
+// Catmull-Rom footprint of a history position; rows and columns clamped to the image.
+// Sharper than bilinear, which would blur history a little more on every frame of sub-pixel motion.
+struct HistoryTaps
+{
+    const float* rows[4];
+    int32_t x[4];               // Float offsets of the columns
+    float wx[4];
+    float wy[4];
+};
+
+inline void CatmullRomWeights(float f, float* weights)
+{
+    weights[0] = f * (-0.5f + f * (1.0f - 0.5f * f));
+    weights[1] = 1.0f + f * f * (-2.5f + 1.5f * f);
+    weights[2] = f * (0.5f + f * (2.0f - 1.5f * f));
+    weights[3] = f * f * (-0.5f + 0.5f * f);
+}
+
+inline HistoryTaps GetHistoryTaps(const ResolveSpanArgs& args, float x, float y)
+{
+    const float fx0 = std::floor(x);
+    const float fy0 = std::floor(y);
+    const int32_t ix = static_cast<int32_t>(fx0);
+    const int32_t iy = static_cast<int32_t>(fy0);
+    const int32_t maxX = static_cast<int32_t>(args.historyWidth) - 1;
+    const int32_t maxY = static_cast<int32_t>(args.historyHeight) - 1;
+    const size_t pitch = static_cast<size_t>(args.historyWidth) * 4;
+
+    HistoryTaps taps;
+    for (int k = 0; k < 4; ++k)
+    {
+        taps.x[k] = std::clamp(ix - 1 + k, 0, maxX) * 4;
+        taps.rows[k] = args.history + static_cast<size_t>(std::clamp(iy - 1 + k, 0, maxY)) * pitch;
+    }
+    CatmullRomWeights(x - fx0, taps.wx);
+    CatmullRomWeights(y - fy0, taps.wy);
+    return taps;
+}
+
+//------------------------------------------------------------------------------
+// Scalar
+//------------------------------------------------------------------------------
+
+// Separable 4x4 filter of RGBA pixels
+void Filter4x4Scalar(const float* const* rows, const int32_t* x, const float* wx, const float* wy, float* result)
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        result[c] = 0.0f;
+    }
+    for (int r = 0; r < 4; ++r)
+    {
+        float row[4] = {};
+        for (int t = 0; t < 4; ++t)
+        {
+            const float* pixel = rows[r] + x[t];
+            for (int c = 0; c < 4; ++c)
+            {
+                row[c] += wx[t] * pixel[c];
+            }
+        }
+        for (int c = 0; c < 4; ++c)
+        {
+            result[c] += wy[r] * row[c];
+        }
+    }
+}
+
+void ResolveSpanScalar(const ResolveSpanArgs& args)
+{
+    for (uint32_t i = 0; i < args.count; ++i)
+    {
+        const ReferenceColumn& column = args.columns[i];
+
+        float current[4];
+        Filter4x4Scalar(args.colorRows, column.tapX, column.tapWeight, args.rowWeight, current);
+
+        float lo[4];
+        float hi[4];
+        std::memcpy(lo, args.neighborRows[0] + column.neighborX[0], sizeof(lo));
+        std::memcpy(hi, lo, sizeof(hi));
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int n = 0; n < 3; ++n)
+            {
+                const float* pixel = args.neighborRows[r] + column.neighborX[n];
+                for (int c = 0; c < 4; ++c)
+                {
+                    lo[c] = std::min(lo[c], pixel[c]);
+                    hi[c] = std::max(hi[c], pixel[c]);
+                }
+            }
+        }
+
+        float result[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            result[c] = std::min(std::max(current[c], lo[c]), hi[c]);
+        }
+
+        const float hx = args.historyPos[2 * i];
+        if (hx > kNoHistory)
+        {
+            const HistoryTaps taps = GetHistoryTaps(args, hx, args.historyPos[2 * i + 1]);
+            float history[4];
+            Filter4x4Scalar(taps.rows, taps.x, taps.wx, taps.wy, history);
+            for (int c = 0; c < 4; ++c)
+            {
+                history[c] = std::min(std::max(history[c], lo[c]), hi[c]);
+                result[c] = history[c] + args.currentWeight * (result[c] - history[c]);
+            }
+        }
+
+        std::memcpy(args.output + 4 * i, result, sizeof(result));
+        std::memcpy(args.historyOut + 4 * i, result, sizeof(result));
+    }
+}
+
+//------------------------------------------------------------------------------
+// AVX2 + FMA: two RGBA taps per 256-bit register
+//------------------------------------------------------------------------------
+
+#if DLSS_SIMD_X64
+
+DLSS_TARGET_AVX2 inline __m256 Load2(const float* a, const float* b)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(a)), _mm_loadu_ps(b), 1);
+}
+
+DLSS_TARGET_AVX2 inline __m256 Splat2(float a, float b)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_set1_ps(a)), _mm_set1_ps(b), 1);
+}
+
+DLSS_TARGET_AVX2 inline __m128 Filter4x4Avx2(const float* const* rows, const int32_t* x, const float* wx,
+    const float* wy)
+{
+    const __m256 w01 = Splat2(wx[0], wx[1]);
+    const __m256 w23 = Splat2(wx[2], wx[3]);
+
+    __m256 sum = _mm256_setzero_ps();
+    for (int r = 0; r < 4; ++r)
+    {
+        const float* row = rows[r];
+        __m256 taps = _mm256_mul_ps(Load2(row + x[0], row + x[1]), w01);
+        taps = _mm256_fmadd_ps(Load2(row + x[2], row + x[3]), w23, taps);
+        sum = _mm256_fmadd_ps(taps, _mm256_set1_ps(wy[r]), sum);
+    }
+    return _mm_add_ps(_mm256_castps256_ps128(sum), _mm256_extractf128_ps(sum, 1));
+}
+
+DLSS_TARGET_AVX2 void ResolveSpanAvx2(const ResolveSpanArgs& args)
+{
+    const __m128 currentWeight = _mm_set1_ps(args.currentWeight);
+
+    for (uint32_t i = 0; i < args.count; ++i)
+    {
+        const ReferenceColumn& column = args.columns[i];
+        __m128 result = Filter4x4Avx2(args.colorRows, column.tapX, column.tapWeight, args.rowWeight);
+
+        __m256 lo2 = Load2(args.neighborRows[0] + column.neighborX[0], args.neighborRows[0] + column.neighborX[1]);
+        __m256 hi2 = lo2;
+        __m128 lo1 = _mm_loadu_ps(args.neighborRows[0] + column.neighborX[2]);
+        __m128 hi1 = lo1;
+        for (int r = 1; r < 3; ++r)
+        {
+            const float* row = args.neighborRows[r];
+            const __m256 pair = Load2(row + column.neighborX[0], row + column.neighborX[1]);
+            const __m128 single = _mm_loadu_ps(row + column.neighborX[2]);
+            lo2 = _mm256_min_ps(lo2, pair);
+            hi2 = _mm256_max_ps(hi2, pair);
+            lo1 = _mm_min_ps(lo1, single);
+            hi1 = _mm_max_ps(hi1, single);
+        }
+        const __m128 lo = _mm_min_ps(_mm_min_ps(_mm256_castps256_ps128(lo2), _mm256_extractf128_ps(lo2, 1)), lo1);
+        const __m128 hi = _mm_max_ps(_mm_max_ps(_mm256_castps256_ps128(hi2), _mm256_extractf128_ps(hi2, 1)), hi1);
+        result = _mm_min_ps(_mm_max_ps(result, lo), hi);
+
+        const float hx = args.historyPos[2 * i];
+        if (hx > kNoHistory)
+        {
+            const HistoryTaps taps = GetHistoryTaps(args, hx, args.historyPos[2 * i + 1]);
+            __m128 history = Filter4x4Avx2(taps.rows, taps.x, taps.wx, taps.wy);
+            history = _mm_min_ps(_mm_max_ps(history, lo), hi);
+            result = _mm_fmadd_ps(_mm_sub_ps(result, history), currentWeight, history);
+        }
+
+        _mm_storeu_ps(args.output + 4 * i, result);
+        _mm_storeu_ps(args.historyOut + 4 * i, result);
+    }
+}
+
+#endif // DLSS_SIMD_X64
+
+//------------------------------------------------------------------------------
+// NEON: one RGBA tap per 128-bit register
+//------------------------------------------------------------------------------
+
+#if DLSS_SIMD_NEON
+
+inline float32x4_t Filter4x4Neon(const float* const* rows, const int32_t* x, const float* wx, const float* wy)
+{
+    float32x4_t sum = vdupq_n_f32(0.0f);
+    for (int r = 0; r < 4; ++r)
+    {
+        const float* row = rows[r];
+        float32x4_t taps = vmulq_n_f32(vld1q_f32(row + x[0]), wx[0]);
+        taps = vfmaq_n_f32(taps, vld1q_f32(row + x[1]), wx[1]);
+        taps = vfmaq_n_f32(taps, vld1q_f32(row + x[2]), wx[2]);
+        taps = vfmaq_n_f32(taps, vld1q_f32(row + x[3]), wx[3]);
+        sum = vfmaq_n_f32(sum, taps, wy[r]);
+    }
+    return sum;
+}
+
+void ResolveSpanNeon(const ResolveSpanArgs& args)
+{
+    for (uint32_t i = 0; i < args.count; ++i)
+    {
+        const ReferenceColumn& column = args.columns[i];
+        float32x4_t result = Filter4x4Neon(args.colorRows, column.tapX, column.tapWeight, args.rowWeight);
+
+        float32x4_t lo = vld1q_f32(args.neighborRows[0] + column.neighborX[0]);
+        float32x4_t hi = lo;
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int n = 0; n < 3; ++n)
+            {
+                const float32x4_t pixel = vld1q_f32(args.neighborRows[r] + column.neighborX[n]);
+                lo = vminq_f32(lo, pixel);
+                hi = vmaxq_f32(hi, pixel);
+            }
+        }
+        result = vminq_f32(vmaxq_f32(result, lo), hi);
+
+        const float hx = args.historyPos[2 * i];
+        if (hx > kNoHistory)
+        {
+            const HistoryTaps taps = GetHistoryTaps(args, hx, args.historyPos[2 * i + 1]);
+            float32x4_t history = Filter4x4Neon(taps.rows, taps.x, taps.wx, taps.wy);
+            history = vminq_f32(vmaxq_f32(history, lo), hi);
+            result = vfmaq_n_f32(history, vsubq_f32(result, history), args.currentWeight);
+        }
+
+        vst1q_f32(args.output + 4 * i, result);
+        vst1q_f32(args.historyOut + 4 * i, result);
+    }
+}
+
+#endif // DLSS_SIMD_NEON
+
+//------------------------------------------------------------------------------
+// Dispatch
+//------------------------------------------------------------------------------
+
+const ReferenceKernels kScalarKernels = {"scalar", ResolveSpanScalar};
+#if DLSS_SIMD_X64
+const ReferenceKernels kAvx2Kernels = {"avx2", ResolveSpanAvx2};
+#endif
+#if DLSS_SIMD_NEON
+const ReferenceKernels kNeonKernels = {"neon", ResolveSpanNeon};
+#endif
+
+const ReferenceKernels* FindKernels(const char* name)
+{
+    if (std::strcmp(name, kScalarKernels.name) == 0)
+    {
+        return &kScalarKernels;
+    }
+#if DLSS_SIMD_X64
+    if (std::strcmp(name, kAvx2Kernels.name) == 0 && CpuSupportsAvx2())
+    {
+        return &kAvx2Kernels;
+    }
+#endif
+#if DLSS_SIMD_NEON
+    if (std::strcmp(name, kNeonKernels.name) == 0)
+    {
+        return &kNeonKernels;
+    }
+#endif
+    return nullptr;
+}
+
+const ReferenceKernels* DetectKernels()
+{
+#if DLSS_SIMD_X64
+    if (CpuSupportsAvx2())
+    {
+        return &kAvx2Kernels;
+    }
+#elif DLSS_SIMD_NEON
+    return &kNeonKernels;
+#endif
+    return &kScalarKernels;
+}
+
+std::atomic<const ReferenceKernels*> g_kernels{nullptr};
+
+} // namespace
+
+const ReferenceKernels& GetReferenceKernels()
+{
+    const ReferenceKernels* kernels = g_kernels.load(std::memory_order_acquire);
+    if (!kernels)
+    {
+        // Detection is idempotent, so racing first calls agree
+        const ReferenceKernels* detected = DetectKernels();
+        g_kernels.compare_exchange_strong(kernels, detected, std::memory_order_acq_rel);
+        kernels = g_kernels.load(std::memory_order_acquire);
+    }
+    return *kernels;
+}
+
+bool SelectReferenceKernels(const char* name)
+{
+    const ReferenceKernels* kernels = name ? FindKernels(name) : nullptr;
+    if (!kernels)
+    {
+        return false;
+    }
+    g_kernels.store(kernels, std::memory_order_release);
+    return true;
+}
+
+} // namespace dlss
@@ -0,0 +1,69 @@
+//------------------------------------------------------------------------------
+// DLSSReferenceKernels.h - Per-pixel kernels of the CPU reference upscaler
+//------------------------------------------------------------------------------
+// ReferenceFeature (DLSSReferenceUpscaler.h) does the per-frame setup: tap
+// tables, motion and history positions. The kernels here resolve one span of
+// an output row from those tables, one RGBA pixel at a time:
+//
+//   1. Lanczos-2 resample of the jittered color (4x4 taps)
+//   2. Clamp to the min/max of the 3x3 color neighborhood (anti-ringing)
+//   3. Catmull-Rom history fetch (4x4 taps), clamped to the same neighborhood
+//   4. Exponential blend of history and the current frame
+//
+// Both 4x4 filters share one separable helper per variant. AVX2 (x86-64,
+// chosen at runtime) processes two RGBA taps per 256-bit register and NEON
+// (ARM64) one per 128-bit register; the scalar variant is
+// the portable fallback. Each variant is deterministic on its own; variants
+// may differ in the last bits because they sum taps in different orders.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace dlss
+{
+
+/// Horizontal taps of one output column. Offsets are in floats from the start of a row.
+struct ReferenceColumn
+{
+    int32_t tapX[4];            // Lanczos footprint
+    float tapWeight[4];         // Normalized Lanczos-2 weights
+    int32_t neighborX[3];       // 3x3 neighborhood around the nearest render pixel
+};
+
+/// historyPos value of a pixel without valid history (reset, off-screen reprojection).
+constexpr float kNoHistory = -2.0f;
+
+struct ResolveSpanArgs
+{
+    const float* colorRows[4];          // Rows of the Lanczos footprint
+    float rowWeight[4];
+    const float* neighborRows[3];       // Rows of the 3x3 neighborhood
+    const ReferenceColumn* columns;     // One per pixel of the span
+    const float* historyPos;            // x, y per pixel in history texels (minus 0.5), or kNoHistory
+    const float* history;               // Previous output, tightly packed RGBA
+    uint32_t historyWidth;
+    uint32_t historyHeight;
+    float currentWeight;                // Blend weight of the current frame when history is valid
+    float* output;                      // First RGBA pixel of the span in the output image
+    float* historyOut;                  // Same span in the next history buffer
+    uint32_t count;                     // Pixels in the span
+};
+
+using ResolveSpanFn = void (*)(const ResolveSpanArgs& args);
+
+struct ReferenceKernels
+{
+    const char* name;                   // "avx2", "neon" or "scalar"
+    ResolveSpanFn resolveSpan;
+};
+
+/// Kernels in use: the best variant the CPU supports unless SelectReferenceKernels chose another.
+const ReferenceKernels& GetReferenceKernels();
+
+/// Force a variant, e.g. to compare a SIMD variant with the scalar one.
+/// @return false if name is unknown or not supported on this CPU; the selection is unchanged.
+bool SelectReferenceKernels(const char* name);
+
+} // namespace dlss
@@ -0,0 +1,354 @@
+//------------------------------------------------------------------------------
+// DLSSReferenceUpscaler.cpp - Deterministic CPU temporal upscaler
+//------------------------------------------------------------------------------
+
+#include "DLSSReferenceUpscaler.h"
+#include "DLSSReferenceKernels.h"
+#include "DLSSThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
+namespace dlss
+{
+
+namespace
+{
+
+constexpr uint32_t kTileWidth = 128;
+constexpr uint32_t kTileHeight = 32;
+constexpr float kPi = 3.14159265358979f;
+
+std::mutex g_imageMutex;
+std::unordered_set<const void*> g_images;
+
+float Lanczos2(float x)
+{
+    x = std::fabs(x);
+    if (x < 1e-6f)
+    {
+        return 1.0f;
+    }
+    if (x >= 2.0f)
+    {
+        return 0.0f;
+    }
+    const float px = kPi * x;
+    return 2.0f * std::sin(px) * std::sin(px * 0.5f) / (px * px);
+}
+
+// Render-space taps of one output row or column
+struct AxisTaps
+{
+    int32_t tap[4];             // Lanczos footprint, clamped to the render size
+    float weight[4];
+    int32_t neighbor[3];        // Nearest render pixel and its neighbors; neighbor[1] is the nearest
+};
+
+AxisTaps MakeAxisTaps(uint32_t outputIndex, uint32_t outputSize, uint32_t renderSize, float jitter)
+{
+    // Render pixel i samples i + 0.5 + jitter, so this output pixel center lies at
+    // sample index t, with samples at integer t
+    const float position = (static_cast<float>(outputIndex) + 0.5f) * static_cast<float>(renderSize) /
+        static_cast<float>(outputSize) - jitter;
+    const float t = position - 0.5f;
+    const int32_t base = static_cast<int32_t>(std::floor(t));
+    const int32_t maxIndex = static_cast<int32_t>(renderSize) - 1;
+
+    AxisTaps taps;
+    float sum = 0.0f;
+    for (int k = 0; k < 4; ++k)
+    {
+        const int32_t index = base - 1 + k;
+        taps.tap[k] = std::clamp(index, 0, maxIndex);
+        taps.weight[k] = Lanczos2(t - static_cast<float>(index));
+        sum += taps.weight[k];
+    }
+    for (float& weight : taps.weight)
+    {
+        weight /= sum;
+    }
+
+    const int32_t nearest = std::clamp(static_cast<int32_t>(std::floor(position)), 0, maxIndex);
+    for (int k = 0; k < 3; ++k)
+    {
+        taps.neighbor[k] = std::clamp(nearest - 1 + k, 0, maxIndex);
+    }
+    return taps;
+}
+
+// Whether a width x height region at (baseX, baseY) lies inside image
+bool RegionFits(const CpuImage* image, uint32_t baseX, uint32_t baseY, uint32_t width, uint32_t height,
+    uint32_t minChannels)
+{
+    return image && image->data && image->channels >= minChannels &&
+        image->rowPitch >= image->width * image->channels &&
+        static_cast<uint64_t>(baseX) + width <= image->width &&
+        static_cast<uint64_t>(baseY) + height <= image->height;
+}
+
+} // namespace
+
+//------------------------------------------------------------------------------
+// CPU image registry
+//------------------------------------------------------------------------------
+
+void RegisterCpuImage(const CpuImage* image)
+{
+    if (image)
+    {
+        std::lock_guard<std::mutex> lock(g_imageMutex);
+        g_images.insert(image);
+    }
+}
+
+void UnregisterCpuImage(const CpuImage* image)
+{
+    std::lock_guard<std::mutex> lock(g_imageMutex);
+    g_images.erase(image);
+}
+
+const CpuImage* FindCpuImage(const void* resource)
+{
+    std::lock_guard<std::mutex> lock(g_imageMutex);
+    return g_images.count(resource) ? static_cast<const CpuImage*>(resource) : nullptr;
+}
+
+//------------------------------------------------------------------------------
+// ReferenceFeature
+//------------------------------------------------------------------------------
+
+bool ReferenceFeature::Evaluate(const ReferenceInputs& inputs, ThreadPool& pool)
+{
+    const uint32_t renderWidth = inputs.renderWidth ? inputs.renderWidth : m_desc.renderWidth;
+    const uint32_t renderHeight = inputs.renderHeight ? inputs.renderHeight : m_desc.renderHeight;
+    const uint32_t outputWidth = m_desc.outputWidth;
+    const uint32_t outputHeight = m_desc.outputHeight;
+    const uint32_t mvWidth = m_desc.mvLowRes ? renderWidth : outputWidth;
+    const uint32_t mvHeight = m_desc.mvLowRes ? renderHeight : outputHeight;
+
+    if (renderWidth == 0 || renderHeight == 0 || outputWidth == 0 || outputHeight == 0 ||
+        !RegionFits(inputs.color, inputs.colorBaseX, inputs.colorBaseY, renderWidth, renderHeight, 4) ||
+        !RegionFits(inputs.output, inputs.outputBaseX, inputs.outputBaseY, outputWidth, outputHeight, 4) ||
+        inputs.color->channels != 4 || inputs.output->channels != 4)
+    {
+        return false;
+    }
+    if (inputs.motionVectors &&
+        !RegionFits(inputs.motionVectors, inputs.mvBaseX, inputs.mvBaseY, mvWidth, mvHeight, 2))
+    {
+        return false;
+    }
+    if (inputs.depth && !RegionFits(inputs.depth, inputs.depthBaseX, inputs.depthBaseY, renderWidth, renderHeight, 1))
+    {
+        return false;
+    }
+
+    const size_t historySize = static_cast<size_t>(outputWidth) * outputHeight * 4;
+    if (m_history[0].size() != historySize)
+    {
+        m_history[0].assign(historySize, 0.0f);
+        m_history[1].assign(historySize, 0.0f);
+        m_historyValid = false;
+    }
+    const bool useHistory = m_historyValid && !inputs.reset;
+    const std::vector<float>& previous = m_history[m_current];
+    std::vector<float>& next = m_history[m_current ^ 1];
+
+    // Separable setup shared by every tile
+    std::vector<AxisTaps> columnTaps(outputWidth);
+    std::vector<ReferenceColumn> columns(outputWidth);
+    for (uint32_t x = 0; x < outputWidth; ++x)
+    {
+        const AxisTaps taps = MakeAxisTaps(x, outputWidth, renderWidth, inputs.jitterX);
+        ReferenceColumn& column = columns[x];
+        for (int k = 0; k < 4; ++k)
+        {
+            column.tapX[k] = static_cast<int32_t>(inputs.colorBaseX + taps.tap[k]) * 4;
+            column.tapWeight[k] = taps.weight[k];
+        }
+        for (int k = 0; k < 3; ++k)
+        {
+            column.neighborX[k] = static_cast<int32_t>(inputs.colorBaseX + taps.neighbor[k]) * 4;
+        }
+        columnTaps[x] = taps;
+    }
+    std::vector<AxisTaps> rowTaps(outputHeight);
+    for (uint32_t y = 0; y < outputHeight; ++y)
+    {
+        rowTaps[y] = MakeAxisTaps(y, outputHeight, renderHeight, inputs.jitterY);
+    }
+
+    // Jitter difference in MV pixels, removed from jittered motion vectors
+    const float jitterDeltaX = m_desc.mvJittered ?
+        (inputs.jitterX - m_prevJitterX) * static_cast<float>(mvWidth) / static_cast<float>(renderWidth) : 0.0f;
+    const float jitterDeltaY = m_desc.mvJittered ?
+        (inputs.jitterY - m_prevJitterY) * static_cast<float>(mvHeight) / static_cast<float>(renderHeight) : 0.0f;
+
+    // Motion vector of an output pixel, in MV pixels
+    auto fetchMotion = [&](uint32_t x, uint32_t y, float& motionX, float& motionY) {
+        const CpuImage* mv = inputs.motionVectors;
+        if (!mv)
+        {
+            motionX = 0.0f;
+            motionY = 0.0f;
+            return;
+        }
+
+        int32_t texelX = static_cast<int32_t>(x);
+        int32_t texelY = static_cast<int32_t>(y);
+        if (m_desc.mvLowRes)
+        {
+            texelX = columnTaps[x].neighbor[1];
+            texelY = rowTaps[y].neighbor[1];
+
+            // Take the motion of the closest surface in the 3x3 so edges move with the foreground
+            if (inputs.depth)
+            {
+                const CpuImage* depth = inputs.depth;
+                float closest = 0.0f;
+                bool first = true;
+                for (int32_t dy : rowTaps[y].neighbor)
+                {
+                    const float* depthRow = depth->data + static_cast<size_t>(inputs.depthBaseY + dy) * depth->rowPitch;
+                    for (int32_t dx : columnTaps[x].neighbor)
+                    {
+                        const float value = depthRow[static_cast<size_t>(inputs.depthBaseX + dx) * depth->channels];
+                        const bool closer = m_desc.depthInverted ? value > closest : value < closest;
+                        if (first || closer)
+                        {
+                            closest = value;
+                            texelX = dx;
+                            texelY = dy;
+                            first = false;
+                        }
+                    }
+                }
+            }
+        }
+
+        const float* texel = mv->data + static_cast<size_t>(inputs.mvBaseY + texelY) * mv->rowPitch +
+            static_cast<size_t>(inputs.mvBaseX + texelX) * mv->channels;
+        motionX = texel[0] * inputs.mvScaleX - jitterDeltaX;
+        motionY = texel[1] * inputs.mvScaleY - jitterDeltaY;
+    };
+
+    const ReferenceKernels& kernels = GetReferenceKernels();
+    const CpuImage& color = *inputs.color;
+    const CpuImage& output = *inputs.output;
+    const uint32_t tilesX = (outputWidth + kTileWidth - 1) / kTileWidth;
+    const uint32_t tilesY = (outputHeight + kTileHeight - 1) / kTileHeight;
+
+    pool.ParallelFor(tilesX * tilesY, [&](uint32_t tile) {
+        const uint32_t x0 = (tile % tilesX) * kTileWidth;
+        const uint32_t y0 = (tile / tilesX) * kTileHeight;
+        const uint32_t x1 = std::min(x0 + kTileWidth, outputWidth);
+        const uint32_t y1 = std::min(y0 + kTileHeight, outputHeight);
+        float historyPos[2 * kTileWidth];
+
+        for (uint32_t y = y0; y < y1; ++y)
+        {
+            for (uint32_t x = x0; x < x1; ++x)
+            {
+                float* position = historyPos + 2 * (x - x0);
+                position[0] = kNoHistory;
+                position[1] = kNoHistory;
+                if (!useHistory)
+                {
+                    continue;
+                }
+
+                float motionX;
+                float motionY;
+                fetchMotion(x, y, motionX, motionY);
+                const float u = (static_cast<float>(x) + 0.5f) / static_cast<float>(outputWidth) +
+                    motionX / static_cast<float>(mvWidth);
+                const float v = (static_cast<float>(y) + 0.5f) / static_cast<float>(outputHeight) +
+                    motionY / static_cast<float>(mvHeight);
+                if (u >= 0.0f && u <= 1.0f && v >= 0.0f && v <= 1.0f)
+                {
+                    position[0] = u * static_cast<float>(outputWidth) - 0.5f;
+                    position[1] = v * static_cast<float>(outputHeight) - 0.5f;
+                }
+            }
+
+            const AxisTaps& row = rowTaps[y];
+            ResolveSpanArgs args;
+            for (int k = 0; k < 4; ++k)
+            {
+                args.colorRows[k] = color.data + static_cast<size_t>(inputs.colorBaseY + row.tap[k]) * color.rowPitch;
+                args.rowWeight[k] = row.weight[k];
+            }
+            for (int k = 0; k < 3; ++k)
+            {
+                args.neighborRows[k] = color.data + static_cast<size_t>(inputs.colorBaseY + row.neighbor[k]) * color.rowPitch;
+            }
+            args.columns = columns.data() + x0;
+            args.historyPos = historyPos;
+            args.history = previous.data();
+            args.historyWidth = outputWidth;
+            args.historyHeight = outputHeight;
+            args.currentWeight = kCurrentWeight;
+            args.output = output.data + static_cast<size_t>(inputs.outputBaseY + y) * output.rowPitch +
+                static_cast<size_t>(inputs.outputBaseX + x0) * 4;
+            args.historyOut = next.data() + (static_cast<size_t>(y) * outputWidth + x0) * 4;
+            args.count = x1 - x0;
+            kernels.resolveSpan(args);
+        }
+    });
+
+    m_current ^= 1;
+    m_historyValid = true;
+    m_prevJitterX = inputs.jitterX;
+    m_prevJitterY = inputs.jitterY;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// ReferenceUpscaler
+//------------------------------------------------------------------------------
+
+ReferenceUpscaler& ReferenceUpscaler::Instance()
+{
+    static ReferenceUpscaler instance;
+    return instance;
+}
+
+ReferenceUpscaler::~ReferenceUpscaler() = default;
+
+void ReferenceUpscaler::AddFeature(unsigned int id, const ReferenceFeatureDesc& desc)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_features.insert_or_assign(id, ReferenceFeature(desc));
+}
+
+void ReferenceUpscaler::RemoveFeature(unsigned int id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_features.erase(id);
+}
+
+bool ReferenceUpscaler::Evaluate(unsigned int id, const ReferenceInputs& inputs)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_features.find(id);
+    if (it == m_features.end())
+    {
+        return false;
+    }
+    if (!m_pool)
+    {
+        m_pool = std::make_unique<ThreadPool>();
+    }
+    return it->second.Evaluate(inputs, *m_pool);
+}
+
+void ReferenceUpscaler::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_features.clear();
+    m_pool.reset();
+}
+
+} // namespace dlss
@@ -0,0 +1,145 @@
+//------------------------------------------------------------------------------
+// DLSSReferenceUpscaler.h - Deterministic CPU temporal upscaler
+//------------------------------------------------------------------------------
+// A small, readable temporal upscaler used as the evaluate of the null NGX
+// backend and as an oracle for validating inputs offline. It is not DLSS: it
+// reprojects the previous output with the motion vectors, Lanczos-resamples
+// the jittered color, clamps history to the current color neighborhood and
+// blends the two. That is enough for a wrong jitter sign, a missing MV scale
+// or a bad subrect to show up as a measurable loss of quality against ground
+// truth, which is what dlss_reference checks.
+//
+// Conventions (shared with the plugin's inputs):
+//   - Render pixel i samples the scene at i + 0.5 + Jitter.Offset, in render
+//     pixels.
+//   - Motion vectors point from the current pixel to where it was in the
+//     previous frame; after MV.Scale they are in pixels of the MV texture
+//     (render size with MVLowRes, output size otherwise). With MVJittered
+//     they include the jitter difference between the two frames.
+//
+// Images are CPU float buffers the caller registers with RegisterCpuImage.
+// NullNGX only runs the upscaler when Color and Output resolve to registered
+// images, so pointers from a real graphics API are never dereferenced.
+// Output is tiled across a ThreadPool; every tile is independent, so results
+// do not depend on the thread count.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace dlss
+{
+
+class ThreadPool;
+
+/// A float image in CPU memory, usable wherever NGX takes a resource pointer.
+struct CpuImage
+{
+    float* data;
+    uint32_t width;
+    uint32_t height;
+    uint32_t channels;          // 4 for color and output, >= 2 for motion vectors, >= 1 for depth
+    uint32_t rowPitch;          // In floats
+};
+
+/// Make image resolvable through FindCpuImage until it is unregistered.
+void RegisterCpuImage(const CpuImage* image);
+void UnregisterCpuImage(const CpuImage* image);
+
+/// The registered image at resource, or nullptr for anything else (e.g. a GPU resource).
+const CpuImage* FindCpuImage(const void* resource);
+
+/// Creation parameters of a feature.
+struct ReferenceFeatureDesc
+{
+    uint32_t renderWidth;
+    uint32_t renderHeight;
+    uint32_t outputWidth;
+    uint32_t outputHeight;
+    bool mvLowRes;
+    bool mvJittered;
+    bool depthInverted;
+};
+
+/// Per-frame inputs; sizes and offsets are in pixels.
+struct ReferenceInputs
+{
+    const CpuImage* color = nullptr;
+    const CpuImage* output = nullptr;
+    const CpuImage* motionVectors = nullptr;    // Optional: without it history is reprojected with zero motion
+    const CpuImage* depth = nullptr;            // Optional: dilates low-resolution motion vectors
+    uint32_t renderWidth = 0;                   // 0: creation size
+    uint32_t renderHeight = 0;
+    uint32_t colorBaseX = 0;
+    uint32_t colorBaseY = 0;
+    uint32_t depthBaseX = 0;
+    uint32_t depthBaseY = 0;
+    uint32_t mvBaseX = 0;
+    uint32_t mvBaseY = 0;
+    uint32_t outputBaseX = 0;
+    uint32_t outputBaseY = 0;
+    float jitterX = 0.0f;
+    float jitterY = 0.0f;
+    float mvScaleX = 1.0f;
+    float mvScaleY = 1.0f;
+    bool reset = false;
+};
+
+/// History and setup of one upscaler instance.
+class ReferenceFeature
+{
+public:
+    explicit ReferenceFeature(const ReferenceFeatureDesc& desc) : m_desc(desc) {}
+
+    /// Weight of the current frame in the history blend.
+    static constexpr float kCurrentWeight = 0.1f;
+
+    /// Upscale one frame into inputs.output.
+    /// @return false if an image is missing or a region does not fit its image; nothing is written.
+    bool Evaluate(const ReferenceInputs& inputs, ThreadPool& pool);
+
+    const ReferenceFeatureDesc& GetDesc() const { return m_desc; }
+
+private:
+    ReferenceFeatureDesc m_desc;
+    std::vector<float> m_history[2];            // RGBA at output size
+    uint32_t m_current = 0;                     // m_history index holding the last output
+    bool m_historyValid = false;
+    float m_prevJitterX = 0.0f;
+    float m_prevJitterY = 0.0f;
+};
+
+/// Features of the null NGX backend, keyed by NGX handle id.
+class ReferenceUpscaler
+{
+public:
+    static ReferenceUpscaler& Instance();
+
+    void AddFeature(unsigned int id, const ReferenceFeatureDesc& desc);
+    void RemoveFeature(unsigned int id);
+
+    /// @return false if the feature is unknown or ReferenceFeature::Evaluate fails.
+    bool Evaluate(unsigned int id, const ReferenceInputs& inputs);
+
+    /// Drop every feature and stop the worker threads (NGX shutdown).
+    void Shutdown();
+
+private:
+    ReferenceUpscaler() = default;
+    ~ReferenceUpscaler();
+
+    // Non-copyable
+    ReferenceUpscaler(const ReferenceUpscaler&) = delete;
+    ReferenceUpscaler& operator=(const ReferenceUpscaler&) = delete;
+
+    std::mutex m_mutex;
+    std::unordered_map<unsigned int, ReferenceFeature> m_features;
+    std::unique_ptr<ThreadPool> m_pool;         // Created on first evaluate
+};
+
+} // namespace dlss
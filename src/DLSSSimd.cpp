@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// DLSSSimd.cpp - Instruction set selection for the CPU kernels
+//------------------------------------------------------------------------------
+
+#include "DLSSSimd.h"
+
+#if DLSS_SIMD_X64 && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace dlss
+{
+
+static bool DetectAvx2()
+{
+#if DLSS_SIMD_X64 && defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool fma = (info[2] & (1 << 12)) != 0;
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#elif DLSS_SIMD_X64
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+    return false;
+#endif
+}
+
+bool CpuSupportsAvx2()
+{
+    static const bool supported = DetectAvx2();
+    return supported;
+}
+
+} // namespace dlss
@@ -0,0 +1,30 @@
+//------------------------------------------------------------------------------
+// DLSSSimd.h - Instruction set selection for the CPU kernels
+//------------------------------------------------------------------------------
+// x86-64 builds target the baseline ISA and compile AVX2 variants of hot loops
+// with DLSS_TARGET_AVX2, picked at runtime when CpuSupportsAvx2() holds. ARM64
+// always has NEON, so its variants need no runtime check.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define DLSS_SIMD_X64 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #define DLSS_TARGET_AVX2
+    #else
+        #define DLSS_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define DLSS_SIMD_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace dlss
+{
+
+/// Whether the CPU and OS support AVX2 and FMA (false on non-x86 CPUs).
+bool CpuSupportsAvx2();
+
+} // namespace dlss
@@ -0,0 +1,275 @@
+//------------------------------------------------------------------------------
+// DLSSTelemetry.cpp - Always-on CPU latency histograms
+//------------------------------------------------------------------------------
+
+#include "DLSSTelemetry.h"
+
+#include <bit>
+
+namespace dlss
+{
+
+Telemetry& Telemetry::Instance()
+{
+    static Telemetry instance;
+    return instance;
+}
+
+static const char* const kPointNames[DLSS_Telemetry_Count] = {
+    "DLSS_Init",
+    "DLSS_Shutdown",
+    "DLSS_AllocateParameters",
+    "DLSS_GetCapabilityParameters",
+    "DLSS_DestroyParameters",
+    "DLSS_Parameter_SetULL",
+    "DLSS_Parameter_SetF",
+    "DLSS_Parameter_SetD",
+    "DLSS_Parameter_SetUI",
+    "DLSS_Parameter_SetI",
+    "DLSS_Parameter_SetD3d12Resource",
+    "DLSS_Parameter_SetVoidPointer",
+    "DLSS_Parameter_GetULL",
+    "DLSS_Parameter_GetF",
+    "DLSS_Parameter_GetD",
+    "DLSS_Parameter_GetUI",
+    "DLSS_Parameter_GetI",
+    "DLSS_Parameter_GetD3d12Resource",
+    "DLSS_Parameter_GetVoidPointer",
+    "DLSS_AllocateFeatureHandle",
+    "DLSS_FreeFeatureHandle",
+    "DLSS_GetErrorCounters",
+    "DLSS_GetGpuTimings",
+    "DLSS_DumpFlightRecorder",
+    "DLSS_CopyFlightRecorder",
+    "Render: CreateFeature",
+    "Render: EvaluateFeature",
+    "Render: DestroyFeature",
+    "Render: EndFrame",
+    "DLSS_Parameter_SetTexture",
+    "DLSS_Parameter_SetTextureId",
+    "DLSS_RegisterTexture",
+    "DLSS_CreateBindingSet",
+    "DLSS_UpdateBindingSet",
+    "DLSS_BeginTrace",
+    "DLSS_EndTrace",
+    "DLSS_BeginCapture",
+    "DLSS_EndCapture",
+    "DLSS_DrsConfigure",
+    "DLSS_DrsUpdate",
+    "DLSS_SetOptimalSettingsResolutions",
+    "DLSS_GetOptimalSettingsTable",
+    "DLSS_LookupOptimalSettings",
+    "DLSS_QueryCapabilities",
+    "DLSS_InitAsync",
+    "DLSS_GetInitState",
+    "DLSS_GetJitterOffset",
+    "DLSS_GetJitterSequence",
+    "DLSS_RunCalibration",
+    "DLSS_GetCalibrationTable",
+    "DLSS_SetCircuitBreakerSettings",
+    "DLSS_GetFeatureHealth",
+    "DLSS_ResetFeatureHealth",
+    "DLSS_UnregisterTexture",
+    "DLSS_DestroyBindingSet",
+};
+
+const char* Telemetry::GetPointName(DLSSTelemetryPoint point)
+{
+    if (point < 0 || point >= DLSS_Telemetry_Count)
+    {
+        return "Unknown";
+    }
+    return kPointNames[point];
+}
+
+Telemetry::~Telemetry()
+{
+    for (std::atomic<Shard*>& shard : m_shards)
+    {
+        delete shard.exchange(nullptr);
+    }
+}
+
+uint32_t Telemetry::GetBucketIndex(uint64_t ticks)
+{
+    if (ticks < kSubBucketCount)
+    {
+        return static_cast<uint32_t>(ticks);
+    }
+
+    const uint32_t exponent = static_cast<uint32_t>(std::bit_width(ticks)) - 1;
+    if (exponent > kMaxExponent)
+    {
+        return kBucketCount - 1;
+    }
+
+    const uint32_t sub = static_cast<uint32_t>(ticks >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1);
+    return (exponent - kSubBucketBits + 1) * kSubBucketCount + sub;
+}
+
+uint64_t Telemetry::GetBucketLowerBound(uint32_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index;
+    }
+
+    const uint32_t exponent = index / kSubBucketCount + kSubBucketBits - 1;
+    const uint64_t sub = index % kSubBucketCount;
+    return (kSubBucketCount + sub) << (exponent - kSubBucketBits);
+}
+
+uint64_t Telemetry::GetBucketUpperBound(uint32_t index)
+{
+    if (index < kSubBucketCount)
+    {
+        return index + 1;
+    }
+
+    const uint32_t exponent = index / kSubBucketCount + kSubBucketBits - 1;
+    const uint64_t sub = index % kSubBucketCount;
+    return (kSubBucketCount + sub + 1) << (exponent - kSubBucketBits);
+}
+
+Telemetry::Shard& Telemetry::GetThreadShard()
+{
+    thread_local Shard* t_shard = nullptr;
+    if (t_shard)
+    {
+        return *t_shard;
+    }
+
+    const uint32_t slot = m_nextShard.fetch_add(1, std::memory_order_relaxed) % kMaxShards;
+    Shard* shard = m_shards[slot].load(std::memory_order_acquire);
+    if (!shard)
+    {
+        Shard* created = new Shard();
+        if (m_shards[slot].compare_exchange_strong(shard, created, std::memory_order_acq_rel))
+        {
+            shard = created;
+        }
+        else
+        {
+            delete created;
+        }
+    }
+
+    t_shard = shard;
+    return *shard;
+}
+
+void Telemetry::Record(DLSSTelemetryPoint point, uint64_t ticks)
+{
+    if (point < 0 || point >= DLSS_Telemetry_Count)
+    {
+        return;
+    }
+
+    Shard& shard = GetThreadShard();
+    shard.buckets[point][GetBucketIndex(ticks)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum[point].fetch_add(ticks, std::memory_order_relaxed);
+    if (ticks > shard.max[point].load(std::memory_order_relaxed))
+    {
+        shard.max[point].store(ticks, std::memory_order_relaxed);
+    }
+}
+
+int Telemetry::Snapshot(DLSSLatencyStats* outStats, int maxCount) const
+{
+    if (!outStats)
+    {
+        return DLSS_Telemetry_Count;
+    }
+
+    const double usPerTick = 1e6 / TimestampTicksPerSecond();
+    const int count = maxCount < DLSS_Telemetry_Count ? maxCount : DLSS_Telemetry_Count;
+
+    static constexpr double kQuantiles[] = {0.50, 0.90, 0.99, 0.999};
+
+    for (int point = 0; point < count; ++point)
+    {
+        uint64_t buckets[kBucketCount] = {};
+        uint64_t total = 0;
+        uint64_t sum = 0;
+        uint64_t max = 0;
+
+        for (const std::atomic<Shard*>& shardPtr : m_shards)
+        {
+            const Shard* shard = shardPtr.load(std::memory_order_acquire);
+            if (!shard)
+            {
+                continue;
+            }
+
+            for (uint32_t i = 0; i < kBucketCount; ++i)
+            {
+                const uint64_t value = shard->buckets[point][i].load(std::memory_order_relaxed);
+                buckets[i] += value;
+                total += value;
+            }
+            sum += shard->sum[point].load(std::memory_order_relaxed);
+            const uint64_t shardMax = shard->max[point].load(std::memory_order_relaxed);
+            max = shardMax > max ? shardMax : max;
+        }
+
+        DLSSLatencyStats& stats = outStats[point];
+        stats = {};
+        stats.point = point;
+        stats.count = total;
+        if (total == 0)
+        {
+            continue;
+        }
+
+        stats.meanUs = static_cast<float>(static_cast<double>(sum) / static_cast<double>(total) * usPerTick);
+        stats.maxUs = static_cast<float>(static_cast<double>(max) * usPerTick);
+
+        float* quantileOut[] = {&stats.p50Us, &stats.p90Us, &stats.p99Us, &stats.p999Us};
+        uint64_t cumulative = 0;
+        uint32_t bucket = 0;
+        for (size_t q = 0; q < sizeof(kQuantiles) / sizeof(kQuantiles[0]); ++q)
+        {
+            const uint64_t rank = static_cast<uint64_t>(kQuantiles[q] * static_cast<double>(total) + 0.5);
+            const uint64_t target = rank > 0 ? rank : 1;
+            while (bucket < kBucketCount && cumulative + buckets[bucket] < target)
+            {
+                cumulative += buckets[bucket++];
+            }
+
+            // Report the bucket midpoint, never above the exact maximum
+            const uint32_t index = bucket < kBucketCount ? bucket : kBucketCount - 1;
+            double ticks = 0.5 * static_cast<double>(GetBucketLowerBound(index) + GetBucketUpperBound(index));
+            if (ticks > static_cast<double>(max))
+            {
+                ticks = static_cast<double>(max);
+            }
+            *quantileOut[q] = static_cast<float>(ticks * usPerTick);
+        }
+    }
+
+    return DLSS_Telemetry_Count;
+}
+
+void Telemetry::Reset()
+{
+    for (std::atomic<Shard*>& shardPtr : m_shards)
+    {
+        Shard* shard = shardPtr.load(std::memory_order_acquire);
+        if (!shard)
+        {
+            continue;
+        }
+
+        for (int point = 0; point < DLSS_Telemetry_Count; ++point)
+        {
+            for (std::atomic<uint64_t>& bucket : shard->buckets[point])
+            {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            shard->sum[point].store(0, std::memory_order_relaxed);
+            shard->max[point].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace dlss
@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+// DLSSTelemetry.h - Always-on CPU latency histograms
+//------------------------------------------------------------------------------
+// Every DLSS_* export and render-event branch records its CPU time into a
+// log-bucketed histogram (HDR-histogram style: 16 linear sub-buckets per power
+// of two, ~6% relative error). Each recording thread gets its own shard, so the
+// hot path is two timestamp reads and three uncontended relaxed atomic adds;
+// shards are merged when DLSS_GetTelemetry is called. While a trace is
+// running the same scope is also emitted as a trace event (see DLSSTrace.h).
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#include "DLSSPluginLite.h"
+#include "DLSSTiming.h"
+#include "DLSSTrace.h"
+
+namespace dlss
+{
+
+class Telemetry
+{
+public:
+    static Telemetry& Instance();
+
+    ~Telemetry();
+
+    // Non-copyable
+    Telemetry(const Telemetry&) = delete;
+    Telemetry& operator=(const Telemetry&) = delete;
+
+    static constexpr uint32_t kSubBucketBits = 4;
+    static constexpr uint32_t kSubBucketCount = 1u << kSubBucketBits;
+    static constexpr uint32_t kMaxExponent = 40;    // Larger samples land in the last bucket
+    static constexpr uint32_t kBucketCount = (kMaxExponent - kSubBucketBits + 2) * kSubBucketCount;
+
+    /// Threads beyond this share shards (still correct, just contended).
+    static constexpr uint32_t kMaxShards = 8;
+
+    /// Record one sample in ReadTimestamp() ticks.
+    void Record(DLSSTelemetryPoint point, uint64_t ticks);
+
+    /// Merge all shards into one entry per point.
+    /// @return DLSS_Telemetry_Count (may exceed maxCount).
+    int Snapshot(DLSSLatencyStats* outStats, int maxCount) const;
+
+    /// Clear all histograms.
+    void Reset();
+
+    /// Display name of a point ("Unknown" if out of range).
+    static const char* GetPointName(DLSSTelemetryPoint point);
+
+    static uint32_t GetBucketIndex(uint64_t ticks);
+    static uint64_t GetBucketLowerBound(uint32_t index);
+    static uint64_t GetBucketUpperBound(uint32_t index);
+
+private:
+    Telemetry() = default;
+
+    struct Shard
+    {
+        std::atomic<uint64_t> buckets[DLSS_Telemetry_Count][kBucketCount];
+        std::atomic<uint64_t> sum[DLSS_Telemetry_Count];
+        std::atomic<uint64_t> max[DLSS_Telemetry_Count];
+    };
+
+    Shard& GetThreadShard();
+
+    std::atomic<Shard*> m_shards[kMaxShards] = {};
+    std::atomic<uint32_t> m_nextShard{0};
+};
+
+/// RAII timer used at the top of each export / render-event branch.
+class LatencyScope
+{
+public:
+    explicit LatencyScope(DLSSTelemetryPoint point)
+        : m_point(point)
+        , m_start(ReadTimestamp())
+    {
+    }
+
+    ~LatencyScope()
+    {
+        const uint64_t end = ReadTimestamp();
+        Telemetry::Instance().Record(m_point, end - m_start);
+
+        if (Tracer::IsActive() && m_point >= 0 && m_point < DLSS_Telemetry_Count)
+        {
+            Tracer::Instance().RecordComplete(Telemetry::GetPointName(m_point), m_start, end);
+        }
+    }
+
+    LatencyScope(const LatencyScope&) = delete;
+    LatencyScope& operator=(const LatencyScope&) = delete;
+
+private:
+    DLSSTelemetryPoint m_point;
+    uint64_t m_start;
+};
+
+} // namespace dlss
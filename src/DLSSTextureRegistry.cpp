@@ -0,0 +1,273 @@
+//------------------------------------------------------------------------------
+// DLSSTextureRegistry.cpp - Native textures by Unity instance ID
+//------------------------------------------------------------------------------
+
+#include "DLSSTextureRegistry.h"
+
+#include "DLSSGraphicsBackend.h"
+
+namespace dlss
+{
+
+TextureRegistry& TextureRegistry::Instance()
+{
+    static TextureRegistry instance;
+    return instance;
+}
+
+bool TextureRegistry::Register(int textureId, void* nativeTexture)
+{
+    if (textureId == 0 || !nativeTexture)
+    {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_textures[textureId] = Registration{nativeTexture, m_nextVersion++};
+    return true;
+}
+
+bool TextureRegistry::Unregister(int textureId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_textures.erase(textureId) > 0;
+}
+
+void TextureRegistry::Bind(NVSDK_NGX_Parameter* parameters, const char* name, int textureId)
+{
+    if (!parameters || !name)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (textureId == 0)
+    {
+        EraseBinding(parameters, name);
+    }
+    else
+    {
+        Binding& binding = m_bindings[parameters][name];
+        if (binding.textureId != textureId)
+        {
+            binding = Binding{textureId, 0};
+        }
+    }
+    UpdateHasBindings();
+}
+
+void TextureRegistry::Unbind(NVSDK_NGX_Parameter* parameters, const char* name)
+{
+    if (!m_hasBindings.load(std::memory_order_relaxed) || !parameters || !name)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    EraseBinding(parameters, name);
+
+    // A set applied to the block rebinds the parameter on its next evaluate
+    for (auto& pair : m_sets)
+    {
+        if (pair.second.appliedParameters != parameters)
+        {
+            continue;
+        }
+        for (SetBinding& setBinding : pair.second.bindings)
+        {
+            if (setBinding.name == name)
+            {
+                setBinding.binding.appliedVersion = 0;
+            }
+        }
+    }
+}
+
+void TextureRegistry::RemoveParameters(NVSDK_NGX_Parameter* parameters)
+{
+    if (!m_hasBindings.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bindings.erase(parameters);
+    for (auto& pair : m_sets)
+    {
+        if (pair.second.appliedParameters == parameters)
+        {
+            pair.second.appliedParameters = nullptr;
+        }
+    }
+    UpdateHasBindings();
+}
+
+void TextureRegistry::ClearBindings()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bindings.clear();
+    for (auto& pair : m_sets)
+    {
+        pair.second.appliedParameters = nullptr;
+    }
+    UpdateHasBindings();
+}
+
+void TextureRegistry::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bindings.clear();
+    m_sets.clear();
+    m_textures.clear();
+    UpdateHasBindings();
+}
+
+void TextureRegistry::Apply(NVSDK_NGX_Parameter* parameters, GraphicsBackend& backend,
+    std::vector<std::pair<std::string, int>>* outUnresolved)
+{
+    if (!parameters || !m_hasBindings.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto bindings = m_bindings.find(parameters);
+    if (bindings == m_bindings.end())
+    {
+        return;
+    }
+    for (auto& pair : bindings->second)
+    {
+        ApplyBinding(parameters, pair.first, pair.second, backend, outUnresolved);
+    }
+}
+
+int TextureRegistry::CreateSet(const DLSSBindingDesc* bindings, int bindingCount, std::string& outError)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    BindingSet set;
+    if (!BuildSet(bindings, bindingCount, set, outError))
+    {
+        return 0;
+    }
+    const int setId = m_nextSetId++;
+    m_sets[setId] = std::move(set);
+    UpdateHasBindings();
+    return setId;
+}
+
+bool TextureRegistry::UpdateSet(int setId, const DLSSBindingDesc* bindings, int bindingCount, std::string& outError)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_sets.find(setId);
+    if (it == m_sets.end())
+    {
+        outError = "binding set does not exist";
+        return false;
+    }
+    BindingSet set;
+    if (!BuildSet(bindings, bindingCount, set, outError))
+    {
+        return false;
+    }
+    it->second = std::move(set);
+    return true;
+}
+
+bool TextureRegistry::DestroySet(int setId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool erased = m_sets.erase(setId) > 0;
+    UpdateHasBindings();
+    return erased;
+}
+
+bool TextureRegistry::ApplySet(int setId, NVSDK_NGX_Parameter* parameters, GraphicsBackend& backend,
+    std::vector<std::pair<std::string, int>>* outUnresolved)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_sets.find(setId);
+    if (it == m_sets.end())
+    {
+        return false;
+    }
+    if (!parameters)
+    {
+        return true;    // The evaluate reports the missing block
+    }
+    BindingSet& set = it->second;
+    if (set.appliedParameters != parameters)
+    {
+        for (SetBinding& setBinding : set.bindings)
+        {
+            setBinding.binding.appliedVersion = 0;
+        }
+        set.appliedParameters = parameters;
+    }
+    for (SetBinding& setBinding : set.bindings)
+    {
+        ApplyBinding(parameters, setBinding.name, setBinding.binding, backend, outUnresolved);
+    }
+    return true;
+}
+
+bool TextureRegistry::BuildSet(const DLSSBindingDesc* bindings, int bindingCount, BindingSet& outSet,
+    std::string& outError) const
+{
+    outSet.bindings.reserve(static_cast<size_t>(bindingCount));
+    for (int i = 0; i < bindingCount; ++i)
+    {
+        const DLSSBindingDesc& desc = bindings[i];
+        if (m_textures.find(desc.textureId) == m_textures.end())
+        {
+            outError = std::string(desc.name) + " uses texture id " + std::to_string(desc.textureId) +
+                ", which is not registered";
+            return false;
+        }
+        outSet.bindings.push_back(SetBinding{desc.name, Binding{desc.textureId, 0}});
+    }
+    return true;
+}
+
+void TextureRegistry::ApplyBinding(NVSDK_NGX_Parameter* parameters, const std::string& name, Binding& binding,
+    GraphicsBackend& backend, std::vector<std::pair<std::string, int>>* outUnresolved)
+{
+    auto texture = m_textures.find(binding.textureId);
+    if (texture == m_textures.end())
+    {
+        if (binding.appliedVersion != kUnresolvedVersion)
+        {
+            // Evaluating with the previous texture would hide the missing registration
+            backend.SetTexture(parameters, name.c_str(), nullptr);
+            binding.appliedVersion = kUnresolvedVersion;
+            if (outUnresolved && !binding.unresolvedReported)
+            {
+                outUnresolved->emplace_back(name, binding.textureId);
+            }
+            binding.unresolvedReported = true;
+        }
+        return;
+    }
+    binding.unresolvedReported = false;
+    if (binding.appliedVersion != texture->second.version)
+    {
+        backend.SetTexture(parameters, name.c_str(), texture->second.nativeTexture);
+        binding.appliedVersion = texture->second.version;
+    }
+}
+
+void TextureRegistry::EraseBinding(NVSDK_NGX_Parameter* parameters, const char* name)
+{
+    auto it = m_bindings.find(parameters);
+    if (it != m_bindings.end())
+    {
+        it->second.erase(name);
+        if (it->second.empty())
+        {
+            m_bindings.erase(it);
+        }
+    }
+    UpdateHasBindings();
+}
+
+void TextureRegistry::UpdateHasBindings()
+{
+    m_hasBindings.store(!m_bindings.empty() || !m_sets.empty(), std::memory_order_relaxed);
+}
+
+} // namespace dlss
@@ -0,0 +1,141 @@
+//------------------------------------------------------------------------------
+// DLSSTextureRegistry.h - Native textures by Unity instance ID
+//------------------------------------------------------------------------------
+// Texture.GetNativeTexturePtr can stall the main thread on the render thread,
+// and calling it for every input of every frame showed up in CPU profiles. C#
+// instead registers a RenderTexture's native texture once, when the texture is
+// created or recreated, under its instance ID (DLSS_RegisterTexture), and
+// binds resource parameters to IDs (DLSS_Parameter_SetTextureId).
+//
+// Bindings are resolved on the render thread when a create or evaluate event
+// uses the parameters, just before GraphicsBackend::BeginCommands. Each
+// registration carries a version that changes whenever the ID is registered
+// again, so a binding is passed to GraphicsBackend::SetTexture only when its
+// ID or the texture behind the ID changed since the last event.
+//
+// Binding sets (DLSS_CreateBindingSet) hold all resource parameters of a view
+// as one list of IDs, validated once by ValidateBindingSet. A bound evaluate
+// applies the set to its parameter block in a single pass over the list,
+// with the same versioning as the per-parameter bindings.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DLSSBackend.h"
+#include "DLSSPluginLite.h"
+
+namespace dlss
+{
+
+class GraphicsBackend;
+
+class TextureRegistry
+{
+public:
+    static TextureRegistry& Instance();
+
+    TextureRegistry() = default;
+
+    // Non-copyable
+    TextureRegistry(const TextureRegistry&) = delete;
+    TextureRegistry& operator=(const TextureRegistry&) = delete;
+
+    /// Register or replace the native texture of an ID.
+    /// @return false if textureId is 0 or nativeTexture is null.
+    bool Register(int textureId, void* nativeTexture);
+
+    /// @return false if the ID was not registered.
+    bool Unregister(int textureId);
+
+    /// Bind a resource parameter to an ID; textureId 0 removes the binding.
+    void Bind(NVSDK_NGX_Parameter* parameters, const char* name, int textureId);
+
+    /// Drop a binding because the parameter was set directly.
+    void Unbind(NVSDK_NGX_Parameter* parameters, const char* name);
+
+    /// Drop every binding of a parameter block being destroyed.
+    void RemoveParameters(NVSDK_NGX_Parameter* parameters);
+
+    /// Drop every binding (NGX shutdown destroys the parameter blocks); registrations and sets are kept.
+    void ClearBindings();
+
+    /// Drop every registration, binding and set (device shutdown).
+    void Clear();
+
+    /// Render thread: pass the bindings of parameters whose texture changed to backend.SetTexture.
+    /// Bindings to unregistered IDs are set to null.
+    /// @param outUnresolved Receives (name, ID) of bindings that became unresolved in this call. A binding
+    ///                      is reported once until it resolves or is rebound to another ID.
+    void Apply(NVSDK_NGX_Parameter* parameters, GraphicsBackend& backend,
+        std::vector<std::pair<std::string, int>>* outUnresolved);
+
+    /// Store a binding set that passed ValidateBindingSet.
+    /// @return Set id, or 0 with outError if a texture is not registered.
+    int CreateSet(const DLSSBindingDesc* bindings, int bindingCount, std::string& outError);
+
+    /// Replace the bindings of a set; the set is unchanged on failure.
+    bool UpdateSet(int setId, const DLSSBindingDesc* bindings, int bindingCount, std::string& outError);
+
+    /// @return false if the set does not exist.
+    bool DestroySet(int setId);
+
+    /// Render thread: bind a set's textures to parameters, as Apply does for single bindings.
+    /// @return false if the set does not exist.
+    bool ApplySet(int setId, NVSDK_NGX_Parameter* parameters, GraphicsBackend& backend,
+        std::vector<std::pair<std::string, int>>* outUnresolved);
+
+private:
+    static constexpr uint64_t kUnresolvedVersion = ~0ull;
+
+    struct Registration
+    {
+        void* nativeTexture;
+        uint64_t version;
+    };
+
+    struct Binding
+    {
+        int textureId;
+        uint64_t appliedVersion;    // 0 until applied, kUnresolvedVersion while the ID is not registered
+        bool unresolvedReported = false;    // Set while unresolved once reported, so set reapplies stay quiet
+    };
+
+    struct SetBinding
+    {
+        std::string name;
+        Binding binding;
+    };
+
+    struct BindingSet
+    {
+        std::vector<SetBinding> bindings;
+        NVSDK_NGX_Parameter* appliedParameters = nullptr;   // Block the applied versions refer to
+    };
+
+    using BindingMap = std::unordered_map<std::string, Binding>;
+
+    // Callers hold m_mutex
+    bool BuildSet(const DLSSBindingDesc* bindings, int bindingCount, BindingSet& outSet, std::string& outError) const;
+    void ApplyBinding(NVSDK_NGX_Parameter* parameters, const std::string& name, Binding& binding,
+        GraphicsBackend& backend, std::vector<std::pair<std::string, int>>* outUnresolved);
+    void EraseBinding(NVSDK_NGX_Parameter* parameters, const char* name);
+    void UpdateHasBindings();
+
+    std::unordered_map<int, Registration> m_textures;
+    std::unordered_map<NVSDK_NGX_Parameter*, BindingMap> m_bindings;
+    std::unordered_map<int, BindingSet> m_sets;
+    std::atomic<bool> m_hasBindings{false};     // Bindings or sets exist; lets direct setters skip the lock
+    uint64_t m_nextVersion = 1;
+    int m_nextSetId = 1;
+    std::mutex m_mutex;
+};
+
+} // namespace dlss
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// DLSSThreadPool.cpp - Fixed worker pool for data-parallel CPU kernels
+//------------------------------------------------------------------------------
+
+#include "DLSSThreadPool.h"
+
+#include <algorithm>
+
+namespace dlss
+{
+
+ThreadPool::ThreadPool(uint32_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    m_workers.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+        m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)>& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // A single item or no workers: skip the hand-off
+    if (count == 1 || m_workers.empty())
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            body(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> loop(m_loopMutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_body = &body;
+        m_count = count;
+        m_next.store(0, std::memory_order_relaxed);
+        m_activeWorkers = static_cast<uint32_t>(m_workers.size());
+        m_generation++;
+    }
+    m_wake.notify_all();
+
+    RunItems();
+
+    // Workers still finishing their last item keep using body, so wait for all of them
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_activeWorkers == 0; });
+    m_body = nullptr;
+}
+
+void ThreadPool::WorkerLoop()
+{
+    uint64_t seenGeneration = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+        m_wake.wait(lock, [&] { return m_stop || m_generation != seenGeneration; });
+        if (m_stop)
+        {
+            return;
+        }
+        seenGeneration = m_generation;
+
+        lock.unlock();
+        RunItems();
+        lock.lock();
+
+        if (--m_activeWorkers == 0)
+        {
+            m_done.notify_one();
+        }
+    }
+}
+
+void ThreadPool::RunItems()
+{
+    for (;;)
+    {
+        const uint32_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+        if (i >= m_count)
+        {
+            return;
+        }
+        (*m_body)(i);
+    }
+}
+
+} // namespace dlss
@@ -0,0 +1,62 @@
+//------------------------------------------------------------------------------
+// DLSSThreadPool.h - Fixed worker pool for data-parallel CPU kernels
+//------------------------------------------------------------------------------
+// ParallelFor splits a loop into independent items (image tiles, frames) and
+// runs them on the workers and the calling thread until every item is done.
+// Items are claimed from a shared counter, so uneven tiles balance themselves.
+// One loop runs at a time; concurrent callers queue on a mutex. Results must
+// not depend on which thread runs an item, which keeps callers deterministic
+// for any worker count.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dlss
+{
+
+class ThreadPool
+{
+public:
+    /// @param threadCount Threads working on a loop, including the caller;
+    /// 0 picks std::thread::hardware_concurrency().
+    explicit ThreadPool(uint32_t threadCount = 0);
+    ~ThreadPool();
+
+    // Non-copyable
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Threads working on a loop, including the caller.
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+    /// Call body(i) for every i in [0, count) and return when all calls have finished.
+    /// body must not call ParallelFor on the same pool.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& body);
+
+private:
+    void WorkerLoop();
+    void RunItems();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_loopMutex;                         // Serializes ParallelFor callers
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;                 // Workers: a loop started or the pool stops
+    std::condition_variable m_done;                 // Caller: the last worker left the loop
+    const std::function<void(uint32_t)>* m_body = nullptr;
+    uint32_t m_count = 0;
+    uint64_t m_generation = 0;                      // Bumped per loop so workers join each one once
+    uint32_t m_activeWorkers = 0;
+    bool m_stop = false;
+    std::atomic<uint32_t> m_next{0};
+};
+
+} // namespace dlss
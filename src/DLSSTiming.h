@@ -0,0 +1,96 @@
+//------------------------------------------------------------------------------
+// DLSSTiming.h - Cheap timestamps and frame counter shared by diagnostics
+//------------------------------------------------------------------------------
+// ReadTimestamp() returns raw CPU cycle counter ticks where available (a few
+// nanoseconds per read) and falls back to steady_clock nanoseconds elsewhere.
+// Use TimestampTicksPerSecond() to convert ticks to wall time.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define DLSS_HAS_CYCLE_COUNTER 1
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <x86intrin.h>
+    #define DLSS_HAS_CYCLE_COUNTER 1
+#else
+    #define DLSS_HAS_CYCLE_COUNTER 0
+#endif
+
+namespace dlss
+{
+
+/// Monotonic wall clock in nanoseconds.
+inline uint64_t MonotonicNs()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/// Raw timestamp in implementation-defined ticks (see TimestampTicksPerSecond).
+inline uint64_t ReadTimestamp()
+{
+#if DLSS_HAS_CYCLE_COUNTER
+    return __rdtsc();
+#else
+    return MonotonicNs();
+#endif
+}
+
+/// Pair of (ticks, ns) captured when the plugin was loaded, used for calibration.
+struct TimestampEpoch
+{
+    uint64_t ticks;
+    uint64_t ns;
+};
+
+inline const TimestampEpoch& GetTimestampEpoch()
+{
+    static const TimestampEpoch epoch{ReadTimestamp(), MonotonicNs()};
+    return epoch;
+}
+
+/// Tick rate of ReadTimestamp(), calibrated against steady_clock.
+inline double TimestampTicksPerSecond()
+{
+#if DLSS_HAS_CYCLE_COUNTER
+    const TimestampEpoch& epoch = GetTimestampEpoch();
+
+    // Make sure the calibration window is long enough to be meaningful
+    uint64_t ns = MonotonicNs();
+    while (ns - epoch.ns < 10000000ull)
+    {
+        ns = MonotonicNs();
+    }
+    const uint64_t ticks = ReadTimestamp();
+    return static_cast<double>(ticks - epoch.ticks) * 1e9 / static_cast<double>(ns - epoch.ns);
+#else
+    return 1e9;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Frame counter
+//------------------------------------------------------------------------------
+// Advanced on the render thread by DLSS_Event_EndFrame. Main-thread exports
+// read the value the render thread last published.
+//------------------------------------------------------------------------------
+
+inline std::atomic<uint32_t> g_frameIndex{0};
+
+inline uint32_t CurrentFrameIndex()
+{
+    return g_frameIndex.load(std::memory_order_relaxed);
+}
+
+inline uint32_t AdvanceFrameIndex()
+{
+    return g_frameIndex.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace dlss
@@ -0,0 +1,289 @@
+//------------------------------------------------------------------------------
+// DLSSTrace.cpp - Chrome Trace Event export of the plugin timeline
+//------------------------------------------------------------------------------
+
+#include "DLSSTrace.h"
+#include "DLSSTiming.h"
+
+#include <chrono>
+
+namespace dlss
+{
+
+std::atomic<bool> Tracer::s_active{false};
+
+Tracer& Tracer::Instance()
+{
+    static Tracer instance;
+    return instance;
+}
+
+Tracer::~Tracer()
+{
+    End();
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    for (ThreadBuffer* buffer : m_buffers)
+    {
+        delete buffer;
+    }
+    m_buffers.clear();
+}
+
+Tracer::ThreadBuffer& Tracer::GetThreadBuffer()
+{
+    // Buffers are never freed while the plugin is loaded, so the cached
+    // pointer stays valid across traces.
+    thread_local ThreadBuffer* t_buffer = nullptr;
+    if (!t_buffer)
+    {
+        ThreadBuffer* buffer = new ThreadBuffer();
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        buffer->threadId = static_cast<uint32_t>(m_buffers.size()) + 1;
+        m_buffers.push_back(buffer);
+        t_buffer = buffer;
+    }
+    return *t_buffer;
+}
+
+void Tracer::Push(const Event& event)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    if (head - buffer.tail.load(std::memory_order_acquire) >= kThreadBufferCapacity)
+    {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer.events[head % kThreadBufferCapacity] = event;
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Tracer::RecordComplete(const char* name, uint64_t startTicks, uint64_t endTicks)
+{
+    Event event = {};
+    event.start = startTicks;
+    event.end = endTicks;
+    event.name = name;
+    event.phase = Phase::Complete;
+    Push(event);
+}
+
+void Tracer::RecordCounter(const char* name, uint64_t ticks, int handle, double value)
+{
+    Event event = {};
+    event.start = ticks;
+    event.end = ticks;
+    event.name = name;
+    event.value = value;
+    event.handle = handle;
+    event.phase = Phase::Counter;
+    Push(event);
+}
+
+void Tracer::RecordLog(const char* category, const char* message)
+{
+    LogLine line;
+    line.ticks = ReadTimestamp();
+    line.threadId = GetThreadBuffer().threadId;
+    line.category = category;
+    line.message = message ? message : "";
+
+    std::lock_guard<std::mutex> lock(m_logMutex);
+    m_pendingLogs.push_back(std::move(line));
+}
+
+bool Tracer::Begin(const char* path)
+{
+    std::lock_guard<std::mutex> control(m_controlMutex);
+    if (m_file || !path)
+    {
+        return false;
+    }
+
+    m_file = std::fopen(path, "wb");
+    if (!m_file)
+    {
+        return false;
+    }
+
+    // Discard anything left over from a previous trace
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        for (ThreadBuffer* buffer : m_buffers)
+        {
+            buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+            buffer->dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_logMutex);
+        m_pendingLogs.clear();
+    }
+
+    m_ticksPerUs = TimestampTicksPerSecond() / 1e6;
+    m_startTicks = ReadTimestamp();
+    m_eventsWritten = 0;
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", m_file);
+    std::fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"UnityDLSS\"}}", m_file);
+
+    m_stopWriter = false;
+    m_writer = std::thread(&Tracer::WriterLoop, this);
+    s_active.store(true, std::memory_order_release);
+    return true;
+}
+
+int Tracer::End()
+{
+    std::lock_guard<std::mutex> control(m_controlMutex);
+    if (!m_file)
+    {
+        return -1;
+    }
+
+    s_active.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stopWriter = true;
+    }
+    m_wake.notify_one();
+    if (m_writer.joinable())
+    {
+        m_writer.join();
+    }
+
+    Drain();
+
+    // Thread names and drop counts
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        for (ThreadBuffer* buffer : m_buffers)
+        {
+            WriteSeparator();
+            std::fprintf(m_file,
+                "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"DLSS thread %u\"}}",
+                buffer->threadId, buffer->threadId);
+
+            const uint64_t dropped = buffer->dropped.load(std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                WriteSeparator();
+                std::fprintf(m_file,
+                    "{\"name\":\"EventsDropped\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"count\":%llu}}",
+                    buffer->threadId, TicksToUs(ReadTimestamp()), static_cast<unsigned long long>(dropped));
+            }
+        }
+    }
+
+    std::fputs("\n]}\n", m_file);
+    std::fclose(m_file);
+    m_file = nullptr;
+
+    return static_cast<int>(m_eventsWritten);
+}
+
+void Tracer::WriterLoop()
+{
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    while (!m_stopWriter)
+    {
+        m_wake.wait_for(lock, std::chrono::milliseconds(kFlushIntervalMs));
+        lock.unlock();
+        Drain();
+        lock.lock();
+    }
+}
+
+void Tracer::Drain()
+{
+    std::vector<ThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        buffers = m_buffers;
+    }
+
+    for (ThreadBuffer* buffer : buffers)
+    {
+        const uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+        for (; tail < head; ++tail)
+        {
+            WriteEvent(buffer->threadId, buffer->events[tail % kThreadBufferCapacity]);
+        }
+        buffer->tail.store(tail, std::memory_order_release);
+    }
+
+    std::vector<LogLine> logs;
+    {
+        std::lock_guard<std::mutex> lock(m_logMutex);
+        logs.swap(m_pendingLogs);
+    }
+    for (const LogLine& line : logs)
+    {
+        WriteLog(line);
+    }
+
+    std::fflush(m_file);
+}
+
+double Tracer::TicksToUs(uint64_t ticks) const
+{
+    // Events may predate Begin (e.g. GPU samples read back late)
+    const double delta = static_cast<double>(static_cast<int64_t>(ticks - m_startTicks));
+    return delta / m_ticksPerUs;
+}
+
+void Tracer::WriteSeparator()
+{
+    std::fputs(",\n", m_file);
+}
+
+void Tracer::WriteEvent(uint32_t threadId, const Event& event)
+{
+    WriteSeparator();
+    switch (event.phase)
+    {
+    case Phase::Complete:
+        std::fprintf(m_file, "{\"name\":\"%s\",\"cat\":\"DLSS\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+            event.name, threadId, TicksToUs(event.start),
+            static_cast<double>(event.end - event.start) / m_ticksPerUs);
+        break;
+    case Phase::Counter:
+        std::fprintf(m_file, "{\"name\":\"%s\",\"cat\":\"DLSS\",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"handle %d\":%.4f}}",
+            event.name, threadId, TicksToUs(event.start), event.handle, event.value);
+        break;
+    }
+    m_eventsWritten++;
+}
+
+void Tracer::WriteLog(const LogLine& line)
+{
+    std::string escaped;
+    escaped.reserve(line.message.size());
+    for (char c : line.message)
+    {
+        switch (c)
+        {
+        case '"': escaped += "\\\""; break;
+        case '\\': escaped += "\\\\"; break;
+        case '\n': escaped += "\\n"; break;
+        case '\r': break;
+        case '\t': escaped += "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) >= 0x20)
+            {
+                escaped += c;
+            }
+            break;
+        }
+    }
+
+    WriteSeparator();
+    std::fprintf(m_file, "{\"name\":\"%s\",\"cat\":\"Log\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"message\":\"%s\"}}",
+        line.category, line.threadId, TicksToUs(line.ticks), escaped.c_str());
+    m_eventsWritten++;
+}
+
+} // namespace dlss
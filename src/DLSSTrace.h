@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+// DLSSTrace.h - Chrome Trace Event export of the plugin timeline
+//------------------------------------------------------------------------------
+// Between DLSS_BeginTrace and DLSS_EndTrace every instrumented export and
+// render event (see LatencyScope), NGX log line and GPU evaluate timing is
+// written to a Chrome Trace Event JSON file that loads in chrome://tracing or
+// ui.perfetto.dev.
+//
+// Producers push fixed-size events into their own single-producer ring, so
+// recording is a handful of stores and one release store. A background writer
+// thread drains the rings and formats JSON. NGX log lines are rare and carry
+// a string, so they go through a small mutex-guarded queue instead.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace dlss
+{
+
+class Tracer
+{
+public:
+    static Tracer& Instance();
+
+    ~Tracer();
+
+    // Non-copyable
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    /// Events buffered per thread between two writer passes; overflow is dropped and counted.
+    static constexpr uint32_t kThreadBufferCapacity = 8192;
+
+    /// Writer thread wake-up interval.
+    static constexpr uint32_t kFlushIntervalMs = 20;
+
+    /// Cheap check used at instrumentation sites.
+    static bool IsActive()
+    {
+        return s_active.load(std::memory_order_relaxed);
+    }
+
+    /// Open the output file and start the writer thread.
+    /// @return false if a trace is already running or the file cannot be created.
+    bool Begin(const char* path);
+
+    /// Stop the writer thread, flush remaining events and close the file.
+    /// @return Number of events written, or -1 if no trace was running.
+    int End();
+
+    /// Duration event ("X"); name must be a string literal.
+    void RecordComplete(const char* name, uint64_t startTicks, uint64_t endTicks);
+
+    /// Counter event ("C") with one series per handle; name must be a string literal.
+    void RecordCounter(const char* name, uint64_t ticks, int handle, double value);
+
+    /// Instant event ("i") carrying a copied message.
+    void RecordLog(const char* category, const char* message);
+
+private:
+    Tracer() = default;
+
+    enum class Phase : uint8_t
+    {
+        Complete,
+        Counter,
+    };
+
+    struct Event
+    {
+        uint64_t start;
+        uint64_t end;
+        const char* name;
+        double value;
+        int32_t handle;
+        Phase phase;
+    };
+
+    struct ThreadBuffer
+    {
+        uint32_t threadId = 0;
+        std::atomic<uint64_t> head{0};      // Written by the owning thread
+        std::atomic<uint64_t> tail{0};      // Written by the writer thread
+        std::atomic<uint64_t> dropped{0};
+        Event events[kThreadBufferCapacity];
+    };
+
+    struct LogLine
+    {
+        uint64_t ticks;
+        uint32_t threadId;
+        const char* category;
+        std::string message;
+    };
+
+    ThreadBuffer& GetThreadBuffer();
+    void Push(const Event& event);
+    void WriterLoop();
+    void Drain();
+    void WriteEvent(uint32_t threadId, const Event& event);
+    void WriteLog(const LogLine& line);
+    void WriteSeparator();
+    double TicksToUs(uint64_t ticks) const;
+
+    static std::atomic<bool> s_active;
+
+    std::mutex m_buffersMutex;
+    std::vector<ThreadBuffer*> m_buffers;
+
+    std::mutex m_logMutex;
+    std::vector<LogLine> m_pendingLogs;
+
+    std::mutex m_controlMutex;              // Serializes Begin/End
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake;
+    bool m_stopWriter = false;
+    std::thread m_writer;
+
+    FILE* m_file = nullptr;
+    uint64_t m_startTicks = 0;
+    double m_ticksPerUs = 1.0;
+    uint64_t m_eventsWritten = 0;
+};
+
+} // namespace dlss
@@ -0,0 +1,643 @@
+//------------------------------------------------------------------------------
+// NullNGX.cpp - NGX SDK subset implemented without a GPU
+//------------------------------------------------------------------------------
+// Parameter blocks store every value in a name -> value map and convert between
+// numeric types on read, like the SDK; feature handles are real allocations so
+// lifetimes behave like the SDK. Evaluation validates its inputs; when Color
+// and Output are registered CPU images it runs the reference upscaler, which
+// keeps per-feature history from creation to release, and otherwise does no
+// work. The capability block reports SR and RR (but not FG) as available and
+// carries an optimal-settings callback with the published DLSS scale factors
+// and stats callbacks that report no VRAM, so the C# side takes the same paths
+// it would on an RTX machine. The D3D11 and Vulkan entry points share this
+// state; the Vulkan ones additionally check the Vulkan handles and image view
+// descriptors the plugin passes in.
+//------------------------------------------------------------------------------
+
+#include "NullNGX.h"
+#include "DLSSReferenceUpscaler.h"
+
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+
+struct NullValue
+{
+    enum class Type : uint8_t
+    {
+        ULL,
+        F,
+        D,
+        UI,
+        I,
+        Pointer
+    };
+
+    Type type;
+    union
+    {
+        unsigned long long ull;
+        float f;
+        double d;
+        unsigned int ui;
+        int i;
+        void* pointer;
+    };
+};
+
+// Transparent hash so lookups by const char* do not allocate a std::string
+struct NameHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view name) const
+    {
+        return std::hash<std::string_view>{}(name);
+    }
+};
+
+} // namespace
+
+struct NVSDK_NGX_Parameter
+{
+    std::unordered_map<std::string, NullValue, NameHash, std::equal_to<>> values;
+};
+
+static std::atomic<bool> g_initialized{false};
+static std::atomic<unsigned int> g_nextFeatureId{1};
+
+//------------------------------------------------------------------------------
+// Value Storage
+//------------------------------------------------------------------------------
+
+static NVSDK_NGX_Result SetValue(NVSDK_NGX_Parameter* parameters, const char* name, const NullValue& value)
+{
+    if (!parameters || !name)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+
+    auto it = parameters->values.find(std::string_view(name));
+    if (it != parameters->values.end())
+    {
+        it->second = value;
+    }
+    else
+    {
+        parameters->values.emplace(name, value);
+    }
+    return NVSDK_NGX_Result_Success;
+}
+
+static NVSDK_NGX_Result FindValue(const NVSDK_NGX_Parameter* parameters, const char* name, const void* outValue,
+    const NullValue** outFound)
+{
+    if (!parameters || !name || !outValue)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+
+    auto it = parameters->values.find(std::string_view(name));
+    if (it == parameters->values.end())
+    {
+        return NVSDK_NGX_Result_FAIL_UnsupportedParameter;
+    }
+    *outFound = &it->second;
+    return NVSDK_NGX_Result_Success;
+}
+
+template <typename T>
+static NVSDK_NGX_Result GetNumber(const NVSDK_NGX_Parameter* parameters, const char* name, T* outValue)
+{
+    const NullValue* value = nullptr;
+    NVSDK_NGX_Result result = FindValue(parameters, name, outValue, &value);
+    if (NVSDK_NGX_FAILED(result))
+    {
+        return result;
+    }
+
+    switch (value->type)
+    {
+    case NullValue::Type::ULL: *outValue = static_cast<T>(value->ull); break;
+    case NullValue::Type::F: *outValue = static_cast<T>(value->f); break;
+    case NullValue::Type::D: *outValue = static_cast<T>(value->d); break;
+    case NullValue::Type::UI: *outValue = static_cast<T>(value->ui); break;
+    case NullValue::Type::I: *outValue = static_cast<T>(value->i); break;
+    case NullValue::Type::Pointer: return NVSDK_NGX_Result_FAIL_UnsupportedParameter;
+    }
+    return NVSDK_NGX_Result_Success;
+}
+
+static NVSDK_NGX_Result GetPointer(const NVSDK_NGX_Parameter* parameters, const char* name, void** outValue)
+{
+    const NullValue* value = nullptr;
+    NVSDK_NGX_Result result = FindValue(parameters, name, outValue, &value);
+    if (NVSDK_NGX_FAILED(result))
+    {
+        return result;
+    }
+    if (value->type != NullValue::Type::Pointer)
+    {
+        return NVSDK_NGX_Result_FAIL_UnsupportedParameter;
+    }
+    *outValue = value->pointer;
+    return NVSDK_NGX_Result_Success;
+}
+
+//------------------------------------------------------------------------------
+// Optimal Settings
+//------------------------------------------------------------------------------
+
+// Per-axis render scale by NVSDK_NGX_PerfQuality_Value
+static const float kPerfQualityScale[] = {
+    0.5f,           // MaxPerf
+    0.58f,          // Balanced
+    2.0f / 3.0f,    // MaxQuality
+    1.0f / 3.0f,    // UltraPerformance
+    0.77f,          // UltraQuality
+    1.0f,           // DLAA
+};
+
+static unsigned int ScaleSize(unsigned int size, float scale)
+{
+    return static_cast<unsigned int>(std::lround(static_cast<float>(size) * scale));
+}
+
+static NVSDK_NGX_Result NVSDK_CONV NullGetOptimalSettings(NVSDK_NGX_Parameter* parameters)
+{
+    unsigned int width = 0;
+    unsigned int height = 0;
+    int quality = -1;
+    NVSDK_NGX_Parameter_GetUI(parameters, NVSDK_NGX_Parameter_Width, &width);
+    NVSDK_NGX_Parameter_GetUI(parameters, NVSDK_NGX_Parameter_Height, &height);
+    NVSDK_NGX_Parameter_GetI(parameters, NVSDK_NGX_Parameter_PerfQualityValue, &quality);
+    if (width == 0 || height == 0 || quality < 0 || quality > NVSDK_NGX_PerfQuality_Value_DLAA)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+
+    // Dynamic range: Ultra Performance up to native, except DLAA which is native only
+    const float scale = kPerfQualityScale[quality];
+    const float minScale = quality == NVSDK_NGX_PerfQuality_Value_DLAA ? 1.0f : kPerfQualityScale[NVSDK_NGX_PerfQuality_Value_UltraPerformance];
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_OutWidth, ScaleSize(width, scale));
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_OutHeight, ScaleSize(height, scale));
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, width);
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height, height);
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, ScaleSize(width, minScale));
+    NVSDK_NGX_Parameter_SetUI(parameters, NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height, ScaleSize(height, minScale));
+    NVSDK_NGX_Parameter_SetF(parameters, NVSDK_NGX_Parameter_Sharpness, 0.0f);
+    return NVSDK_NGX_Result_Success;
+}
+
+//------------------------------------------------------------------------------
+// Statistics
+//------------------------------------------------------------------------------
+
+// Shared by the DLSS and DLSSD stats callbacks: the reference upscaler keeps its history in
+// system memory, so no feature holds any VRAM
+static NVSDK_NGX_Result NVSDK_CONV NullGetStats(NVSDK_NGX_Parameter* parameters)
+{
+    return NVSDK_NGX_Parameter_SetULL(parameters, NVSDK_NGX_Parameter_SizeInBytes, 0);
+}
+
+//------------------------------------------------------------------------------
+// Initialization/Shutdown
+//------------------------------------------------------------------------------
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_Init_with_ProjectID(const char*, NVSDK_NGX_EngineType, const char*, const wchar_t*,
+    ID3D12Device*, const NVSDK_NGX_FeatureCommonInfo*, NVSDK_NGX_Version)
+{
+    g_initialized.store(true, std::memory_order_relaxed);
+    return NVSDK_NGX_Result_Success;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown1(ID3D12Device*)
+{
+    g_initialized.store(false, std::memory_order_relaxed);
+    dlss::ReferenceUpscaler::Instance().Shutdown();
+    return NVSDK_NGX_Result_Success;
+}
+
+//------------------------------------------------------------------------------
+// Parameter Management
+//------------------------------------------------------------------------------
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_AllocateParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    if (!outParameters)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    *outParameters = new NVSDK_NGX_Parameter();
+    return NVSDK_NGX_Result_Success;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    if (!g_initialized.load(std::memory_order_relaxed))
+    {
+        return NVSDK_NGX_Result_FAIL_NotInitialized;
+    }
+
+    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_AllocateParameters(outParameters);
+    if (NVSDK_NGX_SUCCEED(result))
+    {
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSampling_Available, 1);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSampling_NeedsUpdatedDriver, 0);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult, NVSDK_NGX_Result_Success);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_Available, 1);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_NeedsUpdatedDriver, 0);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_SuperSamplingDenoising_FeatureInitResult, NVSDK_NGX_Result_Success);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_FrameGeneration_Available, 0);
+        NVSDK_NGX_Parameter_SetI(*outParameters, NVSDK_NGX_Parameter_FrameGeneration_FeatureInitResult, NVSDK_NGX_Result_FAIL_FeatureNotSupported);
+        NVSDK_NGX_Parameter_SetULL(*outParameters, NVSDK_NGX_Parameter_SizeInBytes, 0);
+        NVSDK_NGX_Parameter_SetVoidPointer(*outParameters, NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback,
+            reinterpret_cast<void*>(&NullGetOptimalSettings));
+        NVSDK_NGX_Parameter_SetVoidPointer(*outParameters, NVSDK_NGX_Parameter_DLSSGetStatsCallback,
+            reinterpret_cast<void*>(&NullGetStats));
+        NVSDK_NGX_Parameter_SetVoidPointer(*outParameters, NVSDK_NGX_Parameter_DLSSDGetStatsCallback,
+            reinterpret_cast<void*>(&NullGetStats));
+    }
+    return result;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_DestroyParameters(NVSDK_NGX_Parameter* parameters)
+{
+    if (!parameters)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    delete parameters;
+    return NVSDK_NGX_Result_Success;
+}
+
+//------------------------------------------------------------------------------
+// Features
+//------------------------------------------------------------------------------
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_CreateFeature(ID3D12GraphicsCommandList*, NVSDK_NGX_Feature, NVSDK_NGX_Parameter* parameters,
+    NVSDK_NGX_Handle** outHandle)
+{
+    if (!g_initialized.load(std::memory_order_relaxed))
+    {
+        return NVSDK_NGX_Result_FAIL_NotInitialized;
+    }
+    if (!parameters || !outHandle)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    *outHandle = new NVSDK_NGX_Handle{g_nextFeatureId.fetch_add(1, std::memory_order_relaxed)};
+
+    unsigned int featureFlags = 0;
+    dlss::ReferenceFeatureDesc desc = {};
+    GetNumber(parameters, NVSDK_NGX_Parameter_Width, &desc.renderWidth);
+    GetNumber(parameters, NVSDK_NGX_Parameter_Height, &desc.renderHeight);
+    GetNumber(parameters, NVSDK_NGX_Parameter_OutWidth, &desc.outputWidth);
+    GetNumber(parameters, NVSDK_NGX_Parameter_OutHeight, &desc.outputHeight);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, &featureFlags);
+    desc.mvLowRes = (featureFlags & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes) != 0;
+    desc.mvJittered = (featureFlags & NVSDK_NGX_DLSS_Feature_Flags_MVJittered) != 0;
+    desc.depthInverted = (featureFlags & NVSDK_NGX_DLSS_Feature_Flags_DepthInverted) != 0;
+    dlss::ReferenceUpscaler::Instance().AddFeature((*outHandle)->Id, desc);
+    return NVSDK_NGX_Result_Success;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_ReleaseFeature(NVSDK_NGX_Handle* handle)
+{
+    if (!handle)
+    {
+        return NVSDK_NGX_Result_FAIL_FeatureNotFound;
+    }
+    dlss::ReferenceUpscaler::Instance().RemoveFeature(handle->Id);
+    delete handle;
+    return NVSDK_NGX_Result_Success;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCommandList*, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback)
+{
+    if (!handle)
+    {
+        return NVSDK_NGX_Result_FAIL_FeatureNotFound;
+    }
+    if (!parameters)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+
+    // Only resources the caller registered as CPU images are ever dereferenced
+    void* color = nullptr;
+    void* output = nullptr;
+    GetPointer(parameters, NVSDK_NGX_Parameter_Color, &color);
+    GetPointer(parameters, NVSDK_NGX_Parameter_Output, &output);
+    dlss::ReferenceInputs inputs;
+    inputs.color = dlss::FindCpuImage(color);
+    inputs.output = dlss::FindCpuImage(output);
+    if (!inputs.color || !inputs.output)
+    {
+        return NVSDK_NGX_Result_Success;
+    }
+
+    void* motionVectors = nullptr;
+    void* depth = nullptr;
+    int reset = 0;
+    GetPointer(parameters, NVSDK_NGX_Parameter_MotionVectors, &motionVectors);
+    GetPointer(parameters, NVSDK_NGX_Parameter_Depth, &depth);
+    inputs.motionVectors = dlss::FindCpuImage(motionVectors);
+    inputs.depth = dlss::FindCpuImage(depth);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, &inputs.renderWidth);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, &inputs.renderHeight);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X, &inputs.colorBaseX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, &inputs.colorBaseY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X, &inputs.depthBaseX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y, &inputs.depthBaseY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X, &inputs.mvBaseX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y, &inputs.mvBaseY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X, &inputs.outputBaseX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y, &inputs.outputBaseY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_Jitter_Offset_X, &inputs.jitterX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_Jitter_Offset_Y, &inputs.jitterY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_MV_Scale_X, &inputs.mvScaleX);
+    GetNumber(parameters, NVSDK_NGX_Parameter_MV_Scale_Y, &inputs.mvScaleY);
+    GetNumber(parameters, NVSDK_NGX_Parameter_Reset, &reset);
+    inputs.reset = reset != 0;
+
+    return dlss::ReferenceUpscaler::Instance().Evaluate(handle->Id, inputs) ?
+        NVSDK_NGX_Result_Success : NVSDK_NGX_Result_FAIL_InvalidParameter;
+}
+
+//------------------------------------------------------------------------------
+// D3D11
+//------------------------------------------------------------------------------
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_Init_with_ProjectID(const char* projectId, NVSDK_NGX_EngineType engineType,
+    const char* engineVersion, const wchar_t* applicationDataPath, ID3D11Device*,
+    const NVSDK_NGX_FeatureCommonInfo* featureInfo, NVSDK_NGX_Version sdkVersion)
+{
+    return NVSDK_NGX_D3D12_Init_with_ProjectID(projectId, engineType, engineVersion, applicationDataPath, nullptr,
+        featureInfo, sdkVersion);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_Shutdown1(ID3D11Device*)
+{
+    return NVSDK_NGX_D3D12_Shutdown1(nullptr);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_AllocateParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    return NVSDK_NGX_D3D12_AllocateParameters(outParameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    return NVSDK_NGX_D3D12_GetCapabilityParameters(outParameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_DestroyParameters(NVSDK_NGX_Parameter* parameters)
+{
+    return NVSDK_NGX_D3D12_DestroyParameters(parameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_CreateFeature(ID3D11DeviceContext*, NVSDK_NGX_Feature feature,
+    NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle)
+{
+    return NVSDK_NGX_D3D12_CreateFeature(nullptr, feature, parameters, outHandle);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_ReleaseFeature(NVSDK_NGX_Handle* handle)
+{
+    return NVSDK_NGX_D3D12_ReleaseFeature(handle);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceContext*, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback callback)
+{
+    return NVSDK_NGX_D3D12_EvaluateFeature(nullptr, handle, parameters, callback);
+}
+
+//------------------------------------------------------------------------------
+// Vulkan
+//------------------------------------------------------------------------------
+
+// A resource set on Vulkan must be an image view descriptor; unset resources are fine
+static bool IsValidImageView(const NVSDK_NGX_Parameter* parameters, const char* name, bool readWrite)
+{
+    void* pointer = nullptr;
+    if (NVSDK_NGX_FAILED(GetPointer(parameters, name, &pointer)) || !pointer)
+    {
+        return true;
+    }
+    const NVSDK_NGX_Resource_VK* resource = static_cast<const NVSDK_NGX_Resource_VK*>(pointer);
+    return resource->Type == NVSDK_NGX_RESOURCE_VK_TYPE_VK_IMAGEVIEW &&
+        resource->Resource.ImageViewInfo.ImageView != VK_NULL_HANDLE &&
+        resource->Resource.ImageViewInfo.Image != VK_NULL_HANDLE &&
+        (!readWrite || resource->ReadWrite);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_RequiredExtensions(unsigned int* outInstanceExtCount, const char*** outInstanceExts,
+    unsigned int* outDeviceExtCount, const char*** outDeviceExts)
+{
+    // Same kind of list the SDK returns, so the plugin's Vulkan init intercept has something to add
+    static const char* kInstanceExtensions[] = {
+        "VK_KHR_get_physical_device_properties2",
+        "VK_KHR_external_memory_capabilities",
+    };
+    static const char* kDeviceExtensions[] = {
+        "VK_NVX_binary_import",
+        "VK_NVX_image_view_handle",
+        "VK_KHR_push_descriptor",
+    };
+
+    if (!outInstanceExtCount || !outInstanceExts || !outDeviceExtCount || !outDeviceExts)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    *outInstanceExtCount = static_cast<unsigned int>(sizeof(kInstanceExtensions) / sizeof(kInstanceExtensions[0]));
+    *outInstanceExts = kInstanceExtensions;
+    *outDeviceExtCount = static_cast<unsigned int>(sizeof(kDeviceExtensions) / sizeof(kDeviceExtensions[0]));
+    *outDeviceExts = kDeviceExtensions;
+    return NVSDK_NGX_Result_Success;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_Init_with_ProjectID(const char* projectId, NVSDK_NGX_EngineType engineType,
+    const char* engineVersion, const wchar_t* applicationDataPath, VkInstance instance, VkPhysicalDevice physicalDevice,
+    VkDevice device, PFN_vkGetInstanceProcAddr, PFN_vkGetDeviceProcAddr, const NVSDK_NGX_FeatureCommonInfo* featureInfo,
+    NVSDK_NGX_Version sdkVersion)
+{
+    if (!instance || !physicalDevice || !device)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    return NVSDK_NGX_D3D12_Init_with_ProjectID(projectId, engineType, engineVersion, applicationDataPath, nullptr,
+        featureInfo, sdkVersion);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_Shutdown1(VkDevice)
+{
+    return NVSDK_NGX_D3D12_Shutdown1(nullptr);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_AllocateParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    return NVSDK_NGX_D3D12_AllocateParameters(outParameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters)
+{
+    return NVSDK_NGX_D3D12_GetCapabilityParameters(outParameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_DestroyParameters(NVSDK_NGX_Parameter* parameters)
+{
+    return NVSDK_NGX_D3D12_DestroyParameters(parameters);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_CreateFeature1(VkDevice device, VkCommandBuffer commandBuffer, NVSDK_NGX_Feature feature,
+    NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle)
+{
+    if (!device || !commandBuffer)
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    return NVSDK_NGX_D3D12_CreateFeature(nullptr, feature, parameters, outHandle);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_ReleaseFeature(NVSDK_NGX_Handle* handle)
+{
+    return NVSDK_NGX_D3D12_ReleaseFeature(handle);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer commandBuffer, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback callback)
+{
+    NVSDK_NGX_Result result = NVSDK_NGX_D3D12_EvaluateFeature(nullptr, handle, parameters, callback);
+    if (NVSDK_NGX_FAILED(result))
+    {
+        return result;
+    }
+    if (!commandBuffer ||
+        !IsValidImageView(parameters, NVSDK_NGX_Parameter_Color, false) ||
+        !IsValidImageView(parameters, NVSDK_NGX_Parameter_Output, true))
+    {
+        return NVSDK_NGX_Result_FAIL_InvalidParameter;
+    }
+    return NVSDK_NGX_Result_Success;
+}
+
+//------------------------------------------------------------------------------
+// Parameter Setters / Getters
+//------------------------------------------------------------------------------
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetULL(NVSDK_NGX_Parameter* parameters, const char* name, unsigned long long value)
+{
+    NullValue stored = {NullValue::Type::ULL, {}};
+    stored.ull = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetF(NVSDK_NGX_Parameter* parameters, const char* name, float value)
+{
+    NullValue stored = {NullValue::Type::F, {}};
+    stored.f = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD(NVSDK_NGX_Parameter* parameters, const char* name, double value)
+{
+    NullValue stored = {NullValue::Type::D, {}};
+    stored.d = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetUI(NVSDK_NGX_Parameter* parameters, const char* name, unsigned int value)
+{
+    NullValue stored = {NullValue::Type::UI, {}};
+    stored.ui = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetI(NVSDK_NGX_Parameter* parameters, const char* name, int value)
+{
+    NullValue stored = {NullValue::Type::I, {}};
+    stored.i = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD3d12Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D12Resource* value)
+{
+    NullValue stored = {NullValue::Type::Pointer, {}};
+    stored.pointer = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD3d11Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D11Resource* value)
+{
+    NullValue stored = {NullValue::Type::Pointer, {}};
+    stored.pointer = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetVoidPointer(NVSDK_NGX_Parameter* parameters, const char* name, void* value)
+{
+    NullValue stored = {NullValue::Type::Pointer, {}};
+    stored.pointer = value;
+    return SetValue(parameters, name, stored);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetULL(NVSDK_NGX_Parameter* parameters, const char* name, unsigned long long* outValue)
+{
+    return GetNumber(parameters, name, outValue);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetF(NVSDK_NGX_Parameter* parameters, const char* name, float* outValue)
+{
+    return GetNumber(parameters, name, outValue);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD(NVSDK_NGX_Parameter* parameters, const char* name, double* outValue)
+{
+    return GetNumber(parameters, name, outValue);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetUI(NVSDK_NGX_Parameter* parameters, const char* name, unsigned int* outValue)
+{
+    return GetNumber(parameters, name, outValue);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetI(NVSDK_NGX_Parameter* parameters, const char* name, int* outValue)
+{
+    return GetNumber(parameters, name, outValue);
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD3d12Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D12Resource** outValue)
+{
+    void* pointer = nullptr;
+    NVSDK_NGX_Result result = GetPointer(parameters, name, outValue ? &pointer : nullptr);
+    if (NVSDK_NGX_SUCCEED(result))
+    {
+        *outValue = static_cast<ID3D12Resource*>(pointer);
+    }
+    return result;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD3d11Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D11Resource** outValue)
+{
+    void* pointer = nullptr;
+    NVSDK_NGX_Result result = GetPointer(parameters, name, outValue ? &pointer : nullptr);
+    if (NVSDK_NGX_SUCCEED(result))
+    {
+        *outValue = static_cast<ID3D11Resource*>(pointer);
+    }
+    return result;
+}
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetVoidPointer(NVSDK_NGX_Parameter* parameters, const char* name, void** outValue)
+{
+    return GetPointer(parameters, name, outValue);
+}
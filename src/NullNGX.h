@@ -0,0 +1,350 @@
+//------------------------------------------------------------------------------
+// NullNGX.h - NGX SDK subset implemented without a GPU
+//------------------------------------------------------------------------------
+// Declares the NGX types and entry points the plugin uses, with the same names
+// and result codes as the SDK, so DLSSPluginLite.cpp compiles unchanged when
+// DLSS_BACKEND_NULL is set. Parameter blocks are in-memory maps and feature
+// handles are plain allocations, so every plugin code path runs without a GPU
+// or driver (headless servers, CI, dlss_replay, dlss_bench). Evaluation runs
+// the CPU reference upscaler (DLSSReferenceUpscaler.h) when Color and Output
+// are registered CPU images. Off Windows the
+// handful of D3D12 and D3D11 types referenced by the Unity D3D12 and D3D11
+// interfaces are declared opaquely; they are never dereferenced. The D3D11 and
+// Vulkan entry points share the same implementation; the Vulkan types come
+// from NullVulkan.h.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "NullVulkan.h"
+
+#ifdef _WIN32
+    #include <d3d11.h>
+    #include <d3d12.h>
+    #include <dxgi1_4.h>
+#else
+    typedef uint32_t UINT32;
+    typedef uint64_t UINT64;
+    typedef unsigned int UINT;
+    typedef int D3D12_RESOURCE_STATES;
+
+    struct ID3D12Device;
+    struct ID3D12Fence;
+    struct ID3D12CommandQueue;
+    struct ID3D12GraphicsCommandList;
+    struct ID3D12Resource;
+    struct ID3D11Device;
+    struct ID3D11DeviceContext;
+    struct ID3D11Resource;
+    struct ID3D11RenderTargetView;
+    struct ID3D11ShaderResourceView;
+    struct IDXGISwapChain;
+#endif
+
+#define NVSDK_CONV
+
+//------------------------------------------------------------------------------
+// Result codes (values match nvsdk_ngx_defs.h)
+//------------------------------------------------------------------------------
+
+typedef enum NVSDK_NGX_Result
+{
+    NVSDK_NGX_Result_Success = 0x1,
+    NVSDK_NGX_Result_Fail = 0xBAD00000,
+
+    NVSDK_NGX_Result_FAIL_FeatureNotSupported = NVSDK_NGX_Result_Fail | 1,
+    NVSDK_NGX_Result_FAIL_PlatformError = NVSDK_NGX_Result_Fail | 2,
+    NVSDK_NGX_Result_FAIL_FeatureAlreadyExists = NVSDK_NGX_Result_Fail | 3,
+    NVSDK_NGX_Result_FAIL_FeatureNotFound = NVSDK_NGX_Result_Fail | 4,
+    NVSDK_NGX_Result_FAIL_InvalidParameter = NVSDK_NGX_Result_Fail | 5,
+    NVSDK_NGX_Result_FAIL_ScratchBufferTooSmall = NVSDK_NGX_Result_Fail | 6,
+    NVSDK_NGX_Result_FAIL_NotInitialized = NVSDK_NGX_Result_Fail | 7,
+    NVSDK_NGX_Result_FAIL_UnsupportedInputFormat = NVSDK_NGX_Result_Fail | 8,
+    NVSDK_NGX_Result_FAIL_RWFlagMissing = NVSDK_NGX_Result_Fail | 9,
+    NVSDK_NGX_Result_FAIL_MissingInput = NVSDK_NGX_Result_Fail | 10,
+    NVSDK_NGX_Result_FAIL_UnableToInitializeFeature = NVSDK_NGX_Result_Fail | 11,
+    NVSDK_NGX_Result_FAIL_OutOfDate = NVSDK_NGX_Result_Fail | 12,
+    NVSDK_NGX_Result_FAIL_OutOfGPUMemory = NVSDK_NGX_Result_Fail | 13,
+    NVSDK_NGX_Result_FAIL_UnsupportedFormat = NVSDK_NGX_Result_Fail | 14,
+    NVSDK_NGX_Result_FAIL_UnableToWriteToAppDataPath = NVSDK_NGX_Result_Fail | 15,
+    NVSDK_NGX_Result_FAIL_UnsupportedParameter = NVSDK_NGX_Result_Fail | 16,
+    NVSDK_NGX_Result_FAIL_Denied = NVSDK_NGX_Result_Fail | 17,
+    NVSDK_NGX_Result_FAIL_NotImplemented = NVSDK_NGX_Result_Fail | 18,
+} NVSDK_NGX_Result;
+
+#define NVSDK_NGX_SUCCEED(value) (((value) & 0xFFF00000) != NVSDK_NGX_Result_Fail)
+#define NVSDK_NGX_FAILED(value) (((value) & 0xFFF00000) == NVSDK_NGX_Result_Fail)
+
+//------------------------------------------------------------------------------
+// Types
+//------------------------------------------------------------------------------
+
+typedef enum NVSDK_NGX_Feature
+{
+    NVSDK_NGX_Feature_Reserved0 = 0,
+    NVSDK_NGX_Feature_SuperSampling = 1,
+    NVSDK_NGX_Feature_InPainting = 2,
+    NVSDK_NGX_Feature_ImageSuperResolution = 3,
+    NVSDK_NGX_Feature_SlowMotion = 4,
+    NVSDK_NGX_Feature_VideoSuperResolution = 5,
+    NVSDK_NGX_Feature_ImageSignalProcessing = 9,
+    NVSDK_NGX_Feature_DeepResolve = 10,
+    NVSDK_NGX_Feature_FrameGeneration = 11,
+    NVSDK_NGX_Feature_DeepDVC = 12,
+    NVSDK_NGX_Feature_RayReconstruction = 13,
+} NVSDK_NGX_Feature;
+
+typedef enum NVSDK_NGX_Logging_Level
+{
+    NVSDK_NGX_LOGGING_LEVEL_OFF = 0,
+    NVSDK_NGX_LOGGING_LEVEL_ON,
+    NVSDK_NGX_LOGGING_LEVEL_VERBOSE,
+    NVSDK_NGX_LOGGING_LEVEL_NUM
+} NVSDK_NGX_Logging_Level;
+
+typedef enum NVSDK_NGX_EngineType
+{
+    NVSDK_NGX_ENGINE_TYPE_CUSTOM = 0,
+    NVSDK_NGX_ENGINE_TYPE_UNREAL,
+    NVSDK_NGX_ENGINE_TYPE_UNITY,
+    NVSDK_NGX_ENGINE_TYPE_OMNIVERSE,
+    NVSDK_NGX_ENGINE_COUNT
+} NVSDK_NGX_EngineType;
+
+typedef enum NVSDK_NGX_Version
+{
+    NVSDK_NGX_Version_API = 0x0000015
+} NVSDK_NGX_Version;
+
+typedef void (NVSDK_CONV *NVSDK_NGX_AppLogCallback)(const char* message, NVSDK_NGX_Logging_Level loggingLevel,
+    NVSDK_NGX_Feature sourceComponent);
+
+struct NVSDK_NGX_LoggingInfo
+{
+    NVSDK_NGX_AppLogCallback LoggingCallback;
+    NVSDK_NGX_Logging_Level MinimumLoggingLevel;
+    bool DisableOtherLoggingSinks;
+};
+
+struct NVSDK_NGX_FeatureCommonInfo
+{
+    const void* PathListInfo;
+    void* InternalData;
+    NVSDK_NGX_LoggingInfo LoggingInfo;
+};
+
+struct NVSDK_NGX_Handle
+{
+    unsigned int Id;
+};
+
+typedef enum NVSDK_NGX_PerfQuality_Value
+{
+    NVSDK_NGX_PerfQuality_Value_MaxPerf,
+    NVSDK_NGX_PerfQuality_Value_Balanced,
+    NVSDK_NGX_PerfQuality_Value_MaxQuality,
+    NVSDK_NGX_PerfQuality_Value_UltraPerformance,
+    NVSDK_NGX_PerfQuality_Value_UltraQuality,
+    NVSDK_NGX_PerfQuality_Value_DLAA,
+} NVSDK_NGX_PerfQuality_Value;
+
+typedef enum NVSDK_NGX_DLSS_Feature_Flags
+{
+    NVSDK_NGX_DLSS_Feature_Flags_None = 0,
+    NVSDK_NGX_DLSS_Feature_Flags_IsHDR = 1 << 0,
+    NVSDK_NGX_DLSS_Feature_Flags_MVLowRes = 1 << 1,
+    NVSDK_NGX_DLSS_Feature_Flags_MVJittered = 1 << 2,
+    NVSDK_NGX_DLSS_Feature_Flags_DepthInverted = 1 << 3,
+    NVSDK_NGX_DLSS_Feature_Flags_Reserved_0 = 1 << 4,
+    NVSDK_NGX_DLSS_Feature_Flags_DoSharpening = 1 << 5,
+    NVSDK_NGX_DLSS_Feature_Flags_AutoExposure = 1 << 6,
+    NVSDK_NGX_DLSS_Feature_Flags_AlphaUpscaling = 1 << 7,
+} NVSDK_NGX_DLSS_Feature_Flags;
+
+struct NVSDK_NGX_Parameter;
+
+// Resource descriptor set with NVSDK_NGX_Parameter_SetVoidPointer on Vulkan
+typedef struct NVSDK_NGX_ImageViewInfo_VK
+{
+    VkImageView ImageView;
+    VkImage Image;
+    VkImageSubresourceRange SubresourceRange;
+    VkFormat Format;
+    unsigned int Width;
+    unsigned int Height;
+} NVSDK_NGX_ImageViewInfo_VK;
+
+typedef struct NVSDK_NGX_BufferInfo_VK
+{
+    VkBuffer Buffer;
+    unsigned int SizeInBytes;
+} NVSDK_NGX_BufferInfo_VK;
+
+typedef enum NVSDK_NGX_Resource_VK_Type
+{
+    NVSDK_NGX_RESOURCE_VK_TYPE_VK_IMAGEVIEW,
+    NVSDK_NGX_RESOURCE_VK_TYPE_VK_BUFFER
+} NVSDK_NGX_Resource_VK_Type;
+
+typedef struct NVSDK_NGX_Resource_VK
+{
+    union
+    {
+        NVSDK_NGX_ImageViewInfo_VK ImageViewInfo;
+        NVSDK_NGX_BufferInfo_VK BufferInfo;
+    } Resource;
+    NVSDK_NGX_Resource_VK_Type Type;
+    bool ReadWrite;
+} NVSDK_NGX_Resource_VK;
+
+typedef NVSDK_NGX_Result (NVSDK_CONV *PFN_NVSDK_NGX_DLSS_GetOptimalSettingsCallback)(NVSDK_NGX_Parameter* parameters);
+typedef NVSDK_NGX_Result (NVSDK_CONV *PFN_NVSDK_NGX_DLSS_GetStatsCallback)(NVSDK_NGX_Parameter* parameters);
+
+#define NVSDK_NGX_Parameter_Width "Width"
+#define NVSDK_NGX_Parameter_Height "Height"
+#define NVSDK_NGX_Parameter_OutWidth "OutWidth"
+#define NVSDK_NGX_Parameter_OutHeight "OutHeight"
+#define NVSDK_NGX_Parameter_Jitter_Offset_X "Jitter.Offset.X"
+#define NVSDK_NGX_Parameter_Jitter_Offset_Y "Jitter.Offset.Y"
+#define NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width "DLSS.Render.Subrect.Dimensions.Width"
+#define NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height "DLSS.Render.Subrect.Dimensions.Height"
+#define NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X "DLSS.Input.Color.Subrect.Base.X"
+#define NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y "DLSS.Input.Color.Subrect.Base.Y"
+#define NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X "DLSS.Input.Depth.Subrect.Base.X"
+#define NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y "DLSS.Input.Depth.Subrect.Base.Y"
+#define NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X "DLSS.Input.MV.SubrectBase.X"
+#define NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y "DLSS.Input.MV.SubrectBase.Y"
+#define NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X "DLSS.Output.Subrect.Base.X"
+#define NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y "DLSS.Output.Subrect.Base.Y"
+#define NVSDK_NGX_Parameter_SizeInBytes "SizeInBytes"
+#define NVSDK_NGX_Parameter_CreationNodeMask "CreationNodeMask"
+#define NVSDK_NGX_Parameter_VisibilityNodeMask "VisibilityNodeMask"
+#define NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags "DLSS.Feature.Create.Flags"
+#define NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects "DLSS.Enable.Output.Subrects"
+#define NVSDK_NGX_Parameter_Color "Color"
+#define NVSDK_NGX_Parameter_Output "Output"
+#define NVSDK_NGX_Parameter_Depth "Depth"
+#define NVSDK_NGX_Parameter_MotionVectors "MotionVectors"
+#define NVSDK_NGX_Parameter_MV_Scale_X "MV.Scale.X"
+#define NVSDK_NGX_Parameter_MV_Scale_Y "MV.Scale.Y"
+#define NVSDK_NGX_Parameter_Reset "Reset"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_DLAA "DLSS.Hint.Render.Preset.DLAA"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Quality "DLSS.Hint.Render.Preset.Quality"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Balanced "DLSS.Hint.Render.Preset.Balanced"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Performance "DLSS.Hint.Render.Preset.Performance"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraPerformance "DLSS.Hint.Render.Preset.UltraPerformance"
+#define NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraQuality "DLSS.Hint.Render.Preset.UltraQuality"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_DLAA "RayReconstruction.Hint.Render.Preset.DLAA"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Quality "RayReconstruction.Hint.Render.Preset.Quality"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Balanced "RayReconstruction.Hint.Render.Preset.Balanced"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_Performance "RayReconstruction.Hint.Render.Preset.Performance"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_UltraPerformance "RayReconstruction.Hint.Render.Preset.UltraPerformance"
+#define NVSDK_NGX_Parameter_RayReconstruction_Hint_Render_Preset_UltraQuality "RayReconstruction.Hint.Render.Preset.UltraQuality"
+#define NVSDK_NGX_Parameter_DLSS_Denoise_Mode "DLSS.Denoise.Mode"
+#define NVSDK_NGX_Parameter_DLSS_Roughness_Mode "DLSS.Roughness.Mode"
+#define NVSDK_NGX_Parameter_Use_HW_Depth "DLSS.Use.HW.Depth"
+#define NVSDK_NGX_Parameter_DiffuseAlbedo "DiffuseAlbedo"
+#define NVSDK_NGX_Parameter_SpecularAlbedo "SpecularAlbedo"
+#define NVSDK_NGX_Parameter_GBuffer_Normals "GBuffer.Normals"
+#define NVSDK_NGX_Parameter_GBuffer_Roughness "GBuffer.Roughness"
+#define NVSDK_NGX_Parameter_WorldToViewMatrix "WorldToViewMatrix"
+#define NVSDK_NGX_Parameter_ViewToClipMatrix "ViewToClipMatrix"
+#define NVSDK_NGX_Parameter_PerfQualityValue "PerfQualityValue"
+#define NVSDK_NGX_Parameter_RTXValue "RTXValue"
+#define NVSDK_NGX_Parameter_Sharpness "Sharpness"
+#define NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback "DLSSOptimalSettingsCallback"
+#define NVSDK_NGX_Parameter_DLSSGetStatsCallback "DLSSGetStatsCallback"
+#define NVSDK_NGX_Parameter_DLSSDGetStatsCallback "DLSSDGetStatsCallback"
+#define NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width "DLSS.Get.Dynamic.Max.Render.Width"
+#define NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height "DLSS.Get.Dynamic.Max.Render.Height"
+#define NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width "DLSS.Get.Dynamic.Min.Render.Width"
+#define NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height "DLSS.Get.Dynamic.Min.Render.Height"
+#define NVSDK_NGX_Parameter_SuperSampling_Available "SuperSampling.Available"
+#define NVSDK_NGX_Parameter_SuperSampling_NeedsUpdatedDriver "SuperSampling.NeedsUpdatedDriver"
+#define NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMajor "SuperSampling.MinDriverVersionMajor"
+#define NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMinor "SuperSampling.MinDriverVersionMinor"
+#define NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult "SuperSampling.FeatureInitResult"
+#define NVSDK_NGX_Parameter_SuperSamplingDenoising_Available "SuperSamplingDenoising.Available"
+#define NVSDK_NGX_Parameter_SuperSamplingDenoising_NeedsUpdatedDriver "SuperSamplingDenoising.NeedsUpdatedDriver"
+#define NVSDK_NGX_Parameter_SuperSamplingDenoising_MinDriverVersionMajor "SuperSamplingDenoising.MinDriverVersionMajor"
+#define NVSDK_NGX_Parameter_SuperSamplingDenoising_MinDriverVersionMinor "SuperSamplingDenoising.MinDriverVersionMinor"
+#define NVSDK_NGX_Parameter_SuperSamplingDenoising_FeatureInitResult "SuperSamplingDenoising.FeatureInitResult"
+#define NVSDK_NGX_Parameter_FrameGeneration_Available "FrameGeneration.Available"
+#define NVSDK_NGX_Parameter_FrameGeneration_NeedsUpdatedDriver "FrameGeneration.NeedsUpdatedDriver"
+#define NVSDK_NGX_Parameter_FrameGeneration_MinDriverVersionMajor "FrameGeneration.MinDriverVersionMajor"
+#define NVSDK_NGX_Parameter_FrameGeneration_MinDriverVersionMinor "FrameGeneration.MinDriverVersionMinor"
+#define NVSDK_NGX_Parameter_FrameGeneration_FeatureInitResult "FrameGeneration.FeatureInitResult"
+
+//------------------------------------------------------------------------------
+// Entry points
+//------------------------------------------------------------------------------
+
+typedef void (NVSDK_CONV *PFN_NVSDK_NGX_ProgressCallback)(float inCurrentProgress, bool& outShouldCancel);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_Init_with_ProjectID(const char* projectId, NVSDK_NGX_EngineType engineType,
+    const char* engineVersion, const wchar_t* applicationDataPath, ID3D12Device* device,
+    const NVSDK_NGX_FeatureCommonInfo* featureInfo = nullptr, NVSDK_NGX_Version sdkVersion = NVSDK_NGX_Version_API);
+NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown1(ID3D12Device* device);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_AllocateParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_D3D12_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_D3D12_DestroyParameters(NVSDK_NGX_Parameter* parameters);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D12_CreateFeature(ID3D12GraphicsCommandList* commandList, NVSDK_NGX_Feature feature,
+    NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle);
+NVSDK_NGX_Result NVSDK_NGX_D3D12_ReleaseFeature(NVSDK_NGX_Handle* handle);
+NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCommandList* commandList, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback callback = nullptr);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_Init_with_ProjectID(const char* projectId, NVSDK_NGX_EngineType engineType,
+    const char* engineVersion, const wchar_t* applicationDataPath, ID3D11Device* device,
+    const NVSDK_NGX_FeatureCommonInfo* featureInfo = nullptr, NVSDK_NGX_Version sdkVersion = NVSDK_NGX_Version_API);
+NVSDK_NGX_Result NVSDK_NGX_D3D11_Shutdown1(ID3D11Device* device);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_AllocateParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_D3D11_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_D3D11_DestroyParameters(NVSDK_NGX_Parameter* parameters);
+
+NVSDK_NGX_Result NVSDK_NGX_D3D11_CreateFeature(ID3D11DeviceContext* context, NVSDK_NGX_Feature feature,
+    NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle);
+NVSDK_NGX_Result NVSDK_NGX_D3D11_ReleaseFeature(NVSDK_NGX_Handle* handle);
+NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceContext* context, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback callback = nullptr);
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_RequiredExtensions(unsigned int* outInstanceExtCount, const char*** outInstanceExts,
+    unsigned int* outDeviceExtCount, const char*** outDeviceExts);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_Init_with_ProjectID(const char* projectId, NVSDK_NGX_EngineType engineType,
+    const char* engineVersion, const wchar_t* applicationDataPath, VkInstance instance, VkPhysicalDevice physicalDevice,
+    VkDevice device, PFN_vkGetInstanceProcAddr getInstanceProcAddr = nullptr, PFN_vkGetDeviceProcAddr getDeviceProcAddr = nullptr,
+    const NVSDK_NGX_FeatureCommonInfo* featureInfo = nullptr, NVSDK_NGX_Version sdkVersion = NVSDK_NGX_Version_API);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_Shutdown1(VkDevice device);
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_AllocateParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_GetCapabilityParameters(NVSDK_NGX_Parameter** outParameters);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_DestroyParameters(NVSDK_NGX_Parameter* parameters);
+
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_CreateFeature1(VkDevice device, VkCommandBuffer commandBuffer, NVSDK_NGX_Feature feature,
+    NVSDK_NGX_Parameter* parameters, NVSDK_NGX_Handle** outHandle);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_ReleaseFeature(NVSDK_NGX_Handle* handle);
+NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer commandBuffer, const NVSDK_NGX_Handle* handle,
+    const NVSDK_NGX_Parameter* parameters, PFN_NVSDK_NGX_ProgressCallback callback = nullptr);
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetULL(NVSDK_NGX_Parameter* parameters, const char* name, unsigned long long value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetF(NVSDK_NGX_Parameter* parameters, const char* name, float value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD(NVSDK_NGX_Parameter* parameters, const char* name, double value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetUI(NVSDK_NGX_Parameter* parameters, const char* name, unsigned int value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetI(NVSDK_NGX_Parameter* parameters, const char* name, int value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD3d12Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D12Resource* value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetD3d11Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D11Resource* value);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_SetVoidPointer(NVSDK_NGX_Parameter* parameters, const char* name, void* value);
+
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetULL(NVSDK_NGX_Parameter* parameters, const char* name, unsigned long long* outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetF(NVSDK_NGX_Parameter* parameters, const char* name, float* outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD(NVSDK_NGX_Parameter* parameters, const char* name, double* outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetUI(NVSDK_NGX_Parameter* parameters, const char* name, unsigned int* outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetI(NVSDK_NGX_Parameter* parameters, const char* name, int* outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD3d12Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D12Resource** outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetD3d11Resource(NVSDK_NGX_Parameter* parameters, const char* name, ID3D11Resource** outValue);
+NVSDK_NGX_Result NVSDK_NGX_Parameter_GetVoidPointer(NVSDK_NGX_Parameter* parameters, const char* name, void** outValue);
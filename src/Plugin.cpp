@@ -1,17 +1,26 @@
-#pragma comment(lib, "dxgi")
-#pragma comment(lib, "d3d12")
-
 #include <atomic>
-#include <d3d12.h>
-#include <dxgi.h>
-#include <dxgi1_4.h>
-#include <wrl/client.h>
+#include <memory>
+#include "DLSSBackend.h"
 #include "Plugin.h"
+#include "DLSSGraphicsBackend.h"
+#if DLSS_VULKAN_BACKEND
+#include "DLSSGraphicsBackendVulkan.h"
+#endif
 #include "DLSSPluginLite.h"
+#include "DLSSProfiler.h"
+#include "DLSSTextureRegistry.h"
 #include "IUnityInterface.h"
 #include "IUnityGraphics.h"
-#include "IUnityGraphicsD3D12.h"
+#if DLSS_VULKAN_BACKEND
+#include "IUnityGraphicsVulkan.h"
+#endif
 #include "IUnityLog.h"
+#include "DLSSInitEvent.h"
+
+#if defined(_MSC_VER) && !DLSS_BACKEND_NULL
+#pragma comment(lib, "dxgi")
+#pragma comment(lib, "d3d12")
+#endif
 
 
 
@@ -20,8 +29,9 @@
 static IUnityInterfaces *g_unityInterfaces = nullptr;
 static IUnityGraphics *g_unityGraphics = nullptr;
 static std::atomic<UnityGfxRenderer> g_renderer{kUnityGfxRendererNull};
-IUnityGraphicsD3D12v8 *g_unityGraphics_D3D12 = nullptr;  // Non-static for DLSS access
+std::unique_ptr<dlss::GraphicsBackend> g_graphicsBackend;  // Non-static for DLSS access
 IUnityLog *g_unityLog = nullptr;  // Non-static for DLSS logging access
+UnityEventQueue::IUnityEventQueue *g_unityEventQueue = nullptr;  // Non-static for the DLSS_InitAsync notification
 
 
 
@@ -35,12 +45,15 @@ static void HandleDeviceEvent(UnityGfxDeviceEventType eventType) {
             if (g_unityGraphics) {
                 g_renderer = g_unityGraphics->GetRenderer();
             }
+            g_graphicsBackend = dlss::CreateGraphicsBackend(g_renderer, g_unityInterfaces);
             // Note: DLSS_Init_with_ProjectID_D3D12() is called explicitly from C# after device init
             // to allow passing app-specific parameters (projectId, engineVersion, etc.)
             break;
         case kUnityGfxDeviceEventShutdown:
             // Note: DLSS_Shutdown_D3D12() is called explicitly from C# before device shutdown
             // The lite plugin is managed entirely from C# side
+            g_graphicsBackend.reset();
+            dlss::TextureRegistry::Instance().Clear();  // Native textures die with the device
             g_renderer = kUnityGfxRendererNull;
             g_unityLog = nullptr;
             break;
@@ -64,16 +77,18 @@ UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API UnityPluginLoad(IUnityInterfaces
     g_unityInterfaces = unityInterfaces;
     g_unityGraphics = g_unityInterfaces->Get<IUnityGraphics>();
     g_unityGraphics->RegisterDeviceEventCallback(OnGraphicsDeviceEvent);
-    g_unityGraphics_D3D12 = g_unityInterfaces->Get<IUnityGraphicsD3D12v8>();
     g_unityLog = g_unityInterfaces->Get<IUnityLog>();
+    g_unityEventQueue = g_unityInterfaces->Get<UnityEventQueue::IUnityEventQueue>();
+    dlss::Profiler::Instance().Initialize(unityInterfaces);
 
 
-#if SUPPORT_VULKAN
-    if (s_Graphics->GetRenderer() == kUnityGfxRendererNull) {
-        extern void RenderAPI_Vulkan_OnPluginLoad(IUnityInterfaces *);
-        RenderAPI_Vulkan_OnPluginLoad(unityInterfaces);
+#if DLSS_VULKAN_BACKEND
+    // Loaded as a preload plugin, before Unity picked a device: if it picks Vulkan,
+    // have it enable the extensions NGX needs. Unity has no Vulkan interface otherwise.
+    if (g_unityGraphics->GetRenderer() == kUnityGfxRendererNull) {
+        dlss::InterceptVulkanInitialization(g_unityInterfaces->Get<IUnityGraphicsVulkanV2>());
     }
-#endif // SUPPORT_VULKAN
+#endif
 
     // Initialize now (in case the graphics device is already initialized)
     OnGraphicsDeviceEvent(kUnityGfxDeviceEventInitialize);
@@ -82,5 +97,6 @@ UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API UnityPluginLoad(IUnityInterfaces
 // Called by Unity when the plugin is unloaded
 UNITY_INTERFACE_EXPORT void UNITY_INTERFACE_API UnityPluginUnload() {
     g_unityGraphics->UnregisterDeviceEventCallback(OnGraphicsDeviceEvent);
+    dlss::Profiler::Instance().Shutdown();
 }
 }
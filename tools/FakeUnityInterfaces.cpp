@@ -0,0 +1,447 @@
+//------------------------------------------------------------------------------
+// FakeUnityInterfaces.cpp - Minimal Unity runtime for the offline tools
+//------------------------------------------------------------------------------
+
+#include "FakeUnityInterfaces.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "DLSSBackend.h"
+#include "IUnityInterface.h"
+#include "IUnityGraphics.h"
+#include "IUnityGraphicsD3D12.h"
+#include "IUnityGraphicsVulkan.h"
+#include "IUnityLog.h"
+
+namespace dlss
+{
+
+static bool g_printLog = false;
+static UnityGfxRenderer g_renderer = kUnityGfxRendererD3D12;
+static IUnityGraphicsDeviceEventCallback g_deviceEventCallback = nullptr;
+
+// Stand-ins for the D3D12 and Vulkan objects; only their addresses are used
+static char g_fakeDevice;
+static char g_fakeCommandList;
+static char g_fakeVkInstance;
+static char g_fakeVkPhysicalDevice;
+static char g_fakeVkDevice;
+static char g_fakeVkCommandBuffer;
+
+//------------------------------------------------------------------------------
+// IUnityGraphics
+//------------------------------------------------------------------------------
+
+static UnityGfxRenderer UNITY_INTERFACE_API FakeGetRenderer()
+{
+    return g_renderer;
+}
+
+static void UNITY_INTERFACE_API FakeRegisterDeviceEventCallback(IUnityGraphicsDeviceEventCallback callback)
+{
+    g_deviceEventCallback = callback;
+}
+
+static void UNITY_INTERFACE_API FakeUnregisterDeviceEventCallback(IUnityGraphicsDeviceEventCallback)
+{
+    g_deviceEventCallback = nullptr;
+}
+
+static int UNITY_INTERFACE_API FakeReserveEventIDRange(int)
+{
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// IUnityGraphicsD3D12v8
+//------------------------------------------------------------------------------
+
+static ID3D12Device* UNITY_INTERFACE_API FakeGetDevice()
+{
+    return reinterpret_cast<ID3D12Device*>(&g_fakeDevice);
+}
+
+static bool UNITY_INTERFACE_API FakeCommandRecordingState(UnityGraphicsD3D12RecordingState* outState)
+{
+    if (!outState)
+    {
+        return false;
+    }
+    outState->commandList = reinterpret_cast<ID3D12GraphicsCommandList*>(&g_fakeCommandList);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Vulkan loader and device
+//------------------------------------------------------------------------------
+
+static FakeVulkanState g_vulkan;
+static UnityVulkanInitCallback g_vulkanInitCallback = nullptr;
+static void* g_vulkanInitUserData = nullptr;
+static uintptr_t g_nextImageView = 1;
+
+static const char* const kAvailableInstanceExtensions[] = {
+    "VK_KHR_surface",
+    "VK_KHR_get_physical_device_properties2",
+    "VK_KHR_external_memory_capabilities",
+};
+static const char* const kAvailableDeviceExtensions[] = {
+    "VK_KHR_swapchain",
+    "VK_NVX_binary_import",
+    "VK_NVX_image_view_handle",
+};
+
+template <size_t N>
+static VkResult EnumerateFakeExtensions(const char* const (&names)[N], uint32_t* count, VkExtensionProperties* properties)
+{
+    if (!properties)
+    {
+        *count = static_cast<uint32_t>(N);
+        return VK_SUCCESS;
+    }
+    const uint32_t written = *count < N ? *count : static_cast<uint32_t>(N);
+    for (uint32_t i = 0; i < written; ++i)
+    {
+        properties[i] = {};
+        std::strncpy(properties[i].extensionName, names[i], VK_MAX_EXTENSION_NAME_SIZE - 1);
+        properties[i].specVersion = 1;
+    }
+    *count = written;
+    return written < N ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+static VkResult VKAPI_CALL FakeEnumerateInstanceExtensionProperties(const char*, uint32_t* count,
+    VkExtensionProperties* properties)
+{
+    return EnumerateFakeExtensions(kAvailableInstanceExtensions, count, properties);
+}
+
+static VkResult VKAPI_CALL FakeEnumerateDeviceExtensionProperties(VkPhysicalDevice, const char*, uint32_t* count,
+    VkExtensionProperties* properties)
+{
+    return EnumerateFakeExtensions(kAvailableDeviceExtensions, count, properties);
+}
+
+static VkResult VKAPI_CALL FakeCreateInstance(const VkInstanceCreateInfo* createInfo, const VkAllocationCallbacks*,
+    VkInstance* outInstance)
+{
+    g_vulkan.instanceExtensions.assign(createInfo->ppEnabledExtensionNames,
+        createInfo->ppEnabledExtensionNames + createInfo->enabledExtensionCount);
+    *outInstance = reinterpret_cast<VkInstance>(&g_fakeVkInstance);
+    return VK_SUCCESS;
+}
+
+static VkResult VKAPI_CALL FakeCreateDevice(VkPhysicalDevice, const VkDeviceCreateInfo* createInfo,
+    const VkAllocationCallbacks*, VkDevice* outDevice)
+{
+    g_vulkan.deviceExtensions.assign(createInfo->ppEnabledExtensionNames,
+        createInfo->ppEnabledExtensionNames + createInfo->enabledExtensionCount);
+    *outDevice = reinterpret_cast<VkDevice>(&g_fakeVkDevice);
+    return VK_SUCCESS;
+}
+
+static VkResult VKAPI_CALL FakeCreateImageView(VkDevice device, const VkImageViewCreateInfo* createInfo,
+    const VkAllocationCallbacks*, VkImageView* outView)
+{
+    if (device != reinterpret_cast<VkDevice>(&g_fakeVkDevice) || !createInfo ||
+        createInfo->sType != VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO || !createInfo->image)
+    {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+    *outView = reinterpret_cast<VkImageView>(g_nextImageView++);
+    g_vulkan.imageViewsCreated++;
+    g_vulkan.imageViewsLive++;
+    return VK_SUCCESS;
+}
+
+static void VKAPI_CALL FakeDestroyImageView(VkDevice, VkImageView view, const VkAllocationCallbacks*)
+{
+    if (view)
+    {
+        g_vulkan.imageViewsLive--;
+    }
+}
+
+static PFN_vkVoidFunction VKAPI_CALL FakeGetDeviceProcAddr(VkDevice, const char* name)
+{
+    if (std::strcmp(name, "vkCreateImageView") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeCreateImageView);
+    }
+    if (std::strcmp(name, "vkDestroyImageView") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeDestroyImageView);
+    }
+    return nullptr;
+}
+
+// The loader's vkGetInstanceProcAddr
+static PFN_vkVoidFunction VKAPI_CALL FakeGetInstanceProcAddr(VkInstance, const char* name)
+{
+    if (std::strcmp(name, "vkCreateInstance") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeCreateInstance);
+    }
+    if (std::strcmp(name, "vkEnumerateInstanceExtensionProperties") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeEnumerateInstanceExtensionProperties);
+    }
+    if (std::strcmp(name, "vkCreateDevice") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeCreateDevice);
+    }
+    if (std::strcmp(name, "vkEnumerateDeviceExtensionProperties") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeEnumerateDeviceExtensionProperties);
+    }
+    if (std::strcmp(name, "vkGetDeviceProcAddr") == 0)
+    {
+        return reinterpret_cast<PFN_vkVoidFunction>(&FakeGetDeviceProcAddr);
+    }
+    return nullptr;
+}
+
+// What Unity does at startup with the Vulkan renderer: resolve vkGetInstanceProcAddr
+// through the preload plugin's intercept and create the instance and device with it
+static void CreateFakeVulkanDevice()
+{
+    PFN_vkGetInstanceProcAddr getInstanceProcAddr = &FakeGetInstanceProcAddr;
+    if (g_vulkanInitCallback)
+    {
+        getInstanceProcAddr = g_vulkanInitCallback(&FakeGetInstanceProcAddr, g_vulkanInitUserData);
+    }
+
+    static const char* const kUnityInstanceExtensions[] = {
+        "VK_KHR_surface",
+        "VK_KHR_get_physical_device_properties2",
+    };
+    VkInstanceCreateInfo instanceInfo = {};
+    instanceInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    instanceInfo.enabledExtensionCount = 2;
+    instanceInfo.ppEnabledExtensionNames = kUnityInstanceExtensions;
+    VkInstance instance = VK_NULL_HANDLE;
+    auto createInstance = reinterpret_cast<PFN_vkCreateInstance>(getInstanceProcAddr(VK_NULL_HANDLE, "vkCreateInstance"));
+    createInstance(&instanceInfo, nullptr, &instance);
+
+    static const char* const kUnityDeviceExtensions[] = {
+        "VK_KHR_swapchain",
+    };
+    VkDeviceCreateInfo deviceInfo = {};
+    deviceInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    deviceInfo.enabledExtensionCount = 1;
+    deviceInfo.ppEnabledExtensionNames = kUnityDeviceExtensions;
+    VkDevice device = VK_NULL_HANDLE;
+    auto createDevice = reinterpret_cast<PFN_vkCreateDevice>(getInstanceProcAddr(instance, "vkCreateDevice"));
+    createDevice(reinterpret_cast<VkPhysicalDevice>(&g_fakeVkPhysicalDevice), &deviceInfo, nullptr, &device);
+}
+
+//------------------------------------------------------------------------------
+// IUnityGraphicsVulkanV2
+//------------------------------------------------------------------------------
+
+static bool UNITY_INTERFACE_API FakeAddInterceptInitialization(UnityVulkanInitCallback callback, void* userData, int32_t)
+{
+    // Unity accepts the hook only before it initializes the device
+    if (g_renderer != kUnityGfxRendererNull)
+    {
+        return false;
+    }
+    g_vulkanInitCallback = callback;
+    g_vulkanInitUserData = userData;
+    return true;
+}
+
+static void UNITY_INTERFACE_API FakeConfigureEvent(int eventId, const UnityVulkanPluginEventConfig*)
+{
+    g_vulkan.configuredEvents.push_back(eventId);
+}
+
+static UnityVulkanInstance UNITY_INTERFACE_API FakeVulkanInstance()
+{
+    UnityVulkanInstance instance = {};
+    instance.instance = reinterpret_cast<VkInstance>(&g_fakeVkInstance);
+    instance.physicalDevice = reinterpret_cast<VkPhysicalDevice>(&g_fakeVkPhysicalDevice);
+    instance.device = reinterpret_cast<VkDevice>(&g_fakeVkDevice);
+    instance.getInstanceProcAddr = &FakeGetInstanceProcAddr;
+    return instance;
+}
+
+static bool UNITY_INTERFACE_API FakeVulkanCommandRecordingState(UnityVulkanRecordingState* outState,
+    UnityVulkanGraphicsQueueAccess)
+{
+    if (!outState)
+    {
+        return false;
+    }
+    *outState = {};
+    outState->commandBuffer = reinterpret_cast<VkCommandBuffer>(&g_fakeVkCommandBuffer);
+    outState->commandBufferLevel = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    outState->subPassIndex = -1;
+    outState->currentFrameNumber = g_vulkan.currentFrame;
+    outState->safeFrameNumber = g_vulkan.safeFrame;
+    return true;
+}
+
+static bool UNITY_INTERFACE_API FakeAccessTexture(void* nativeTexture, const VkImageSubresource*, VkImageLayout layout,
+    VkPipelineStageFlags, VkAccessFlags, UnityVulkanResourceAccessMode, UnityVulkanImage* outImage)
+{
+    if (!nativeTexture || !outImage)
+    {
+        return false;
+    }
+    g_vulkan.textureLayouts[nativeTexture] = layout;
+
+    *outImage = {};
+    outImage->image = reinterpret_cast<VkImage>(nativeTexture);
+    outImage->layout = layout;
+    outImage->aspect = VK_IMAGE_ASPECT_COLOR_BIT;
+    outImage->format = VK_FORMAT_R16G16B16A16_SFLOAT;
+    outImage->extent = {kFakeVulkanImageSize, kFakeVulkanImageSize, 1};
+    outImage->tiling = VK_IMAGE_TILING_OPTIMAL;
+    outImage->type = VK_IMAGE_TYPE_2D;
+    outImage->samples = VK_SAMPLE_COUNT_1_BIT;
+    outImage->layers = 1;
+    outImage->mipCount = 1;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// IUnityLog
+//------------------------------------------------------------------------------
+
+static void UNITY_INTERFACE_API FakeLog(UnityLogType type, const char* message, const char*, const int)
+{
+    if (!g_printLog)
+    {
+        return;
+    }
+
+    const char* prefix = "log";
+    switch (type)
+    {
+        case kUnityLogTypeError: prefix = "error"; break;
+        case kUnityLogTypeWarning: prefix = "warning"; break;
+        default: break;
+    }
+    std::fprintf(stderr, "[%s] %s\n", prefix, message);
+}
+
+//------------------------------------------------------------------------------
+// IUnityInterfaces
+//------------------------------------------------------------------------------
+
+static IUnityGraphics g_graphics;
+static IUnityGraphicsD3D12v8 g_graphicsD3D12;
+static IUnityGraphicsVulkanV2 g_graphicsVulkan;
+static IUnityLog g_log;
+static IUnityInterfaces g_interfaces;
+
+static IUnityInterface* UNITY_INTERFACE_API FakeGetInterface(UnityInterfaceGUID guid)
+{
+    if (guid == GetUnityInterfaceGUID<IUnityGraphics>())
+    {
+        return &g_graphics;
+    }
+    if (guid == GetUnityInterfaceGUID<IUnityGraphicsD3D12v8>())
+    {
+        return &g_graphicsD3D12;
+    }
+    if (guid == GetUnityInterfaceGUID<IUnityGraphicsVulkanV2>())
+    {
+        return &g_graphicsVulkan;
+    }
+    if (guid == GetUnityInterfaceGUID<IUnityLog>())
+    {
+        return &g_log;
+    }
+    return nullptr;
+}
+
+static IUnityInterface* UNITY_INTERFACE_API FakeGetInterfaceSplit(unsigned long long guidHigh, unsigned long long guidLow)
+{
+    return FakeGetInterface(UnityInterfaceGUID(guidHigh, guidLow));
+}
+
+static void UNITY_INTERFACE_API FakeRegisterInterface(UnityInterfaceGUID, IUnityInterface*)
+{
+}
+
+static void UNITY_INTERFACE_API FakeRegisterInterfaceSplit(unsigned long long, unsigned long long, IUnityInterface*)
+{
+}
+
+void LoadPluginWithFakeUnity(bool printLog, FakeRenderer renderer)
+{
+    g_printLog = printLog;
+    g_deviceEventCallback = nullptr;
+    g_vulkan = {};
+    g_vulkanInitCallback = nullptr;
+    g_vulkanInitUserData = nullptr;
+
+    g_graphics = {};
+    g_graphics.GetRenderer = FakeGetRenderer;
+    g_graphics.RegisterDeviceEventCallback = FakeRegisterDeviceEventCallback;
+    g_graphics.UnregisterDeviceEventCallback = FakeUnregisterDeviceEventCallback;
+    g_graphics.ReserveEventIDRange = FakeReserveEventIDRange;
+
+    g_graphicsD3D12 = {};
+    g_graphicsD3D12.GetDevice = FakeGetDevice;
+    g_graphicsD3D12.CommandRecordingState = FakeCommandRecordingState;
+
+    g_graphicsVulkan = {};
+    g_graphicsVulkan.AddInterceptInitialization = FakeAddInterceptInitialization;
+    g_graphicsVulkan.ConfigureEvent = FakeConfigureEvent;
+    g_graphicsVulkan.Instance = FakeVulkanInstance;
+    g_graphicsVulkan.CommandRecordingState = FakeVulkanCommandRecordingState;
+    g_graphicsVulkan.AccessTexture = FakeAccessTexture;
+
+    g_log = {};
+    g_log.Log = FakeLog;
+
+    g_interfaces = {};
+    g_interfaces.GetInterface = FakeGetInterface;
+    g_interfaces.RegisterInterface = FakeRegisterInterface;
+    g_interfaces.GetInterfaceSplit = FakeGetInterfaceSplit;
+    g_interfaces.RegisterInterfaceSplit = FakeRegisterInterfaceSplit;
+
+    if (renderer == FakeRenderer::D3D12)
+    {
+        g_renderer = kUnityGfxRendererD3D12;
+        UnityPluginLoad(&g_interfaces);
+        return;
+    }
+
+    // A preload plugin is loaded before Unity picks the device
+    g_renderer = kUnityGfxRendererNull;
+    UnityPluginLoad(&g_interfaces);
+    CreateFakeVulkanDevice();
+    g_renderer = kUnityGfxRendererVulkan;
+    if (g_deviceEventCallback)
+    {
+        g_deviceEventCallback(kUnityGfxDeviceEventInitialize);
+    }
+}
+
+void UnloadPluginFromFakeUnity()
+{
+    if (g_deviceEventCallback)
+    {
+        g_deviceEventCallback(kUnityGfxDeviceEventShutdown);
+    }
+    UnityPluginUnload();
+}
+
+const FakeVulkanState& GetFakeVulkanState()
+{
+    return g_vulkan;
+}
+
+void AdvanceFakeVulkanFrame(unsigned long long latencyFrames)
+{
+    g_vulkan.currentFrame++;
+    g_vulkan.safeFrame = g_vulkan.currentFrame > latencyFrames + 1 ? g_vulkan.currentFrame - latencyFrames - 1 : 0;
+}
+
+} // namespace dlss
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// FakeUnityInterfaces.h - Minimal Unity runtime for the offline tools
+//------------------------------------------------------------------------------
+// Provides IUnityGraphics, IUnityGraphicsD3D12v8, IUnityGraphicsVulkanV2 and
+// IUnityLog to a plugin built with DLSS_BACKEND_NULL. The D3D12 device and
+// command list are dummy pointers that the null backend never dereferences; the
+// profiler interface is absent, as in a release player.
+//
+// The fake Vulkan device implements only what the Vulkan backend and its init
+// intercept call: instance and device creation, extension enumeration and image
+// views. Its loader offers the instance extensions VK_KHR_surface,
+// VK_KHR_get_physical_device_properties2 and VK_KHR_external_memory_capabilities
+// and the device extensions VK_KHR_swapchain, VK_NVX_binary_import and
+// VK_NVX_image_view_handle; Unity enables VK_KHR_surface,
+// VK_KHR_get_physical_device_properties2 and VK_KHR_swapchain. AccessTexture reports every non-null native texture as a
+// 2D RGBA16F image of kFakeVulkanImageSize pixels square, whose VkImage is the
+// native texture pointer.
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dlss
+{
+
+/// Renderer the fake Unity initializes its graphics device with.
+enum class FakeRenderer
+{
+    D3D12,
+    Vulkan,     // Loads the plugin as a preload plugin, then creates the device through its init intercept
+};
+
+/// Width and height of the images the fake Vulkan device reports.
+constexpr unsigned int kFakeVulkanImageSize = 128;
+
+/// What the plugin did to the fake Vulkan device since LoadPluginWithFakeUnity.
+struct FakeVulkanState
+{
+    std::vector<std::string> instanceExtensions;    // Enabled at vkCreateInstance
+    std::vector<std::string> deviceExtensions;      // Enabled at vkCreateDevice
+    std::vector<int> configuredEvents;              // ConfigureEvent IDs, in call order
+    std::unordered_map<void*, int> textureLayouts;  // Last VkImageLayout each native texture was accessed with
+    int imageViewsCreated = 0;
+    int imageViewsLive = 0;                         // Created and not destroyed yet
+    unsigned long long currentFrame = 1;            // UnityVulkanRecordingState::currentFrameNumber
+    unsigned long long safeFrame = 0;               // UnityVulkanRecordingState::safeFrameNumber
+};
+
+/// Call UnityPluginLoad with the fake interfaces, then raise
+/// kUnityGfxDeviceEventInitialize for the renderer.
+/// @param printLog Forward plugin log messages to stderr.
+void LoadPluginWithFakeUnity(bool printLog, FakeRenderer renderer = FakeRenderer::D3D12);
+
+/// Raise kUnityGfxDeviceEventShutdown, then call UnityPluginUnload.
+void UnloadPluginFromFakeUnity();
+
+/// State of the fake Vulkan device.
+const FakeVulkanState& GetFakeVulkanState();
+
+/// End the current Vulkan frame, with the GPU latencyFrames frames behind: the
+/// next frame reports every frame older than latencyFrames as safe.
+void AdvanceFakeVulkanFrame(unsigned long long latencyFrames);
+
+} // namespace dlss
@@ -0,0 +1,659 @@
+//------------------------------------------------------------------------------
+// dlss_batch.cpp - Headless upscaling of captured frame sequences
+//------------------------------------------------------------------------------
+// Usage: dlss_batch --color PATH --output PATH [--motion PATH] [--depth PATH]
+//                   [--input NAME=PATH]... [--size WxH] [--out-size WxH | --scale S]
+//                   [--first N] [--count N] [--feature sr|rr] [--mv-scale X,Y]
+//                   [--mv-jittered] [--depth-inverted] [--jitter FILE]
+//                   [--reset-every N] [--in-flight N] [--decoders N]
+//
+// Pushes offline-rendered frames (e.g. cinematics) through the plugin's
+// create / evaluate path outside Unity. Inputs are frame sequences as read by
+// DLSSFrameSequence: uncompressed OpenEXR, or raw floats with --size (color
+// and extra inputs RGBA, motion vectors 2 channels, depth 1). --input binds
+// any other NGX resource parameter, e.g. G-buffer inputs of ray
+// reconstruction: --input GBuffer.Normals=normals/%04d.exr. Output frames are
+// written as RGBA float, to a printf pattern or to one raw file.
+//
+// Frames move through a bounded pipeline of --in-flight slots: decoder threads
+// map and convert the inputs of upcoming frames, this thread evaluates frames
+// in order, and a writer thread saves the outputs. A slot is reused only once
+// its output is written, so at most --in-flight frames are in memory.
+//
+// Jitter defaults to the plugin's Halton sequence (DLSS_Event_EvaluateFeatureJittered
+// with the frame index, matching DLSS_GetJitterOffset at render time);
+// --jitter FILE gives one "x y" line per frame instead.
+//
+// The tool links the plugin built with the null NGX backend, whose evaluate is
+// the CPU reference upscaler (DLSSReferenceUpscaler.h), so it needs no GPU.
+// Ray reconstruction runs the same upscaler; G-buffer inputs are bound but
+// not used by it.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DLSSFrameSequence.h"
+#include "DLSSPluginLite.h"
+#include "DLSSReferenceUpscaler.h"
+#include "DLSSThreadPool.h"
+#include "FakeUnityInterfaces.h"
+#include "NullNGX.h"
+
+static const char* const kUsage =
+    "Usage: %s --color PATH --output PATH [--motion PATH] [--depth PATH]\n"
+    "       [--input NAME=PATH]... [--size WxH] [--out-size WxH | --scale S]\n"
+    "       [--first N] [--count N] [--feature sr|rr] [--mv-scale X,Y]\n"
+    "       [--mv-jittered] [--depth-inverted] [--jitter FILE]\n"
+    "       [--reset-every N] [--in-flight N] [--decoders N]\n";
+
+/// One input sequence and the NGX parameter its frames are bound to.
+struct InputSpec
+{
+    std::string parameter;
+    dlss::FrameSequenceDesc desc;
+};
+
+enum class SlotState
+{
+    Free,
+    Decoding,
+    Ready,          // Inputs decoded, waiting for evaluate
+    Writing,        // Output evaluated, waiting for the writer
+};
+
+/// Everything one in-flight frame needs. Each slot keeps its own readers, so the
+/// images they return stay valid until the slot is reused.
+struct Slot
+{
+    SlotState state = SlotState::Free;
+    uint32_t frame = 0;
+    std::vector<std::unique_ptr<dlss::FrameSequence>> readers;     // Per InputSpec
+    std::vector<dlss::CpuImage> inputs;
+    std::vector<float> output;
+    double decodeSeconds = 0.0;
+};
+
+class Pipeline
+{
+public:
+    Pipeline(const std::vector<InputSpec>& inputs, uint32_t frameCount, uint32_t slotCount, uint32_t outputWidth,
+        uint32_t outputHeight)
+        : m_inputs(inputs), m_frameCount(frameCount), m_slots(slotCount)
+    {
+        for (Slot& slot : m_slots)
+        {
+            slot.inputs.resize(inputs.size());
+            slot.output.resize(static_cast<size_t>(outputWidth) * outputHeight * 4);
+            for (size_t i = 0; i < inputs.size(); ++i)
+            {
+                slot.readers.push_back(std::make_unique<dlss::FrameSequence>());
+            }
+        }
+    }
+
+    // Non-copyable
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    /// Open every reader of every slot.
+    bool Open(std::string& outError)
+    {
+        for (Slot& slot : m_slots)
+        {
+            for (size_t i = 0; i < m_inputs.size(); ++i)
+            {
+                if (!slot.readers[i]->Open(m_inputs[i].desc, outError))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /// Decoder thread body: claim the next frame whose slot is free and decode its inputs.
+    void Decode()
+    {
+        dlss::ThreadPool pool(1);           // Frames are decoded in parallel, not within a frame
+        for (;;)
+        {
+            Slot* slot = nullptr;
+            uint32_t frame = 0;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock, [&] {
+                    return m_failed || m_nextDecode >= m_frameCount ||
+                        SlotOf(m_nextDecode).state == SlotState::Free;
+                });
+                if (m_failed || m_nextDecode >= m_frameCount)
+                {
+                    return;
+                }
+                frame = m_nextDecode++;
+                slot = &SlotOf(frame);
+                slot->state = SlotState::Decoding;
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            std::string error;
+            bool decoded = true;
+            for (size_t i = 0; i < m_inputs.size() && decoded; ++i)
+            {
+                dlss::MetricImage image = {};
+                decoded = slot->readers[i]->ReadFrame(frame, pool, image, error);
+                // The upscaler only reads its inputs
+                slot->inputs[i] = {const_cast<float*>(image.data), image.width, image.height,
+                    slot->readers[i]->GetChannels(), image.rowPitch};
+            }
+            slot->decodeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot->frame = frame;
+            slot->state = SlotState::Ready;
+            if (!decoded)
+            {
+                Fail(error);
+            }
+            m_changed.notify_all();
+        }
+    }
+
+    /// Writer thread body: save outputs in frame order and free their slots.
+    void Write(const std::string& outputPath, uint32_t firstFrame, uint32_t outputWidth, uint32_t outputHeight)
+    {
+        const bool pattern = outputPath.find('%') != std::string::npos;
+        for (uint32_t frame = 0; frame < m_frameCount; ++frame)
+        {
+            Slot* slot = &SlotOf(frame);
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock, [&] {
+                    return m_failed || (slot->state == SlotState::Writing && slot->frame == frame);
+                });
+                if (m_failed)
+                {
+                    return;
+                }
+            }
+
+            std::string path = outputPath;
+            if (pattern)
+            {
+                char buffer[1024];
+                std::snprintf(buffer, sizeof(buffer), outputPath.c_str(), static_cast<int>(firstFrame + frame));
+                path = buffer;
+            }
+            const dlss::MetricImage image = {slot->output.data(), outputWidth, outputHeight, 4 * outputWidth};
+            std::string error;
+            const bool written = dlss::WriteFrameFile(path, image, !pattern && frame > 0, error);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            slot->state = SlotState::Free;
+            if (!written)
+            {
+                Fail(error);
+            }
+            m_changed.notify_all();
+        }
+    }
+
+    /// Wait until frame's inputs are decoded.
+    /// @return The slot, or nullptr if the pipeline failed.
+    Slot* WaitForInputs(uint32_t frame)
+    {
+        Slot& slot = SlotOf(frame);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [&] { return m_failed || (slot.state == SlotState::Ready && slot.frame == frame); });
+        return m_failed ? nullptr : &slot;
+    }
+
+    /// Hand an evaluated slot to the writer.
+    void Evaluated(Slot& slot)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        slot.state = SlotState::Writing;
+        m_changed.notify_all();
+    }
+
+    /// Stop every thread; the first error is kept.
+    void Abort(const std::string& error)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Fail(error);
+        m_changed.notify_all();
+    }
+
+    bool Failed(std::string& outError)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        outError = m_error;
+        return m_failed;
+    }
+
+private:
+    Slot& SlotOf(uint32_t frame) { return m_slots[frame % m_slots.size()]; }
+
+    // Caller holds m_mutex
+    void Fail(const std::string& error)
+    {
+        if (!m_failed)
+        {
+            m_failed = true;
+            m_error = error;
+        }
+    }
+
+    const std::vector<InputSpec>& m_inputs;
+    const uint32_t m_frameCount;
+    std::vector<Slot> m_slots;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;      // Any slot changed state, or the pipeline failed
+    uint32_t m_nextDecode = 0;
+    bool m_failed = false;
+    std::string m_error;
+};
+
+static bool ParseSize(const char* text, uint32_t* width, uint32_t* height)
+{
+    unsigned int w = 0;
+    unsigned int h = 0;
+    if (std::sscanf(text, "%ux%u", &w, &h) != 2 || w == 0 || h == 0)
+    {
+        return false;
+    }
+    *width = w;
+    *height = h;
+    return true;
+}
+
+// One "x y" pair per line, in render pixels
+static bool LoadJitter(const char* path, uint32_t frames, std::vector<float>& outJitter)
+{
+    FILE* file = std::fopen(path, "r");
+    if (!file)
+    {
+        return false;
+    }
+    outJitter.clear();
+    float x = 0.0f;
+    float y = 0.0f;
+    while (outJitter.size() < 2 * static_cast<size_t>(frames) && std::fscanf(file, "%f %f", &x, &y) == 2)
+    {
+        outJitter.push_back(x);
+        outJitter.push_back(y);
+    }
+    std::fclose(file);
+    return outJitter.size() == 2 * static_cast<size_t>(frames);
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<InputSpec> inputs;
+    std::string outputPath;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t outputWidth = 0;
+    uint32_t outputHeight = 0;
+    float scale = 0.0f;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    bool rayReconstruction = false;
+    float mvScaleX = 1.0f;
+    float mvScaleY = 1.0f;
+    bool mvJittered = false;
+    bool depthInverted = false;
+    const char* jitterPath = nullptr;
+    uint32_t resetEvery = 0;
+    uint32_t inFlight = 4;
+    uint32_t decoders = std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        bool valid = true;
+        if (hasValue && std::strcmp(argv[i], "--color") == 0)
+        {
+            inputs.insert(inputs.begin(), InputSpec{"Color", {argv[++i]}});
+        }
+        else if (hasValue && std::strcmp(argv[i], "--motion") == 0)
+        {
+            inputs.push_back({"MotionVectors", {argv[++i]}});
+            inputs.back().desc.channels = 2;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--depth") == 0)
+        {
+            inputs.push_back({"Depth", {argv[++i]}});
+            inputs.back().desc.channels = 1;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--input") == 0)
+        {
+            const char* spec = argv[++i];
+            const char* equals = std::strchr(spec, '=');
+            valid = equals && equals != spec && equals[1] != '\0';
+            if (valid)
+            {
+                inputs.push_back({std::string(spec, equals), {equals + 1}});
+            }
+        }
+        else if (hasValue && std::strcmp(argv[i], "--output") == 0)
+        {
+            outputPath = argv[++i];
+        }
+        else if (hasValue && std::strcmp(argv[i], "--size") == 0)
+        {
+            valid = ParseSize(argv[++i], &width, &height);
+        }
+        else if (hasValue && std::strcmp(argv[i], "--out-size") == 0)
+        {
+            valid = ParseSize(argv[++i], &outputWidth, &outputHeight);
+        }
+        else if (hasValue && std::strcmp(argv[i], "--scale") == 0)
+        {
+            scale = static_cast<float>(std::atof(argv[++i]));
+            valid = scale >= 1.0f && scale <= 4.0f;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--first") == 0)
+        {
+            first = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--count") == 0)
+        {
+            count = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--feature") == 0)
+        {
+            const char* feature = argv[++i];
+            rayReconstruction = std::strcmp(feature, "rr") == 0;
+            valid = rayReconstruction || std::strcmp(feature, "sr") == 0;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--mv-scale") == 0)
+        {
+            valid = std::sscanf(argv[++i], "%f,%f", &mvScaleX, &mvScaleY) == 2;
+        }
+        else if (std::strcmp(argv[i], "--mv-jittered") == 0)
+        {
+            mvJittered = true;
+        }
+        else if (std::strcmp(argv[i], "--depth-inverted") == 0)
+        {
+            depthInverted = true;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--jitter") == 0)
+        {
+            jitterPath = argv[++i];
+        }
+        else if (hasValue && std::strcmp(argv[i], "--reset-every") == 0)
+        {
+            resetEvery = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--in-flight") == 0)
+        {
+            inFlight = static_cast<uint32_t>(std::atoi(argv[++i]));
+            valid = inFlight >= 1;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--decoders") == 0)
+        {
+            decoders = static_cast<uint32_t>(std::atoi(argv[++i]));
+            valid = decoders >= 1;
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (!valid)
+        {
+            std::fprintf(stderr, kUsage, argv[0]);
+            return 1;
+        }
+    }
+    if (inputs.empty() || inputs.front().parameter != "Color" || outputPath.empty())
+    {
+        std::fprintf(stderr, kUsage, argv[0]);
+        return 1;
+    }
+
+    // Every input shares the frame range; raw inputs are at render size
+    for (InputSpec& input : inputs)
+    {
+        input.desc.first = first;
+        input.desc.count = count;
+        input.desc.width = width;
+        input.desc.height = height;
+    }
+
+    // Probe the inputs for the render size, output size and frame count
+    uint32_t frames = 0;
+    uint32_t renderWidth = 0;
+    uint32_t renderHeight = 0;
+    bool mvLowRes = true;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        dlss::FrameSequence probe;
+        std::string error;
+        if (!probe.Open(inputs[i].desc, error))
+        {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+        if (i == 0)
+        {
+            frames = probe.GetFrameCount();
+            renderWidth = probe.GetWidth();
+            renderHeight = probe.GetHeight();
+            if (outputWidth == 0)
+            {
+                const float factor = scale > 0.0f ? scale : 1.5f;
+                outputWidth = static_cast<uint32_t>(renderWidth * factor + 0.5f);
+                outputHeight = static_cast<uint32_t>(renderHeight * factor + 0.5f);
+            }
+        }
+        else if (probe.GetFrameCount() < frames)
+        {
+            std::fprintf(stderr, "%s has %u frames, fewer than color's %u; using %u\n",
+                inputs[i].desc.path.c_str(), probe.GetFrameCount(), frames, probe.GetFrameCount());
+            frames = probe.GetFrameCount();
+        }
+
+        // Motion vectors come at render size (MVLowRes) or output size
+        if (inputs[i].parameter == "MotionVectors")
+        {
+            mvLowRes = probe.GetWidth() == renderWidth && probe.GetHeight() == renderHeight;
+            if (!mvLowRes && (probe.GetWidth() != outputWidth || probe.GetHeight() != outputHeight))
+            {
+                std::fprintf(stderr, "Motion vectors are %ux%u, neither the render nor the output size\n",
+                    probe.GetWidth(), probe.GetHeight());
+                return 1;
+            }
+        }
+    }
+
+    // The slots' readers then open exactly this range instead of probing again
+    for (InputSpec& input : inputs)
+    {
+        input.desc.count = frames;
+    }
+
+    std::vector<float> jitter;
+    if (jitterPath && !LoadJitter(jitterPath, frames, jitter))
+    {
+        std::fprintf(stderr, "%s does not hold %u jitter offsets\n", jitterPath, frames);
+        return 1;
+    }
+
+    Pipeline pipeline(inputs, frames, inFlight, outputWidth, outputHeight);
+    std::string error;
+    if (!pipeline.Open(error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    dlss::LoadPluginWithFakeUnity(false);
+
+    DLSSInitParams init = {};
+    init.engineType = DLSS_ENGINE_TYPE_UNITY;
+    init.engineVersion = "dlss_batch";
+    init.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+    if (NVSDK_NGX_FAILED(DLSS_Init_with_ProjectID_D3D12(&init)))
+    {
+        std::fprintf(stderr, "DLSS initialization failed\n");
+        dlss::UnloadPluginFromFakeUnity();
+        return 1;
+    }
+
+    const UnityRenderingEventAndData renderEvent = DLSS_UnityRenderEventFunc();
+    const int handle = DLSS_AllocateFeatureHandle();
+
+    int createFlags = NVSDK_NGX_DLSS_Feature_Flags_IsHDR;
+    createFlags |= mvLowRes ? NVSDK_NGX_DLSS_Feature_Flags_MVLowRes : 0;
+    createFlags |= mvJittered ? NVSDK_NGX_DLSS_Feature_Flags_MVJittered : 0;
+    createFlags |= depthInverted ? NVSDK_NGX_DLSS_Feature_Flags_DepthInverted : 0;
+
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+    DLSS_Parameter_SetUI(parameters, "CreationNodeMask", 1);
+    DLSS_Parameter_SetUI(parameters, "VisibilityNodeMask", 1);
+    DLSS_Parameter_SetUI(parameters, "Width", renderWidth);
+    DLSS_Parameter_SetUI(parameters, "Height", renderHeight);
+    DLSS_Parameter_SetUI(parameters, "OutWidth", outputWidth);
+    DLSS_Parameter_SetUI(parameters, "OutHeight", outputHeight);
+    DLSS_Parameter_SetI(parameters, "PerfQualityValue", 1);
+    DLSS_Parameter_SetI(parameters, "DLSS.Feature.Create.Flags", createFlags);
+    DLSS_Parameter_SetI(parameters, "DLSS.Enable.Output.Subrects", 0);
+
+    DLSSCreateFeatureParams create = {};
+    create.handle = handle;
+    create.feature = rayReconstruction ? DLSS_NGX_Feature_RayReconstruction : DLSS_NGX_Feature_SuperSampling;
+    create.parameters = parameters;
+    renderEvent(DLSS_Event_CreateFeature, &create);
+
+    DLSSFeatureHealth health = {};
+    if (DLSS_GetFeatureHealth(handle, &health) != 0)
+    {
+        std::fprintf(stderr, "Feature creation failed\n");
+        DLSS_DestroyParameters_D3D12(parameters);
+        DLSS_FreeFeatureHandle(handle);
+        DLSS_Shutdown_D3D12();
+        dlss::UnloadPluginFromFakeUnity();
+        return 1;
+    }
+
+    std::printf("%u frames, %ux%u -> %ux%u, %s, %zu inputs, %u in flight, %u decoders\n", frames, renderWidth,
+        renderHeight, outputWidth, outputHeight, rayReconstruction ? "RR" : "SR", inputs.size(), inFlight, decoders);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < decoders; ++i)
+    {
+        threads.emplace_back([&pipeline] { pipeline.Decode(); });
+    }
+    threads.emplace_back([&] { pipeline.Write(outputPath, first, outputWidth, outputHeight); });
+
+    dlss::CpuImage output = {nullptr, outputWidth, outputHeight, 4, 4 * outputWidth};
+    double waitSeconds = 0.0;
+    double evaluateSeconds = 0.0;
+    double decodeSeconds = 0.0;
+    uint32_t evaluated = 0;
+    for (uint32_t frame = 0; frame < frames; ++frame)
+    {
+        const auto waitStart = std::chrono::steady_clock::now();
+        Slot* slot = pipeline.WaitForInputs(frame);
+        if (!slot)
+        {
+            break;
+        }
+        const auto evaluateStart = std::chrono::steady_clock::now();
+        waitSeconds += std::chrono::duration<double>(evaluateStart - waitStart).count();
+        decodeSeconds += slot->decodeSeconds;
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            dlss::RegisterCpuImage(&slot->inputs[i]);
+            DLSS_Parameter_SetD3d12Resource(parameters, inputs[i].parameter.c_str(), &slot->inputs[i]);
+        }
+        output.data = slot->output.data();
+        dlss::RegisterCpuImage(&output);
+        DLSS_Parameter_SetD3d12Resource(parameters, "Output", &output);
+        DLSS_Parameter_SetF(parameters, "MV.Scale.X", mvScaleX);
+        DLSS_Parameter_SetF(parameters, "MV.Scale.Y", mvScaleY);
+        DLSS_Parameter_SetI(parameters, "Reset", frame == 0 || (resetEvery && frame % resetEvery == 0) ? 1 : 0);
+
+        if (jitter.empty())
+        {
+            DLSSEvaluateJitteredParams evaluate = {};
+            evaluate.handle = handle;
+            evaluate.parameters = parameters;
+            evaluate.jitterFrameIndex = first + frame;
+            renderEvent(DLSS_Event_EvaluateFeatureJittered, &evaluate);
+        }
+        else
+        {
+            DLSS_Parameter_SetF(parameters, "Jitter.Offset.X", jitter[2 * frame]);
+            DLSS_Parameter_SetF(parameters, "Jitter.Offset.Y", jitter[2 * frame + 1]);
+            DLSSEvaluateFeatureParams evaluate = {};
+            evaluate.handle = handle;
+            evaluate.parameters = parameters;
+            renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+        }
+        renderEvent(DLSS_Event_EndFrame, nullptr);
+
+        dlss::UnregisterCpuImage(&output);
+        for (dlss::CpuImage& image : slot->inputs)
+        {
+            dlss::UnregisterCpuImage(&image);
+        }
+        evaluateSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - evaluateStart).count();
+
+        DLSS_GetFeatureHealth(handle, &health);
+        if (NVSDK_NGX_FAILED(health.lastResult) || health.bypassedEvaluates != 0)
+        {
+            char message[96];
+            std::snprintf(message, sizeof(message), "Frame %u: evaluate failed (NGX result 0x%08x)", first + frame,
+                static_cast<unsigned int>(health.lastResult));
+            pipeline.Abort(message);
+            break;
+        }
+        pipeline.Evaluated(*slot);
+        ++evaluated;
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    DLSSDestroyFeatureParams destroy = {};
+    destroy.handle = handle;
+    renderEvent(DLSS_Event_DestroyFeature, &destroy);
+    DLSS_DestroyParameters_D3D12(parameters);
+    DLSS_FreeFeatureHandle(handle);
+    DLSS_Shutdown_D3D12();
+    dlss::UnloadPluginFromFakeUnity();
+
+    if (pipeline.Failed(error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    // Waiting on inputs means decode is the bottleneck; raise --decoders or --in-flight
+    const double perFrame = evaluated ? 1000.0 / evaluated : 0.0;
+    std::printf("%u frames in %.2f s: %.2f frames/s\n", evaluated, seconds, evaluated / seconds);
+    std::printf("  evaluate %8.3f ms/frame\n", evaluateSeconds * perFrame);
+    std::printf("  decode   %8.3f ms/frame (per decoder thread)\n", decodeSeconds * perFrame);
+    std::printf("  stalled  %8.3f ms/frame waiting for inputs\n", waitSeconds * perFrame);
+    return 0;
+}
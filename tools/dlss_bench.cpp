@@ -0,0 +1,501 @@
+//------------------------------------------------------------------------------
+// dlss_bench.cpp - Microbenchmarks of the plugin's CPU hot paths
+//------------------------------------------------------------------------------
+// Usage: dlss_bench [--filter SUBSTRING] [--repetitions N] [--out results.json]
+//
+// Runs against the plugin built with the null NGX backend and fake Unity
+// interfaces, so the numbers are the plugin's own overhead (telemetry, flight
+// recorder, handle table, logging) without NGX or driver time. Each benchmark
+// runs one warm-up pass and N timed repetitions; JSON results report the
+// median and minimum ns per operation.
+//
+// The SR/RR frame benchmarks issue the same per-frame parameter writes as
+// DLSSSuperResolution.cs / DLSSRayReconstruction.cs, the render-event payload
+// copy RingBufferAllocator performs, one EvaluateFeature and one EndFrame.
+// Managed-side costs (P/Invoke transitions, string marshalling) are not
+// included.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "DLSSErrorTracker.h"
+#include "DLSSPluginLite.h"
+#include "FakeUnityInterfaces.h"
+
+//------------------------------------------------------------------------------
+// Harness
+//------------------------------------------------------------------------------
+
+struct BenchResult
+{
+    std::string name;
+    uint64_t iterations = 0;
+    int repetitions = 0;
+    double nsPerOp = 0.0;       // Median over repetitions
+    double minNsPerOp = 0.0;
+};
+
+struct BenchCase
+{
+    const char* name;
+    uint64_t iterations;                        // Operations per repetition
+    std::function<void()> setup;                // Untimed, before each repetition
+    std::function<void(uint64_t)> body;         // Timed, called once per operation
+    std::function<void()> teardown;             // Untimed, after each repetition
+};
+
+static BenchResult RunBench(const BenchCase& bench, int repetitions)
+{
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+
+    // Repetition 0 is the warm-up
+    for (int rep = 0; rep <= repetitions; ++rep)
+    {
+        if (bench.setup)
+        {
+            bench.setup();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < bench.iterations; ++i)
+        {
+            bench.body(i);
+        }
+        const auto end = std::chrono::steady_clock::now();
+
+        if (bench.teardown)
+        {
+            bench.teardown();
+        }
+
+        if (rep > 0)
+        {
+            const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+            samples.push_back(ns / static_cast<double>(bench.iterations));
+        }
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    BenchResult result;
+    result.name = bench.name;
+    result.iterations = bench.iterations;
+    result.repetitions = repetitions;
+    result.nsPerOp = samples[samples.size() / 2];
+    result.minNsPerOp = samples.front();
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// RingBufferAllocator.Allocate<T> equivalent
+//------------------------------------------------------------------------------
+
+class PayloadRing
+{
+public:
+    explicit PayloadRing(size_t capacity)
+        : m_buffer(capacity)
+    {
+    }
+
+    template <typename T>
+    void* Allocate(const T& item)
+    {
+        if (m_writePosition + sizeof(T) > m_buffer.size())
+        {
+            m_writePosition = 0;
+        }
+        void* dest = m_buffer.data() + m_writePosition;
+        std::memcpy(dest, &item, sizeof(T));
+        m_writePosition += sizeof(T);
+        m_totalBytes += sizeof(T);
+        return dest;
+    }
+
+    unsigned long long GetTotalBytes() const { return m_totalBytes; }
+
+private:
+    std::vector<uint8_t> m_buffer;
+    size_t m_writePosition = 0;
+    unsigned long long m_totalBytes = 0;
+};
+
+//------------------------------------------------------------------------------
+// Per-view frames
+//------------------------------------------------------------------------------
+
+struct BenchView
+{
+    void* parameters = nullptr;
+    int handle = DLSS_INVALID_FEATURE_HANDLE;
+};
+
+static void* FakeTexture(uintptr_t id)
+{
+    return reinterpret_cast<void*>(0x10000 + id * 0x100);
+}
+
+static BenchView CreateView(UnityRenderingEventAndData renderEvent, DLSSNGXFeature feature)
+{
+    BenchView view;
+    DLSS_AllocateParameters_D3D12(&view.parameters);
+    view.handle = DLSS_AllocateFeatureHandle();
+
+    DLSS_Parameter_SetUI(view.parameters, "CreationNodeMask", 1);
+    DLSS_Parameter_SetUI(view.parameters, "VisibilityNodeMask", 1);
+    DLSS_Parameter_SetUI(view.parameters, "Width", 1280);
+    DLSS_Parameter_SetUI(view.parameters, "Height", 720);
+    DLSS_Parameter_SetUI(view.parameters, "OutWidth", 2560);
+    DLSS_Parameter_SetUI(view.parameters, "OutHeight", 1440);
+    DLSS_Parameter_SetI(view.parameters, "PerfQualityValue", 1);
+    DLSS_Parameter_SetI(view.parameters, "DLSS.Feature.Create.Flags", 0);
+    DLSS_Parameter_SetI(view.parameters, "DLSS.Enable.Output.Subrects", 0);
+
+    DLSSCreateFeatureParams create = {};
+    create.handle = view.handle;
+    create.feature = feature;
+    create.parameters = view.parameters;
+    renderEvent(DLSS_Event_CreateFeature, &create);
+    return view;
+}
+
+static void DestroyView(UnityRenderingEventAndData renderEvent, BenchView& view)
+{
+    DLSSDestroyFeatureParams destroy = {};
+    destroy.handle = view.handle;
+    renderEvent(DLSS_Event_DestroyFeature, &destroy);
+    DLSS_DestroyParameters_D3D12(view.parameters);
+    view = BenchView();
+}
+
+static void EvaluateAndEndFrame(UnityRenderingEventAndData renderEvent, PayloadRing& ring, const BenchView& view)
+{
+    const unsigned long long bytesAtFrameStart = ring.GetTotalBytes();
+
+    DLSSEvaluateFeatureParams evaluate = {};
+    evaluate.handle = view.handle;
+    evaluate.parameters = view.parameters;
+    renderEvent(DLSS_Event_EvaluateFeature, ring.Allocate(evaluate));
+
+    DLSSEndFrameParams endFrame = {};
+    endFrame.ringBufferBytesUsed = ring.GetTotalBytes() - bytesAtFrameStart;
+    renderEvent(DLSS_Event_EndFrame, ring.Allocate(endFrame));
+}
+
+// DLSSSuperResolution.Execute
+static void SuperResolutionFrame(UnityRenderingEventAndData renderEvent, PayloadRing& ring, const BenchView& view, uint64_t frame)
+{
+    void* p = view.parameters;
+    const float jitter = static_cast<float>(frame % 8) * 0.125f - 0.5f;
+
+    DLSS_Parameter_SetD3d12Resource(p, "Color", FakeTexture(1));
+    DLSS_Parameter_SetD3d12Resource(p, "Output", FakeTexture(2));
+    DLSS_Parameter_SetD3d12Resource(p, "Depth", FakeTexture(3));
+    DLSS_Parameter_SetD3d12Resource(p, "MotionVectors", FakeTexture(4));
+    DLSS_Parameter_SetD3d12Resource(p, "ExposureTexture", FakeTexture(5));
+    DLSS_Parameter_SetD3d12Resource(p, "DLSS.Input.Bias.Current.Color.Mask", FakeTexture(6));
+    DLSS_Parameter_SetF(p, "Jitter.Offset.X", jitter);
+    DLSS_Parameter_SetF(p, "Jitter.Offset.Y", -jitter);
+    DLSS_Parameter_SetF(p, "MV.Scale.X", -1280.0f);
+    DLSS_Parameter_SetF(p, "MV.Scale.Y", -720.0f);
+    DLSS_Parameter_SetI(p, "Reset", 0);
+    DLSS_Parameter_SetUI(p, "DLSS.Render.Subrect.Dimensions.Width", 1280);
+    DLSS_Parameter_SetUI(p, "DLSS.Render.Subrect.Dimensions.Height", 720);
+    DLSS_Parameter_SetF(p, "DLSS.Pre.Exposure", 1.0f);
+    DLSS_Parameter_SetF(p, "DLSS.Exposure.Scale", 1.0f);
+    DLSS_Parameter_SetI(p, "DLSS.Indicator.Invert.Y.Axis", 1);
+    DLSS_Parameter_SetI(p, "DLSS.Indicator.Invert.X.Axis", 0);
+
+    EvaluateAndEndFrame(renderEvent, ring, view);
+}
+
+static const char* const kMatrixNames[2][16] = {
+    {"WorldToViewMatrix_00", "WorldToViewMatrix_01", "WorldToViewMatrix_02", "WorldToViewMatrix_03",
+     "WorldToViewMatrix_10", "WorldToViewMatrix_11", "WorldToViewMatrix_12", "WorldToViewMatrix_13",
+     "WorldToViewMatrix_20", "WorldToViewMatrix_21", "WorldToViewMatrix_22", "WorldToViewMatrix_23",
+     "WorldToViewMatrix_30", "WorldToViewMatrix_31", "WorldToViewMatrix_32", "WorldToViewMatrix_33"},
+    {"ViewToClipMatrix_00", "ViewToClipMatrix_01", "ViewToClipMatrix_02", "ViewToClipMatrix_03",
+     "ViewToClipMatrix_10", "ViewToClipMatrix_11", "ViewToClipMatrix_12", "ViewToClipMatrix_13",
+     "ViewToClipMatrix_20", "ViewToClipMatrix_21", "ViewToClipMatrix_22", "ViewToClipMatrix_23",
+     "ViewToClipMatrix_30", "ViewToClipMatrix_31", "ViewToClipMatrix_32", "ViewToClipMatrix_33"},
+};
+
+// DLSSRayReconstruction.Execute with every optional G-buffer and ray input bound
+static void RayReconstructionFrame(UnityRenderingEventAndData renderEvent, PayloadRing& ring, const BenchView& view, uint64_t frame)
+{
+    void* p = view.parameters;
+    const float jitter = static_cast<float>(frame % 8) * 0.125f - 0.5f;
+
+    DLSS_Parameter_SetD3d12Resource(p, "Color", FakeTexture(1));
+    DLSS_Parameter_SetD3d12Resource(p, "Output", FakeTexture(2));
+    DLSS_Parameter_SetD3d12Resource(p, "Depth", FakeTexture(3));
+    DLSS_Parameter_SetD3d12Resource(p, "MotionVectors", FakeTexture(4));
+    DLSS_Parameter_SetD3d12Resource(p, "DiffuseAlbedo", FakeTexture(5));
+    DLSS_Parameter_SetD3d12Resource(p, "SpecularAlbedo", FakeTexture(6));
+    DLSS_Parameter_SetD3d12Resource(p, "Normals", FakeTexture(7));
+    DLSS_Parameter_SetD3d12Resource(p, "Roughness", FakeTexture(8));
+    DLSS_Parameter_SetD3d12Resource(p, "Emissive", FakeTexture(9));
+    DLSS_Parameter_SetD3d12Resource(p, "DiffuseRayDirection", FakeTexture(10));
+    DLSS_Parameter_SetD3d12Resource(p, "DiffuseHitDistance", FakeTexture(11));
+    DLSS_Parameter_SetD3d12Resource(p, "SpecularRayDirection", FakeTexture(12));
+    DLSS_Parameter_SetD3d12Resource(p, "SpecularHitDistance", FakeTexture(13));
+
+    for (const auto& matrix : kMatrixNames)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            DLSS_Parameter_SetF(p, matrix[i], (i % 5 == 0) ? 1.0f : 0.0f);
+        }
+    }
+
+    DLSS_Parameter_SetF(p, "Jitter.Offset.X", jitter);
+    DLSS_Parameter_SetF(p, "Jitter.Offset.Y", -jitter);
+    DLSS_Parameter_SetF(p, "MV.Scale.X", 1.0f);
+    DLSS_Parameter_SetF(p, "MV.Scale.Y", 1.0f);
+    DLSS_Parameter_SetI(p, "Reset", 0);
+    DLSS_Parameter_SetUI(p, "DLSS.Render.Subrect.Dimensions.Width", 1280);
+    DLSS_Parameter_SetUI(p, "DLSS.Render.Subrect.Dimensions.Height", 720);
+    DLSS_Parameter_SetF(p, "FrameTimeDeltaInMsec", 16.6f);
+    DLSS_Parameter_SetF(p, "DLSS.Pre.Exposure", 1.0f);
+    DLSS_Parameter_SetF(p, "DLSS.Exposure.Scale", 1.0f);
+    DLSS_Parameter_SetI(p, "DLSS.Indicator.Invert.Y.Axis", 1);
+    DLSS_Parameter_SetI(p, "DLSS.Indicator.Invert.X.Axis", 0);
+
+    EvaluateAndEndFrame(renderEvent, ring, view);
+}
+
+//------------------------------------------------------------------------------
+// JSON output
+//------------------------------------------------------------------------------
+
+static void WriteJson(FILE* out, const std::vector<BenchResult>& results)
+{
+    std::fprintf(out, "{\n  \"backend\": \"null\",\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const BenchResult& r = results[i];
+        std::fprintf(out,
+            "    {\"name\": \"%s\", \"iterations\": %llu, \"repetitions\": %d, \"ns_per_op\": %.2f, \"min_ns_per_op\": %.2f}%s\n",
+            r.name.c_str(), static_cast<unsigned long long>(r.iterations), r.repetitions, r.nsPerOp, r.minNsPerOp,
+            i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+//------------------------------------------------------------------------------
+// Main
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    const char* filter = nullptr;
+    const char* outPath = nullptr;
+    int repetitions = 7;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--repetitions") == 0 && i + 1 < argc)
+        {
+            repetitions = std::atoi(argv[++i]);
+            repetitions = repetitions > 0 ? repetitions : 1;
+        }
+        else if (std::strcmp(argv[i], "--out") == 0 && i + 1 < argc)
+        {
+            outPath = argv[++i];
+        }
+        else
+        {
+            std::fprintf(stderr, "Usage: %s [--filter SUBSTRING] [--repetitions N] [--out results.json]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    dlss::LoadPluginWithFakeUnity(false);
+
+    DLSSInitParams init = {};
+    init.engineType = DLSS_ENGINE_TYPE_UNITY;
+    init.engineVersion = "dlss_bench";
+    init.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+    DLSS_Init_with_ProjectID_D3D12(&init);
+
+    const UnityRenderingEventAndData renderEvent = DLSS_UnityRenderEventFunc();
+    PayloadRing ring(2 * 1024 * 1024);
+
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+
+    static const char* const kRotatingNames[] = {
+        "Jitter.Offset.X", "Jitter.Offset.Y", "MV.Scale.X", "MV.Scale.Y",
+        "DLSS.Pre.Exposure", "DLSS.Exposure.Scale", "FrameTimeDeltaInMsec", "Sharpness",
+    };
+
+    // Handles for the create/destroy benchmarks; the plugin wraps handle ids at 1024
+    constexpr uint64_t kHandleBatch = 512;
+    std::vector<int> handles;
+    auto allocateHandles = [&handles]()
+    {
+        handles.clear();
+        for (uint64_t i = 0; i < kHandleBatch; ++i)
+        {
+            handles.push_back(DLSS_AllocateFeatureHandle());
+        }
+    };
+    auto createFeatures = [&handles, renderEvent, parameters]()
+    {
+        for (int handle : handles)
+        {
+            DLSSCreateFeatureParams create = {handle, DLSS_NGX_Feature_SuperSampling, parameters};
+            renderEvent(DLSS_Event_CreateFeature, &create);
+        }
+    };
+    auto destroyFeatures = [&handles, renderEvent]()
+    {
+        // DestroyFeature also removes the handle from the table
+        for (int handle : handles)
+        {
+            DLSSDestroyFeatureParams destroy = {handle};
+            renderEvent(DLSS_Event_DestroyFeature, &destroy);
+        }
+        handles.clear();
+    };
+
+    BenchView evaluateView;
+    BenchView jitteredView;
+    BenchView srView;
+    BenchView rrView;
+    int failingHandle = 100000;
+
+    const std::vector<BenchCase> cases = {
+        {"Parameter_SetF", 1000000, nullptr,
+            [parameters](uint64_t i) { DLSS_Parameter_SetF(parameters, "Jitter.Offset.X", static_cast<float>(i)); },
+            nullptr},
+        {"Parameter_SetF/rotating_names", 1000000, nullptr,
+            [parameters](uint64_t i) { DLSS_Parameter_SetF(parameters, kRotatingNames[i % 8], static_cast<float>(i)); },
+            nullptr},
+        {"FeatureHandle/allocate_free", 1000000, nullptr,
+            [](uint64_t) { DLSS_FreeFeatureHandle(DLSS_AllocateFeatureHandle()); },
+            nullptr},
+        {"RenderEvent/CreateFeature", kHandleBatch, allocateHandles,
+            [&handles, renderEvent, parameters](uint64_t i)
+            {
+                DLSSCreateFeatureParams create = {handles[i], DLSS_NGX_Feature_SuperSampling, parameters};
+                renderEvent(DLSS_Event_CreateFeature, &create);
+            },
+            destroyFeatures},
+        {"RenderEvent/EvaluateFeature", 1000000,
+            [&evaluateView, renderEvent]() { evaluateView = CreateView(renderEvent, DLSS_NGX_Feature_SuperSampling); },
+            [&evaluateView, renderEvent](uint64_t)
+            {
+                DLSSEvaluateFeatureParams evaluate = {evaluateView.handle, evaluateView.parameters};
+                renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+            },
+            [&evaluateView, renderEvent]() { DestroyView(renderEvent, evaluateView); }},
+        {"RenderEvent/EvaluateFeatureJittered", 1000000,
+            [&jitteredView, renderEvent]() { jitteredView = CreateView(renderEvent, DLSS_NGX_Feature_SuperSampling); },
+            [&jitteredView, renderEvent](uint64_t i)
+            {
+                DLSSEvaluateJitteredParams evaluate = {jitteredView.handle, jitteredView.parameters, i};
+                renderEvent(DLSS_Event_EvaluateFeatureJittered, &evaluate);
+            },
+            [&jitteredView, renderEvent]() { DestroyView(renderEvent, jitteredView); }},
+        {"RenderEvent/DestroyFeature", kHandleBatch,
+            [&allocateHandles, &createFeatures]() { allocateHandles(); createFeatures(); },
+            [&handles, renderEvent](uint64_t i)
+            {
+                DLSSDestroyFeatureParams destroy = {handles[i]};
+                renderEvent(DLSS_Event_DestroyFeature, &destroy);
+            },
+            [&handles]() { handles.clear(); }},
+        {"RenderEvent/EndFrame", 1000000, nullptr,
+            [renderEvent](uint64_t)
+            {
+                DLSSEndFrameParams endFrame = {64};
+                renderEvent(DLSS_Event_EndFrame, &endFrame);
+            },
+            nullptr},
+        {"RenderEvent/unknown_id", 100000, nullptr,
+            [renderEvent](uint64_t) { renderEvent(99, nullptr); },
+            nullptr},
+        {"LogDlssResult/failure_rate_limited", 1000000, nullptr,
+            [renderEvent, parameters](uint64_t)
+            {
+                DLSSEvaluateFeatureParams evaluate = {5000, parameters};
+                renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+            },
+            nullptr},
+        {"LogDlssResult/failure_reported", 20000, nullptr,
+            [renderEvent, parameters, &failingHandle](uint64_t)
+            {
+                // A new (handle, result) pair every time, so every failure is formatted and logged
+                DLSSEvaluateFeatureParams evaluate = {failingHandle++, parameters};
+                renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+            },
+            []() { dlss::ErrorTracker::Instance().Reset(); }},
+        {"Jitter/GetJitterOffset", 10000000, nullptr,
+            [](uint64_t i)
+            {
+                DLSSJitterOffset offset;
+                DLSS_GetJitterOffset(1280, 720, 1920, 1080, i, &offset);
+            },
+            nullptr},
+        {"RingBuffer/evaluate_payload_copy", 10000000, nullptr,
+            [&ring, parameters](uint64_t i)
+            {
+                DLSSEvaluateFeatureParams evaluate = {static_cast<int>(i & 0xFF), parameters};
+                void* volatile dest = ring.Allocate(evaluate);
+                (void)dest;
+            },
+            nullptr},
+        {"Frame/SR", 200000,
+            [&srView, renderEvent]() { srView = CreateView(renderEvent, DLSS_NGX_Feature_SuperSampling); },
+            [&srView, &ring, renderEvent](uint64_t i) { SuperResolutionFrame(renderEvent, ring, srView, i); },
+            [&srView, renderEvent]() { DestroyView(renderEvent, srView); }},
+        {"Frame/RR", 100000,
+            [&rrView, renderEvent]() { rrView = CreateView(renderEvent, DLSS_NGX_Feature_RayReconstruction); },
+            [&rrView, &ring, renderEvent](uint64_t i) { RayReconstructionFrame(renderEvent, ring, rrView, i); },
+            [&rrView, renderEvent]() { DestroyView(renderEvent, rrView); }},
+    };
+
+    std::vector<BenchResult> results;
+    for (const BenchCase& bench : cases)
+    {
+        if (filter && !std::strstr(bench.name, filter))
+        {
+            continue;
+        }
+        results.push_back(RunBench(bench, repetitions));
+        std::fprintf(stderr, "%-40s %10.1f ns/op\n", bench.name, results.back().nsPerOp);
+    }
+
+    DLSS_DestroyParameters_D3D12(parameters);
+    DLSS_Shutdown_D3D12();
+    dlss::UnloadPluginFromFakeUnity();
+
+    FILE* out = stdout;
+    if (outPath)
+    {
+        out = std::fopen(outPath, "w");
+        if (!out)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", outPath);
+            return 1;
+        }
+    }
+    WriteJson(out, results);
+    if (out != stdout)
+    {
+        std::fclose(out);
+    }
+    return 0;
+}
@@ -0,0 +1,292 @@
+//------------------------------------------------------------------------------
+// dlss_drs_sim.cpp - Drives the dynamic resolution controller with synthetic load
+//------------------------------------------------------------------------------
+// Usage: dlss_drs_sim [--trace NAME] [--latency N] [--assumed-latency N] [--bound N]
+//                     [--csv out.csv] [--kp X] [--ki X] [--max-step X] [--deadband X]
+//
+// Simulates a GPU whose frame time is a fixed cost plus the DLSS evaluate plus
+// a scene load that scales with render pixel count, with the measurement
+// arriving --latency frames late (as GPU timings do). The controller is told
+// --assumed-latency (default: the real latency) to test a mismatch. Each
+// trace changes the load at known frames; after every change the controller
+// must bring the frame time back within the trace's tolerance of the target
+// and hold it there for kSettleWindow frames, or pin the render size at the
+// end of its range when the target is out of reach, within --bound frames.
+//
+// Prints the settling time per load change and exits with 1 if any exceeds
+// the bound. --csv writes every simulated frame for plotting.
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "DLSSDynamicResolution.h"
+
+static constexpr int kSettleWindow = 10;
+
+static constexpr unsigned int kOutputWidth = 3840;
+static constexpr unsigned int kOutputHeight = 2160;
+static constexpr unsigned int kMaxRenderWidth = 2560;
+static constexpr unsigned int kMaxRenderHeight = 1440;
+
+static constexpr float kTargetMs = 16.67f;
+static constexpr float kFixedMs = 1.5f;        // Shadows, UI and other resolution-independent work
+static constexpr float kDlssMs = 1.2f;         // Evaluate at output resolution
+
+struct LoadTrace
+{
+    const char* name;
+    int frames;
+    float tolerance;                            // Allowed |frame - target| / target once settled
+    std::vector<int> changes;                   // Frames at which the load changes
+    std::function<float(int)> sceneMs;          // Scene cost at the maximum render size
+};
+
+// Deterministic noise in [-1, 1]
+static float Noise(int frame)
+{
+    uint32_t x = static_cast<uint32_t>(frame) * 747796405u + 2891336453u;
+    x = ((x >> ((x >> 28u) + 4u)) ^ x) * 277803737u;
+    x = (x >> 22u) ^ x;
+    return static_cast<float>(x) / 2147483647.5f - 1.0f;
+}
+
+static std::vector<LoadTrace> MakeTraces()
+{
+    std::vector<LoadTrace> traces;
+
+    traces.push_back({"step", 600, 0.05f, {0, 150, 300, 450}, [](int f)
+    {
+        if (f < 150) return 20.0f;
+        if (f < 300) return 30.0f;
+        if (f < 450) return 10.0f;
+        return 20.0f;
+    }});
+
+    traces.push_back({"ramp", 500, 0.05f, {0, 400}, [](int f)
+    {
+        if (f < 100) return 12.0f;
+        if (f < 400) return 12.0f + 28.0f * static_cast<float>(f - 100) / 300.0f;
+        return 40.0f;
+    }});
+
+    std::vector<int> spikeChanges = {0};
+    for (int f = 40; f < 400; f += 40)
+    {
+        spikeChanges.push_back(f);
+    }
+    traces.push_back({"spikes", 400, 0.05f, spikeChanges, [](int f)
+    {
+        return (f > 0 && f % 40 == 0) ? 66.0f : 22.0f;
+    }});
+
+    traces.push_back({"noise", 400, 0.12f, {0}, [](int f)
+    {
+        return 24.0f * (1.0f + 0.08f * Noise(f));
+    }});
+
+    traces.push_back({"saturate", 400, 0.05f, {0, 200}, [](int f)
+    {
+        return f < 200 ? 60.0f : 20.0f;
+    }});
+
+    return traces;
+}
+
+struct SimFrame
+{
+    float frameMs;
+    unsigned int width;
+    unsigned int height;
+};
+
+// Target out of reach: the render size sits at the matching end of its range
+static bool IsPinned(const SimFrame& frame, const dlss::DrsRange& range)
+{
+    const bool pinnedLow = frame.width <= (range.minWidth + 7) / 8 * 8;
+    const bool pinnedHigh = frame.width >= range.maxWidth / 8 * 8;
+    return (frame.frameMs > kTargetMs && pinnedLow) || (frame.frameMs < kTargetMs && pinnedHigh);
+}
+
+static bool IsSettled(const SimFrame& frame, const LoadTrace& trace, const dlss::DrsRange& range)
+{
+    return std::fabs(frame.frameMs - kTargetMs) / kTargetMs <= trace.tolerance || IsPinned(frame, range);
+}
+
+static bool RunTrace(const LoadTrace& trace, const DLSSDrsSettings& settings, int latency, int bound, FILE* csv)
+{
+    dlss::DrsRange range;
+    range.maxWidth = kMaxRenderWidth;
+    range.maxHeight = kMaxRenderHeight;
+    range.minWidth = (kOutputWidth + 2) / 3;
+    range.minHeight = (kOutputHeight + 2) / 3;
+
+    dlss::DrsController controller;
+    controller.SetRange(range);
+    controller.SetSettings(settings);
+
+    const float maxPixels = static_cast<float>(kMaxRenderWidth) * static_cast<float>(kMaxRenderHeight);
+    unsigned int width = kMaxRenderWidth;
+    unsigned int height = kMaxRenderHeight;
+    std::deque<float> inFlight;
+    std::vector<SimFrame> frames;
+    frames.reserve(trace.frames);
+
+    for (int f = 0; f < trace.frames; ++f)
+    {
+        const float pixels = static_cast<float>(width) * static_cast<float>(height);
+        const float frameMs = kFixedMs + kDlssMs + trace.sceneMs(f) * pixels / maxPixels;
+        frames.push_back({frameMs, width, height});
+        inFlight.push_back(frameMs);
+
+        // Timings of frame f reach the CPU `latency` frames later
+        if (static_cast<int>(inFlight.size()) > latency)
+        {
+            DLSSDrsResult result = {};
+            controller.Update(inFlight.front(), kDlssMs, &result);
+            inFlight.pop_front();
+            width = result.renderWidth;
+            height = result.renderHeight;
+        }
+
+        if (csv)
+        {
+            std::fprintf(csv, "%s,%d,%.3f,%u,%u\n", trace.name, f, frameMs, frames.back().width, frames.back().height);
+        }
+    }
+
+    bool passed = true;
+    for (size_t c = 0; c < trace.changes.size(); ++c)
+    {
+        const int begin = trace.changes[c];
+        const int end = c + 1 < trace.changes.size() ? trace.changes[c + 1] : trace.frames;
+
+        int settledAt = -1;
+        int run = 0;
+        for (int f = begin; f < end; ++f)
+        {
+            run = IsSettled(frames[f], trace, range) ? run + 1 : 0;
+            if (run == kSettleWindow)
+            {
+                settledAt = f - kSettleWindow + 1;
+                break;
+            }
+        }
+
+        // Largest deviation once settled (ignoring frames pinned at a range limit),
+        // and how often the size moved afterwards
+        float maxError = 0.0f;
+        int sizeChanges = 0;
+        if (settledAt >= 0)
+        {
+            for (int f = settledAt; f < end; ++f)
+            {
+                if (!IsPinned(frames[f], range))
+                {
+                    maxError = std::max(maxError, std::fabs(frames[f].frameMs - kTargetMs) / kTargetMs);
+                }
+                if (f > settledAt && frames[f].width != frames[f - 1].width)
+                {
+                    sizeChanges++;
+                }
+            }
+        }
+
+        const int settleFrames = settledAt >= 0 ? settledAt - begin : -1;
+        const bool ok = settledAt >= 0 && settleFrames <= bound;
+        passed = passed && ok;
+
+        if (settledAt >= 0)
+        {
+            std::printf("  %-10s change @%-4d settled in %3d frames  max error %5.1f%%  size changes %d  %s\n",
+                trace.name, begin, settleFrames, maxError * 100.0f, sizeChanges, ok ? "ok" : "FAIL");
+        }
+        else
+        {
+            std::printf("  %-10s change @%-4d did not settle within %d frames  FAIL\n", trace.name, begin, end - begin);
+        }
+    }
+    return passed;
+}
+
+int main(int argc, char** argv)
+{
+    const char* traceFilter = nullptr;
+    const char* csvPath = nullptr;
+    int latency = 2;
+    int bound = 45;
+    DLSSDrsSettings settings = {};
+    settings.targetFrameMs = kTargetMs;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--trace") == 0 && hasValue) traceFilter = argv[++i];
+        else if (std::strcmp(argv[i], "--csv") == 0 && hasValue) csvPath = argv[++i];
+        else if (std::strcmp(argv[i], "--latency") == 0 && hasValue) latency = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--assumed-latency") == 0 && hasValue) settings.latencyFrames = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--bound") == 0 && hasValue) bound = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--kp") == 0 && hasValue) settings.kp = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--ki") == 0 && hasValue) settings.ki = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--max-step") == 0 && hasValue) settings.maxStep = static_cast<float>(std::atof(argv[++i]));
+        else if (std::strcmp(argv[i], "--deadband") == 0 && hasValue) settings.deadband = static_cast<float>(std::atof(argv[++i]));
+        else
+        {
+            std::fprintf(stderr,
+                "Usage: %s [--trace NAME] [--latency N] [--assumed-latency N] [--bound N]\n"
+                "          [--csv out.csv] [--kp X] [--ki X] [--max-step X] [--deadband X]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE* csv = nullptr;
+    if (csvPath)
+    {
+        csv = std::fopen(csvPath, "w");
+        if (!csv)
+        {
+            std::fprintf(stderr, "Failed to open %s\n", csvPath);
+            return 1;
+        }
+        std::fprintf(csv, "trace,frame,frame_ms,render_width,render_height\n");
+    }
+
+    if (settings.latencyFrames == 0)
+    {
+        settings.latencyFrames = latency;
+    }
+    std::printf("target %.2f ms, latency %d frames (assumed %d), bound %d frames\n",
+        kTargetMs, latency, settings.latencyFrames, bound);
+
+    bool passed = true;
+    int run = 0;
+    for (const LoadTrace& trace : MakeTraces())
+    {
+        if (traceFilter && std::strcmp(trace.name, traceFilter) != 0)
+        {
+            continue;
+        }
+        passed = RunTrace(trace, settings, latency, bound, csv) && passed;
+        run++;
+    }
+
+    if (csv)
+    {
+        std::fclose(csv);
+    }
+
+    if (run == 0)
+    {
+        std::fprintf(stderr, "No trace named %s\n", traceFilter);
+        return 1;
+    }
+
+    std::printf("%s\n", passed ? "All load changes settled within the bound" : "Some load changes did not settle");
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// dlss_flight_decode.cpp - Decoder for DLSS flight recorder dumps
+//------------------------------------------------------------------------------
+// Usage: dlss_flight_decode <dump.bin> [--csv]
+//
+// Prints one line per record, oldest first, with the time relative to the
+// first record. Dumps come from DLSS_DumpFlightRecorder / DLSS_CopyFlightRecorder.
+//------------------------------------------------------------------------------
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "DLSSFlightRecorder.h"
+
+using dlss::FlightRecord;
+using dlss::FlightRecorderDumpHeader;
+
+static bool ReadFile(const char* path, std::vector<uint8_t>& outData)
+{
+    FILE* file = std::fopen(path, "rb");
+    if (!file)
+    {
+        return false;
+    }
+
+    uint8_t chunk[64 * 1024];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        outData.insert(outData.end(), chunk, chunk + read);
+    }
+    std::fclose(file);
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <dump.bin> [--csv]\n", argv[0]);
+        return 1;
+    }
+
+    const bool csv = argc > 2 && std::strcmp(argv[2], "--csv") == 0;
+
+    std::vector<uint8_t> data;
+    if (!ReadFile(argv[1], data))
+    {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    FlightRecorderDumpHeader header = {};
+    if (data.size() < sizeof(header))
+    {
+        std::fprintf(stderr, "File is too small to be a flight recorder dump\n");
+        return 1;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != dlss::kFlightRecorderMagic)
+    {
+        std::fprintf(stderr, "Bad magic 0x%08X\n", header.magic);
+        return 1;
+    }
+    if (header.version != dlss::kFlightRecorderVersion || header.recordSize != sizeof(FlightRecord))
+    {
+        std::fprintf(stderr, "Unsupported dump version %u (record size %u)\n",
+            static_cast<unsigned>(header.version), static_cast<unsigned>(header.recordSize));
+        return 1;
+    }
+
+    const size_t available = (data.size() - sizeof(header)) / sizeof(FlightRecord);
+    const size_t count = header.recordCount < available ? header.recordCount : available;
+    const double ticksToMs = header.ticksPerSecond > 0.0 ? 1000.0 / header.ticksPerSecond : 0.0;
+
+    if (!csv)
+    {
+        std::printf("# %zu records (%" PRIu64 " recorded, %" PRIu64 " overwritten), %.0f ticks/s\n",
+            count, header.totalRecorded, header.totalRecorded - header.recordCount, header.ticksPerSecond);
+        std::printf("%8s %12s %8s %4s %-28s %7s %12s %18s\n",
+            "index", "time_ms", "frame", "thr", "event", "handle", "result", "arg");
+    }
+    else
+    {
+        std::printf("index,time_ms,frame,thread,event,handle,result,arg\n");
+    }
+
+    uint64_t firstTimestamp = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        FlightRecord record = {};
+        std::memcpy(&record, data.data() + sizeof(header) + i * sizeof(FlightRecord), sizeof(record));
+        if (i == 0)
+        {
+            firstTimestamp = record.timestamp;
+        }
+
+        const double timeMs = static_cast<double>(record.timestamp - firstTimestamp) * ticksToMs;
+        const char* name = dlss::GetFlightEventName(record.eventId);
+
+        if (csv)
+        {
+            std::printf("%zu,%.6f,%u,%u,%s,%d,0x%08X,0x%016" PRIX64 "\n",
+                i, timeMs, record.frameIndex, static_cast<unsigned>(record.threadTag), name,
+                record.handle, static_cast<uint32_t>(record.result), record.arg);
+        }
+        else
+        {
+            std::printf("%8zu %12.4f %8u %4u %-28s %7d   0x%08X 0x%016" PRIX64 "\n",
+                i, timeMs, record.frameIndex, static_cast<unsigned>(record.threadTag), name,
+                record.handle, static_cast<uint32_t>(record.result), record.arg);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// dlss_gpu_timer_check.cpp - Checks the GPU timer's query slot ring
+//------------------------------------------------------------------------------
+// Usage: dlss_gpu_timer_check
+//
+// Drives GpuTimer with the CPU-clock query backend at GPU latencies of 0 to
+// kFramesInFlight frames and checks the bookkeeping that the D3D12 path
+// relies on but cannot show without a GPU:
+//   - results are read back exactly `latency` frames after their frame ends,
+//     and dropped once the GPU is kFramesInFlight or more frames behind;
+//   - evaluates beyond kMaxEvaluatesPerFrame in one frame are not timed;
+//   - query slots wrap around the ring, and the per-handle history keeps
+//     the last kHistorySize samples;
+//   - a handle removed while its queries are in flight gets no samples.
+// Then runs a feature through the plugin's render events (null NGX backend)
+// and checks that DLSS_GetGpuTimings reports its evaluates.
+//
+// Prints one line per check and exits with 1 if any fails.
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstdint>
+
+#include "DLSSGpuTimer.h"
+#include "DLSSPluginLite.h"
+#include "FakeUnityInterfaces.h"
+
+using dlss::GpuTimer;
+
+static constexpr int kHandle = 1;
+static constexpr int kOtherHandle = 2;
+
+static int g_failures = 0;
+
+static void Check(bool passed, const char* what)
+{
+    std::printf("%s  %s\n", passed ? "pass" : "FAIL", what);
+    if (!passed)
+    {
+        g_failures++;
+    }
+}
+
+// Any non-null pointer; the CPU backend records into no command list
+static void* const kCommandList = reinterpret_cast<void*>(0x1000);
+
+static unsigned int GetSampleCount(const GpuTimer& timer, int handle)
+{
+    DLSSGpuTiming timings[4] = {};
+    const int count = timer.Snapshot(timings, 4);
+    for (int i = 0; i < count && i < 4; ++i)
+    {
+        if (timings[i].handle == handle)
+        {
+            return timings[i].sampleCount;
+        }
+    }
+    return 0;
+}
+
+static int TimeEvaluate(GpuTimer& timer, int handle)
+{
+    const int token = timer.BeginEvaluate(kCommandList, handle, DLSS_NGX_Feature_SuperSampling);
+    timer.EndEvaluate(kCommandList, token);
+    return token;
+}
+
+//------------------------------------------------------------------------------
+// Checks
+//------------------------------------------------------------------------------
+
+// One evaluate per frame: after frame n ends, n + 1 - latency samples are back
+static void CheckReadbackLatency(uint32_t latency)
+{
+    GpuTimer timer;
+    timer.SetBackend(dlss::CreateCpuGpuQueryBackend(GpuTimer::kQueryCount, latency));
+
+    const bool dropped = latency >= GpuTimer::kFramesInFlight;
+    constexpr int kFrames = 12;
+    bool matched = true;
+    for (int frame = 0; frame < kFrames; ++frame)
+    {
+        TimeEvaluate(timer, kHandle);
+        timer.EndFrame();
+
+        const int ended = frame + 1;
+        const int expected = dropped || ended < static_cast<int>(latency) ? 0 : ended - static_cast<int>(latency);
+        const unsigned int samples = GetSampleCount(timer, kHandle);
+        if (samples != static_cast<unsigned int>(expected))
+        {
+            std::printf("      frame %d: %u samples, expected %d\n", frame, samples, expected);
+            matched = false;
+        }
+    }
+
+    char what[128];
+    if (dropped)
+    {
+        std::snprintf(what, sizeof(what), "latency %u: every result dropped (ring of %u frames)", latency,
+            GpuTimer::kFramesInFlight);
+    }
+    else
+    {
+        std::snprintf(what, sizeof(what), "latency %u: results read back %u frames after their frame", latency, latency);
+    }
+    Check(matched, what);
+}
+
+static void CheckOverflowDrop()
+{
+    GpuTimer timer;
+    timer.SetBackend(dlss::CreateCpuGpuQueryBackend(GpuTimer::kQueryCount, 0));
+
+    constexpr uint32_t kEvaluates = GpuTimer::kMaxEvaluatesPerFrame + 5;
+    uint32_t timed = 0;
+    bool droppedTail = true;
+    for (uint32_t i = 0; i < kEvaluates; ++i)
+    {
+        const int token = TimeEvaluate(timer, i % 2 ? kOtherHandle : kHandle);
+        if (token >= 0)
+        {
+            timed++;
+        }
+        else if (i < GpuTimer::kMaxEvaluatesPerFrame)
+        {
+            droppedTail = false;
+        }
+    }
+    timer.EndFrame();
+
+    Check(timed == GpuTimer::kMaxEvaluatesPerFrame && droppedTail,
+        "evaluates beyond kMaxEvaluatesPerFrame in a frame are not timed");
+    Check(GetSampleCount(timer, kHandle) + GetSampleCount(timer, kOtherHandle) == GpuTimer::kMaxEvaluatesPerFrame,
+        "the timed evaluates of a full frame are all read back");
+
+    // The next frame starts with an empty slot
+    Check(TimeEvaluate(timer, kHandle) >= 0, "a new frame times evaluates again after an overflow");
+}
+
+static void CheckSlotWrap()
+{
+    GpuTimer timer;
+    timer.SetBackend(dlss::CreateCpuGpuQueryBackend(GpuTimer::kQueryCount, 2));
+
+    constexpr uint32_t kFrames = GpuTimer::kHistorySize + 3 * GpuTimer::kFramesInFlight;
+    bool slotsWrapped = true;
+    for (uint32_t frame = 0; frame < kFrames; ++frame)
+    {
+        // Two evaluates per frame; tokens index pairs in the frame's slot
+        const int first = TimeEvaluate(timer, kHandle);
+        const int second = TimeEvaluate(timer, kHandle);
+        const uint32_t slot = frame % GpuTimer::kFramesInFlight;
+        if (first != static_cast<int>(slot * GpuTimer::kMaxEvaluatesPerFrame) || second != first + 1)
+        {
+            slotsWrapped = false;
+        }
+        timer.EndFrame();
+    }
+
+    Check(slotsWrapped, "frames reuse the query slots in ring order");
+    Check(GetSampleCount(timer, kHandle) == GpuTimer::kHistorySize,
+        "per-handle history keeps the last kHistorySize samples across wraps");
+}
+
+static void CheckRemoveInFlight()
+{
+    GpuTimer timer;
+    timer.SetBackend(dlss::CreateCpuGpuQueryBackend(GpuTimer::kQueryCount, 2));
+
+    TimeEvaluate(timer, kHandle);
+    TimeEvaluate(timer, kOtherHandle);
+    timer.EndFrame();
+    timer.RemoveHandle(kHandle);
+    for (uint32_t frame = 0; frame < GpuTimer::kFramesInFlight; ++frame)
+    {
+        timer.EndFrame();
+    }
+
+    Check(GetSampleCount(timer, kHandle) == 0 && GetSampleCount(timer, kOtherHandle) == 1,
+        "a handle removed with queries in flight gets no samples");
+}
+
+// The null NGX backend installs the CPU backend at init, two frames behind
+static void CheckPlugin()
+{
+    dlss::LoadPluginWithFakeUnity(false);
+
+    DLSSInitParams init = {};
+    init.engineType = DLSS_ENGINE_TYPE_UNITY;
+    init.engineVersion = "dlss_gpu_timer_check";
+    init.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+    DLSS_Init_with_ProjectID_D3D12(&init);
+
+    UnityRenderingEventAndData renderEvent = DLSS_UnityRenderEventFunc();
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+    DLSS_Parameter_SetUI(parameters, "Width", 64);
+    DLSS_Parameter_SetUI(parameters, "Height", 64);
+    DLSS_Parameter_SetUI(parameters, "OutWidth", 128);
+    DLSS_Parameter_SetUI(parameters, "OutHeight", 128);
+
+    const int handle = DLSS_AllocateFeatureHandle();
+    DLSSCreateFeatureParams create = {};
+    create.handle = handle;
+    create.feature = DLSS_NGX_Feature_SuperSampling;
+    create.parameters = parameters;
+    renderEvent(DLSS_Event_CreateFeature, &create);
+
+    constexpr int kFrames = 10;
+    for (int frame = 0; frame < kFrames; ++frame)
+    {
+        DLSSEvaluateFeatureParams evaluate = {};
+        evaluate.handle = handle;
+        evaluate.parameters = parameters;
+        renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+
+        DLSSEndFrameParams endFrame = {};
+        renderEvent(DLSS_Event_EndFrame, &endFrame);
+    }
+
+    DLSSGpuTiming timing = {};
+    const int count = DLSS_GetGpuTimings(&timing, 1);
+    Check(count == 1 && timing.handle == handle && timing.sampleCount == kFrames - 2,
+        "DLSS_GetGpuTimings reports evaluates on the null backend, two frames late");
+
+    DLSSDestroyFeatureParams destroy = {};
+    destroy.handle = handle;
+    renderEvent(DLSS_Event_DestroyFeature, &destroy);
+    DLSS_DestroyParameters_D3D12(parameters);
+    DLSS_Shutdown_D3D12();
+    dlss::UnloadPluginFromFakeUnity();
+}
+
+//------------------------------------------------------------------------------
+// Main
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        std::fprintf(stderr, "Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    for (uint32_t latency = 0; latency <= GpuTimer::kFramesInFlight; ++latency)
+    {
+        CheckReadbackLatency(latency);
+    }
+    CheckOverflowDrop();
+    CheckSlotWrap();
+    CheckRemoveInFlight();
+    CheckPlugin();
+
+    std::printf("\n%d check%s failed\n", g_failures, g_failures == 1 ? "" : "s");
+    return g_failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,308 @@
+//------------------------------------------------------------------------------
+// dlss_metrics.cpp - Image-quality metrics over frame sequences
+//------------------------------------------------------------------------------
+// Usage: dlss_metrics --reference PATH --test PATH [--size WxH] [--first N] [--count N]
+//                     [--csv FILE] [--flip] [--flip-maps DIR] [--ppd PPD] [--peak P]
+//                     [--no-psnr] [--no-ssim] [--threads N] [--kernels scalar|avx2|neon]
+//
+// Compares a test sequence (DLSS output captured from a build under test, or
+// written by dlss_replay) with a reference sequence of the same frames, e.g. a
+// supersampled render, frame by frame. Paths are raw RGBA float files or
+// uncompressed OpenEXR, either single files or printf patterns such as
+// "out/%04d.exr" (see DLSSFrameSequence.h); --size is required for raw input.
+//
+// Prints one line per frame (frame, MSE, PSNR, SSIM, FLIP), to --csv FILE if
+// given, then the mean of each metric, the worst frame and the throughput.
+// --flip-maps writes each frame's FLIP error map to DIR/flip_NNNNN.pfm.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "DLSSFrameSequence.h"
+#include "DLSSImageMetrics.h"
+#include "DLSSMetricKernels.h"
+#include "DLSSThreadPool.h"
+
+static const char* const kUsage =
+    "Usage: %s --reference PATH --test PATH [--size WxH] [--first N] [--count N]\n"
+    "       [--csv FILE] [--flip] [--flip-maps DIR] [--ppd PPD] [--peak P]\n"
+    "       [--no-psnr] [--no-ssim] [--threads N] [--kernels scalar|avx2|neon]\n";
+
+struct Worst
+{
+    double value = 0.0;
+    uint32_t frame = 0;
+    bool valid = false;
+};
+
+// Track the lowest (higherIsWorse false) or highest value and its frame
+static void UpdateWorst(Worst& worst, double value, uint32_t frame, bool higherIsWorse)
+{
+    if (std::isnan(value))
+    {
+        return;
+    }
+    if (!worst.valid || (higherIsWorse ? value > worst.value : value < worst.value))
+    {
+        worst = {value, frame, true};
+    }
+}
+
+// Portable float map, bottom row first
+static bool WritePfm(const std::string& path, const float* pixels, uint32_t width, uint32_t height)
+{
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+    {
+        return false;
+    }
+    std::fprintf(file, "Pf\n%u %u\n-1.0\n", width, height);
+    bool written = true;
+    for (uint32_t row = height; row-- > 0 && written;)
+    {
+        written = std::fwrite(pixels + static_cast<size_t>(row) * width, sizeof(float), width, file) == width;
+    }
+    return std::fclose(file) == 0 && written;
+}
+
+static bool ParseSize(const char* text, uint32_t* width, uint32_t* height)
+{
+    unsigned int w = 0;
+    unsigned int h = 0;
+    if (std::sscanf(text, "%ux%u", &w, &h) != 2 || w == 0 || h == 0)
+    {
+        return false;
+    }
+    *width = w;
+    *height = h;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    dlss::FrameSequenceDesc reference;
+    dlss::FrameSequenceDesc test;
+    dlss::MetricOptions options;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t first = 0;
+    uint32_t count = 0;
+    uint32_t threads = 0;
+    const char* csvPath = nullptr;
+    const char* flipMapDir = nullptr;
+    const char* kernels = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        bool valid = true;
+        if (hasValue && std::strcmp(argv[i], "--reference") == 0)
+        {
+            reference.path = argv[++i];
+        }
+        else if (hasValue && std::strcmp(argv[i], "--test") == 0)
+        {
+            test.path = argv[++i];
+        }
+        else if (hasValue && std::strcmp(argv[i], "--size") == 0)
+        {
+            valid = ParseSize(argv[++i], &width, &height);
+        }
+        else if (hasValue && std::strcmp(argv[i], "--first") == 0)
+        {
+            first = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--count") == 0)
+        {
+            count = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--csv") == 0)
+        {
+            csvPath = argv[++i];
+        }
+        else if (std::strcmp(argv[i], "--flip") == 0)
+        {
+            options.flip = true;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--flip-maps") == 0)
+        {
+            flipMapDir = argv[++i];
+            options.flip = true;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--ppd") == 0)
+        {
+            options.pixelsPerDegree = static_cast<float>(std::atof(argv[++i]));
+            valid = options.pixelsPerDegree >= 1.0f;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--peak") == 0)
+        {
+            options.peak = static_cast<float>(std::atof(argv[++i]));
+            valid = options.peak > 0.0f;
+        }
+        else if (std::strcmp(argv[i], "--no-psnr") == 0)
+        {
+            options.psnr = false;
+        }
+        else if (std::strcmp(argv[i], "--no-ssim") == 0)
+        {
+            options.ssim = false;
+        }
+        else if (hasValue && std::strcmp(argv[i], "--threads") == 0)
+        {
+            threads = static_cast<uint32_t>(std::atoi(argv[++i]));
+        }
+        else if (hasValue && std::strcmp(argv[i], "--kernels") == 0)
+        {
+            kernels = argv[++i];
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (!valid)
+        {
+            std::fprintf(stderr, kUsage, argv[0]);
+            return 1;
+        }
+    }
+    if (reference.path.empty() || test.path.empty())
+    {
+        std::fprintf(stderr, kUsage, argv[0]);
+        return 1;
+    }
+    if (kernels && !dlss::SelectMetricKernels(kernels))
+    {
+        std::fprintf(stderr, "Kernels '%s' are not available on this CPU\n", kernels);
+        return 1;
+    }
+
+    for (dlss::FrameSequenceDesc* desc : {&reference, &test})
+    {
+        desc->first = first;
+        desc->count = count;
+        desc->width = width;
+        desc->height = height;
+    }
+
+    dlss::FrameSequence referenceFrames;
+    dlss::FrameSequence testFrames;
+    std::string error;
+    if (!referenceFrames.Open(reference, error) || !testFrames.Open(test, error))
+    {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (referenceFrames.GetWidth() != testFrames.GetWidth() || referenceFrames.GetHeight() != testFrames.GetHeight())
+    {
+        std::fprintf(stderr, "Reference is %ux%u but test is %ux%u\n", referenceFrames.GetWidth(),
+            referenceFrames.GetHeight(), testFrames.GetWidth(), testFrames.GetHeight());
+        return 1;
+    }
+    const uint32_t frames = std::min(referenceFrames.GetFrameCount(), testFrames.GetFrameCount());
+    if (referenceFrames.GetFrameCount() != testFrames.GetFrameCount())
+    {
+        std::fprintf(stderr, "Reference has %u frames and test %u; comparing the first %u\n",
+            referenceFrames.GetFrameCount(), testFrames.GetFrameCount(), frames);
+    }
+
+    FILE* csv = stdout;
+    if (csvPath && !(csv = std::fopen(csvPath, "w")))
+    {
+        std::fprintf(stderr, "Cannot write %s\n", csvPath);
+        return 1;
+    }
+
+    dlss::ThreadPool pool(threads);
+    const uint32_t frameWidth = referenceFrames.GetWidth();
+    const uint32_t frameHeight = referenceFrames.GetHeight();
+    std::vector<float> flipMap(flipMapDir ? static_cast<size_t>(frameWidth) * frameHeight : 0);
+    options.flipMap = flipMapDir ? flipMap.data() : nullptr;
+
+    std::printf("%ux%u, %u frames, %u threads, %s kernels\n", frameWidth, frameHeight, frames,
+        pool.GetThreadCount(), dlss::GetMetricKernels().name);
+    std::fprintf(csv, "frame,mse,psnr,ssim,flip\n");
+
+    double psnrSum = 0.0;
+    double ssimSum = 0.0;
+    double flipSum = 0.0;
+    uint32_t finitePsnrFrames = 0;
+    uint32_t ssimFrames = 0;
+    Worst worstPsnr;
+    Worst worstSsim;
+    Worst worstFlip;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < frames; ++frame)
+    {
+        dlss::MetricImage referenceImage = {};
+        dlss::MetricImage testImage = {};
+        dlss::FrameMetrics metrics;
+        if (!referenceFrames.ReadFrame(frame, pool, referenceImage, error) ||
+            !testFrames.ReadFrame(frame, pool, testImage, error) ||
+            !dlss::CompareImages(referenceImage, testImage, options, pool, metrics))
+        {
+            std::fprintf(stderr, "Frame %u: %s\n", first + frame, error.empty() ? "size mismatch" : error.c_str());
+            return 1;
+        }
+
+        const uint32_t number = first + frame;
+        std::fprintf(csv, "%u,%.9g,%.4f,%.6f,%.6f\n", number, metrics.mse, metrics.psnr, metrics.ssim, metrics.flip);
+        if (std::isfinite(metrics.psnr))
+        {
+            psnrSum += metrics.psnr;
+            ++finitePsnrFrames;
+        }
+        if (!std::isnan(metrics.ssim))
+        {
+            ssimSum += metrics.ssim;
+            ++ssimFrames;
+        }
+        flipSum += metrics.flip;
+        UpdateWorst(worstPsnr, metrics.psnr, number, false);
+        UpdateWorst(worstSsim, metrics.ssim, number, false);
+        UpdateWorst(worstFlip, metrics.flip, number, true);
+
+        if (flipMapDir)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "/flip_%05u.pfm", number);
+            if (!WritePfm(flipMapDir + std::string(name), flipMap.data(), frameWidth, frameHeight))
+            {
+                std::fprintf(stderr, "Cannot write %s%s\n", flipMapDir, name);
+                return 1;
+            }
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (csv != stdout)
+    {
+        std::fclose(csv);
+    }
+
+    if (options.psnr)
+    {
+        std::printf("PSNR  mean %8.4f dB   worst %8.4f dB (frame %u)%s\n",
+            finitePsnrFrames ? psnrSum / finitePsnrFrames : INFINITY, worstPsnr.value, worstPsnr.frame,
+            finitePsnrFrames < frames ? "  [identical frames excluded from the mean]" : "");
+    }
+    if (options.ssim && ssimFrames)
+    {
+        std::printf("SSIM  mean %8.6f      worst %8.6f    (frame %u)\n", ssimSum / ssimFrames, worstSsim.value,
+            worstSsim.frame);
+    }
+    if (options.flip)
+    {
+        std::printf("FLIP  mean %8.6f      worst %8.6f    (frame %u)\n", frames ? flipSum / frames : 0.0,
+            worstFlip.value, worstFlip.frame);
+    }
+    const double pixels = static_cast<double>(frameWidth) * frameHeight * frames;
+    std::printf("%.2f s, %.1f frames/s, %.0f MPix/s\n", seconds, frames / seconds, pixels / seconds / 1e6);
+    return 0;
+}
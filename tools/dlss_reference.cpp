@@ -0,0 +1,322 @@
+//------------------------------------------------------------------------------
+// dlss_reference.cpp - Checks input conventions against the CPU reference upscaler
+//------------------------------------------------------------------------------
+// Usage: dlss_reference [--output WxH] [--scale S] [--frames N] [--kernels scalar|avx2|neon]
+//
+// Renders a band-limited, panning test pattern at render resolution with the
+// plugin's Halton jitter (DLSS_GetJitterOffset) and low-resolution motion
+// vectors, and upscales it through DLSS_Event_EvaluateFeatureJittered with the
+// null NGX backend, whose evaluate is the reference upscaler. The same frames
+// are also rendered with the jitter sign flipped, with motion vectors of the
+// wrong sign and without jitter. Each case reports the PSNR of the output
+// against the pattern sampled at output resolution (averaged over the second
+// half of the frames, once history has converged) and the evaluate time.
+//
+// Exits with 1 unless the correct inputs beat every mistake by kMinMarginDb, so
+// a change to the jitter table or the reference conventions that breaks them
+// shows up here.
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "DLSSPluginLite.h"
+#include "DLSSReferenceKernels.h"
+#include "DLSSReferenceUpscaler.h"
+#include "FakeUnityInterfaces.h"
+
+static constexpr double kMinMarginDb = 1.0;
+static constexpr float kTwoPi = 6.28318530718f;
+
+// Pattern motion in output pixels per frame
+static constexpr float kVelocityX = 0.37f;
+static constexpr float kVelocityY = -0.21f;
+
+enum class Mistake
+{
+    None,
+    FlippedJitter,          // Scene rendered with -jitter
+    FlippedMotion,          // MV.Scale of the wrong sign
+    NoJitter,               // Scene rendered without jitter, plugin still reports it
+};
+
+struct Case
+{
+    const char* name;
+    Mistake mistake;
+};
+
+struct CaseResult
+{
+    double psnr = 0.0;
+    double msPerFrame = 0.0;
+};
+
+// Test pattern at (x, y) output pixels, frame n; frequencies stay below the render Nyquist limit
+static void SamplePattern(float x, float y, uint64_t frame, float* rgba)
+{
+    x -= kVelocityX * static_cast<float>(frame);
+    y -= kVelocityY * static_cast<float>(frame);
+    const float a = std::sin(kTwoPi * (0.21f * x + 0.05f * y));
+    const float b = std::sin(kTwoPi * (0.03f * x - 0.17f * y));
+    const float c = std::sin(kTwoPi * (0.11f * x + 0.13f * y));
+    rgba[0] = 0.5f + 0.25f * a + 0.2f * b;
+    rgba[1] = 0.5f + 0.3f * b + 0.15f * c;
+    rgba[2] = 0.5f + 0.2f * c + 0.25f * a;
+    rgba[3] = 1.0f;
+}
+
+struct Image
+{
+    std::vector<float> pixels;
+    dlss::CpuImage view = {};
+
+    Image(uint32_t width, uint32_t height, uint32_t channels)
+        : pixels(static_cast<size_t>(width) * height * channels, 0.0f)
+    {
+        view = {pixels.data(), width, height, channels, width * channels};
+        dlss::RegisterCpuImage(&view);
+    }
+    ~Image() { dlss::UnregisterCpuImage(&view); }
+
+    // Non-copyable
+    Image(const Image&) = delete;
+    Image& operator=(const Image&) = delete;
+};
+
+static double Psnr(const Image& output, const Image& truth)
+{
+    double sum = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < output.pixels.size(); i += 4)
+    {
+        for (size_t c = 0; c < 3; ++c)
+        {
+            const double d = static_cast<double>(output.pixels[i + c]) - truth.pixels[i + c];
+            sum += d * d;
+            ++count;
+        }
+    }
+    const double mse = sum / static_cast<double>(count);
+    return mse > 0.0 ? 10.0 * std::log10(1.0 / mse) : 99.0;
+}
+
+static CaseResult RunCase(const Case& testCase, UnityRenderingEventAndData renderEvent, uint32_t renderWidth,
+    uint32_t renderHeight, uint32_t outputWidth, uint32_t outputHeight, uint32_t frames, int handle)
+{
+    const float toOutputX = static_cast<float>(outputWidth) / static_cast<float>(renderWidth);
+    const float toOutputY = static_cast<float>(outputHeight) / static_cast<float>(renderHeight);
+
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+    DLSS_Parameter_SetUI(parameters, "CreationNodeMask", 1);
+    DLSS_Parameter_SetUI(parameters, "VisibilityNodeMask", 1);
+    DLSS_Parameter_SetUI(parameters, "Width", renderWidth);
+    DLSS_Parameter_SetUI(parameters, "Height", renderHeight);
+    DLSS_Parameter_SetUI(parameters, "OutWidth", outputWidth);
+    DLSS_Parameter_SetUI(parameters, "OutHeight", outputHeight);
+    DLSS_Parameter_SetI(parameters, "PerfQualityValue", 1);
+    DLSS_Parameter_SetI(parameters, "DLSS.Feature.Create.Flags", 1 << 1);   // MVLowRes
+    DLSS_Parameter_SetI(parameters, "DLSS.Enable.Output.Subrects", 0);
+
+    DLSSCreateFeatureParams create = {};
+    create.handle = handle;
+    create.feature = DLSS_NGX_Feature_SuperSampling;
+    create.parameters = parameters;
+    renderEvent(DLSS_Event_CreateFeature, &create);
+
+    Image color(renderWidth, renderHeight, 4);
+    Image motion(renderWidth, renderHeight, 2);
+    Image output(outputWidth, outputHeight, 4);
+    Image truth(outputWidth, outputHeight, 4);
+
+    // Uniform motion: every pixel was -velocity away in the previous frame
+    const float motionSign = testCase.mistake == Mistake::FlippedMotion ? -1.0f : 1.0f;
+    for (size_t i = 0; i < motion.pixels.size(); i += 2)
+    {
+        motion.pixels[i] = -kVelocityX / toOutputX;
+        motion.pixels[i + 1] = -kVelocityY / toOutputY;
+    }
+
+    DLSS_Parameter_SetD3d12Resource(parameters, "Color", &color.view);
+    DLSS_Parameter_SetD3d12Resource(parameters, "MotionVectors", &motion.view);
+    DLSS_Parameter_SetD3d12Resource(parameters, "Output", &output.view);
+    DLSS_Parameter_SetF(parameters, "MV.Scale.X", motionSign);
+    DLSS_Parameter_SetF(parameters, "MV.Scale.Y", motionSign);
+
+    CaseResult result;
+    uint32_t measured = 0;
+    double evaluateSeconds = 0.0;
+    for (uint32_t frame = 0; frame < frames; ++frame)
+    {
+        DLSSJitterOffset jitter = {};
+        DLSS_GetJitterOffset(renderWidth, renderHeight, outputWidth, outputHeight, frame, &jitter);
+        if (testCase.mistake == Mistake::FlippedJitter)
+        {
+            jitter.x = -jitter.x;
+            jitter.y = -jitter.y;
+        }
+        else if (testCase.mistake == Mistake::NoJitter)
+        {
+            jitter = {};
+        }
+
+        // Render pixel i samples i + 0.5 + jitter
+        for (uint32_t y = 0; y < renderHeight; ++y)
+        {
+            for (uint32_t x = 0; x < renderWidth; ++x)
+            {
+                SamplePattern((static_cast<float>(x) + 0.5f + jitter.x) * toOutputX,
+                    (static_cast<float>(y) + 0.5f + jitter.y) * toOutputY, frame,
+                    &color.pixels[(static_cast<size_t>(y) * renderWidth + x) * 4]);
+            }
+        }
+
+        DLSS_Parameter_SetI(parameters, "Reset", frame == 0 ? 1 : 0);
+        DLSSEvaluateJitteredParams evaluate = {};
+        evaluate.handle = handle;
+        evaluate.parameters = parameters;
+        evaluate.jitterFrameIndex = frame;
+        const auto start = std::chrono::steady_clock::now();
+        renderEvent(DLSS_Event_EvaluateFeatureJittered, &evaluate);
+        evaluateSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (frame < frames / 2)
+        {
+            continue;
+        }
+        for (uint32_t y = 0; y < outputHeight; ++y)
+        {
+            for (uint32_t x = 0; x < outputWidth; ++x)
+            {
+                SamplePattern(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f, frame,
+                    &truth.pixels[(static_cast<size_t>(y) * outputWidth + x) * 4]);
+            }
+        }
+        result.psnr += Psnr(output, truth);
+        ++measured;
+    }
+
+    DLSSDestroyFeatureParams destroy = {};
+    destroy.handle = handle;
+    renderEvent(DLSS_Event_DestroyFeature, &destroy);
+    DLSS_DestroyParameters_D3D12(parameters);
+
+    result.psnr /= measured ? measured : 1;
+    result.msPerFrame = evaluateSeconds * 1000.0 / frames;
+    return result;
+}
+
+static bool ParseSize(const char* text, uint32_t* width, uint32_t* height)
+{
+    unsigned int w = 0;
+    unsigned int h = 0;
+    if (std::sscanf(text, "%ux%u", &w, &h) != 2 || w == 0 || h == 0)
+    {
+        return false;
+    }
+    *width = w;
+    *height = h;
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t outputWidth = 960;
+    uint32_t outputHeight = 540;
+    float scale = 1.5f;
+    uint32_t frames = 24;
+    const char* kernels = nullptr;
+    for (int i = 1; i < argc; ++i)
+    {
+        bool valid = i + 1 < argc;
+        if (valid && std::strcmp(argv[i], "--output") == 0)
+        {
+            valid = ParseSize(argv[++i], &outputWidth, &outputHeight);
+        }
+        else if (valid && std::strcmp(argv[i], "--scale") == 0)
+        {
+            scale = static_cast<float>(std::atof(argv[++i]));
+            valid = scale >= 1.0f && scale <= 4.0f;
+        }
+        else if (valid && std::strcmp(argv[i], "--frames") == 0)
+        {
+            frames = static_cast<uint32_t>(std::atoi(argv[++i]));
+            valid = frames >= 2;
+        }
+        else if (valid && std::strcmp(argv[i], "--kernels") == 0)
+        {
+            kernels = argv[++i];
+        }
+        else
+        {
+            valid = false;
+        }
+
+        if (!valid)
+        {
+            std::fprintf(stderr, "Usage: %s [--output WxH] [--scale S] [--frames N] [--kernels scalar|avx2|neon]\n",
+                argv[0]);
+            return 1;
+        }
+    }
+
+    if (kernels && !dlss::SelectReferenceKernels(kernels))
+    {
+        std::fprintf(stderr, "Kernels '%s' are not available on this CPU\n", kernels);
+        return 1;
+    }
+
+    const uint32_t renderWidth = static_cast<uint32_t>(std::lround(outputWidth / scale));
+    const uint32_t renderHeight = static_cast<uint32_t>(std::lround(outputHeight / scale));
+
+    dlss::LoadPluginWithFakeUnity(false);
+
+    DLSSInitParams init = {};
+    init.engineType = DLSS_ENGINE_TYPE_UNITY;
+    init.engineVersion = "dlss_reference";
+    init.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+    DLSS_Init_with_ProjectID_D3D12(&init);
+
+    const UnityRenderingEventAndData renderEvent = DLSS_UnityRenderEventFunc();
+
+    std::printf("%ux%u -> %ux%u, %u frames, %s kernels\n", renderWidth, renderHeight, outputWidth, outputHeight,
+        frames, dlss::GetReferenceKernels().name);
+
+    static const Case kCases[] = {
+        {"correct", Mistake::None},
+        {"flipped jitter", Mistake::FlippedJitter},
+        {"flipped motion", Mistake::FlippedMotion},
+        {"no jitter", Mistake::NoJitter},
+    };
+
+    double correctPsnr = 0.0;
+    bool passed = true;
+    for (const Case& testCase : kCases)
+    {
+        const int handle = DLSS_AllocateFeatureHandle();
+        const CaseResult result = RunCase(testCase, renderEvent, renderWidth, renderHeight, outputWidth, outputHeight,
+            frames, handle);
+        DLSS_FreeFeatureHandle(handle);
+
+        if (testCase.mistake == Mistake::None)
+        {
+            correctPsnr = result.psnr;
+            std::printf("  %-16s %7.2f dB  %8.3f ms/frame\n", testCase.name, result.psnr, result.msPerFrame);
+            continue;
+        }
+
+        const bool detected = correctPsnr - result.psnr >= kMinMarginDb;
+        passed = passed && detected;
+        std::printf("  %-16s %7.2f dB  %8.3f ms/frame  %s\n", testCase.name, result.psnr, result.msPerFrame,
+            detected ? "detected" : "NOT DETECTED");
+    }
+
+    DLSS_Shutdown_D3D12();
+    dlss::UnloadPluginFromFakeUnity();
+    return passed ? 0 : 1;
+}
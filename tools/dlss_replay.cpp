@@ -0,0 +1,661 @@
+//------------------------------------------------------------------------------
+// dlss_replay.cpp - Replays a DLSS capture through the plugin
+//------------------------------------------------------------------------------
+// Usage: dlss_replay <capture.bin> [--loops N] [--realtime] [--log] [--strict]
+//
+// Feeds the records written between DLSS_BeginCapture and DLSS_EndCapture
+// back into the plugin's exports and render event callback. The plugin is
+// linked against the null NGX backend and fake Unity interfaces, so this runs
+// without a GPU and measures only the plugin's own CPU path.
+//
+// Parameter blocks and feature handles are remapped from the captured values
+// to the ones returned during replay. A feature-handle or texture registry
+// call whose outcome differs from the capture is counted as a divergence
+// (--strict turns any divergence into exit code 2). Captures that start
+// mid-session reference blocks and handles created earlier; blocks are
+// allocated on first use and unknown handles are passed through unchanged.
+// Texture ids registered before the capture began stay unregistered, so
+// bindings to them evaluate with no texture.
+//
+//   --loops N     Replay the capture N times (Init / Shutdown around each pass)
+//   --realtime    Sleep to reproduce the captured timing
+//   --log         Print plugin log messages
+//   --strict      Exit with code 2 if the handle table diverged from the capture
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "DLSSCapture.h"
+#include "DLSSPluginLite.h"
+#include "DLSSTelemetry.h"
+#include "DLSSTiming.h"
+#include "FakeUnityInterfaces.h"
+
+using dlss::CaptureFileHeader;
+using dlss::CaptureRecordHeader;
+using dlss::CaptureRecordType;
+
+static bool ReadFile(const char* path, std::vector<uint8_t>& outData)
+{
+    FILE* file = std::fopen(path, "rb");
+    if (!file)
+    {
+        return false;
+    }
+
+    uint8_t chunk[64 * 1024];
+    size_t read = 0;
+    while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+    {
+        outData.insert(outData.end(), chunk, chunk + read);
+    }
+    std::fclose(file);
+    return true;
+}
+
+/// One record located in the capture buffer.
+struct ReplayRecord
+{
+    CaptureRecordHeader header;
+    const uint8_t* payload;
+};
+
+/// Accumulated replay cost of one record kind.
+struct ReplayStats
+{
+    uint64_t count = 0;
+    uint64_t ticks = 0;
+};
+
+// Render events are broken down by id, everything else by record type
+static constexpr int kRenderEventKinds = 7;    // One per DLSSRenderEventId, plus unknown ids
+static constexpr int kStatKinds = static_cast<int>(CaptureRecordType::Count) + kRenderEventKinds;
+
+static int GetStatKind(const ReplayRecord& record, int eventId)
+{
+    if (record.header.type != static_cast<uint8_t>(CaptureRecordType::RenderEvent))
+    {
+        return record.header.type;
+    }
+    const int offset = (eventId >= 0 && eventId < kRenderEventKinds - 1) ? eventId : kRenderEventKinds - 1;
+    return static_cast<int>(CaptureRecordType::Count) + offset;
+}
+
+static const char* GetStatKindName(int kind)
+{
+    static const char* const kRenderEventNames[kRenderEventKinds] = {
+        "Render: CreateFeature", "Render: EvaluateFeature", "Render: DestroyFeature", "Render: EndFrame",
+        "Render: EvaluateFeatureJittered", "Render: EvaluateFeatureBound", "Render: unknown id"};
+
+    if (kind >= static_cast<int>(CaptureRecordType::Count))
+    {
+        return kRenderEventNames[kind - static_cast<int>(CaptureRecordType::Count)];
+    }
+    return dlss::GetCaptureRecordName(static_cast<uint8_t>(kind));
+}
+
+template <typename T>
+static T ReadPayload(const ReplayRecord& record)
+{
+    T value = {};
+    std::memcpy(&value, record.payload, sizeof(T) < record.header.size ? sizeof(T) : record.header.size);
+    return value;
+}
+
+template <typename T>
+static T FromBits(uint64_t bits)
+{
+    T value = {};
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+//------------------------------------------------------------------------------
+// Replay state
+//------------------------------------------------------------------------------
+
+class Replayer
+{
+public:
+    Replayer(const std::vector<std::string>& names, UnityRenderingEventAndData renderEvent)
+        : m_names(names)
+        , m_renderEvent(renderEvent)
+    {
+    }
+
+    void Begin()
+    {
+        DLSSInitParams params = {};
+        params.engineType = DLSS_ENGINE_TYPE_UNITY;
+        params.engineVersion = "dlss_replay";
+        params.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+        DLSS_Init_with_ProjectID_D3D12(&params);
+    }
+
+    void End()
+    {
+        for (auto& pair : m_parameters)
+        {
+            DLSS_DestroyParameters_D3D12(pair.second);
+        }
+        m_parameters.clear();
+        m_handles.clear();
+        for (auto& pair : m_bindingSets)
+        {
+            DLSS_DestroyBindingSet(pair.second);
+        }
+        m_bindingSets.clear();
+        DLSS_Shutdown_D3D12();
+    }
+
+    void Replay(const ReplayRecord& record);
+
+    uint64_t GetDivergences() const { return m_divergences; }
+    uint64_t GetRenumberedHandles() const { return m_renumberedHandles; }
+    uint64_t GetImplicitParameters() const { return m_implicitParameters; }
+
+private:
+    void* ResolveParameters(uint64_t captured);
+    int ResolveHandle(int captured) const;
+    int ResolveBindingSet(int captured) const;
+    void ReplayBindingSet(CaptureRecordType type, const ReplayRecord& record);
+    void ReplayParameterSet(const dlss::CaptureParameterSet& set);
+    void ReplayRenderEvent(const dlss::CaptureRenderEvent& event);
+
+    const std::vector<std::string>& m_names;
+    UnityRenderingEventAndData m_renderEvent;
+
+    std::unordered_map<uint64_t, void*> m_parameters;   // Captured identity -> replay block
+    std::unordered_map<int, int> m_handles;             // Captured handle -> replay handle
+    std::unordered_map<int, int> m_bindingSets;         // Captured binding set -> replay binding set
+
+    uint64_t m_divergences = 0;
+    uint64_t m_renumberedHandles = 0;
+    uint64_t m_implicitParameters = 0;
+};
+
+void* Replayer::ResolveParameters(uint64_t captured)
+{
+    if (captured == 0)
+    {
+        return nullptr;
+    }
+
+    auto it = m_parameters.find(captured);
+    if (it != m_parameters.end())
+    {
+        return it->second;
+    }
+
+    // Block was allocated before the capture started
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+    m_parameters[captured] = parameters;
+    m_implicitParameters++;
+    return parameters;
+}
+
+int Replayer::ResolveHandle(int captured) const
+{
+    auto it = m_handles.find(captured);
+    return it != m_handles.end() ? it->second : captured;
+}
+
+int Replayer::ResolveBindingSet(int captured) const
+{
+    auto it = m_bindingSets.find(captured);
+    return it != m_bindingSets.end() ? it->second : captured;
+}
+
+void Replayer::Replay(const ReplayRecord& record)
+{
+    switch (static_cast<CaptureRecordType>(record.header.type))
+    {
+    case CaptureRecordType::Init:
+        Begin();
+        break;
+
+    case CaptureRecordType::Shutdown:
+        DLSS_Shutdown_D3D12();
+        m_handles.clear();
+        break;
+
+    case CaptureRecordType::AllocateParameters:
+    case CaptureRecordType::GetCapabilityParameters:
+    {
+        const auto captured = ReadPayload<dlss::CaptureParameters>(record);
+        void* parameters = nullptr;
+        if (record.header.type == static_cast<uint8_t>(CaptureRecordType::AllocateParameters))
+        {
+            DLSS_AllocateParameters_D3D12(&parameters);
+        }
+        else
+        {
+            DLSS_GetCapabilityParameters_D3D12(&parameters);
+        }
+        if (captured.parameters != 0 && parameters)
+        {
+            m_parameters[captured.parameters] = parameters;
+        }
+        break;
+    }
+
+    case CaptureRecordType::DestroyParameters:
+    {
+        const auto captured = ReadPayload<dlss::CaptureParameters>(record);
+        auto it = m_parameters.find(captured.parameters);
+        if (it != m_parameters.end())
+        {
+            DLSS_DestroyParameters_D3D12(it->second);
+            m_parameters.erase(it);
+        }
+        break;
+    }
+
+    case CaptureRecordType::ParameterSet:
+        ReplayParameterSet(ReadPayload<dlss::CaptureParameterSet>(record));
+        break;
+
+    case CaptureRecordType::AllocateFeatureHandle:
+    {
+        const auto captured = ReadPayload<dlss::CaptureFeatureHandle>(record);
+        const int handle = DLSS_AllocateFeatureHandle();
+        if ((handle == DLSS_INVALID_FEATURE_HANDLE) != (captured.result == DLSS_INVALID_FEATURE_HANDLE))
+        {
+            m_divergences++;
+        }
+        if (handle != DLSS_INVALID_FEATURE_HANDLE && captured.result != DLSS_INVALID_FEATURE_HANDLE)
+        {
+            m_handles[captured.result] = handle;
+            if (handle != captured.result)
+            {
+                m_renumberedHandles++;
+            }
+        }
+        break;
+    }
+
+    case CaptureRecordType::FreeFeatureHandle:
+    {
+        const auto captured = ReadPayload<dlss::CaptureFeatureHandle>(record);
+        const int result = DLSS_FreeFeatureHandle(ResolveHandle(captured.handle));
+        if (result != captured.result)
+        {
+            m_divergences++;
+        }
+        m_handles.erase(captured.handle);
+        break;
+    }
+
+    case CaptureRecordType::RenderEvent:
+        ReplayRenderEvent(ReadPayload<dlss::CaptureRenderEvent>(record));
+        break;
+
+    case CaptureRecordType::RegisterTexture:
+    {
+        const auto captured = ReadPayload<dlss::CaptureTexture>(record);
+        if (DLSS_RegisterTexture(captured.textureId, FromBits<void*>(captured.nativeTexture)) != captured.result)
+        {
+            m_divergences++;
+        }
+        break;
+    }
+
+    case CaptureRecordType::UnregisterTexture:
+    {
+        const auto captured = ReadPayload<dlss::CaptureTexture>(record);
+        if (DLSS_UnregisterTexture(captured.textureId) != captured.result)
+        {
+            m_divergences++;
+        }
+        break;
+    }
+
+    case CaptureRecordType::CreateBindingSet:
+    case CaptureRecordType::UpdateBindingSet:
+        ReplayBindingSet(static_cast<CaptureRecordType>(record.header.type), record);
+        break;
+
+    case CaptureRecordType::DestroyBindingSet:
+    {
+        const auto captured = ReadPayload<dlss::CaptureFeatureHandle>(record);
+        if (DLSS_DestroyBindingSet(ResolveBindingSet(captured.handle)) != captured.result)
+        {
+            m_divergences++;
+        }
+        m_bindingSets.erase(captured.handle);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+void Replayer::ReplayParameterSet(const dlss::CaptureParameterSet& set)
+{
+    if (set.nameId >= m_names.size())
+    {
+        return;
+    }
+
+    void* parameters = ResolveParameters(set.parameters);
+    const char* name = m_names[set.nameId].c_str();
+
+    // Resource and pointer values are opaque identities; the null backend never dereferences them
+    switch (static_cast<dlss::CaptureValueType>(set.valueType))
+    {
+        case dlss::CaptureValueType::ULL: DLSS_Parameter_SetULL(parameters, name, set.value); break;
+        case dlss::CaptureValueType::F: DLSS_Parameter_SetF(parameters, name, FromBits<float>(set.value)); break;
+        case dlss::CaptureValueType::D: DLSS_Parameter_SetD(parameters, name, FromBits<double>(set.value)); break;
+        case dlss::CaptureValueType::UI: DLSS_Parameter_SetUI(parameters, name, FromBits<unsigned int>(set.value)); break;
+        case dlss::CaptureValueType::I: DLSS_Parameter_SetI(parameters, name, FromBits<int>(set.value)); break;
+        case dlss::CaptureValueType::D3d12Resource: DLSS_Parameter_SetD3d12Resource(parameters, name, FromBits<void*>(set.value)); break;
+        case dlss::CaptureValueType::VoidPointer: DLSS_Parameter_SetVoidPointer(parameters, name, FromBits<void*>(set.value)); break;
+        case dlss::CaptureValueType::Texture: DLSS_Parameter_SetTexture(parameters, name, FromBits<void*>(set.value)); break;
+        case dlss::CaptureValueType::TextureId: DLSS_Parameter_SetTextureId(parameters, name, FromBits<int>(set.value)); break;
+        default: break;
+    }
+}
+
+void Replayer::ReplayBindingSet(CaptureRecordType type, const ReplayRecord& record)
+{
+    const auto captured = ReadPayload<dlss::CaptureBindingSet>(record);
+    DLSSBindingSetInfo info = {};
+    info.feature = static_cast<DLSSNGXFeature>(captured.feature);
+    info.createFlags = captured.createFlags;
+    info.renderWidth = captured.renderWidth;
+    info.renderHeight = captured.renderHeight;
+    info.outputWidth = captured.outputWidth;
+    info.outputHeight = captured.outputHeight;
+
+    // Truncated records replay with the bindings that fit
+    const size_t available = record.header.size > sizeof(captured) ? record.header.size - sizeof(captured) : 0;
+    const size_t count = std::min<size_t>(captured.bindingCount, available / sizeof(dlss::CaptureBinding));
+    std::vector<DLSSBindingDesc> bindings(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        dlss::CaptureBinding entry = {};
+        std::memcpy(&entry, record.payload + sizeof(captured) + i * sizeof(entry), sizeof(entry));
+        bindings[i].name = entry.nameId < m_names.size() ? m_names[entry.nameId].c_str() : nullptr;
+        bindings[i].textureId = entry.textureId;
+        bindings[i].width = entry.width;
+        bindings[i].height = entry.height;
+        bindings[i].channels = entry.channels;
+        bindings[i].flags = entry.flags;
+    }
+
+    if (type == CaptureRecordType::CreateBindingSet)
+    {
+        const int bindingSet = DLSS_CreateBindingSet(&info, bindings.data(), static_cast<int>(count));
+        if ((bindingSet < 0) != (captured.result < 0))
+        {
+            m_divergences++;
+        }
+        if (bindingSet >= 0 && captured.result >= 0)
+        {
+            m_bindingSets[captured.result] = bindingSet;
+        }
+    }
+    else if (DLSS_UpdateBindingSet(ResolveBindingSet(captured.bindingSet), &info, bindings.data(),
+        static_cast<int>(count)) != captured.result)
+    {
+        m_divergences++;
+    }
+}
+
+void Replayer::ReplayRenderEvent(const dlss::CaptureRenderEvent& event)
+{
+    switch (event.eventId)
+    {
+    case DLSS_Event_CreateFeature:
+    {
+        DLSSCreateFeatureParams params = {};
+        params.handle = ResolveHandle(event.handle);
+        params.feature = static_cast<DLSSNGXFeature>(event.feature);
+        params.parameters = ResolveParameters(event.parameters);
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    case DLSS_Event_EvaluateFeature:
+    {
+        DLSSEvaluateFeatureParams params = {};
+        params.handle = ResolveHandle(event.handle);
+        params.parameters = ResolveParameters(event.parameters);
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    case DLSS_Event_EvaluateFeatureJittered:
+    {
+        DLSSEvaluateJitteredParams params = {};
+        params.handle = ResolveHandle(event.handle);
+        params.parameters = ResolveParameters(event.parameters);
+        params.jitterFrameIndex = event.ringBufferBytesUsed;
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    case DLSS_Event_EvaluateFeatureBound:
+    {
+        DLSSEvaluateBoundParams params = {};
+        params.handle = ResolveHandle(event.handle);
+        params.bindingSet = ResolveBindingSet(event.feature);
+        params.parameters = ResolveParameters(event.parameters);
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    case DLSS_Event_DestroyFeature:
+    {
+        DLSSDestroyFeatureParams params = {};
+        params.handle = ResolveHandle(event.handle);
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    case DLSS_Event_EndFrame:
+    {
+        DLSSEndFrameParams params = {};
+        params.ringBufferBytesUsed = event.ringBufferBytesUsed;
+        m_renderEvent(event.eventId, event.hasData ? &params : nullptr);
+        break;
+    }
+    default:
+        m_renderEvent(event.eventId, nullptr);
+        break;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Main
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <capture.bin> [--loops N] [--realtime] [--log] [--strict]\n", argv[0]);
+        return 1;
+    }
+
+    int loops = 1;
+    bool realtime = false;
+    bool printLog = false;
+    bool strict = false;
+    for (int i = 2; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+        {
+            loops = std::atoi(argv[++i]);
+            loops = loops > 0 ? loops : 1;
+        }
+        else if (std::strcmp(argv[i], "--realtime") == 0)
+        {
+            realtime = true;
+        }
+        else if (std::strcmp(argv[i], "--log") == 0)
+        {
+            printLog = true;
+        }
+        else if (std::strcmp(argv[i], "--strict") == 0)
+        {
+            strict = true;
+        }
+    }
+
+    std::vector<uint8_t> data;
+    if (!ReadFile(argv[1], data))
+    {
+        std::fprintf(stderr, "Failed to open %s\n", argv[1]);
+        return 1;
+    }
+
+    CaptureFileHeader header = {};
+    if (data.size() < sizeof(header))
+    {
+        std::fprintf(stderr, "File is too small to be a DLSS capture\n");
+        return 1;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+
+    if (header.magic != dlss::kCaptureMagic)
+    {
+        std::fprintf(stderr, "Bad magic 0x%08X\n", header.magic);
+        return 1;
+    }
+    if (header.version != dlss::kCaptureVersion || header.recordHeaderSize != sizeof(CaptureRecordHeader))
+    {
+        std::fprintf(stderr, "Unsupported capture version %u (record header size %u)\n",
+            static_cast<unsigned>(header.version), static_cast<unsigned>(header.recordHeaderSize));
+        return 1;
+    }
+
+    // Index the records and collect interned names up front so the timed loop only replays
+    std::vector<ReplayRecord> records;
+    std::vector<std::string> names;
+    uint64_t frames = 0;
+    size_t offset = sizeof(header);
+    while (offset + sizeof(CaptureRecordHeader) <= data.size())
+    {
+        ReplayRecord record = {};
+        std::memcpy(&record.header, data.data() + offset, sizeof(record.header));
+        offset += sizeof(record.header);
+        if (offset + record.header.size > data.size())
+        {
+            std::fprintf(stderr, "Capture is truncated, ignoring the last record\n");
+            break;
+        }
+        record.payload = data.data() + offset;
+        offset += record.header.size;
+
+        if (record.header.type == static_cast<uint8_t>(CaptureRecordType::Name))
+        {
+            const auto entry = ReadPayload<dlss::CaptureName>(record);
+            if (sizeof(entry) + entry.length <= record.header.size)
+            {
+                if (names.size() <= entry.id)
+                {
+                    names.resize(entry.id + 1u);
+                }
+                names[entry.id].assign(reinterpret_cast<const char*>(record.payload) + sizeof(entry), entry.length);
+            }
+            continue;
+        }
+
+        if (record.header.type == static_cast<uint8_t>(CaptureRecordType::RenderEvent) &&
+            ReadPayload<dlss::CaptureRenderEvent>(record).eventId == DLSS_Event_EndFrame)
+        {
+            frames++;
+        }
+        records.push_back(record);
+    }
+
+    const double capturedMs = records.empty() || header.ticksPerSecond <= 0.0 ? 0.0
+        : static_cast<double>(records.back().header.timestamp - header.startTimestamp) * 1000.0 / header.ticksPerSecond;
+    std::printf("Capture: %zu records, %zu names, %" PRIu64 " frames, %.1f ms captured\n",
+        records.size(), names.size(), frames, capturedMs);
+
+    dlss::LoadPluginWithFakeUnity(printLog);
+    DLSS_ResetTelemetry();
+
+    Replayer replayer(names, DLSS_UnityRenderEventFunc());
+    ReplayStats stats[kStatKinds] = {};
+    const double ticksPerSecond = dlss::TimestampTicksPerSecond();
+
+    uint64_t totalTicks = 0;
+    for (int loop = 0; loop < loops; ++loop)
+    {
+        replayer.Begin();
+
+        const auto wallStart = std::chrono::steady_clock::now();
+        for (const ReplayRecord& record : records)
+        {
+            if (realtime && header.ticksPerSecond > 0.0)
+            {
+                const double offsetS = static_cast<double>(record.header.timestamp - header.startTimestamp) / header.ticksPerSecond;
+                std::this_thread::sleep_until(wallStart + std::chrono::duration<double>(offsetS));
+            }
+
+            int eventId = -1;
+            if (record.header.type == static_cast<uint8_t>(CaptureRecordType::RenderEvent))
+            {
+                eventId = ReadPayload<dlss::CaptureRenderEvent>(record).eventId;
+            }
+
+            const uint64_t start = dlss::ReadTimestamp();
+            replayer.Replay(record);
+            const uint64_t elapsed = dlss::ReadTimestamp() - start;
+
+            ReplayStats& kind = stats[GetStatKind(record, eventId)];
+            kind.count++;
+            kind.ticks += elapsed;
+            totalTicks += elapsed;
+        }
+
+        replayer.End();
+    }
+
+    const double nsPerTick = 1e9 / ticksPerSecond;
+    const uint64_t replayed = static_cast<uint64_t>(records.size()) * static_cast<uint64_t>(loops);
+    std::printf("Replayed %" PRIu64 " records in %.3f ms (%.1f ns/record, %d loop%s)\n\n",
+        replayed, static_cast<double>(totalTicks) * nsPerTick / 1e6,
+        replayed ? static_cast<double>(totalTicks) * nsPerTick / static_cast<double>(replayed) : 0.0,
+        loops, loops == 1 ? "" : "s");
+
+    std::printf("%-28s %12s %12s\n", "Record", "Count", "Avg ns");
+    for (int kind = 0; kind < kStatKinds; ++kind)
+    {
+        if (stats[kind].count == 0)
+        {
+            continue;
+        }
+        std::printf("%-28s %12" PRIu64 " %12.1f\n", GetStatKindName(kind), stats[kind].count,
+            static_cast<double>(stats[kind].ticks) * nsPerTick / static_cast<double>(stats[kind].count));
+    }
+
+    // The plugin's own per-export histograms, as DLSS_GetTelemetry reports them in the player
+    DLSSLatencyStats telemetry[DLSS_Telemetry_Count] = {};
+    DLSS_GetTelemetry(telemetry, DLSS_Telemetry_Count);
+    std::printf("\n%-34s %12s %10s %10s %10s\n", "Plugin entry point", "Count", "p50 us", "p99 us", "max us");
+    for (const DLSSLatencyStats& point : telemetry)
+    {
+        if (point.count == 0)
+        {
+            continue;
+        }
+        std::printf("%-34s %12llu %10.3f %10.3f %10.3f\n", dlss::Telemetry::GetPointName(static_cast<DLSSTelemetryPoint>(point.point)), point.count,
+            point.p50Us, point.p99Us, point.maxUs);
+    }
+
+    std::printf("\nHandle table: %" PRIu64 " divergences, %" PRIu64 " renumbered handles, %" PRIu64 " implicit parameter blocks\n",
+        replayer.GetDivergences(), replayer.GetRenumberedHandles(), replayer.GetImplicitParameters());
+
+    dlss::UnloadPluginFromFakeUnity();
+    return strict && replayer.GetDivergences() > 0 ? 2 : 0;
+}
@@ -0,0 +1,185 @@
+//------------------------------------------------------------------------------
+// dlss_vulkan_check.cpp - Smoke run of the Vulkan backend
+//------------------------------------------------------------------------------
+// Usage: dlss_vulkan_check
+//
+// Loads the plugin into a fake Unity that picks the Vulkan renderer (see
+// FakeUnityInterfaces.h) and checks what a Vulkan player relies on but CI
+// cannot show without a GPU:
+//   - the init intercept appends the NGX instance and device extensions the
+//     loader offers, leaving out unavailable and already enabled ones;
+//   - the Vulkan backend is selected, and every render event that records
+//     NGX work is configured to run outside a render pass;
+//   - evaluates bind Color and Output as image views of the accessed images,
+//     transitioned for reading and for compute writes respectively;
+//   - image views are reused across frames and destroyed once the last frame
+//     that used them is complete, or at device shutdown.
+//
+// Prints one line per check and exits with 1 if any fails.
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "DLSSBackend.h"
+#include "DLSSPluginLite.h"
+#include "FakeUnityInterfaces.h"
+
+// Frames the fake GPU runs behind the render thread
+static constexpr unsigned long long kLatencyFrames = 2;
+
+// Native textures; the fake device uses the pointers as VkImage handles
+static char g_colorTexture;
+static char g_outputTexture;
+
+static int g_failures = 0;
+
+static void Check(bool passed, const char* what)
+{
+    std::printf("%s  %s\n", passed ? "pass" : "FAIL", what);
+    if (!passed)
+    {
+        g_failures++;
+    }
+}
+
+static bool Contains(const std::vector<int>& values, int value)
+{
+    return std::find(values.begin(), values.end(), value) != values.end();
+}
+
+static int GetLayout(void* nativeTexture)
+{
+    const auto& layouts = dlss::GetFakeVulkanState().textureLayouts;
+    auto it = layouts.find(nativeTexture);
+    return it != layouts.end() ? it->second : -1;
+}
+
+static bool Evaluate(UnityRenderingEventAndData renderEvent, int handle, void* parameters)
+{
+    DLSSEvaluateFeatureParams evaluate = {};
+    evaluate.handle = handle;
+    evaluate.parameters = parameters;
+    renderEvent(DLSS_Event_EvaluateFeature, &evaluate);
+
+    DLSSEndFrameParams endFrame = {};
+    renderEvent(DLSS_Event_EndFrame, &endFrame);
+    dlss::AdvanceFakeVulkanFrame(kLatencyFrames);
+
+    DLSSFeatureHealth health = {};
+    return DLSS_GetFeatureHealth(handle, &health) == 0 && NVSDK_NGX_SUCCEED(health.lastResult);
+}
+
+//------------------------------------------------------------------------------
+// Checks
+//------------------------------------------------------------------------------
+
+static void CheckIntercept()
+{
+    const dlss::FakeVulkanState& state = dlss::GetFakeVulkanState();
+    const std::vector<std::string> instanceExtensions = {
+        "VK_KHR_surface",
+        "VK_KHR_get_physical_device_properties2",
+        "VK_KHR_external_memory_capabilities",
+    };
+    const std::vector<std::string> deviceExtensions = {
+        "VK_KHR_swapchain",
+        "VK_NVX_binary_import",
+        "VK_NVX_image_view_handle",
+    };
+    Check(state.instanceExtensions == instanceExtensions,
+        "instance: missing NGX extensions appended, enabled ones not repeated");
+    Check(state.deviceExtensions == deviceExtensions,
+        "device: available NGX extensions appended after Unity's, unavailable ones left out");
+}
+
+static void CheckBackend()
+{
+    Check(DLSS_GetGraphicsApi() == DLSS_GraphicsApi_Vulkan, "Unity's Vulkan renderer selects the Vulkan backend");
+
+    const std::vector<int>& configured = dlss::GetFakeVulkanState().configuredEvents;
+    Check(Contains(configured, DLSS_Event_CreateFeature) && Contains(configured, DLSS_Event_EvaluateFeature) &&
+            Contains(configured, DLSS_Event_DestroyFeature) && Contains(configured, DLSS_Event_EvaluateFeatureJittered) &&
+            Contains(configured, DLSS_Event_EvaluateFeatureBound),
+        "every event that records NGX work is configured");
+}
+
+static void CheckFeature()
+{
+    DLSSInitParams init = {};
+    init.engineType = DLSS_ENGINE_TYPE_UNITY;
+    init.engineVersion = "dlss_vulkan_check";
+    init.loggingLevel = DLSS_LOGGING_LEVEL_OFF;
+    Check(NVSDK_NGX_SUCCEED(DLSS_Init_with_ProjectID_D3D12(&init)), "NGX initializes with Unity's Vulkan device");
+
+    UnityRenderingEventAndData renderEvent = DLSS_UnityRenderEventFunc();
+    void* parameters = nullptr;
+    DLSS_AllocateParameters_D3D12(&parameters);
+    DLSS_Parameter_SetUI(parameters, "Width", dlss::kFakeVulkanImageSize / 2);
+    DLSS_Parameter_SetUI(parameters, "Height", dlss::kFakeVulkanImageSize / 2);
+    DLSS_Parameter_SetUI(parameters, "OutWidth", dlss::kFakeVulkanImageSize);
+    DLSS_Parameter_SetUI(parameters, "OutHeight", dlss::kFakeVulkanImageSize);
+
+    const int handle = DLSS_AllocateFeatureHandle();
+    DLSSCreateFeatureParams create = {};
+    create.handle = handle;
+    create.feature = DLSS_NGX_Feature_SuperSampling;
+    create.parameters = parameters;
+    renderEvent(DLSS_Event_CreateFeature, &create);
+
+    DLSS_Parameter_SetTexture(parameters, NVSDK_NGX_Parameter_Color, &g_colorTexture);
+    DLSS_Parameter_SetTexture(parameters, NVSDK_NGX_Parameter_Output, &g_outputTexture);
+    Check(Evaluate(renderEvent, handle, parameters), "an evaluate with Color and Output bound succeeds");
+
+    const dlss::FakeVulkanState& state = dlss::GetFakeVulkanState();
+    Check(GetLayout(&g_colorTexture) == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL &&
+            GetLayout(&g_outputTexture) == VK_IMAGE_LAYOUT_GENERAL,
+        "Color is transitioned for reading, Output for compute writes");
+    Check(state.imageViewsCreated == 2 && state.imageViewsLive == 2, "one image view per bound texture");
+
+    bool evaluated = true;
+    for (unsigned long long frame = 0; frame < 2 * kLatencyFrames; ++frame)
+    {
+        evaluated = Evaluate(renderEvent, handle, parameters) && evaluated;
+    }
+    Check(evaluated && state.imageViewsCreated == 2, "image views are reused across frames");
+
+    // Color's view is destroyed once no frame in flight uses it
+    DLSS_Parameter_SetTexture(parameters, NVSDK_NGX_Parameter_Color, nullptr);
+    for (unsigned long long frame = 0; frame <= kLatencyFrames + 1; ++frame)
+    {
+        Evaluate(renderEvent, handle, parameters);
+    }
+    Check(state.imageViewsLive == 1, "an unbound texture's view is destroyed once its last frame completes");
+
+    DLSSDestroyFeatureParams destroy = {};
+    destroy.handle = handle;
+    renderEvent(DLSS_Event_DestroyFeature, &destroy);
+    DLSS_DestroyParameters_D3D12(parameters);
+    DLSS_Shutdown_D3D12();
+}
+
+//------------------------------------------------------------------------------
+// Main
+//------------------------------------------------------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        std::fprintf(stderr, "Usage: %s\n", argv[0]);
+        return 1;
+    }
+
+    dlss::LoadPluginWithFakeUnity(false, dlss::FakeRenderer::Vulkan);
+    CheckIntercept();
+    CheckBackend();
+    CheckFeature();
+    dlss::UnloadPluginFromFakeUnity();
+    Check(dlss::GetFakeVulkanState().imageViewsLive == 0, "device shutdown destroys the remaining image views");
+
+    std::printf("\n%d check%s failed\n", g_failures, g_failures == 1 ? "" : "s");
+    return g_failures > 0 ? 1 : 0;
+}